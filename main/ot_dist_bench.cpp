@@ -0,0 +1,236 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2016, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_dist_bench.h"
+
+namespace __OpenTimer {
+
+static size_t num_connections = 256;
+static size_t num_active = 0;
+static size_t num_messages = 1000;
+static size_t message_size = 64;
+
+// handler
+// Echo a packet on the server end. On the client end, send the next packet until the messages
+// are exhausted and leave the loop once every active client is done.
+template <typename EventT>
+static void handler(EventT* event) {
+
+  if(event->has_state(EventT::ON_WRITE)) {
+    flush_packets(event);
+  }
+  else if(event->has_state(EventT::ON_READ)) {
+
+    if(event->istream()->eof()) {
+      OpenCluster::LOGE("Connection closed (fd=", event->fd(), ")");
+      event->reactor()->uncommit(event);
+      event->reactor()->set_loop_break(true);
+      return;
+    }
+
+    while(1) {
+
+      Packet pkt;
+
+      *(event->istream()) >> pkt;
+
+      if(pkt.size == 0) break;
+
+      if(!event->is_client) {
+        send_packet(event, pkt);
+      }
+      else if(--event->num_messages) {
+        send_packet(event, pkt);
+      }
+      else if(++(*event->num_done) == event->num_active) {
+        event->reactor()->set_loop_break(true);
+      }
+    }
+  }
+}
+
+// Function: open_connections
+// Open the loopback connections and return the client and server descriptors. The backlog is
+// drained while connecting since it is shorter than the number of connections.
+static vector < pair<int, int> > open_connections(size_t num) {
+
+  vector < pair<int, int> > fds;
+
+  int listener = OpenCluster::make_socket_server("0");
+
+  CHECK(listener != -1) << "Failed to make the loopback listener";
+
+  sockaddr_storage addr;
+  socklen_t addrlen = sizeof(addr);
+
+  CHECK(getsockname(listener, (sockaddr*)&addr, &addrlen) == 0) << "Failed to query the port";
+
+  string_t port = to_string(ntohs(addr.ss_family == AF_INET6 ?
+                                  ((sockaddr_in6*)&addr)->sin6_port :
+                                  ((sockaddr_in*)&addr)->sin_port));
+
+  int_vt clients;
+  int_vt servers;
+
+  while(servers.size() < num) {
+    if(clients.size() < num) {
+      int fd = OpenCluster::make_socket_client("localhost", port);
+      CHECK(fd != -1) << "Failed to connect to port " << port;
+      clients.push_back(fd);
+    }
+    for(int fd; (fd = OpenCluster::accept_socket_client(listener)) != -1; ) {
+      servers.push_back(fd);
+    }
+  }
+
+  ::close(listener);
+
+  for(size_t i=0; i<num; ++i) {
+    fds.emplace_back(clients[i], servers[i]);
+  }
+
+  return fds;
+}
+
+// Function: run
+// Ping-pong the packets over the connections through a reactor with the given demux and return
+// the elapsed time in seconds. Only the first num_active connections carry traffic and the rest
+// stay idle in the demux.
+template <template <typename> class DemuxT>
+static double run(const vector < pair<int, int> >& fds) {
+
+  using EventT = BenchEvent<DemuxT>;
+
+  OpenCluster::Reactor<EventT> reactor;
+
+  size_t num_done {0};
+  vector < EventT* > clients;
+  vector < EventT* > events;
+
+  for(const auto& fd : fds) {
+    auto client = reactor.insert_io_event(fd.first, handler<EventT>);
+    auto server = reactor.insert_io_event(fd.second, handler<EventT>);
+    client->is_client = true;
+    client->num_messages = num_messages;
+    client->num_done = &num_done;
+    client->num_active = num_active;
+    client->remove_states(EventT::WRITE);
+    server->remove_states(EventT::WRITE);
+    reactor.commit(client);
+    reactor.commit(server);
+    clients.push_back(client);
+    events.push_back(client);
+    events.push_back(server);
+  }
+
+  auto beg = ::std::chrono::steady_clock::now();
+
+  for(size_t i=0; i<num_active; ++i) {
+    send_packet(clients[i], make_packet("ping", string_t(message_size, 'x')));
+  }
+
+  reactor.dispatch();
+
+  auto end = ::std::chrono::steady_clock::now();
+
+  for(const auto& event : events) {
+    reactor.uncommit(event);
+  }
+
+  return ::std::chrono::duration<double>(end - beg).count();
+}
+
+// Procedure: report
+static void report(const char* demux, double elapsed) {
+  printf("%-8s %6zu connections %6zu active %8zu messages %10.3f s %12.0f msg/s\n",
+         demux, num_connections, num_active, num_messages, elapsed,
+         num_active*num_messages/elapsed);
+  fflush(stdout);
+}
+
+};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
+// Command:
+//
+// --num_connections <number>
+// --num_active <number>
+// --num_messages <number>
+// --message_size <number>
+//
+// The benchmark opens the loopback connections once and runs the same ping-pong traffic through
+// the reactor with the select demux and the epoll demux. By default every connection is active.
+//
+namespace OpenTimer = __OpenTimer;
+int main(int argc, char *argv[]) {
+
+  // Initialize the logging.
+  OpenTimer::Timer::init_logging(argv[0], 1);
+
+  if(argc % 2 == 0) {
+    LOG(FATAL) << "Usage: ./ot_dist_bench [--num_connections <number>] [--num_active <number>] "
+               << "[--num_messages <number>] [--message_size <number>]";
+  }
+
+  int i(1);
+  while(i < argc) {
+    if(strcmp(argv[i], "--num_connections") == 0) {
+      OpenTimer::num_connections = atoi(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--num_active") == 0) {
+      OpenTimer::num_active = atoi(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--num_messages") == 0) {
+      OpenTimer::num_messages = atoi(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--message_size") == 0) {
+      OpenTimer::message_size = atoi(argv[++i]);
+    }
+    else {
+      LOG(WARNING) << "Un-recognized command " << argv[i];
+    }
+    ++i;
+  }
+
+  if(OpenTimer::num_active == 0 || OpenTimer::num_active > OpenTimer::num_connections) {
+    OpenTimer::num_active = OpenTimer::num_connections;
+  }
+
+  CHECK(OpenTimer::num_messages > 0) << "The number of messages must be positive";
+
+  auto fds = OpenTimer::open_connections(OpenTimer::num_connections);
+
+  int max_fd {-1};
+  for(const auto& fd : fds) {
+    max_fd = max(max_fd, max(fd.first, fd.second));
+  }
+
+  // Select cannot monitor a descriptor beyond FD_SETSIZE.
+  if(max_fd < FD_SETSIZE) {
+    OpenTimer::report("select", OpenTimer::run<OpenCluster::Select>(fds));
+  }
+  else {
+    LOG(WARNING) << "Skip select (fd " << max_fd << " exceeds FD_SETSIZE " << FD_SETSIZE << ")";
+  }
+
+#if defined(__linux__)
+  OpenTimer::report("epoll", OpenTimer::run<OpenCluster::Epoll>(fds));
+#endif
+
+  for(const auto& fd : fds) {
+    ::close(fd.first);
+    ::close(fd.second);
+  }
+
+  return 0;
+}
+
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2016, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_DIST_BENCH_H_
+#define OT_DIST_BENCH_H_
+
+#include "ot_timer.h"
+#include "ot_packet.h"
+#include "oc_reactor.hpp"
+
+namespace __OpenTimer {
+
+// BenchEvent
+// An io event of the benchmark is one end of a loopback connection. A client sends a packet and
+// waits for the server end to echo it back until its messages are exhausted. The demux template
+// selects the demultiplexer of the reactor under test.
+template <template <typename> class DemuxT>
+class BenchEvent : public OpenCluster::BasicEvent <BenchEvent<DemuxT>, DemuxT> {
+
+  public:
+
+    bool_t is_client {false};
+    size_t num_messages {0};
+    size_t* num_done {nullptr};
+    size_t num_active {0};
+};
+
+};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
+#endif
+
@@ -17,140 +17,133 @@ namespace __OpenTimer {
 
 static int num_agents;
 static string port;
+static string ops_fpath;
 
-// For simple benchmark
-static const char* commands[] = {
-  "repower_gate u3 INV_X1",
-  "report_tns",
-  nullptr
-};
+// Commands issued to the agents in order. Without an ops file the timing is updated and the
+// total negative slack is reported.
+static string_vt commands {"update_timing", "report_tns"};
 
-static int nth_command = 0;
-
-// TODO:
-
-// Format1:
-// key: update_timing
-// value: out=1.2;in=2.0;
-
-// Format2:
-// key: update_boundary_timing
-// vlaue: out=1.2;in=2.0;
-
-// Format3:
-// key: report_tns
-// vlaue: 29.9;
+static size_t nth_command = 0;
+static bool is_shutdown = false;
+static vector < MasterEvent* > agent_events;
 
+// Procedure: flush_outbox
+// Move the messages of the master onto the connections of their agents.
+static void flush_outbox(Master* master) {
+  for(const auto& item : master->outbox()) {
+    send_packet(agent_events[item.first], item.second);
+  }
+  master->outbox().clear();
+}
 
+// user_handler
+// Issue the next command once all agents are registered and the previous command has finished.
+// The agents are told to shut down after the last command and the master leaves the loop once
+// the shutdown has been flushed to every agent.
 static void user_handler(MasterEvent* event) {
 
-  auto master = event->master; 
+  auto master = event->master;
 
-  OpenCluster::LOGD("User's command coming");
-  
-  // TODO
-  //if(master->num_registered_agents < num_agents) return;
-
-  if(commands[nth_command] == nullptr) {
-    OpenCluster::LOGI("All done");
+  if(is_shutdown) {
+    for(const auto& e : agent_events) {
+      if(e->ostream()->rdbuf()->in_avail()) return;
+    }
+    event->reactor()->set_loop_break(true);
     return;
   }
 
-  if(master->is_locked()) return;
-
-  // Handle the command.
-  /*if(strstr(commands[nth_command] == "report_tns") == 0) {
-
-    //
-    master->set_is_locked(true);
-
-    // update timing
-    // Follow the topological order and issue the update_timing 
-    // key= update_timing
+  if(!master->is_ready() || master->is_busy()) return;
 
-    // 
+  if(nth_command == commands.size()) {
+    OpenCluster::LOGI("All done");
+    for(const auto& e : agent_events) {
+      send_packet(e, make_packet("shutdown", ""));
+    }
+    is_shutdown = true;
+    return;
   }
 
-  // Assum this is design modifier
-  else if( ... "repower_gate") {
-    // broadcast 
-  }
-  else {
-    OpenCluster::LOGE("Undefined command");
-  }*/
+  OpenCluster::LOGI("Issue ", commands[nth_command]);
 
+  master->issue(commands[nth_command++]);
 
-  nth_command++;
+  flush_outbox(master);
 }
 
-
+// client_handler
 static void client_handler(MasterEvent* event) {
 
-  if(event->has_state(MasterEvent::ON_WRITE)) {
-    
-    OpenCluster::LOGD("agent write arrived (in_avail=", event->ostream()->rdbuf()->in_avail(), " bytes)");
+  auto master = event->master;
 
-    sleep(1);
+  if(event->has_state(MasterEvent::ON_WRITE)) {
+    flush_packets(event);
   }
   else if(event->has_state(MasterEvent::ON_READ)) {
-   
-    OpenCluster::LOGD("agent read arrived (in_avail=", event->istream()->rdbuf()->in_avail(), " bytes)");
+
+    if(event->istream()->eof()) {
+      OpenCluster::LOGE("Agent ", event->agent, " disconnected (fd=", event->fd(), ")");
+      event->reactor()->uncommit(event);
+      ::close(event->fd());
+      event->reactor()->set_loop_break(true);
+      return;
+    }
 
     while(1) {
 
       Packet pkt;
 
       *(event->istream()) >> pkt;
-      
+
       if(pkt.size == 0) break;
-      
-      OpenCluster::LOGD(pkt.key, " ", pkt.key.size(), " ", pkt.value, " ", pkt.value.size());
-
-      // Actor model.
-      
-      // TODO
-      // key = register
-      // Parse the PI/PO from pkt.value and construct the agent graph.
+
+      OpenCluster::LOGD(pkt.key, " from agent ", event->agent);
+
+      // Register the agent with its boundary ports.
       if(pkt.key == "register") {
+        event->agent = master->insert_agent(pkt.value);
+        if(event->agent != OT_UNDEFINED_IDX) agent_events.push_back(event);
       }
-
-      // An agent has just finished its update_timing
+      // An agent has just finished its update_timing.
       else if(pkt.key == "update_boundary_timing") {
-
+        master->on_update_boundary_timing(event->agent, pkt.value);
       }
+      // An agent has just reported its tns.
       else if(pkt.key == "report_tns") {
-
+        master->on_report_tns(event->agent, pkt.value);
+        if(!master->is_busy()) {
+          printf("%.6f\n", master->tns());
+          fflush(stdout);
+        }
       }
       else {
-
+        OpenCluster::LOGE("Undefined pkt key (", pkt.key, ")");
       }
     }
 
-    
-    sleep(1);
+    flush_outbox(master);
   }
   else {
     OpenCluster::LOGE("Undefined event state");
-    
-    sleep(1);
   }
-
 }
 
-
 // listener_handler
+// Accept the new agents. The connection is read-only until a packet is sent to the agent. The
+// backlog is drained since an edge-triggered demux reports the listener once for all pending
+// connections.
 static void listener_handler(MasterEvent* event) {
-  
-  OpenCluster::LOGI("Listener event arrived");
-  int newfd = OpenCluster::accept_socket_client(event->fd());
-  OpenCluster::LOGI("Accepted a new connection (fd=", newfd, ")");
-  auto new_client_event = event->reactor()->insert_io_event(newfd, client_handler);
-  new_client_event->master = event->master;
-  event->reactor()->commit(new_client_event);
 
-  OpenCluster::LOGI("num events = ", event->reactor()->num_events());
+  int newfd;
+
+  while((newfd = OpenCluster::accept_socket_client(event->fd())) != -1) {
 
-  sleep(1);
+    OpenCluster::LOGI("Accepted a new connection (fd=", newfd, ")");
+
+    auto new_client_event = event->reactor()->insert_io_event(newfd, client_handler);
+    new_client_event->master = event->master;
+    new_client_event->remove_states(MasterEvent::WRITE);
+    event->reactor()->commit(new_client_event);
+  }
 }
 
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
@@ -158,6 +151,11 @@ static void listener_handler(MasterEvent* event) {
 // Command:
 //
 // --port <string>
+// --num_agents <number>
+// --ops_fpath <string>
+//
+// The ops file lists the commands, one per line: repower_gate <gate> <cell>, update_timing, and
+// report_tns.
 //
 namespace OpenTimer = __OpenTimer;
 int main(int argc, char *argv[]) {
@@ -165,8 +163,8 @@ int main(int argc, char *argv[]) {
   // Initialize the logging.
   OpenTimer::Timer::init_logging(argv[0], 1);
 
-  if(argc != 5) {
-    LOG(FATAL) << "Usage: ./OpenTimer-master --port <number> --num_agents <number>";
+  if(argc != 5 && argc != 7) {
+    LOG(FATAL) << "Usage: ./OpenTimer-master --port <number> --num_agents <number> [--ops_fpath <string>]";
   }
 
   int i(1);
@@ -177,33 +175,42 @@ int main(int argc, char *argv[]) {
     else if(strcmp(argv[i], "--port") == 0) {
       OpenTimer::port = argv[++i];
     }
+    else if(strcmp(argv[i], "--ops_fpath") == 0) {
+      OpenTimer::ops_fpath = argv[++i];
+    }
     else {
       LOG(WARNING) << "Un-recognized command " << argv[i];
     }
     ++i;
   }
 
+  // Read the commands.
+  if(!OpenTimer::ops_fpath.empty()) {
+    ifstream ifs(OpenTimer::ops_fpath);
+    if(!ifs.good()) {
+      LOG(FATAL) << "Failed to open " + OpenTimer::ops_fpath;
+    }
+    OpenTimer::commands.clear();
+    for(string line; getline(ifs, line); ) {
+      if(line.find_first_not_of(" \t\r") != string::npos) OpenTimer::commands.push_back(line);
+    }
+  }
+
+  OpenTimer::Master master(OpenTimer::num_agents);
 
-  OpenTimer::Master master;
-  
   OpenCluster::Reactor<OpenTimer::MasterEvent> reactor;
   int listener = OpenCluster::make_socket_server(OpenTimer::port);
   auto event = reactor.insert_io_event(listener, OpenTimer::listener_handler);
   event->master = &master;
+  event->remove_states(OpenTimer::MasterEvent::WRITE);
   reactor.commit(event);
 
-  event = reactor.insert_timeout_event(OpenCluster::make_duration<::std::chrono::seconds>(1), true, OpenTimer::user_handler);
+  event = reactor.insert_timeout_event(OpenCluster::make_duration<::std::chrono::milliseconds>(10), true, OpenTimer::user_handler);
   event->master = &master;
   reactor.commit(event);
 
-
   reactor.dispatch();
 
-
   return 0;
 }
 
-
-
-
-
@@ -14,85 +14,23 @@
 #ifndef OT_DIST_MASTER_H_
 #define OT_DIST_MASTER_H_
 
-#include "ot_timer.h"
+#include "ot_master.h"
 #include "oc_reactor.hpp"
 
 namespace __OpenTimer {
 
-using os_t = OpenCluster::OutputStream<OpenCluster::StreamBuffer>;
-using is_t = OpenCluster::InputStream<OpenCluster::StreamBuffer>;
-
-struct Packet {
-  size_t size {0};
-  string key;
-  string value;
-};
-
-os_t& operator << (os_t& os, const Packet& pkt) {
-  os << pkt.size;
-  os << pkt.key.c_str();
-  os << pkt.value.c_str();
-  return os;
-}
-
-is_t& operator >> (is_t& is, Packet& pkt) {
-    
-  if(is.rdbuf()->in_avail() >= sizeof(size_t)) {
-
-    size_t sz{0};
-    is.rdbuf()->copy(&sz, sizeof(size_t));
-    
-    if(is.rdbuf()->in_avail() >= sz) {
-      is >> pkt.size;
-      is >> pkt.key;
-      is >> pkt.value;
-    }
-
-  }
-  return is;
-}
-
-// Master class.
-class Master;
-
-// Master
+// MasterEvent
+// An io event of the master is the connection to an agent, identified by the agent id given at
+// the registration.
 class MasterEvent : public OpenCluster::BasicEvent <MasterEvent> {
-  
-  
-  public:
-    
-    Master* master {nullptr};
-
-};
-
-
-
-class Master {
-    
-    bool _is_locked {false};
 
   public:
 
-    
-    // 
-    unordered_map < string, double > boundary_timing;
-    
-
-    OC_CODEGEN_ACCESSOR(is_locked)
-
-    OC_CODEGEN_MUTATOR(is_locked);
+    Master* master {nullptr};
+    int_t agent {OT_UNDEFINED_IDX};
 };
 
-
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
 
 #endif
 
-
-
-
-
-
-
-
-
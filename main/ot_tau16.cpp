@@ -18,7 +18,7 @@ int main(int argc, char *argv[]) {
   __OpenTimer::Timer::init_logging(argv[0], 1);
   __OpenTimer::timer_t timer;
   timer.set_num_threads(8);
-  timer.exec_tau2015(argc, argv);
+  timer.exec_tau2016(argc, argv);
 
   return 0;
 }
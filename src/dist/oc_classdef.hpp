@@ -28,10 +28,11 @@ class StreamBuffer;
 class Ticker;
 
 template <typename DerivedT> class Singleton;
-template <typename EventT> class BasicEvent;
+template <typename EventT, template <typename> class DemuxT> class BasicEvent;
 template <typename EventT, typename LessT> class EventHeap;
 template <typename DemuxT> class DemuxInterface;
 template <typename EventT> class Select;
+template <typename EventT> class Epoll;
 template <typename StreamBufferT> class StreamBufferInterface;
 template <typename StreamBufferT> class IOStreamBase;
 template <typename StreamBufferT> class InputStream;
@@ -39,6 +40,13 @@ template <typename StreamBufferT> class OutputStream;
 template <typename EventT> class Reactor;
 template <typename PolicyT> class Logger;
 
+// Default demux: epoll on Linux and select elsewhere.
+#if defined(__linux__)
+template <typename EventT> using DefaultDemux = Epoll<EventT>;
+#else
+template <typename EventT> using DefaultDemux = Select<EventT>;
+#endif
+
 
 };  // End of namespace OpenCluster. --------------------------------------------------------------
 
@@ -323,7 +323,7 @@ void Select<EventT>::remove_impl(EventT* event) {
   }
 
   // Adjust the max_fd
-  while(_max_fd >= 0 && !FD_ISSET(event->fd(), _R[0]) && !FD_ISSET(event->fd(), _W[0])) {
+  while(_max_fd >= 0 && !FD_ISSET(_max_fd, _R[0]) && !FD_ISSET(_max_fd, _W[0])) {
     --_max_fd;
   }
 
@@ -331,6 +331,291 @@ void Select<EventT>::remove_impl(EventT* event) {
   _fd2ev[event->fd()] = nullptr;
 }
 
+// ------------------------------------------------------------------------------------------------
+
+#if defined(__linux__)
+
+// Class: Epoll
+// Epoll monitors the file descriptors registered in the kernel interest list, so the cost of a
+// poll depends on the number of ready descriptors rather than the number of monitored ones and
+// there is no FD_SETSIZE limit. Below are function signatures:
+//
+// int epoll_create1(int flags);
+// int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+// int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout);
+//
+// A descriptor is registered once, edge-triggered for both directions, which relies on the
+// stream buffers reading and writing until EAGAIN. Ready events are filtered by the current
+// interest of the event. Toggling the interest (e.g., the write interest of a connection with
+// pending output) therefore costs no system call: an interest that is turned on is reported in
+// the next poll since its edge may have passed, and a removal is deferred to the next poll such
+// that a remove followed by an insert cancels out. Ready events are collected in a batch that
+// grows when it fills up. A hangup is reported only once by the kernel but the input stream can
+// drain the last bytes of the peer without seeing the end of the stream, so a hung-up event
+// stays readable until it is removed from the demux, as it would be with select.
+template <typename EventT>
+class Epoll : public DemuxInterface<Epoll<EventT>> {
+
+  // Registration of a file descriptor.
+  struct Entry {
+    EventT* event   {nullptr};
+    int states      {0};
+    int pending     {0};
+    bool is_removed {false};
+    bool is_hangup  {false};
+  };
+
+  public:
+
+    Epoll();
+    ~Epoll();
+
+    OC_CODEGEN_DISABLE_COPY(Epoll);
+    OC_CODEGEN_DISABLE_MOVE(Epoll);
+
+    void insert_impl(EventT*);
+    void remove_impl(EventT*);
+
+    template <typename DurationT>
+    void poll_impl(DurationT&&);
+
+  private:
+
+    int _epfd           {-1};
+    size_t _cap         {0};
+    epoll_event* _batch {nullptr};
+
+    ::std::vector<Entry> _fd2en;
+    ::std::vector<int> _removals;
+    ::std::vector<int> _pendings;
+    ::std::vector<int> _hangups;
+
+    void _recap(const size_t);
+    void _apply_removals();
+    void _dispatch(const int, const int);
+
+    static int _states(const EventT*);
+};
+
+// Constructor
+template <typename EventT>
+Epoll<EventT>::Epoll() {
+  if((_epfd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+    LOGE("Failed to create epoll (", strerror(errno), ")");
+  }
+  _recap(MIN_NUM_EPOLL_EVENTS);
+}
+
+// Destructor
+template <typename EventT>
+Epoll<EventT>::~Epoll() {
+  if(_epfd != -1) {
+    ::close(_epfd);
+  }
+  free(_batch);
+}
+
+// Function: _states
+// Extract the IO interest of an event.
+template <typename EventT>
+int Epoll<EventT>::_states(const EventT* event) {
+  return (event->is_read() ? EventState::READ : 0) | (event->is_write() ? EventState::WRITE : 0);
+}
+
+// Procedure: _recap
+// Adjust the capacity of the ready-event batch.
+template <typename EventT>
+void Epoll<EventT>::_recap(const size_t cap) {
+  if(_cap >= cap) return;
+  _batch = static_cast<epoll_event*>(realloc(_batch, cap*sizeof(epoll_event)));
+  _cap = cap;
+}
+
+// Procedure: poll_impl
+// Apply the IO demultiplexing using epoll method and extract active events.
+template <typename EventT>
+template <typename DurationT>
+void Epoll<EventT>::poll_impl(DurationT&& d) {
+
+  if(_epfd == -1) return;
+
+  _apply_removals();
+
+  // Do not block if an event has to be reported anyway.
+  int timeout = 0;
+
+  if(_pendings.empty() && _hangups.empty()) {
+    timeout = static_cast<int>(::std::chrono::duration_cast<::std::chrono::milliseconds>(d).count());
+  }
+
+  while(1) {
+
+    auto ret = epoll_wait(_epfd, _batch, static_cast<int>(_cap), timeout);
+
+    if(ret == -1) {
+      if(errno != EINTR) {
+        LOGE(strerror(errno));
+      }
+      break;
+    }
+
+    // Invoke the handler for every active read/write event.
+    for(int i=0; i<ret; ++i) {
+      auto ready = _batch[i].events;
+      auto state = 0;
+      if(ready & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        state |= EventState::READ;
+      }
+      if(ready & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+        state |= EventState::WRITE;
+      }
+      if(ready & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        auto& en = _fd2en[_batch[i].data.fd];
+        if(!en.is_hangup && (en.states & EventState::READ)) {
+          en.is_hangup = true;
+          _hangups.push_back(_batch[i].data.fd);
+        }
+      }
+      _dispatch(_batch[i].data.fd, state);
+    }
+
+    // Drain the remaining ready events with a larger batch.
+    if(static_cast<size_t>(ret) < _cap || _cap == MAX_NUM_EPOLL_EVENTS) break;
+
+    _recap(::std::min(2*_cap, MAX_NUM_EPOLL_EVENTS));
+    timeout = 0;
+  }
+
+  // Report the interests turned on since the last poll.
+  for(const auto& fd : _pendings) {
+    auto pending = _fd2en[fd].pending;
+    _fd2en[fd].pending = 0;
+    _dispatch(fd, pending);
+  }
+  _pendings.clear();
+
+  // Report the hung-up events until they are removed.
+  for(const auto& fd : _hangups) {
+    _dispatch(fd, EventState::READ);
+  }
+}
+
+// Procedure: _dispatch
+// Invoke the handler on the ready directions of a file descriptor that are of interest.
+template <typename EventT>
+void Epoll<EventT>::_dispatch(const int fd, const int state) {
+
+  const auto& en = _fd2en[fd];
+
+  if(en.event == nullptr || en.is_removed || !this->handler()) return;
+
+  if(state & en.states & EventState::READ) {
+    this->handler()(EventState::ACTIVE_READ, en.event);
+  }
+
+  if(state & en.states & EventState::WRITE) {
+    this->handler()(EventState::ACTIVE_WRITE, en.event);
+  }
+}
+
+// Procedure: _apply_removals
+// Remove the descriptors of the events removed and not inserted back since the last poll.
+template <typename EventT>
+void Epoll<EventT>::_apply_removals() {
+
+  if(_removals.empty()) return;
+
+  for(const auto& fd : _removals) {
+
+    if(!_fd2en[fd].is_removed) continue;
+
+    // A descriptor closed in the meantime has already left the interest list.
+    if(epoll_ctl(_epfd, EPOLL_CTL_DEL, fd, nullptr) == -1) {
+      if(errno != ENOENT && errno != EBADF) {
+        LOGE("Failed to remove fd=", fd, " from epoll (", strerror(errno), ")");
+      }
+    }
+
+    _fd2en[fd] = Entry();
+  }
+  _removals.clear();
+
+  _hangups.erase(
+    ::std::remove_if(_hangups.begin(), _hangups.end(), [&] (int fd) {
+      return !_fd2en[fd].is_hangup;
+    }),
+    _hangups.end()
+  );
+}
+
+// Procedure: insert_impl
+// Insert an event into the demux. An event that is already registered only updates its interest
+// without a system call.
+template <typename EventT>
+void Epoll<EventT>::insert_impl(EventT* event) {
+
+  // Invalid arguments.
+  if(event == nullptr || event->fd() == -1 || _epfd == -1) return;
+
+  const auto fd = event->fd();
+
+  if(static_cast<size_t>(fd) >= _fd2en.size()) {
+    _fd2en.resize(fd + 1);
+  }
+
+  auto& en = _fd2en[fd];
+
+  // Re-insert a registered event, where a newly enabled interest is reported in the next poll.
+  if(en.event == event) {
+    auto enabled = _states(event) & ~en.states;
+    if(enabled && !en.pending) {
+      _pendings.push_back(fd);
+    }
+    en.pending |= enabled;
+    en.states = _states(event);
+    en.is_removed = false;
+    return;
+  }
+
+  // Register a new descriptor, whose current readiness is reported by the kernel. An existing
+  // registration belongs to a removed event of the same descriptor and is taken over.
+  epoll_event ev;
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  ev.data.fd = fd;
+
+  if(epoll_ctl(_epfd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+    if(errno != EEXIST || epoll_ctl(_epfd, EPOLL_CTL_MOD, fd, &ev) == -1) {
+      LOGE("Failed to insert fd=", fd, " into epoll (", strerror(errno), ")");
+      return;
+    }
+  }
+
+  en = Entry();
+  en.event = event;
+  en.states = _states(event);
+}
+
+// Procedure: remove_impl
+// Remove an event from the demux. The descriptor leaves the interest list in the next poll
+// unless the event is inserted back before.
+template <typename EventT>
+void Epoll<EventT>::remove_impl(EventT* event) {
+
+  // Invalid arguments.
+  if(event == nullptr || event->fd() == -1 || _epfd == -1) return;
+
+  const auto fd = event->fd();
+
+  if(static_cast<size_t>(fd) >= _fd2en.size() || _fd2en[fd].event != event) return;
+
+  if(!_fd2en[fd].is_removed) {
+    _fd2en[fd].is_removed = true;
+    _removals.push_back(fd);
+  }
+}
+
+#endif
+
 
 };  // End of namespace OpenCluster. --------------------------------------------------------------
 
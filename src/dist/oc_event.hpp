@@ -198,14 +198,18 @@ inline bool EventState::on_write() const {
 //-------------------------------------------------------------------------------------------------
 
 // Class: BasicEvent
-// The basic event class.
-template <typename EventT>
+// The basic event class. The demux template selects the IO demultiplexer of the reactor that
+// runs the event.
+template <typename EventT, template <typename> class DemuxT = DefaultDemux>
 class BasicEvent : public EventState {
 
   public:
 
     // Handler type.
     using handler_t = void (*) (EventT*);
+
+    // Demux type.
+    using demux_t = DemuxT<EventT>;
   
   private:
     
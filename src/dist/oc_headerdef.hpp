@@ -41,6 +41,9 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
 #include <netdb.h>
 #include <unistd.h>
 #include <stdarg.h>
@@ -436,7 +436,9 @@ void StreamBuffer::write_impl(const void* in_data, const size_t size) {
 
 // Procedure: sync_impl
 // Synchronize the stream buffer with a given file descriptor. Notice that the given file 
-// descriptor should be non-blocking.
+// descriptor should be non-blocking. The function returns zero at the end of the stream and -1
+// with errno set to EAGAIN if no data is available yet, which is not an error for a spurious
+// readiness notification (e.g., an edge-triggered one whose data has already been read).
 ssize_t StreamBuffer::sync_impl(const int fd) {
 
   size_t total {0};
@@ -457,6 +459,7 @@ ssize_t StreamBuffer::sync_impl(const int fd) {
         goto issue_read;
       }
       else if(errno == EAGAIN) {
+        if(total == 0) return -1;
         break; 
       }
       else {
@@ -840,7 +843,9 @@ inline ssize_t InputStream<StreamBufferT>::sync(const int fd) {
   auto ret = this->rdbuf()->sync(fd);
 
   if(ret < 0) {
-    this->insert_iostates(::std::ios_base::failbit);
+    if(errno != EAGAIN) {
+      this->insert_iostates(::std::ios_base::failbit);
+    }
   }
   else if(ret == 0) {
     this->insert_iostates(::std::ios_base::badbit | ::std::ios_base::eofbit);
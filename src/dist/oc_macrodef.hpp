@@ -125,6 +125,8 @@ namespace OpenCluster {
 
 constexpr size_t MAX_NUM_WRITE_IOVECS {8};
 constexpr size_t MAX_NUM_READ_IOVECS  {8};
+constexpr size_t MIN_NUM_EPOLL_EVENTS {64};
+constexpr size_t MAX_NUM_EPOLL_EVENTS {4096};
 
 };  // End of namespace OpenCluster. --------------------------------------------------------------
 
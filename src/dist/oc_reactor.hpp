@@ -47,8 +47,8 @@ class Reactor {
     ArrayList <EventT, SingularAllocator<EventT>> _eventlist;
     EventHeap <EventT, EventTimeoutLessT> _timeoutpq;
     
-    // TODO: user configure to automatically choose the best demux.
-    Select <EventT> _demux;
+    // Demux selected by the event type.
+    typename EventT::demux_t _demux;
 
   public:
     
@@ -396,8 +396,11 @@ void Reactor<EventT>::_process_active_events() {
 
   while(acev) {
     
-    // Stop if the event is accidentally removed from the activelist.
+    // Skip the event if it is removed from the activelist (e.g., uncommitted by a handler).
     if(!acev->has_state(EventState::IN_ACTIVELIST)) {
+      auto previous = acev;
+      acev = acev->next_active_event();
+      previous->set_next_active_event(nullptr);
       continue;
     }
 
@@ -23,7 +23,6 @@ struct is_unique_ptr {
 };
 
 // is_unique_ptr: recursiion
-template <>
 template <typename U>
 struct is_unique_ptr <::std::unique_ptr<U>> {
   static const bool value = true;
@@ -36,7 +35,6 @@ struct is_shared_ptr {
 };
 
 // is_shared_ptr: recursiion
-template <>
 template <typename U>
 struct is_shared_ptr <::std::shared_ptr<U>> {
   static const bool value = true;
@@ -49,7 +47,6 @@ struct is_weak_ptr {
 };
 
 // is_weak_ptr: recursiion
-template <>
 template <typename U>
 struct is_weak_ptr <::std::weak_ptr<U>> {
   static const bool value = true;
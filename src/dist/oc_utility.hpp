@@ -217,7 +217,8 @@ void set_default_socket_client_attribute(const int sfd) {
 
 // Function: accept_socket_client
 // Accept a client connection from a given listener. The newly accepted client will be marked
-// as non-blocking.
+// as non-blocking. An empty backlog of a non-blocking listener returns -1 with errno set to
+// EAGAIN, which is not reported as an error.
 int accept_socket_client(const int listener) {
 
   struct sockaddr client_addr;
@@ -225,7 +226,9 @@ int accept_socket_client(const int listener) {
   auto newfd = accept(listener, &client_addr, &client_addrlen);
 
   if(newfd == -1) {
-    LOGE("Failed to accept a client (", strerror(errno), ")");
+    if(errno != EAGAIN && errno != EWOULDBLOCK) {
+      LOGE("Failed to accept a client (", strerror(errno), ")");
+    }
   } 
   else {
     set_default_socket_client_attribute(newfd);
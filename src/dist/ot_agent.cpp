@@ -15,13 +15,177 @@
 
 namespace __OpenTimer {
 
+// Constructor.
+Agent::Agent():
+  _timer_uptr {new Timer()}
+{
+}
 
+// Destructor.
+Agent::~Agent() {
+}
 
+// Procedure: read_partition
+// Read the partition file, which consists of the lines "input <port>", "output <port>", and
+// "shared <pin>". Without a partition file the agent has no boundary and times a full design.
+void_t Agent::read_partition(string_crt fpath) {
 
+  ifstream ifs(fpath);
 
+  if(!ifs.good()) {
+    LOG(ERROR) << "Failed to open " + fpath;
+    return;
+  }
 
+  _inputs.clear();
+  _outputs.clear();
+  _shared.clear();
+  _excluded.clear();
 
+  string_t keyword, name;
 
+  while(ifs >> keyword) {
+    if(keyword == "partition") {
+      ifs >> name >> name;
+    }
+    else if(keyword == "input" && ifs >> name) {
+      _inputs.push_back(name);
+      _excluded.insert(name);
+    }
+    else if(keyword == "output" && ifs >> name) {
+      _outputs.push_back(name);
+      _excluded.insert(name);
+    }
+    else if(keyword == "shared" && ifs >> name) {
+      _shared.push_back(name);
+      _excluded.insert(name);
+    }
+    else {
+      LOG(WARNING) << "Unexpected keyword " + keyword + " in " + fpath;
+    }
+  }
 
+  // [BEG INFO]
+  LOG(INFO) << "Read partition " + fpath + " (" << _inputs.size() << " inputs, "
+            << _outputs.size() << " outputs, " << _shared.size() << " shared pins)";
+  // [END INFO]
+}
+
+// Function: boundary
+// Return the boundary ports as the registration value "PI=<port>;PO=<port>;...".
+string_t Agent::boundary() const {
+  string_t value;
+  for(const auto& name : _inputs) value += "PI=" + name + ";";
+  for(const auto& name : _outputs) value += "PO=" + name + ";";
+  return value;
+}
+
+// Procedure: repower_gate
+// Repower a gate given as "<gate> <cell>". The command is broadcast to every agent and a gate
+// that lives in another partition is ignored.
+void_t Agent::repower_gate(string_crt value) {
+
+  string_t gate, cell;
+  stringstream ss(value);
+  ss >> gate >> cell;
+
+  if(timer_ptr()->circuit_ptr()->gate_ptr(gate) == nullptr) return;
+
+  timer_ptr()->repower_gate(gate, cell);
+}
+
+// Function: update_timing
+// Assert the boundary timing "at|slew|rat <port> <er> <ef> <lr> <lf>;..." received from the
+// master, update the timing, and return the arrival times and slews of the boundary outputs and
+// the required arrival times of the boundary inputs. Only changed values are asserted to keep
+// the update incremental.
+string_t Agent::update_timing(string_crt value) {
+
+  circuit_pt circuit_ptr = timer_ptr()->circuit_ptr();
+
+  for_each_statement(value, [&] (string_vrt tokens) {
+
+    if(tokens.size() != 6) return;
+
+    string_crt name = tokens[1];
+
+    EL_RF_ITER(el, rf) {
+      float_t v = atof(tokens[2 + 2*el + rf].c_str());
+      if(tokens[0] == "at") {
+        primary_input_pt pi_ptr = circuit_ptr->primary_input_ptr(name);
+        if(pi_ptr && pi_ptr->at(el, rf) != v) timer_ptr()->set_at(name, el, rf, v);
+      }
+      else if(tokens[0] == "slew") {
+        primary_input_pt pi_ptr = circuit_ptr->primary_input_ptr(name);
+        if(pi_ptr && pi_ptr->slew(el, rf) != v) timer_ptr()->set_slew(name, el, rf, v);
+      }
+      else if(tokens[0] == "rat") {
+        primary_output_pt po_ptr = circuit_ptr->primary_output_ptr(name);
+        if(po_ptr && po_ptr->rat(el, rf) != v) timer_ptr()->set_rat(name, el, rf, v);
+      }
+    }
+  });
+
+  timer_ptr()->update_timing();
+
+  string_t reply;
+  float_t values[2][2];
+
+  for(const auto& name : _outputs) {
+    pin_pt pin_ptr = circuit_ptr->pin_ptr(name);
+    if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+    EL_RF_ITER(el, rf) values[el][rf] = pin_ptr->node_ptr()->at(el, rf);
+    reply += make_statement("at", name, values);
+    EL_RF_ITER(el, rf) values[el][rf] = pin_ptr->node_ptr()->slew(el, rf);
+    reply += make_statement("slew", name, values);
+  }
+
+  for(const auto& name : _inputs) {
+    pin_pt pin_ptr = circuit_ptr->pin_ptr(name);
+    if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+    EL_RF_ITER(el, rf) values[el][rf] = pin_ptr->node_ptr()->rat(el, rf);
+    reply += make_statement("rat", name, values);
+  }
+
+  return reply;
+}
+
+// Function: report_tns
+// Return the total negative slack "tns <value>;" over the pins owned by the partition followed
+// by the arrival times and the required arrival times of the shared pins. The slacks are summed
+// in double precision since the partial sums are added up again by the master.
+string_t Agent::report_tns() {
+
+  timer_ptr()->update_timing();
+
+  nodeset_rt nodeset = timer_ptr()->nodeset();
+
+  double tns(0);
+
+  for(const auto& node_ptr : nodeset) {
+    if(_excluded.count(node_ptr->pin_ptr()->name())) continue;
+    EL_RF_ITER(el, rf) {
+      if(node_ptr->slack(el, rf) < OT_FLT_ZERO) tns += node_ptr->slack(el, rf);
+    }
+  }
+
+  char buf[64];
+  snprintf(buf, sizeof(buf), "tns %.17g;", tns);
+
+  string_t reply(buf);
+  float_t values[2][2];
+
+  for(const auto& name : _shared) {
+    pin_pt pin_ptr = timer_ptr()->circuit_ptr()->pin_ptr(name);
+    if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+    EL_RF_ITER(el, rf) values[el][rf] = pin_ptr->node_ptr()->at(el, rf);
+    reply += make_statement("at", name, values);
+    EL_RF_ITER(el, rf) values[el][rf] = pin_ptr->node_ptr()->rat(el, rf);
+    reply += make_statement("rat", name, values);
+  }
+
+  return reply;
+}
 
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
@@ -15,16 +15,50 @@
 #define OT_AGENT_H_
 
 #include "ot_timer.h"
+#include "ot_packet.h"
 
 namespace __OpenTimer {
 
+// Class: Agent
+// An agent runs the timer on one partition of the design for the distributed timing. The
+// partition file written by Timer::write_partitions lists the boundary ports of the partition
+// and the pins shared by all partitions. The agent asserts the boundary timing received from the
+// master, updates the timing, and returns the timing at its boundary. Its total negative slack
+// excludes the boundary ports, which duplicate the driver of a boundary net, and the shared
+// pins, whose timing is merged by the master.
+class Agent {
 
+  public:
 
+    Agent();                                                      // Constructor.
+    ~Agent();                                                     // Destructor.
 
-};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+    inline timer_pt timer_ptr() const;                            // Query the timer pointer.
 
+    void_t read_partition(string_crt);                            // Read the partition file.
+    void_t repower_gate(string_crt);                              // Handle a repower command.
 
+    string_t boundary() const;                                    // Query the boundary ports.
+    string_t update_timing(string_crt);                           // Handle an update command.
+    string_t report_tns();                                        // Handle a tns command.
 
-#endif
+  private:
+
+    timer_upt _timer_uptr;                                        // Timer.
+
+    string_vt _inputs;                                            // Boundary inputs.
+    string_vt _outputs;                                           // Boundary outputs.
+    string_vt _shared;                                            // Shared pins.
+
+    unordered_set < string_t > _excluded;                         // Pins excluded from the tns.
+};
 
+// Function: timer_ptr
+inline timer_pt Agent::timer_ptr() const {
+  return _timer_uptr.get();
+}
+
+};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
+#endif
 
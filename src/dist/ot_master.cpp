@@ -15,5 +15,391 @@
 
 namespace __OpenTimer {
 
+// Constructor.
+BoundaryTiming::BoundaryTiming() {
+  EL_RF_ITER(el, rf) {
+    at[el][rf] = Utility::undefined_at(el);
+    slew[el][rf] = Utility::undefined_slew(el);
+    rat[el][rf] = Utility::undefined_rat(el);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+Master::Master(size_t num_agents):
+  _num_agents(num_agents)
+{
+  CHECK(_num_agents > 0);
+}
+
+// Destructor.
+Master::~Master() {
+}
+
+// Function: insert_agent
+// Register an agent with its boundary "PI=<port>;PO=<port>;..." and return the agent id. The
+// agent graph is built once all agents are registered.
+int_t Master::insert_agent(string_crt boundary) {
+
+  if(is_ready()) {
+    LOG(ERROR) << "Failed to register agent (agent count exceeds " << _num_agents << ")";
+    return OT_UNDEFINED_IDX;
+  }
+
+  int_t id = _inputs.size();
+
+  _inputs.emplace_back();
+  _outputs.emplace_back();
+  _sink.emplace_back();
+
+  for_each_statement(boundary, [&] (string_vrt tokens) {
+    for(const auto& token : tokens) {
+      auto pos = token.find('=');
+      if(pos == string_t::npos) continue;
+      if(token.compare(0, pos, "PI") == 0) _inputs[id].push_back(token.substr(pos + 1));
+      else if(token.compare(0, pos, "PO") == 0) _outputs[id].push_back(token.substr(pos + 1));
+    }
+  });
+
+  // [BEG INFO]
+  LOG(INFO) << "Registered agent " << id << " (" << _inputs[id].size() << " boundary inputs, "
+            << _outputs[id].size() << " boundary outputs)";
+  // [END INFO]
+
+  if(is_ready()) _build_graph();
+
+  return id;
+}
+
+// Procedure: _build_graph
+// Build the agent graph from the boundary ports and order it topologically. An agent graph with
+// a cycle is ordered by releasing the agent with the fewest unfinished fanins.
+void_t Master::_build_graph() {
+
+  unordered_map < string_t, int_t > source;
+
+  for(size_t a=0; a<_num_agents; ++a) {
+    for(const auto& name : _outputs[a]) {
+      if(source.count(name)) {
+        LOG(WARNING) << "Boundary output " + name + " is driven by multiple agents";
+      }
+      source[name] = a;
+    }
+  }
+
+  _fanin.assign(_num_agents, int_vt());
+  _fanout.assign(_num_agents, int_vt());
+
+  for(size_t b=0; b<_num_agents; ++b) {
+    for(const auto& name : _inputs[b]) {
+      auto itr = source.find(name);
+      if(itr == source.end()) {
+        LOG(WARNING) << "Boundary input " + name + " is not driven by any agent";
+        continue;
+      }
+      _fanin[b].push_back(itr->second);
+      _fanout[itr->second].push_back(b);
+    }
+  }
+
+  for(size_t a=0; a<_num_agents; ++a) {
+    sort(_fanin[a].begin(), _fanin[a].end());
+    _fanin[a].erase(unique(_fanin[a].begin(), _fanin[a].end()), _fanin[a].end());
+    sort(_fanout[a].begin(), _fanout[a].end());
+    _fanout[a].erase(unique(_fanout[a].begin(), _fanout[a].end()), _fanout[a].end());
+  }
+
+  // Topological order.
+  int_vt num_fanins(_num_agents);
+  bool_vt is_ordered(_num_agents, false);
+
+  for(size_t a=0; a<_num_agents; ++a) num_fanins[a] = _fanin[a].size();
+
+  _order.clear();
+  _is_acyclic = true;
+
+  while(_order.size() < _num_agents) {
+
+    int_t next = OT_UNDEFINED_IDX;
+
+    for(size_t a=0; a<_num_agents; ++a) {
+      if(is_ordered[a]) continue;
+      if(next == OT_UNDEFINED_IDX || num_fanins[a] < num_fanins[next]) next = a;
+    }
+
+    if(num_fanins[next] > 0) _is_acyclic = false;
+
+    is_ordered[next] = true;
+    _order.push_back(next);
+
+    for(const auto& b : _fanout[next]) --num_fanins[b];
+  }
+
+  _rank.assign(_num_agents, 0);
+  for(size_t i=0; i<_order.size(); ++i) _rank[_order[i]] = i;
+
+  // [BEG INFO]
+  LOG(INFO) << "Built the agent graph (" << (_is_acyclic ? "acyclic" : "cyclic") << ")";
+  // [END INFO]
+}
+
+// Function: issue
+// Issue a user command: repower_gate <gate> <cell>, update_timing, or report_tns. A command can
+// be issued once all agents are registered and the previous command has finished, and false is
+// returned otherwise. The total negative slack is reported on the boundary timing of the last
+// update, which is therefore brought up-to-date first.
+bool_t Master::issue(string_crt command) {
+
+  if(!is_ready() || is_busy()) return false;
+
+  string_vt tokens;
+  stringstream ss(command);
+  for(string_t token; ss >> token; ) tokens.push_back(token);
+
+  if(tokens.empty()) return true;
+
+  if(tokens[0] == "repower_gate" && tokens.size() == 3) {
+    _broadcast("repower_gate", tokens[1] + " " + tokens[2]);
+    _is_timing_dirty = true;
+  }
+  else if(tokens[0] == "update_timing") {
+    _num_sweeps = 0;
+    _begin_sweep(FORWARD_SWEEP);
+  }
+  else if(tokens[0] == "report_tns") {
+    if(_is_timing_dirty) {
+      _is_tns_pending = true;
+      _num_sweeps = 0;
+      _begin_sweep(FORWARD_SWEEP);
+    }
+    else {
+      _begin_report();
+    }
+  }
+  else {
+    LOG(WARNING) << "Failed to issue command " + command + " (unknown command)";
+  }
+
+  return true;
+}
+
+// Procedure: _begin_sweep
+void_t Master::_begin_sweep(State state) {
+
+  _state = state;
+  _num_pending = _num_agents;
+  _is_issued.assign(_num_agents, false);
+  _is_done.assign(_num_agents, false);
+
+  if(state == FORWARD_SWEEP) _is_changed = false;
+
+  ++_num_sweeps;
+
+  _schedule();
+}
+
+// Function: _is_ready
+// An agent is ready in the forward sweep once its fanins ordered before it have replied, and in
+// the backward sweep once its fanouts ordered after it have replied.
+bool_t Master::_is_ready(int_t a) const {
+  if(_state == FORWARD_SWEEP) {
+    for(const auto& b : _fanin[a]) {
+      if(_rank[b] < _rank[a] && !_is_done[b]) return false;
+    }
+  }
+  else {
+    for(const auto& b : _fanout[a]) {
+      if(_rank[b] > _rank[a] && !_is_done[b]) return false;
+    }
+  }
+  return true;
+}
+
+// Procedure: _schedule
+// Issue every ready agent of the sweep that has not been issued.
+void_t Master::_schedule() {
+  for(const auto& a : _order) {
+    if(!_is_issued[a] && _is_ready(a)) _update_timing(a);
+  }
+}
+
+// Procedure: _update_timing
+// Send the update_timing command to an agent with the arrival times and slews of its boundary
+// inputs and the required arrival times of its boundary outputs.
+void_t Master::_update_timing(int_t a) {
+
+  static const BoundaryTiming undefined;
+
+  string_t value;
+
+  for(const auto& name : _inputs[a]) {
+    auto itr = _source.find(name);
+    const auto& timing = (itr == _source.end()) ? undefined : itr->second;
+    value += make_statement("at", name, timing.at);
+    value += make_statement("slew", name, timing.slew);
+  }
+
+  for(const auto& name : _outputs[a]) {
+    float_t rat[2][2];
+    _merge_rat(a, name, rat);
+    value += make_statement("rat", name, rat);
+  }
+
+  _is_issued[a] = true;
+  _outbox.emplace_back(a, make_packet("update_timing", value));
+}
+
+// Procedure: _merge_rat
+// Merge the required arrival times of a boundary output of an agent over its sink agents, which
+// is the minimum (maximum) late (early) value.
+void_t Master::_merge_rat(int_t a, string_crt name, float_t (&rat)[2][2]) const {
+
+  EL_RF_ITER(el, rf) {
+    rat[el][rf] = Utility::undefined_rat(el);
+  }
+
+  for(const auto& b : _fanout[a]) {
+    auto itr = _sink[b].find(name);
+    if(itr == _sink[b].end()) continue;
+    EL_RF_ITER(el, rf) {
+      rat[el][rf] = (el == EARLY) ? max(rat[el][rf], itr->second.rat[el][rf]) :
+                                    min(rat[el][rf], itr->second.rat[el][rf]);
+    }
+  }
+}
+
+// Procedure: on_update_boundary_timing
+// Handle the boundary timing returned by an agent: the arrival times and slews of its boundary
+// outputs and the required arrival times of its boundary inputs.
+void_t Master::on_update_boundary_timing(int_t a, string_crt value) {
+
+  if(_state != FORWARD_SWEEP && _state != BACKWARD_SWEEP) {
+    LOG(WARNING) << "Unexpected boundary timing from agent " << a;
+    return;
+  }
+
+  for_each_statement(value, [&] (string_vrt tokens) {
+
+    if(tokens.size() != 6) return;
+
+    float_t (*values)[2] = nullptr;
+
+    if(tokens[0] == "at") values = _source[tokens[1]].at;
+    else if(tokens[0] == "slew") values = _source[tokens[1]].slew;
+    else if(tokens[0] == "rat") values = _sink[a][tokens[1]].rat;
+    else return;
+
+    for(int i=0; i<4; ++i) {
+      float_t v = atof(tokens[i + 2].c_str());
+      if(values[i >> 1][i & 1] != v) {
+        values[i >> 1][i & 1] = v;
+        _is_changed = true;
+      }
+    }
+  });
+
+  _is_done[a] = true;
+
+  if(--_num_pending == 0) {
+    _finish_sweep();
+  }
+  else {
+    _schedule();
+  }
+}
+
+// Procedure: _finish_sweep
+// A forward sweep is followed by a backward sweep. The sweeps of a cyclic agent graph repeat
+// until the boundary timing does not change.
+void_t Master::_finish_sweep() {
+
+  if(_state == FORWARD_SWEEP) {
+    _begin_sweep(BACKWARD_SWEEP);
+    return;
+  }
+
+  if(!_is_acyclic && _is_changed && _num_sweeps < 2*OT_DEFAULT_DIST_MAX_NUM_ITERATIONS) {
+    _begin_sweep(FORWARD_SWEEP);
+    return;
+  }
+
+  if(_is_changed && !_is_acyclic) {
+    LOG(WARNING) << "Boundary timing not settled after " << _num_sweeps << " sweeps";
+  }
+
+  // [BEG INFO]
+  LOG(INFO) << "Updated the boundary timing in " << _num_sweeps << " sweeps";
+  // [END INFO]
+
+  _state = IDLE;
+  _is_timing_dirty = false;
+
+  if(_is_tns_pending) {
+    _is_tns_pending = false;
+    _begin_report();
+  }
+}
+
+// Procedure: _begin_report
+void_t Master::_begin_report() {
+  _state = REPORT_TNS;
+  _num_pending = _num_agents;
+  _tns = 0;
+  _shared.clear();
+  _broadcast("report_tns", "");
+}
+
+// Procedure: on_report_tns
+// Handle the total negative slack of an agent, which excludes its boundary ports and the pins
+// shared by all partitions. The timing of the shared pins is merged over the agents and their
+// negative slacks are added once all agents have replied.
+void_t Master::on_report_tns(int_t a, string_crt value) {
+
+  if(_state != REPORT_TNS) {
+    LOG(WARNING) << "Unexpected tns from agent " << a;
+    return;
+  }
+
+  for_each_statement(value, [&] (string_vrt tokens) {
+    if(tokens[0] == "tns" && tokens.size() == 2) {
+      _tns += atof(tokens[1].c_str());
+    }
+    else if(tokens[0] == "at" && tokens.size() == 6) {
+      auto& timing = _shared[tokens[1]];
+      EL_RF_ITER(el, rf) {
+        timing.at[el][rf] = atof(tokens[2 + 2*el + rf].c_str());
+      }
+    }
+    else if(tokens[0] == "rat" && tokens.size() == 6) {
+      auto& timing = _shared[tokens[1]];
+      EL_RF_ITER(el, rf) {
+        float_t rat = atof(tokens[2 + 2*el + rf].c_str());
+        timing.rat[el][rf] = (el == EARLY) ? max(timing.rat[el][rf], rat) :
+                                             min(timing.rat[el][rf], rat);
+      }
+    }
+  });
+
+  if(--_num_pending) return;
+
+  for(const auto& item : _shared) {
+    EL_RF_ITER(el, rf) {
+      float_t slack = (el == EARLY) ? item.second.at[el][rf] - item.second.rat[el][rf] :
+                                      item.second.rat[el][rf] - item.second.at[el][rf];
+      if(slack < OT_FLT_ZERO) _tns += slack;
+    }
+  }
+
+  _state = IDLE;
+}
+
+// Procedure: _broadcast
+void_t Master::_broadcast(string_crt key, string_crt value) {
+  for(size_t a=0; a<_num_agents; ++a) {
+    _outbox.emplace_back(a, make_packet(key, value));
+  }
+}
 
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
@@ -15,11 +15,135 @@
 #define OT_MASTER_H_
 
 #include "ot_timer.h"
+#include "ot_packet.h"
 
 namespace __OpenTimer {
 
+// Struct: BoundaryTiming
+// Timing of a boundary port or a shared pin collected from the agents.
+struct BoundaryTiming {
+  float_t at[2][2];                                               // Arrival time.
+  float_t slew[2][2];                                             // Slew.
+  float_t rat[2][2];                                              // Required arrival time.
+  BoundaryTiming();                                               // Constructor.
+};
 
-};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+// Class: Master
+// The master of the distributed timing. Each agent times one partition of the design written by
+// Timer::write_partitions and registers its boundary ports. A boundary output of an agent is a
+// boundary input of one or more agents, which defines the agent graph. The master updates the
+// timing by a forward sweep in the topological order of the graph, where each agent receives
+// the arrival times and slews of its inputs and returns those of its outputs, followed by a
+// backward sweep in the reverse order that carries the required arrival times. Agents without a
+// dependency between them are timed concurrently. The sweeps repeat until the boundary timing
+// settles if the agent graph has a cycle. The master is independent of the transport: messages
+// to the agents are queued in the outbox and messages from the agents are fed to the handlers.
+class Master {
+
+  public:
+
+    Master(size_t);                                               // Constructor.
+    ~Master();                                                    // Destructor.
+
+    inline size_t num_agents() const;                             // Query the agent count.
+    inline size_t num_registered_agents() const;                  // Query the registered count.
+    inline size_t num_sweeps() const;                             // Query the sweep count.
+    inline float_t tns() const;                                   // Query the total negative slack.
+    inline bool_t is_ready() const;                               // Query if all agents are in.
+    inline bool_t is_busy() const;                                // Query if a command is running.
+
+    inline vector < pair<int_t, Packet> >& outbox();              // Query the outbox.
+
+    int_t insert_agent(string_crt);                               // Register an agent.
+    bool_t issue(string_crt);                                     // Issue a user command.
+    void_t on_update_boundary_timing(int_t, string_crt);          // Handle the agent timing.
+    void_t on_report_tns(int_t, string_crt);                      // Handle the agent tns.
+
+  private:
+
+    enum State {
+      IDLE = 0,
+      FORWARD_SWEEP,
+      BACKWARD_SWEEP,
+      REPORT_TNS
+    };
+
+    size_t _num_agents;                                           // Agent count.
+    size_t _num_sweeps {0};                                       // Sweeps of the last update.
+    size_t _num_pending {0};                                      // Agents yet to reply.
+
+    State _state {IDLE};                                          // Command state.
+
+    bool_t _is_acyclic {true};                                    // Agent graph status.
+    bool_t _is_timing_dirty {true};                               // Boundary timing status.
+    bool_t _is_tns_pending {false};                               // Report after the update.
+    bool_t _is_changed {false};                                   // Boundary change in a sweep.
+
+    double _tns {0};                                              // Total negative slack.
+
+    vector < string_vt > _inputs;                                 // Boundary inputs per agent.
+    vector < string_vt > _outputs;                                // Boundary outputs per agent.
+    int_mt _fanin;                                                // Agent graph fanin.
+    int_mt _fanout;                                               // Agent graph fanout.
+    int_vt _order;                                                // Topological order.
+    int_vt _rank;                                                 // Position in the order.
+    bool_vt _is_issued;                                           // Issued in this sweep.
+    bool_vt _is_done;                                             // Replied in this sweep.
 
+    unordered_map < string_t, BoundaryTiming > _source;           // Timing at boundary outputs.
+    vector < unordered_map <string_t, BoundaryTiming> > _sink;    // Timing at boundary inputs.
+    unordered_map < string_t, BoundaryTiming > _shared;           // Timing at shared pins.
+
+    vector < pair<int_t, Packet> > _outbox;                       // Messages to agents.
+
+    void_t _build_graph();                                        // Build the agent graph.
+    void_t _begin_sweep(State);                                   // Start a sweep.
+    void_t _schedule();                                           // Issue the ready agents.
+    void_t _update_timing(int_t);                                 // Issue an agent.
+    void_t _finish_sweep();                                       // Finish a sweep.
+    void_t _begin_report();                                       // Start the tns report.
+    void_t _broadcast(string_crt, string_crt);                    // Send to every agent.
+    void_t _merge_rat(int_t, string_crt, float_t (&)[2][2]) const; // Merge the sink rats.
+
+    bool_t _is_ready(int_t) const;                                // Query if an agent can run.
+};
+
+// Function: num_agents
+inline size_t Master::num_agents() const {
+  return _num_agents;
+}
+
+// Function: num_registered_agents
+inline size_t Master::num_registered_agents() const {
+  return _inputs.size();
+}
+
+// Function: num_sweeps
+inline size_t Master::num_sweeps() const {
+  return _num_sweeps;
+}
+
+// Function: tns
+inline float_t Master::tns() const {
+  return static_cast<float_t>(_tns);
+}
+
+// Function: is_ready
+inline bool_t Master::is_ready() const {
+  return num_registered_agents() == num_agents();
+}
+
+// Function: is_busy
+inline bool_t Master::is_busy() const {
+  return _state != IDLE;
+}
+
+// Function: outbox
+inline vector < pair<int_t, Packet> >& Master::outbox() {
+  return _outbox;
+}
+
+};  // End of namespace __OpenTimer. ----------------------------------------------------------------
 
 #endif
+
@@ -1,7 +1,132 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2016, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
 
+#ifndef OT_PACKET_H_
+#define OT_PACKET_H_
 
+#include "ot_typedef.h"
+
+namespace __OpenTimer {
+
+// Struct: Packet
+// A key/value message exchanged between the master and the agents. On the wire a packet is its
+// size followed by the null-terminated key and value.
 struct Packet {
-  size_t size;
-  string key;
-  string value;
+  size_t size {0};
+  string_t key;
+  string_t value;
 };
+
+// Function: make_packet
+inline Packet make_packet(string_crt key, string_crt value) {
+  Packet pkt;
+  pkt.key = key;
+  pkt.value = value;
+  pkt.size = sizeof(size_t) + key.size() + value.size() + 2;
+  return pkt;
+}
+
+// Function: make_statement
+// Format a boundary timing statement "<kind> <pin> <er> <ef> <lr> <lf>;" of a packet value. The
+// values are printed with enough digits to be read back exactly.
+inline string_t make_statement(string_crt kind, string_crt pin, const float_t (&value)[2][2]) {
+  char buf[128];
+  snprintf(buf, sizeof(buf), " %.9g %.9g %.9g %.9g;", value[EARLY][RISE], value[EARLY][FALL],
+           value[LATE][RISE], value[LATE][FALL]);
+  return kind + " " + pin + buf;
+}
+
+// Procedure: for_each_statement
+// Split a packet value into its ';'-terminated statements and apply a function to the
+// whitespace-separated tokens of each statement.
+template <typename F>
+void_t for_each_statement(string_crt value, F&& f) {
+  size_t beg = 0;
+  while(beg < value.size()) {
+    size_t end = value.find(';', beg);
+    if(end == string_t::npos) end = value.size();
+    string_vt tokens;
+    stringstream ss(value.substr(beg, end - beg));
+    for(string_t token; ss >> token; ) tokens.push_back(token);
+    if(!tokens.empty()) f(tokens);
+    beg = end + 1;
+  }
+}
+
+// Operator: <<
+// Insert a packet into an OpenCluster output stream.
+template <typename OutputStreamT>
+OutputStreamT& operator << (OutputStreamT& os, const Packet& pkt) {
+  os << pkt.size;
+  os << pkt.key.c_str();
+  os << pkt.value.c_str();
+  return os;
+}
+
+// Operator: >>
+// Extract a packet from an OpenCluster input stream. The packet is left empty (zero size) until
+// all its bytes have arrived.
+template <typename InputStreamT>
+InputStreamT& operator >> (InputStreamT& is, Packet& pkt) {
+
+  if(is.rdbuf()->in_avail() >= sizeof(size_t)) {
+
+    size_t sz {0};
+    is.rdbuf()->copy(&sz, sizeof(size_t));
+
+    if(is.rdbuf()->in_avail() >= sz) {
+      is >> pkt.size;
+      is >> pkt.key;
+      is >> pkt.value;
+    }
+  }
+  return is;
+}
+
+// Procedure: send_packet
+// Buffer a packet on the output stream of an io event and enable the write interest of the event
+// such that the reactor flushes the stream once the socket is writable. The event is removed from
+// the demux before its state changes because the demux clears the descriptor by the state.
+template <typename EventT>
+void_t send_packet(EventT* event, const Packet& pkt) {
+
+  *(event->ostream()) << pkt;
+
+  if(!event->is_write()) {
+    event->reactor()->demux().remove(event);
+    event->insert_states(EventT::WRITE);
+    event->reactor()->demux().insert(event);
+  }
+}
+
+// Procedure: flush_packets
+// Flush the output stream of an io event and disable the write interest once the stream is
+// drained, which keeps an idle socket from waking up the reactor.
+template <typename EventT>
+void_t flush_packets(EventT* event) {
+
+  if(event->ostream()->rdbuf()->in_avail()) {
+    event->ostream()->flush(event->fd());
+  }
+
+  if(event->is_write() && event->ostream()->rdbuf()->in_avail() == 0) {
+    event->reactor()->demux().remove(event);
+    event->remove_states(EventT::WRITE);
+    event->reactor()->demux().insert(event);
+  }
+}
+
+};  // End of namespace __OpenTimer. ----------------------------------------------------------------
+
+#endif
+
@@ -36,6 +36,8 @@ class CompareEndpoint;
 class DataChannel;
 class DEFReader;
 class Environment;
+class Eco;
+class EcoOperation;
 class Edge;
 class Endpoint;
 class EndpointMinHeap;
@@ -43,6 +45,10 @@ class EndpointMinHeapKV;
 class Event;
 class FileReader;
 class Gate;
+class Journal;
+class JournalFrame;
+class JournalNodeRecord;
+class JournalTestRecord;
 class Jump;
 class Layer;
 class LayerGeometry;
@@ -57,12 +63,20 @@ class NetPinlistIterator;
 class Node;
 class CPPR;
 class CPPRStorage;
+class CPPRTagPair;
 class Prefix;
 class PrefixHeap;
 class PrefixTree;
 class Path;
 class PathCache;
 class PathMaxHeap; 
+class PathSlackBound;
+class PathSlackHeap;
+class PathWriter;
+class PathTextWriter;
+class PathBinaryWriter;
+class PathCallbackWriter;
+class Partitioner;
 class Pin;
 class Pipeline;
 class PrimaryInput;
@@ -72,6 +86,7 @@ class RCTreeEdge;
 class RCTreeNode;
 class Reactor;
 class Site;
+class SlackStatistics;
 class Spef;
 class SpefPin;
 class SpefNet;
@@ -82,6 +97,9 @@ class String;
 class Test;
 class TechLib;
 class Timer;
+class TimingSnapshot;
+class TimingView;
+class TimingViewBlock;
 class TimerNodeIterator;
 class TimerEdgeIterator;
 class Timing;
@@ -101,6 +119,12 @@ class VerilogModuleInputIterator;
 class VerilogModuleGateIterator;
 class VerilogModuleOutputIterator;
 class VerilogModuleWireIterator;
+class WireEstimator;
+class SpatialGrid;
+class TimingReader;
+class SDCReader;
+class Corner;
+class Model;
 class xxHash32;
 class xxHash64;
 
@@ -160,6 +160,17 @@ enum class TimingType {
   UNDEFINED
 };
 
+enum EcoOperationType {
+  INSERT_GATE_ECO_OPERATION,
+  INSERT_NET_ECO_OPERATION,
+  REPOWER_GATE_ECO_OPERATION,
+  REMOVE_GATE_ECO_OPERATION,
+  REMOVE_NET_ECO_OPERATION,
+  CONNECT_PIN_ECO_OPERATION,
+  DISCONNECT_PIN_ECO_OPERATION,
+  UNDEFINED_ECO_OPERATION
+};
+
 enum EdgeType {
   RCTREE_EDGE_TYPE,
   CONSTRAINT_EDGE_TYPE,
@@ -249,6 +260,21 @@ enum Orientation {
   UNDEFINED_ORIENTATION
 };
 
+enum WireModel {
+  HPWL_WIRE_MODEL,
+  STEINER_WIRE_MODEL,
+  UNDEFINED_WIRE_MODEL
+};
+
+enum TimingAssertionType {
+  CLOCK_TIMING_ASSERTION,
+  AT_TIMING_ASSERTION,
+  SLEW_TIMING_ASSERTION,
+  RAT_TIMING_ASSERTION,
+  LOAD_TIMING_ASSERTION,
+  UNDEFINED_TIMING_ASSERTION
+};
+
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
 
 
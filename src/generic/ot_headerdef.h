@@ -19,6 +19,7 @@
 #include <fstream>
 #include <cstdio>
 #include <cstdlib>
+#include <cstdint>
 #include <cmath>
 #include <vector>
 #include <queue>
@@ -30,12 +31,14 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <atomic>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <functional>
 #include <algorithm>
+#include <numeric>
 #include <sys/time.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -75,6 +78,8 @@ using std::fill;
 using std::swap;
 using std::function;
 using std::unique_ptr;
+using std::shared_ptr;
+using std::atomic;
 using std::pair;
 //using std::make_unique;
 //using std::make_shared;
@@ -66,8 +66,21 @@
 
 #define OT_DEFAULT_EDGE_DELAY OT_FLT_ZERO
 
+#define OT_DEFAULT_TIMING_CHANGE_EPSILON OT_FLT_ZERO
+
+#define OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE 1024
+
+#define OT_LCA_BLOCK_SIZE 64                                // Must match the bitmask width.
+
 #define OT_DEFAULT_TEST_SLACK OT_FLT_ZERO
 
+#define OT_DEFAULT_PARALLEL_TOP_K 65536
+#define OT_DEFAULT_PATH_STREAM_BATCH_SIZE 4096
+
+#define OT_DEFAULT_SLACK_HISTOGRAM_NUM_BINS 20
+#define OT_DEFAULT_SLACK_HISTOGRAM_LOWER -100.0f
+#define OT_DEFAULT_SLACK_HISTOGRAM_UPPER 100.0f
+
 #define OT_DEFAULT_RCTREE_NODE_URES OT_FLT_ZERO
 #define OT_DEFAULT_RCTREE_NODE_CAP OT_FLT_ZERO
 #define OT_DEFAULT_RCTREE_NODE_LCAP OT_FLT_ZERO
@@ -77,6 +90,29 @@
 #define OT_DEFAULT_RCTREE_NODE_IMPULSE OT_FLT_ZERO
 #define OT_DEFAULT_RCTREE_EDGE_RES OT_FLT_ZERO
 
+#define OT_DEFAULT_WIRE_MODEL STEINER_WIRE_MODEL
+#define OT_DEFAULT_WIRE_RES_PER_MICRON 0.002f
+#define OT_DEFAULT_WIRE_CAP_PER_MICRON 0.2f
+
+#define OT_DEFAULT_SPATIAL_GRID_BIN_SIZE 16
+
+#define OT_DEFAULT_DEF_BATCH_SIZE 1024
+
+#define OT_DEFAULT_ABS_LUT_SIZE 7
+#define OT_DEFAULT_ABS_MAX_SLEW 100.0f
+#define OT_DEFAULT_ABS_MAX_LOAD 100.0f
+
+#define OT_DEFAULT_PARTITION_IMBALANCE 0.1f
+#define OT_DEFAULT_PARTITION_NUM_PASSES 8
+#define OT_DEFAULT_DIST_MAX_NUM_ITERATIONS 16
+
+#define OT_DEFAULT_TIMING_BATCH_SIZE 1024
+#define OT_DEFAULT_SDC_BATCH_SIZE 256
+#define OT_TIMING_BINARY_MAGIC "OTTIMING"
+#define OT_TIMING_BINARY_MAGIC_SIZE 8
+
+#define OT_DEFAULT_CORNER_NAME "default"
+
 #define OT_DEFAULT_PRIMARY_OUTPUT_LCAP OT_FLT_ZERO
 #define OT_DEFAULT_PRIMARY_OUTPUT_RAT OT_UNDEFINED_FLT
 #define OT_DEFAULT_PRIMARY_INPUT_AT OT_FLT_ZERO
@@ -51,6 +51,9 @@ typedef vector < int >& int_vrt;                            // Int 1D vector ref
 typedef vector < vector<int> > int_mt;                      // Int 2D vector type.
 typedef vector < vector<int> >* int_mpt;                    // Int 2D vector ptr type.
 typedef vector < vector<int> >& int_mrt;                    // Int 2D vector reference type.
+typedef unordered_map < int, int > int_to_int_umap_t;       // Int to int map type.
+typedef vector < size_t > size_vt;                          // Size vector type.
+typedef vector < size_t >& size_vrt;                        // Size vector reference type.
 typedef struct IntPair int_pair_t;                          // Int pair type.
 typedef struct IntPair& int_pair_rt;                        // Int pair reference type.
 typedef struct IntPair* int_pair_pt;                        // Int pair ptr type.
@@ -64,6 +67,10 @@ typedef set < int_t >& intset_rt;                           // Int set reference
 typedef intset_t::iterator intset_iter_t;                   // Int set iterator.
 typedef queue < int_t > int_que_t;                          // Int queue type.
 
+// Typedef of bitmask variable.
+typedef uint64_t bitmask_t;                                 // 64-bit mask type.
+typedef vector < uint64_t > bitmask_vt;                     // 64-bit mask vector type.
+
 // Typedef of unsigned variable.
 typedef unsigned  unsigned_t;                               // Unsigned type.
 typedef unsigned* unsigned_pt;                              // Unsigned ptr type.
@@ -129,6 +136,8 @@ typedef Point <float_t>* point_pt;                          // Point ptr type.
 typedef Point <float_t>& point_rt;                          // Point reference type.
 typedef const Point <float_t> point_ct;                     // Constant point type.
 typedef const Point <float_t>& point_crt;                   // Constant point reference type.
+typedef vector < point_t > point_vt;                        // Point vector type.
+typedef vector < point_t >& point_vrt;                      // Point vector reference type.
 typedef Point <float_t>::value_t point_value_t;             // Point value type.
 typedef const Point <float_t>::value_t point_value_ct;      // Point value type.
 typedef const Point <float_t>::value_t* point_value_pt;     // Point value ptr type.
@@ -243,6 +252,7 @@ typedef Gate&       gate_rt;                                // Gate reference ty
 typedef const Gate  gate_ct;                                // Constant gate type.
 typedef const Gate* gate_cpt;                               // Constant gate ptr type.
 typedef const Gate& gate_crt;                               // Constant gate reference type.
+typedef vector < gate_pt > gate_ptr_vt;                     // Gate ptr vector type.
 
 // Typedef of primary input port variable.
 typedef PrimaryInput        primary_input_t;                // PrimaryInput type.
@@ -267,6 +277,8 @@ typedef Net&       net_rt;                                  // Net reference typ
 typedef const Net  net_ct;                                  // Constant net type.
 typedef const Net* net_cpt;                                 // Constant net ptr type.
 typedef const Net& net_crt;                                 // Constant net reference type.
+typedef vector < net_pt > net_ptr_vt;                       // Net ptr vector type.
+typedef vector < net_pt >& net_ptr_vrt;                     // Net ptr vector reference type.
 
 // Typedef of pin variable.
 typedef Pin           pin_t;                                // Pin type.
@@ -275,6 +287,10 @@ typedef Pin&          pin_rt;                               // Pin reference typ
 typedef const Pin     pin_ct;                               // Constant pin type.
 typedef const Pin*    pin_cpt;                              // Constant pin ptr type.
 typedef const Pin&    pin_crt;                              // Constant pin reference type.
+typedef vector < pin_pt > pin_ptr_vt;                       // Pin ptr vector type.
+typedef vector < vector<Pin*> > pin_ptr_mt;                 // Pin ptr matrix type.
+typedef unordered_map < Pin*, size_t > pin_ptr_to_idx_umap_t; // Pin ptr to idx map type.
+typedef vector < pin_pt >& pin_ptr_vrt;                     // Pin ptr vector reference type.
 
 // Typedef of node variable.
 typedef Node           node_t;                              // Node type.
@@ -286,6 +302,8 @@ typedef const Node&    node_crt;                            // Constant node ref
 typedef vector < Node* > node_ptr_vt;                       // Node ptr vector type.
 typedef vector < Node* >& node_ptr_vrt;                     // Node ptr vector reference type.
 typedef vector < Node* >* node_ptr_vpt;                     // Node ptr vector ptr type.
+typedef vector < vector<Node*> > node_ptr_mt;               // Node ptr matrix type.
+typedef vector < vector<Node*> >& node_ptr_mrt;             // Node ptr matrix reference type.
 typedef vector < Node* >::iterator node_ptrs_iter_t;        // Node ptr vector iterator type.
 typedef OrderedSet < Node > nodeset_t;                      // Nodeset type.
 typedef OrderedSet < Node >* nodeset_pt;                    // Nodeset ptr type.
@@ -325,6 +343,9 @@ typedef const Jump jump_ct;                                 // Constant jump typ
 typedef const Jump* jump_cpt;                               // Constant jump ptr type.
 typedef const Jump& jump_crt;                               // Constant jump reference type.
 typedef vector < Jump* > jump_ptr_vt;                       // Jump vector type.
+typedef vector < Jump > jump_vt;                            // Jump object vector type.
+typedef vector < Jump >& jump_vrt;                          // Jump object vector ref type.
+typedef vector < vector<Jump> > jump_mt;                    // Jump object matrix type.
 typedef OrderedSet < Jump > jumpset_t;                      // Jumpset type.
 typedef OrderedSet < Jump >* jumpset_pt;                    // Jumpset ptr type.
 typedef OrderedSet < Jump >& jumpset_rt;                    // Jumpset reference type.
@@ -348,6 +369,9 @@ typedef const ClockTree clock_tree_ct;                      // Constant Clock ty
 typedef const ClockTree* clock_tree_cpt;                    // Constant point Clock type.
 typedef const ClockTree& clock_tree_crt;                    // Constant reference Clock type.
 typedef unique_ptr <clock_tree_t> clock_tree_upt;           // Clock tree uptr type.
+typedef vector <clock_tree_pt> clock_tree_ptr_vt;           // Clock tree ptr vector type.
+typedef vector <clock_tree_upt> clock_tree_upt_vt;          // Clock tree uptr vector type.
+typedef const vector <clock_tree_upt>& clock_tree_upt_cvrt; // Constant clock tree uptr vector ref type.
 
 // Typedef of timing arc variable.
 typedef TimingArc        timing_arc_t;                      // Timing-arc type.
@@ -483,10 +507,20 @@ typedef Prefix* prefix_pt;                                  // Prefix ptr type.
 typedef Prefix& prefix_rt;                                  // Prefix reference type.
 typedef const Prefix* prefix_cpt;                           // const prefix ptr type.
 typedef const Prefix& prefix_crt;                           // Const prefix reference type.
+typedef vector <Prefix> prefix_vt;                          // Prefix vector type.
+typedef vector <Prefix>* prefix_vpt;                        // Prefix vector ptr type.
 typedef vector <Prefix*> prefix_ptr_vt;                     // Prefix vector type.
 typedef vector <Prefix*>* prefix_ptr_vpt;                   // Prefix vector ptr type.
 typedef vector <Prefix*>& prefix_ptr_vrt;                   // Prefix vector reference type.
 
+// Typedef of sidetrack variable.
+typedef struct Sidetrack sidetrack_t;                       // Sidetrack type.
+typedef const struct Sidetrack& sidetrack_crt;              // Const sidetrack reference type.
+typedef vector < struct Sidetrack > sidetrack_vt;           // Sidetrack vector type.
+typedef struct SidetrackHeapNode sidetrack_heap_node_t;     // Sidetrack heap node type.
+typedef const struct SidetrackHeapNode& sidetrack_heap_node_crt;  // Const sidetrack heap node ref type.
+typedef vector < struct SidetrackHeapNode > sidetrack_heap_node_vt; // Sidetrack heap node vector type.
+
 // Typedef of path.
 typedef Path path_t;                                        // Path type.
 typedef Path* path_pt;                                      // Path ptr type.
@@ -518,6 +552,15 @@ typedef vector < path_cache_t > path_cache_vt;              // Path cache vector
 typedef vector < path_cache_t >* path_cache_vpt;            // Path cache vector ptr type.
 typedef vector < path_cache_t >& path_cache_vrt;            // Path cache vector reference type.
 
+// Typedef of cppr tag pair.
+typedef CPPRTagPair cppr_tag_pair_t;                        // CPPR tag pair type.
+typedef CPPRTagPair& cppr_tag_pair_rt;                      // CPPR tag pair reference type.
+typedef const CPPRTagPair& cppr_tag_pair_crt;               // Const CPPR tag pair reference type.
+typedef vector < CPPRTagPair > cppr_tag_pair_vt;            // CPPR tag pair vector type.
+typedef vector < CPPRTagPair >& cppr_tag_pair_vrt;          // CPPR tag pair vector reference type.
+typedef vector < vector<CPPRTagPair> > cppr_tag_pair_mt;    // CPPR tag pair 2D vector type.
+typedef vector < vector<CPPRTagPair> >& cppr_tag_pair_mrt;  // CPPR tag pair 2D vector reference type.
+
 // Typedef of path heap variable.
 typedef PrefixTree prefix_tree_t;                           // Path tree type.
 typedef PrefixTree* prefix_tree_pt;                         // Path tree ptr type.
@@ -525,6 +568,7 @@ typedef PrefixTree& prefix_tree_rt;                         // Path tree referen
 typedef const PrefixTree prefix_tree_ct;                    // const prefix tree type.
 typedef const PrefixTree* prefix_tree_cpt;                  // Const prefix tree ptr type.
 typedef const PrefixTree& prefix_tree_crt;                  // Const prefix tree reference type.
+typedef vector < PrefixTree* > prefix_tree_ptr_vt;          // Prefix tree ptr vector type.
 
 // Typedef of path heap variable.
 typedef PrefixHeap prefix_heap_t;                           // Path heap type.
@@ -534,6 +578,24 @@ typedef PathMaxHeap path_max_heap_t;                        // Path heap type.
 typedef vector<PathMaxHeap> path_max_heap_vt;               // Path heap vector type.
 typedef PathMaxHeap* path_max_heap_pt;                      // Path heap ptr type.
 typedef PathMaxHeap& path_max_heap_rt;                      // Path heap reference type.
+typedef PathSlackBound path_slack_bound_t;                  // Path slack bound type.
+typedef PathSlackBound* path_slack_bound_pt;                // Path slack bound ptr type.
+typedef PathSlackBound& path_slack_bound_rt;                // Path slack bound reference type.
+typedef PathSlackHeap path_slack_heap_t;                    // Path slack heap type.
+typedef vector<PathSlackHeap> path_slack_heap_vt;           // Path slack heap vector type.
+typedef PathSlackHeap& path_slack_heap_rt;                  // Path slack heap reference type.
+typedef pair < float_t, int_t > path_slack_record_t;        // Path slack/endpoint record type.
+typedef vector < path_slack_record_t > path_slack_record_vt; // Path slack record vector type.
+typedef vector < path_slack_record_t >& path_slack_record_vrt; // Path slack record ref type.
+
+// Typedef of path writer variable.
+typedef PathWriter path_writer_t;                           // Path writer type.
+typedef PathWriter* path_writer_pt;                         // Path writer ptr type.
+typedef PathWriter& path_writer_rt;                         // Path writer reference type.
+typedef PathTextWriter path_text_writer_t;                  // Path text writer type.
+typedef PathBinaryWriter path_binary_writer_t;              // Path binary writer type.
+typedef PathCallbackWriter path_callback_writer_t;          // Path callback writer type.
+typedef function < void_t (path_rt) > path_callback_t;      // Path callback type.
 
 // Typedef of a layer geometry variable.
 typedef LayerGeometry        layer_geometry_t;              // Layer geometry type.
@@ -558,6 +620,7 @@ typedef Macro&       macro_rt;                              // macro reference t
 typedef const Macro  macro_ct;                              // Constant macro type.
 typedef const Macro* macro_cpt;                             // Constant macro ptr type.
 typedef const Macro& macro_crt;                             // Constant macro reference type.
+typedef vector < macro_pt > macro_ptr_vt;                   // Macro ptr vector type.
 
 // Typedef of a site variable.
 typedef Site        site_t;                                 // site type.
@@ -598,6 +661,113 @@ typedef const Pipeline& pipeline_crt;                       // Constant pipeline
 typedef const Pipeline* pipeline_cpt;                       // Constant pipeline ptr type.
 typedef unique_ptr < pipeline_t > pipeline_upt;             // Pipeline uptr type.
 
+// Typedef of eco.
+typedef Eco eco_t;                                          // Eco type.
+typedef Eco* eco_pt;                                        // Eco ptr type.
+typedef Eco& eco_rt;                                        // Eco reference type.
+typedef const Eco* eco_cpt;                                 // Constant eco ptr type.
+typedef unique_ptr < eco_t > eco_upt;                       // Eco uptr type.
+typedef EcoOperation eco_operation_t;                       // Eco operation type.
+typedef EcoOperation* eco_operation_pt;                     // Eco operation ptr type.
+typedef EcoOperation& eco_operation_rt;                     // Eco operation reference type.
+typedef const EcoOperation& eco_operation_crt;              // Constant eco operation reference type.
+typedef vector < EcoOperation > eco_operation_vt;           // Eco operation vector type.
+typedef vector < EcoOperation >& eco_operation_vrt;         // Eco operation vector reference type.
+typedef const vector < EcoOperation >& eco_operation_cvrt;  // Constant eco operation vector ref type.
+typedef unordered_map < string_t, size_t > string_to_idx_umap_t;          // String to idx map type.
+typedef unordered_map < string_t, string_t > string_to_string_umap_t;     // String to string map type.
+typedef unordered_map < string_t, string_vt > string_to_string_vt_umap_t; // String to strings map type.
+typedef unordered_set < string_t > string_uset_t;                         // String set type.
+typedef struct EcoPin eco_pin_t;                            // Eco pin type.
+typedef unordered_map < string_t, eco_pin_t > string_to_eco_pin_umap_t;  // String to eco pin map type.
+
+// Typedef of journal.
+typedef Journal journal_t;                                  // Journal type.
+typedef Journal* journal_pt;                                // Journal ptr type.
+typedef Journal& journal_rt;                                // Journal reference type.
+typedef unique_ptr < journal_t > journal_upt;               // Journal uptr type.
+typedef JournalFrame journal_frame_t;                       // Journal frame type.
+typedef JournalFrame* journal_frame_pt;                     // Journal frame ptr type.
+typedef JournalFrame& journal_frame_rt;                     // Journal frame reference type.
+typedef vector < JournalFrame > journal_frame_vt;           // Journal frame vector type.
+typedef JournalNodeRecord journal_node_record_t;            // Journal node record type.
+typedef vector < JournalNodeRecord > journal_node_record_vt;// Journal node record vector type.
+typedef JournalTestRecord journal_test_record_t;            // Journal test record type.
+typedef vector < JournalTestRecord > journal_test_record_vt;// Journal test record vector type.
+typedef function < void_t() > journal_undo_t;               // Journal undo type.
+typedef vector < journal_undo_t > journal_undo_vt;          // Journal undo vector type.
+
+// Typedef of timing view.
+typedef TimingView timing_view_t;                                         // Timing view type.
+typedef TimingSnapshot timing_snapshot_t;                                 // Timing snapshot type.
+typedef shared_ptr < timing_snapshot_t > timing_snapshot_spt;             // Timing snapshot sptr type.
+typedef shared_ptr < const timing_snapshot_t > timing_snapshot_cspt;      // Const timing snapshot sptr type.
+typedef TimingViewBlock timing_view_block_t;                              // Timing view block type.
+typedef shared_ptr < const timing_view_block_t > timing_view_block_cspt;  // Const block sptr type.
+typedef vector < timing_view_block_cspt > timing_view_block_cspt_vt;      // Const block sptr vector type.
+typedef shared_ptr < const string_to_idx_umap_t > string_to_idx_umap_cspt;// Const string to idx map sptr type.
+
+// Typedef of slack statistics.
+typedef SlackStatistics slack_statistics_t;                 // Slack statistics type.
+typedef SlackStatistics* slack_statistics_pt;               // Slack statistics ptr type.
+typedef const SlackStatistics& slack_statistics_crt;        // Constant slack statistics ref type.
+typedef unique_ptr < slack_statistics_t > slack_statistics_upt;
+typedef vector < slack_statistics_t > slack_statistics_vt;  // Slack statistics vector type.
+
+// Typedef of wire estimator.
+typedef WireEstimator wire_estimator_t;                     // Wire estimator type.
+typedef WireEstimator* wire_estimator_pt;                   // Wire estimator ptr type.
+typedef const WireEstimator& wire_estimator_crt;            // Constant wire estimator ref type.
+typedef unique_ptr < wire_estimator_t > wire_estimator_upt; // Wire estimator uptr type.
+
+// Typedef of def reader.
+typedef DEFReader def_reader_t;                             // Def reader type.
+typedef DEFReader* def_reader_pt;                           // Def reader ptr type.
+typedef struct DEFComponent def_component_t;                // Def component type.
+typedef vector < def_component_t > def_component_vt;        // Def component vector type.
+typedef struct DEFPin def_pin_t;                            // Def pin type.
+typedef vector < def_pin_t > def_pin_vt;                    // Def pin vector type.
+
+// Typedef of timing reader.
+typedef TimingReader timing_reader_t;                       // Timing reader type.
+typedef TimingReader* timing_reader_pt;                     // Timing reader ptr type.
+typedef const TimingReader& timing_reader_crt;              // Constant timing reader ref type.
+typedef struct TimingAssertion timing_assertion_t;          // Timing assertion type.
+typedef vector < timing_assertion_t > timing_assertion_vt;  // Timing assertion vector type.
+typedef const timing_assertion_vt& timing_assertion_cvrt;   // Constant timing assertion vector ref type.
+
+// Typedef of sdc reader.
+typedef SDCReader sdc_reader_t;                             // Sdc reader type.
+typedef SDCReader* sdc_reader_pt;                           // Sdc reader ptr type.
+typedef struct SDCConstraint sdc_constraint_t;              // Sdc constraint type.
+typedef vector < sdc_constraint_t > sdc_constraint_vt;      // Sdc constraint vector type.
+typedef vector < pair < string_t, pin_pt > > named_pin_ptr_vt;      // Named pin ptr vector type.
+typedef unordered_map < string_t, float_t > string_to_float_umap_t; // String to float map type.
+
+// Typedef of corner.
+typedef Corner corner_t;                                    // Corner type.
+typedef Corner* corner_pt;                                  // Corner ptr type.
+typedef const Corner& corner_crt;                           // Constant corner ref type.
+typedef unique_ptr < corner_t > corner_upt;                 // Corner uptr type.
+typedef vector < corner_upt > corner_upt_vt;                // Corner uptr vector type.
+typedef const vector < corner_upt >& corner_upt_cvrt;       // Constant corner uptr vector ref type.
+typedef unordered_map < Cell*, Cell* > cell_ptr_umap_t;     // Cell ptr to cell ptr map type.
+typedef unordered_map < Cellpin*, Cellpin* > cellpin_ptr_umap_t;        // Cellpin ptr map type.
+typedef unordered_map < TimingArc*, TimingArc* > timing_arc_ptr_umap_t; // Timing-arc ptr map type.
+
+// Typedef of model.
+typedef Model model_t;                                      // Model type.
+typedef Model* model_pt;                                    // Model ptr type.
+typedef const Model& model_crt;                             // Constant model ref type.
+typedef unique_ptr < model_t > model_upt;                   // Model uptr type.
+typedef vector < model_upt > model_upt_vt;                  // Model uptr vector type.
+
+// Typedef of spatial grid.
+typedef SpatialGrid spatial_grid_t;                         // Spatial grid type.
+typedef SpatialGrid* spatial_grid_pt;                       // Spatial grid ptr type.
+typedef const SpatialGrid& spatial_grid_crt;                // Constant spatial grid ref type.
+typedef unique_ptr < spatial_grid_t > spatial_grid_upt;     // Spatial grid uptr type.
+
 // Typedef of verilog module.
 typedef VerilogModule verilog_module_t;                     // Verilog module type.
 typedef VerilogModule* verilog_module_pt;                   // Verilog module ptr type.
@@ -814,6 +984,7 @@ typedef TimingType timing_type_e;                           // Timing arc type e
 typedef TimeUnitBase time_unit_base_e;                      // Timing unit base enum.
 typedef VoltageUnitBase voltage_unit_base_e;                // Voltage unit base enum.
 typedef EdgeType edge_type_e;                               // Edge type enum.
+typedef EcoOperationType eco_operation_type_e;              // Eco operation type enum.
 typedef LibraryType library_type_e;                         // Library type enum.
 typedef PathType path_type_e;                               // Path type enum.
 typedef SiteClass site_class_e;                             // Site class enum.
@@ -825,6 +996,8 @@ typedef Orientation orientation_e;                          // Orientation enum.
 typedef PinUse pin_use_e;                                   // Macropin use type enum.
 typedef GateSource gate_source_e;                           // Gate source type enum.
 typedef NextStateType nextstate_type_e;                     // Next state type enum.
+typedef WireModel wire_model_e;                             // Wire model enum.
+typedef TimingAssertionType timing_assertion_type_e;        // Timing assertion type enum.
 
 // Typedef of constant enum type.
 typedef const CapacitanceUnitBase capacitance_unit_base_ce; // Const capacitance unit base enum.
@@ -841,6 +1014,7 @@ typedef const TimingType timing_type_ce;                    // Const timing arc
 typedef const TimeUnitBase time_unit_base_ce;               // Const timing unit base enum.
 typedef const VoltageUnitBase voltage_unit_base_ce;         // Const voltage unit base enum.
 typedef const EdgeType edge_type_ce;                        // Const edge type enum.
+typedef const EcoOperationType eco_operation_type_ce;       // Const eco operation type enum.
 typedef const PathType path_type_ce;                        // Const path type enum.
 typedef const SiteClass site_class_ce;                      // Const site class enum.
 typedef const MacroClass macro_class_ce;                    // Const macro class enum.
@@ -848,6 +1022,8 @@ typedef const LayerDirection layer_direction_ce;            // Const layer direc
 typedef const LayerType layer_type_ce;                      // Const layer type enum.
 typedef const Mobility mobility_ce;                         // Const mobility enum.
 typedef const Orientation orientation_ce;                   // Const orientation enum.
+typedef const WireModel wire_model_ce;                      // Const wire model enum.
+typedef const TimingAssertionType timing_assertion_type_ce; // Const timing assertion type enum.
 typedef const PinUse pin_use_ce;                            // Macropin use type enum.
 typedef const GateSource gate_source_ce;                    // Gate source type enum.
 typedef const NextStateType nextstate_type_ce;              // Const nextstate type enum.
@@ -900,6 +1076,14 @@ using abs_edgelist_iter_t = ListNode < abs_edge_pt >*;      // Abs edgelist iter
 using abs_node_allocator_t = Allocator < abs_node_t >;                 // Abs node allocator.
 using abs_edge_allocator_t = Allocator < abs_edge_t >;                 // Abs edge allocator.
 
+// Partitioner
+using partitioner_t = Partitioner;                          // Partitioner type.
+using partitioner_pt = partitioner_t*;                      // Partitioner ptr type.
+using partitioner_rt = partitioner_t&;                      // Partitioner ref type.
+using partitioner_ct = const partitioner_t;                 // Constant partitioner type.
+using partitioner_cpt = const partitioner_t*;               // Constant partitioner ptr type.
+using partitioner_crt = const partitioner_t&;               // Constant partitioner ref type.
+
 // Shell related field.
 using shell_reactor_t = function < void_t(int, char**, timer_pt) >;
 using shell_reactor_dict_t = unordered_map < string_t, shell_reactor_t >;
@@ -1904,11 +1904,6 @@ TimingArc::TimingArc(string_crt key):
 TimingArc::~TimingArc() {
 }
 
-// Procedure: set_from_cellpin_name
-void_t TimingArc::set_to_cellpin_name(string_crt name) {
-  _to_cellpin_name = name;
-}
-
 // Function: is_positive_unate
 bool_t TimingArc::is_positive_unate() const {
   if(timing_ptr(RISE, FALL) || timing_ptr(FALL, RISE)) return false;
@@ -1094,6 +1094,11 @@ inline void_t TimingArc::set_from_cellpin_name(string_crt name) {
   _from_cellpin_name = name;
 }
 
+// Procedure: set_to_cellpin_name
+inline void_t TimingArc::set_to_cellpin_name(string_crt name) {
+  _to_cellpin_name = name;
+}
+
 // Procedure: set_timing_ptr
 inline void_t TimingArc::set_timing_ptr(int irf, int orf, timing_pt timing_ptr) {
   _timing_ptr[irf][orf] = timing_ptr;
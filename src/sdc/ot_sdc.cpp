@@ -70,15 +70,16 @@ void SDC::_read_file_to_buffer(const char* fpath, char* &beg, char* &end) {
 
 // Function: _read_next_token
 // Read the next token and store it in the token. The current pointer is also redirected
-// to the next token position.
+// to the next token position. A backslash followed by a whitespace continues the line.
 bool SDC::_read_next_token(const char* beg, const char* end, char*& pre, char*& cursor, char* token) {
   pre = cursor; 
   int len = 0;
   for(; cursor < end; ++cursor) {
 
     // Comment line.
-    if(*cursor == '#') {
-      for(; *cursor != '\n'; ++cursor) ;
+    if(*cursor == '#' && !len) {
+      for(; cursor < end && *cursor != '\n'; ++cursor) ;
+      if(cursor == end) break;
     }
     
     // Group delimiters.
@@ -90,30 +91,91 @@ bool SDC::_read_next_token(const char* beg, const char* end, char*& pre, char*&
     }
     
     // Normal delimiters.
-    if(*cursor == ' ' || *cursor == '\n') {
+    if(isspace(*cursor) || (*cursor == '\\' && cursor + 1 < end && isspace(*(cursor + 1)))) {
       if(len) {
         ++cursor;
         break;
       }
     } 
-    else token[len++] = *cursor;
+    else if(len < OT_SDC_MAX_TOKEN_LENGTH - 1) token[len++] = *cursor;
   }
   token[len] = '\0';
   return len != 0;
 }
 
 // Procedure: _read_objects.
+// Read the objects of a collection enclosed by brackets, where the opening bracket has been read.
+// A port pattern of get_ports is kept as is for the wildcard expansion. The all_inputs and 
+// all_outputs collections are kept as the wildcard "*", which is resolved against the ports of
+// the direction the command applies to. Options of the access command are ignored, and a nested
+// collection is flattened.
 void SDC::_read_objects(std::vector<char*>&objects, const char* beg, const char* end, char*& pre, char*& cursor) {      
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
+  int depth = 1;
   _read_next_token(beg, end, pre, cursor, token);
-  CHECK(_is_object_access_command(token));
+  if(strcmp(token, "all_inputs") == 0 || strcmp(token, "all_outputs") == 0) {
+    objects.push_back(strdup("*"));
+  }
+  else if(!_is_object_access_command(token)) {
+    LOG(WARNING) << std::string("Unsupported object access command ") + token + " (skipped)";
+  }
+  while(depth && _read_next_token(beg, end, pre, cursor, token)) {
+    if(token[0] == '[') ++depth;
+    else if(token[0] == ']') --depth;
+    else if(_is_delimiter(token[0]) || token[0] == '-' || _is_object_access_command(token)) continue;
+    else objects.push_back(strdup(token));
+  }
+}
+
+// Procedure: _read_object_list.
+// Read the objects of a list enclosed by braces, where the opening brace has been read.
+void SDC::_read_object_list(std::vector<char*>&objects, const char* beg, const char* end, char*& pre, char*& cursor) {      
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
   while(_read_next_token(beg, end, pre, cursor, token)) {
-    if(token[0] == ']') break;
+    if(token[0] == '}') break;
     if(_is_delimiter(token[0])) continue;
     objects.push_back(strdup(token));
   }
 }
 
+// Function: _read_name
+// Read the name of an object, which is either a token or the first object of a collection such as
+// [get_clocks clk].
+char* SDC::_read_name(const char* beg, const char* end, char*& pre, char*& cursor) {
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
+  char* name = nullptr;
+  std::vector<char*> objects;
+  _read_next_token(beg, end, pre, cursor, token);
+  if(token[0] == '[') {
+    _read_objects(objects, beg, end, pre, cursor);
+  }
+  else if(token[0] == '{') {
+    _read_object_list(objects, beg, end, pre, cursor);
+  }
+  else {
+    return strdup(token);
+  }
+  if(!objects.empty()) {
+    name = objects[0];
+    objects.erase(objects.begin());
+  }
+  free_sdc_objects(objects);
+  return name;
+}
+
+// Procedure: _skip_command
+// Skip the remaining of the current command, which ends at the first line break outside any 
+// bracket or brace and not escaped by a backslash.
+void SDC::_skip_command(const char* beg, const char* end, char*& pre, char*& cursor) {
+  int depth = 0;
+  for(pre = cursor; cursor < end; ++cursor) {
+    if(*cursor == '\\' && cursor + 1 < end) ++cursor;
+    else if(*cursor == '[' || *cursor == '{') ++depth;
+    else if(*cursor == ']' || *cursor == '}') --depth;
+    else if(*cursor == '\n' && depth <= 0) break;
+  }
+}
+
 // Function: _is_object_access_command
 // Return true if the given string is an object access command. The object access command could be
 // 1) current_design 
@@ -158,7 +220,7 @@ bool SDC::_is_object_access_command(const char *token) const {
 void SDC::_read_set_load(const char* beg, const char* end, char*& pre, char*& cursor) {
   
   SetLoad reader;
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
 
   while(_read_next_token(beg, end, pre, cursor, token)) {
     if(strcmp(token, "-min") == 0) {
@@ -176,12 +238,15 @@ void SDC::_read_set_load(const char* beg, const char* end, char*& pre, char*& cu
     else if(strcmp(token, "-wire_load") == 0) {
       reader.is_wire_load = true;
     }
-    else if(Utility::to_numeric(token) != FLT_MAX) {
+    else if(Utility::to_numeric(token) != OT_UNDEFINED_FLT) {
       reader.value = Utility::to_numeric(token);
     } 
     else if(token[0] == '[') {
       _read_objects(reader.objects, beg, end, pre, cursor);
     }
+    else if(token[0] == '{') {
+      _read_object_list(reader.objects, beg, end, pre, cursor);
+    }
     else {
       cursor = pre;
       break;
@@ -193,8 +258,9 @@ void SDC::_read_set_load(const char* beg, const char* end, char*& pre, char*& cu
     _set_load(&reader, _user_data);
   }
   
-  // DEBUG:
+  #ifdef SDC_CALLBACK_VERBOSITY
   std::cout << dump_set_load(&reader);
+  #endif
 }
 
 // Procedure: _read_create_clock
@@ -207,7 +273,7 @@ void SDC::_read_set_load(const char* beg, const char* end, char*& pre, char*& cu
 void SDC::_read_create_clock(const char* beg, const char* end, char*& pre, char*& cursor) {
 
   CreateClock reader;  
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
   
   while(_read_next_token(beg, end, pre, cursor, token)) {
     if(strcmp(token, "-period") == 0) {
@@ -219,9 +285,16 @@ void SDC::_read_create_clock(const char* beg, const char* end, char*& pre, char*
       reader.clock_name = strdup(token);
     }
     else if(strcmp(token, "-add") == 0) {
-      _read_next_token(beg, end, pre, cursor, token);
       reader.is_add = true;
     }
+    else if(strcmp(token, "-waveform") == 0) {
+      std::vector<char*> edges;
+      _read_next_token(beg, end, pre, cursor, token);
+      if(token[0] == '{') {
+        _read_object_list(edges, beg, end, pre, cursor);
+      }
+      free_sdc_objects(edges);
+    }
     else if(strcmp(token, "-comment") == 0) {
       _read_next_token(beg, end, pre, cursor, token);
       reader.comment_string = strdup(token);
@@ -229,6 +302,9 @@ void SDC::_read_create_clock(const char* beg, const char* end, char*& pre, char*
     else if(token[0] == '[') {
       _read_objects(reader.objects, beg, end, pre, cursor);
     }
+    else if(token[0] == '{') {
+      _read_object_list(reader.objects, beg, end, pre, cursor);
+    }
     else {
       cursor = pre;
       break;
@@ -240,8 +316,9 @@ void SDC::_read_create_clock(const char* beg, const char* end, char*& pre, char*
     _create_clock(&reader, _user_data);
   }
 
-  // DEBUG:
+  #ifdef SDC_CALLBACK_VERBOSITY
   std::cout << dump_create_clock(&reader);
+  #endif
 }
 
 // Procedure: read_set_input_delay
@@ -260,14 +337,19 @@ void SDC::_read_create_clock(const char* beg, const char* end, char*& pre, char*
 // port_pin_list
 void SDC::_read_set_input_delay(const char* beg, const char* end, char*& pre, char*& cursor) {
   
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
   SetInputDelay reader; 
 
   while(_read_next_token(beg, end, pre, cursor, token)) {
     
     if(strcmp(token, "-clock") == 0) {
-      _read_next_token(beg, end, pre, cursor, token);  
-      reader.clock_name = strdup(token);
+      reader.clock_name = _read_name(beg, end, pre, cursor);
+    }
+    else if(strcmp(token, "-reference_pin") == 0) {
+      _read_next_token(beg, end, pre, cursor, token);
+    }
+    else if(strcmp(token, "-clock_fall") == 0) {
+      reader.is_clock_fall = true;
     }
     else if(strcmp(token, "-level_sensitive") == 0) {
       reader.is_level_sensitive = true;
@@ -293,12 +375,15 @@ void SDC::_read_set_input_delay(const char* beg, const char* end, char*& pre, ch
     else if(strcmp(token, "-source_latency_included") == 0) {
       reader.is_source_latency_included = true;
     }
-    else if(Utility::to_numeric(token) != FLT_MAX) {
+    else if(Utility::to_numeric(token) != OT_UNDEFINED_FLT) {
       reader.delay_value = Utility::to_numeric(token);
     }
     else if(token[0] == '[') {
       _read_objects(reader.objects, beg, end, pre, cursor);
     }
+    else if(token[0] == '{') {
+      _read_object_list(reader.objects, beg, end, pre, cursor);
+    }
     else {
       cursor = pre;
       break;
@@ -310,8 +395,9 @@ void SDC::_read_set_input_delay(const char* beg, const char* end, char*& pre, ch
     _set_input_delay(&reader, _user_data);
   }
 
-  // DEBUG:
+  #ifdef SDC_CALLBACK_VERBOSITY
   std::cout << dump_set_input_delay(&reader);
+  #endif
 }
 
 // Procedure: read_set_output_delay
@@ -330,14 +416,19 @@ void SDC::_read_set_input_delay(const char* beg, const char* end, char*& pre, ch
 // port_pin_list
 void SDC::_read_set_output_delay(const char* beg, const char* end, char*& pre, char*& cursor) {
   
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
   SetOutputDelay reader; 
 
   while(_read_next_token(beg, end, pre, cursor, token)) {
     
     if(strcmp(token, "-clock") == 0) {
-      _read_next_token(beg, end, pre, cursor, token);  
-      reader.clock_name = strdup(token);
+      reader.clock_name = _read_name(beg, end, pre, cursor);
+    }
+    else if(strcmp(token, "-reference_pin") == 0) {
+      _read_next_token(beg, end, pre, cursor, token);
+    }
+    else if(strcmp(token, "-clock_fall") == 0) {
+      reader.is_clock_fall = true;
     }
     else if(strcmp(token, "-level_sensitive") == 0) {
       reader.is_level_sensitive = true;
@@ -363,12 +454,15 @@ void SDC::_read_set_output_delay(const char* beg, const char* end, char*& pre, c
     else if(strcmp(token, "-source_latency_included") == 0) {
       reader.is_source_latency_included = true;
     }
-    else if(Utility::to_numeric(token) != FLT_MAX) {
+    else if(Utility::to_numeric(token) != OT_UNDEFINED_FLT) {
       reader.delay_value = Utility::to_numeric(token);
     }
     else if(token[0] == '[') {
       _read_objects(reader.objects, beg, end, pre, cursor);
     }
+    else if(token[0] == '{') {
+      _read_object_list(reader.objects, beg, end, pre, cursor);
+    }
     else {
       cursor = pre;
       break;
@@ -379,8 +473,9 @@ void SDC::_read_set_output_delay(const char* beg, const char* end, char*& pre, c
     _set_output_delay(&reader, _user_data);
   }
 
-  // DEBUG:
+  #ifdef SDC_CALLBACK_VERBOSITY
   std::cout << dump_set_output_delay(&reader);
+  #endif
 }
 
 // Procedure: set_driving_cell
@@ -403,7 +498,7 @@ void SDC::_read_set_output_delay(const char* beg, const char* end, char*& pre, c
 void SDC::_read_set_driving_cell(const char* beg, const char* end, char*& pre, char*& cursor) {
   
   SetDrivingCell reader;
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
   
   while(_read_next_token(beg, end, pre, cursor, token)) {
     if(strcmp(token, "-lib_cell") == 0) {
@@ -430,7 +525,7 @@ void SDC::_read_set_driving_cell(const char* beg, const char* end, char*& pre, c
       _read_next_token(beg, end, pre, cursor, token);
       reader.pin_name = strdup(token);
     }
-    else if(strcmp(token, "-from_pin_name") == 0) {
+    else if(strcmp(token, "-from_pin") == 0) {
       _read_next_token(beg, end, pre, cursor, token);
       reader.from_pin_name = strdup(token);
     }
@@ -445,8 +540,7 @@ void SDC::_read_set_driving_cell(const char* beg, const char* end, char*& pre, c
       reader.no_design_rule = true;
     }
     else if(strcmp(token, "-clock") == 0) {
-      _read_next_token(beg, end, pre, cursor, token);
-      reader.clock_name = strdup(token);
+      reader.clock_name = _read_name(beg, end, pre, cursor);
     }
     else if(strcmp(token, "-clock_fall") == 0) {
       reader.is_clock_fall = true;
@@ -462,6 +556,9 @@ void SDC::_read_set_driving_cell(const char* beg, const char* end, char*& pre, c
     else if(token[0] == '[') {
       _read_objects(reader.objects, beg, end, pre, cursor);
     }
+    else if(token[0] == '{') {
+      _read_object_list(reader.objects, beg, end, pre, cursor);
+    }
     else {
       cursor = pre;
       break;
@@ -473,8 +570,9 @@ void SDC::_read_set_driving_cell(const char* beg, const char* end, char*& pre, c
     _set_driving_cell(&reader, _user_data);
   }
 
-  // DEBUG:
+  #ifdef SDC_CALLBACK_VERBOSITY
   std::cout << dump_set_driving_cell(&reader);
+  #endif
 }
 
 // Procedure: read
@@ -490,20 +588,22 @@ void SDC::read(const char *fpath, void* user_data) {
   char* beg;
   char* end; 
   char* cursor;
-  char token[1024];
+  char token[OT_SDC_MAX_TOKEN_LENGTH];
 
   _read_file_to_buffer(fpath, beg, end);
   cursor = beg;
   
   while(_read_next_token(beg, end, pre, cursor, token)) {
 
+    #ifdef SDC_CALLBACK_VERBOSITY
     printf("token is: %s\n", token);
+    #endif
 
     if(strcmp(token, "set_input_delay") == 0) {
       _read_set_input_delay(beg, end, pre, cursor);
     }
     else if(strcmp(token, "set_load") == 0) {
-      _read_set_load(end, end, pre, cursor); 
+      _read_set_load(beg, end, pre, cursor); 
     }
     else if(strcmp(token, "set_driving_cell") == 0) {
       _read_set_driving_cell(beg, end, pre, cursor);
@@ -515,7 +615,8 @@ void SDC::read(const char *fpath, void* user_data) {
       _read_create_clock(beg, end, pre, cursor);
     }
     else {
-      CHECK(false);
+      LOG(WARNING) << std::string("Unsupported sdc command ") + token + " (skipped)";
+      _skip_command(beg, end, pre, cursor);
     }
   }
 
@@ -17,6 +17,10 @@
 #include "ot_sdcdef.h"
 #include "ot_sdcdump.h"
 
+//#define SDC_CALLBACK_VERBOSITY 1
+
+#define OT_SDC_MAX_TOKEN_LENGTH 1024
+
 namespace __OpenTimer {
 
 // Class: SDC
@@ -33,6 +37,12 @@ class SDC {
     inline void set_user_data(void*);                                                   // Set the user data.
     inline void* user_data() const;                                                     // Query the user data.
 
+    inline void set_create_clock_cbk(callback_t);                                       // Set the callback.
+    inline void set_set_input_delay_cbk(callback_t);                                    // Set the callback.
+    inline void set_set_output_delay_cbk(callback_t);                                   // Set the callback.
+    inline void set_set_load_cbk(callback_t);                                           // Set the callback.
+    inline void set_set_driving_cell_cbk(callback_t);                                   // Set the callback.
+
     void read(const char*, void*);                                                      // Read the sdc file.
 
   private:
@@ -48,12 +58,16 @@ class SDC {
     callback_t _set_driving_cell;                                                       // Callback function.
     
     void _read_objects(std::vector<char*>&, const char*, const char*, char*&, char*&);  // Read objects.
+    void _read_object_list(std::vector<char*>&, const char*, const char*, char*&, char*&);// Read objects.
     void _read_file_to_buffer(const char*, char*&, char*&);                             // Buffer the file.
     void _read_create_clock(const char*, const char*, char*&, char*&);                  // Read create_clock.
     void _read_set_input_delay(const char*, const char*, char*&, char*&);               // Read set_input_delay.
     void _read_set_output_delay(const char*, const char*, char*&, char*&);              // Read set_out_delay.
     void _read_set_load(const char*, const char*, char*&, char*&);                      // Read set_load.
     void _read_set_driving_cell(const char*, const char*, char*&, char*&);              // Read set_driving_cell.
+    void _skip_command(const char*, const char*, char*&, char*&);                       // Skip a command.
+
+    char* _read_name(const char*, const char*, char*&, char*&);                         // Read a name.
     
     bool _is_delimiter(const char) const;                                               // Check if the delimiter
     bool _is_object_access_command(const char*) const;                                  // Check if object accesser.
@@ -72,6 +86,36 @@ inline void* SDC::user_data() const {
   return _user_data;
 }
 
+// Procedure: set_create_clock_cbk
+// Set the callback function of create_clock.
+inline void SDC::set_create_clock_cbk(callback_t cbk) {
+  _create_clock = cbk;
+}
+
+// Procedure: set_set_input_delay_cbk
+// Set the callback function of set_input_delay.
+inline void SDC::set_set_input_delay_cbk(callback_t cbk) {
+  _set_input_delay = cbk;
+}
+
+// Procedure: set_set_output_delay_cbk
+// Set the callback function of set_output_delay.
+inline void SDC::set_set_output_delay_cbk(callback_t cbk) {
+  _set_output_delay = cbk;
+}
+
+// Procedure: set_set_load_cbk
+// Set the callback function of set_load.
+inline void SDC::set_set_load_cbk(callback_t cbk) {
+  _set_load = cbk;
+}
+
+// Procedure: set_set_driving_cell_cbk
+// Set the callback function of set_driving_cell.
+inline void SDC::set_set_driving_cell_cbk(callback_t cbk) {
+  _set_driving_cell = cbk;
+}
+
 };
 
 
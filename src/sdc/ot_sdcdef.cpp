@@ -30,7 +30,8 @@ SetInputDelay::SetInputDelay():
   is_add_delay(false),
   is_network_latency_included(false),
   is_source_latency_included(false),
-  clock_name(nullptr)
+  clock_name(nullptr),
+  delay_value(0.0f)
 {
 }
 
@@ -53,7 +54,8 @@ SetOutputDelay::SetOutputDelay():
   is_add_delay(false),
   is_network_latency_included(false),
   is_source_latency_included(false),
-  clock_name(nullptr)
+  clock_name(nullptr),
+  delay_value(0.0f)
 {
 }
 
@@ -71,7 +73,8 @@ SetLoad::SetLoad():
   is_max(false),
   is_subtract_pin_load(false),
   is_pin_load(false),
-  is_wire_load(false)
+  is_wire_load(false),
+  value(0.0f)
 {
 }
 
@@ -95,7 +98,10 @@ SetDrivingCell::SetDrivingCell():
   lib_cell_name(nullptr),
   pin_name(nullptr),
   from_pin_name(nullptr),
-  clock_name(nullptr)
+  clock_name(nullptr),
+  factor(1.0f),
+  rise_time(FLT_MAX),
+  fall_time(FLT_MAX)
 {
 
 }
@@ -116,7 +122,8 @@ SetDrivingCell::~SetDrivingCell() {
 CreateClock::CreateClock():
   is_add(false),
   clock_name(nullptr),
-  comment_string(nullptr)
+  comment_string(nullptr),
+  period(0.0f)
 {
 }
 
@@ -65,12 +65,15 @@ Illegal commands might cause unexpected program errors.\n");
 string_ct Shell::_help_design_report = string_t("\
 List of design-report commands:\n\n\
 report_worst_paths -numPaths <integer> [-pin <pin_name>]\n\
+stream_worst_paths -numPaths <integer> [-pin <pin_name>] [-batch <integer>] [-binary <file_path>]\n\
 report_at -pin <pin_name> -early/-late -rise/-fall\n\
 report_rat -pin <pin_name> -early/-late -rise/-fall\n\
 report_slack -pin <pin_name> -early/-late -rise/-fall\n\
 report_slew -pin <pin_name> -early/-late -rise/-fall\n\
+report_slack_statistics [-bins <integer>] [-lower <float>] [-upper <float>] [-binary <file_path>]\n\
 report_tns\n\
 report_wns\n\
+report_corners\n\
 report_timer\n\n\
 It is the user's responsibility to make each command legal.\n\
 Illegal commands might cause unexpected program errors.\n");
@@ -81,11 +84,23 @@ List of design-modifier commands:\n\n\
 insert_gate <gate_name> <cell_name>\n\
 remove_gate <gate_name>\n\
 repower_gate <gate_name> <cell_name>\n\
+move_gate <gate_name> <x> <y>\n\
 insert_net <net_name>\n\
 remove_net <net_name>\n\
 disconnect_pin <pin_name>\n\
-connect_pin <pin_name> <net_name>\n\n\
+connect_pin <pin_name> <net_name>\n\
+begin_eco\n\
+commit_eco\n\
+push_state\n\
+pop_state\n\
+merge_state\n\n\
 read_spef <file_path.spef>\n\
+estimate_rctrees [-model hpwl/steiner] [-layer <name>] [-res <float>] [-cap <float>]\n\
+insert_corner <corner_name> <early.lib> <late.lib> [-res <float>] [-cap <float>]\n\
+update_corners\n\
+write_macro <macro_name>\n\
+write_partitions <num_partitions> <prefix>\n\
+read_model <model_name> <early.lib> <late.lib>\n\
 set_at -pin <pi_name> -early/-late -rise/-fall <value>\n\
 set_rat -pin <po_name> -early/-late -rise/-fall <value>\n\
 set_load -pin <po_name> <value>\n\
@@ -218,6 +233,16 @@ void_t Shell::_feed_report_worst_paths(int argc, char **argv, timer_pt timer) {
   timer->report_worst_paths(argc, argv);
 }
 
+// Procedure: _feed_stream_worst_paths
+void_t Shell::_feed_stream_worst_paths(int argc, char **argv, timer_pt timer) {
+  timer->stream_worst_paths(argc, argv);
+}
+
+// Procedure: _feed_report_slack_statistics
+void_t Shell::_feed_report_slack_statistics(int argc, char **argv, timer_pt timer) {
+  timer->report_slack_statistics(argc, argv);
+}
+
 // Procedure: _feed_report_tns
 void_t Shell::_feed_report_tns(int argc, char **argv, timer_pt timer) {
   if(_is_argc_valid(argc, 1)) {
@@ -225,6 +250,13 @@ void_t Shell::_feed_report_tns(int argc, char **argv, timer_pt timer) {
   }
 }
 
+// Procedure: _feed_report_corners
+void_t Shell::_feed_report_corners(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->report_corners();
+  }
+}
+
 // Procedure: _feed_report_wns
 void_t Shell::_feed_report_wns(int argc, char **argv, timer_pt timer) {
   if(_is_argc_valid(argc, 1)) {
@@ -264,6 +296,13 @@ void_t Shell::_feed_insert_gate(int argc, char **argv, timer_pt timer) {
   }
 }
 
+// Procedure: _feed_move_gate
+void_t Shell::_feed_move_gate(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 4)) {
+    timer->move_gate(argv[1], atof(argv[2]), atof(argv[3]));
+  }
+}
+
 // Procedure: _feed_repower_gate
 void_t Shell::_feed_repower_gate(int argc, char **argv, timer_pt timer) {
   if(_is_argc_valid(argc, 3)) {
@@ -292,6 +331,44 @@ void_t Shell::_feed_read_spef(int argc, char **argv, timer_pt timer) {
   }
 }
 
+// Procedure: _feed_estimate_rctrees
+void_t Shell::_feed_estimate_rctrees(int argc, char **argv, timer_pt timer) {
+  timer->estimate_rctrees(argc, argv);
+}
+
+// Procedure: _feed_insert_corner
+void_t Shell::_feed_insert_corner(int argc, char **argv, timer_pt timer) {
+  timer->insert_corner(argc - 1, argv + 1);
+}
+
+// Procedure: _feed_update_corners
+void_t Shell::_feed_update_corners(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->update_corners();
+  }
+}
+
+// Procedure: _feed_write_macro
+void_t Shell::_feed_write_macro(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 2)) {
+    timer->write_macro(argv[1]);
+  }
+}
+
+// Procedure: _feed_write_partitions
+void_t Shell::_feed_write_partitions(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 3)) {
+    timer->write_partitions(atoi(argv[1]), argv[2]);
+  }
+}
+
+// Procedure: _feed_read_model
+void_t Shell::_feed_read_model(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 4)) {
+    timer->read_model(argv[1], argv[2], argv[3]);
+  }
+}
+
 // Procedure: _feed_remove_net
 void_t Shell::_feed_remove_net(int argc, char **argv, timer_pt timer) {
   if(_is_argc_valid(argc, 2)) {
@@ -313,6 +390,41 @@ void_t Shell::_feed_disconnect_pin(int argc, char **argv, timer_pt timer) {
   }
 }
 
+// Procedure: _feed_begin_eco
+void_t Shell::_feed_begin_eco(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->begin_eco();
+  }
+}
+
+// Procedure: _feed_commit_eco
+void_t Shell::_feed_commit_eco(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->commit_eco();
+  }
+}
+
+// Procedure: _feed_push_state
+void_t Shell::_feed_push_state(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->push_state();
+  }
+}
+
+// Procedure: _feed_pop_state
+void_t Shell::_feed_pop_state(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->pop_state();
+  }
+}
+
+// Procedure: _feed_merge_state
+void_t Shell::_feed_merge_state(int argc, char **argv, timer_pt timer) {
+  if(_is_argc_valid(argc, 1)) {
+    timer->merge_state();
+  }
+}
+
 // Procedure: _feed_set_at
 void_t Shell::_feed_set_at(int argc, char **argv, timer_pt timer) {
   timer->set_at(argc, argv);
@@ -361,8 +473,11 @@ void_t Shell::_initiate_reactor_dict() {
   _reactor_dict["init_timer"] = _feed_init_timer;
   _reactor_dict["exec_ops"] = _feed_exec_ops;
   _reactor_dict["report_worst_paths"] = _feed_report_worst_paths;
+  _reactor_dict["stream_worst_paths"] = _feed_stream_worst_paths;
+  _reactor_dict["report_slack_statistics"] = _feed_report_slack_statistics;
   _reactor_dict["report_tns"] = _feed_report_tns;
   _reactor_dict["report_wns"] = _feed_report_wns;
+  _reactor_dict["report_corners"] = _feed_report_corners;
   _reactor_dict["report_at"] = _feed_report_at;
   _reactor_dict["report_rat"] = _feed_report_rat;
   _reactor_dict["report_slew"] = _feed_report_slew;
@@ -372,12 +487,24 @@ void_t Shell::_initiate_reactor_dict() {
   _reactor_dict["report_max_num_threads"] = _feed_report_max_num_threads;
   _reactor_dict["insert_gate"] = _feed_insert_gate;
   _reactor_dict["repower_gate"] = _feed_repower_gate;
+  _reactor_dict["move_gate"] = _feed_move_gate;
   _reactor_dict["remove_gate"] = _feed_remove_gate;
   _reactor_dict["read_spef"] = _feed_read_spef;
+  _reactor_dict["estimate_rctrees"] = _feed_estimate_rctrees;
+  _reactor_dict["insert_corner"] = _feed_insert_corner;
+  _reactor_dict["update_corners"] = _feed_update_corners;
+  _reactor_dict["write_macro"] = _feed_write_macro;
+  _reactor_dict["write_partitions"] = _feed_write_partitions;
+  _reactor_dict["read_model"] = _feed_read_model;
   _reactor_dict["insert_net"] = _feed_insert_net;
   _reactor_dict["remove_net"] = _feed_remove_net;
   _reactor_dict["connect_pin"] = _feed_connect_pin;
   _reactor_dict["disconnect_pin"] = _feed_disconnect_pin;
+  _reactor_dict["begin_eco"] = _feed_begin_eco;
+  _reactor_dict["commit_eco"] = _feed_commit_eco;
+  _reactor_dict["push_state"] = _feed_push_state;
+  _reactor_dict["pop_state"] = _feed_pop_state;
+  _reactor_dict["merge_state"] = _feed_merge_state;
 }
 
 // Procedure: _feed_command
@@ -79,8 +79,11 @@ class Shell final {
     static void_t _feed_report_max_num_threads(int, char**, timer_pt);          // Command reactor.
     static void_t _feed_exec_ops(int, char**, timer_pt);                        // Command reactor.
     static void_t _feed_report_worst_paths(int, char**, timer_pt);              // Command reactor.
+    static void_t _feed_stream_worst_paths(int, char**, timer_pt);              // Command reactor.
+    static void_t _feed_report_slack_statistics(int, char**, timer_pt);         // Command reactor.
     static void_t _feed_report_tns(int, char**, timer_pt);                      // Command reactor.
     static void_t _feed_report_wns(int, char**, timer_pt);                      // Command reactor.
+    static void_t _feed_report_corners(int, char**, timer_pt);                  // Command reactor.
     static void_t _feed_report_at(int, char**, timer_pt);                       // Command reactor.
     static void_t _feed_report_rat(int, char**, timer_pt);                      // Command reactor.
     static void_t _feed_report_slack(int, char**, timer_pt);                    // Command reactor.
@@ -88,12 +91,24 @@ class Shell final {
     static void_t _feed_report_all_slacks(int, char**, timer_pt);               // Command reactor.
     static void_t _feed_insert_gate(int, char**, timer_pt);                     // Command reactor.
     static void_t _feed_repower_gate(int, char**, timer_pt);                    // Command reactor.
+    static void_t _feed_move_gate(int, char**, timer_pt);                       // Command reactor.
     static void_t _feed_remove_gate(int, char**, timer_pt);                     // Command reactor.
     static void_t _feed_insert_net(int, char**, timer_pt);                      // Command reactor.
     static void_t _feed_read_spef(int, char**, timer_pt);                       // Command reactor.
+    static void_t _feed_estimate_rctrees(int, char**, timer_pt);                // Command reactor.
+    static void_t _feed_insert_corner(int, char**, timer_pt);                   // Command reactor.
+    static void_t _feed_update_corners(int, char**, timer_pt);                  // Command reactor.
+    static void_t _feed_write_macro(int, char**, timer_pt);                     // Command reactor.
+    static void_t _feed_write_partitions(int, char**, timer_pt);                // Command reactor.
+    static void_t _feed_read_model(int, char**, timer_pt);                      // Command reactor.
     static void_t _feed_remove_net(int, char**, timer_pt);                      // Command reactor.
     static void_t _feed_connect_pin(int, char**, timer_pt);                     // Command reactor.
     static void_t _feed_disconnect_pin(int, char**, timer_pt);                  // Command reactor.
+    static void_t _feed_begin_eco(int, char**, timer_pt);                       // Command reactor.
+    static void_t _feed_commit_eco(int, char**, timer_pt);                      // Command reactor.
+    static void_t _feed_push_state(int, char**, timer_pt);                      // Command reactor.
+    static void_t _feed_pop_state(int, char**, timer_pt);                       // Command reactor.
+    static void_t _feed_merge_state(int, char**, timer_pt);                     // Command reactor.
 
 };
 
@@ -0,0 +1,968 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_abstractor.h"
+#include "ot_timer.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+AbsNode::AbsNode():
+  _idx(OT_UNDEFINED_IDX),
+  _pin_ptr(nullptr),
+  _is_clock(false)
+{
+}
+
+// Destructor.
+AbsNode::~AbsNode() {
+}
+
+// Function: name
+// The boundary pin carries the name of the primary input or output port.
+string_crt AbsNode::name() const {
+  return pin_ptr()->name();
+}
+
+// Function: is_primary_input
+bool_t AbsNode::is_primary_input() const {
+  return pin_ptr()->is_primary_input();
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+AbsEdge::AbsEdge():
+  _idx(OT_UNDEFINED_IDX),
+  _from_abs_node_ptr(nullptr),
+  _to_abs_node_ptr(nullptr),
+  _is_constraint(false)
+{
+}
+
+// Destructor.
+AbsEdge::~AbsEdge() {
+}
+
+// Function: undefined_value
+// A delay is undefined when it is the undefined arrival time of the split. A setup or hold
+// constraint is relaxed toward the maximum and is undefined at the lowest numeric.
+float_t AbsEdge::undefined_value(int el) const {
+  return is_constraint() ? OT_FLT_MIN : Utility::undefined_at(el);
+}
+
+// Procedure: resize
+// Resize every table to the given number of rows and columns and reset all values to undefined.
+void_t AbsEdge::resize(size_t num_rows, size_t num_cols) {
+  EL_RF_RF_ITER(el, irf, orf) {
+    _value[el][irf][orf].assign(num_rows, float_vt(num_cols, undefined_value(el)));
+    _slew[el][irf][orf].assign(num_rows, float_vt(num_cols, Utility::undefined_slew(el)));
+  }
+}
+
+// Procedure: relax_value
+// Keep the most pessimistic value, which is the largest setup and hold constraint.
+void_t AbsEdge::relax_value(int el, int irf, int orf, size_t i, size_t j, float_ct value) {
+  if(value > _value[el][irf][orf][i][j]) {
+    _value[el][irf][orf][i][j] = value;
+  }
+}
+
+// Function: is_transition_defined
+// The boundary arc is defined for a transition pair if any sweep reached the to pin with it.
+bool_t AbsEdge::is_transition_defined(int el, int irf, int orf) const {
+  for(const auto& row : _value[el][irf][orf]) {
+    for(const auto& value : row) {
+      if(value != undefined_value(el)) return true;
+    }
+  }
+  return false;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+Abstractor::Abstractor(timer_pt timer_ptr):
+  _timer_ptr(timer_ptr),
+  _num_load_slots(0)
+{
+  CHECK(_timer_ptr != nullptr);
+}
+
+// Destructor.
+Abstractor::~Abstractor() {
+}
+
+// Procedure: extract
+// Extract the timing macro. The timing of the timer must be up-to-date such that the rctrees
+// hold the elmore delays and slews used by the characterization sweeps.
+void_t Abstractor::extract() {
+
+  // [BEG INFO]
+  LOG(INFO) << "Extracting timing macro ...";
+  // [END INFO]
+
+  _build_order();
+  _build_boundary();
+  _build_indices();
+
+  // [BEG INFO]
+  LOG(INFO) << "Characterizing " << num_abs_edges() << " boundary arcs on a "
+            << _slew_indices.size() << "x" << _load_indices.size() << " grid";
+  // [END INFO]
+
+  _characterize_clock();
+  _characterize_constraints();
+  _characterize_delays();
+}
+
+// Procedure: _build_order
+// Build the topological order of the timing graph. Sweeps start at the position of their source
+// node and visit only the nodes after it.
+void_t Abstractor::_build_order() {
+
+  nodeset_rt nodeset = _timer_ptr->nodeset();
+  size_t num_indices = nodeset.num_indices();
+
+  int_vt num_fanins(num_indices, 0);
+
+  _order.clear();
+  _order.reserve(nodeset.size());
+  _position.assign(num_indices, OT_UNDEFINED_IDX);
+
+  for(const auto& node_ptr : nodeset) {
+    num_fanins[node_ptr->idx()] = node_ptr->num_fanins();
+    if(node_ptr->num_fanins() == 0) {
+      _position[node_ptr->idx()] = _order.size();
+      _order.push_back(node_ptr);
+    }
+  }
+
+  for(size_t i=0; i<_order.size(); ++i) {
+    for(auto& e : _order[i]->fanout()) {
+      node_pt to_node_ptr = e->to_node_ptr();
+      if(--num_fanins[to_node_ptr->idx()] == 0) {
+        _position[to_node_ptr->idx()] = _order.size();
+        _order.push_back(to_node_ptr);
+      }
+    }
+  }
+
+  CHECK(_order.size() == nodeset.size()) << "Failed to order the timing graph (cycle exception)";
+}
+
+// Procedure: _build_boundary
+// Build the boundary pins and the boundary arcs. Every primary input that sources a clock tree
+// is a clock input. The structural fanout cone of each primary input is searched in parallel,
+// and an arc is created to every primary output in the cone. The cone of a clock input marks
+// the sequential tests whose clock pin it reaches, and a data input gets a constraint arc to
+// each clock input that clocks a test whose data pin is in its cone.
+void_t Abstractor::_build_boundary() {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+  size_t num_indices = _timer_ptr->nodeset().num_indices();
+
+  // Clock inputs.
+  vector < pin_pt > clock_pin_ptrs;
+  for(const auto& clock_tree_uptr : circuit_ptr->clock_tree_uptrs()) {
+    if(clock_tree_uptr->primary_input_ptr()) {
+      clock_pin_ptrs.push_back(clock_tree_uptr->primary_input_ptr()->pin_ptr());
+    }
+  }
+
+  // Boundary pins.
+  vector < abs_node_pt > inputs, outputs;
+  int_vt abs_node_idx(num_indices, OT_UNDEFINED_IDX);
+
+  _clock_abs_node_ptrs.clear();
+
+  for(const auto& item : circuit_ptr->primary_input_dict()) {
+    pin_pt pin_ptr = item.second->pin_ptr();
+    if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+    int_t idx = _abs_nodeset.insert();
+    abs_node_pt abs_node_ptr = _abs_nodeset[idx];
+    abs_node_ptr->set_idx(idx);
+    abs_node_ptr->set_pin_ptr(pin_ptr);
+    if(find(clock_pin_ptrs.begin(), clock_pin_ptrs.end(), pin_ptr) != clock_pin_ptrs.end()) {
+      abs_node_ptr->set_is_clock(true);
+      _clock_abs_node_ptrs.push_back(abs_node_ptr);
+    }
+    inputs.push_back(abs_node_ptr);
+  }
+
+  for(const auto& item : circuit_ptr->primary_output_dict()) {
+    pin_pt pin_ptr = item.second->pin_ptr();
+    if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+    int_t idx = _abs_nodeset.insert();
+    abs_node_pt abs_node_ptr = _abs_nodeset[idx];
+    abs_node_ptr->set_idx(idx);
+    abs_node_ptr->set_pin_ptr(pin_ptr);
+    abs_node_idx[pin_ptr->node_ptr()->idx()] = idx;
+    outputs.push_back(abs_node_ptr);
+  }
+
+  // Sequential tests checked against the clock inputs, indexed by their data and clock pins.
+  int_mt data_tests(num_indices), clock_tests(num_indices);
+  _test_ptrs.clear();
+  if(!_clock_abs_node_ptrs.empty()) {
+    for(const auto& test_ptr : circuit_ptr->testset()) {
+      if(test_ptr->related_node_ptr() == nullptr || test_ptr->constrained_node_ptr() == nullptr) {
+        continue;
+      }
+      data_tests[test_ptr->constrained_node_ptr()->idx()].push_back(_test_ptrs.size());
+      clock_tests[test_ptr->related_node_ptr()->idx()].push_back(_test_ptrs.size());
+      _test_ptrs.push_back(test_ptr);
+    }
+  }
+
+  // Search the fanout cone of each input in parallel. A clock input collects the tests whose
+  // clock pin is in its cone and a data input the tests whose data pin is in its cone.
+  int_mt cone_outputs(inputs.size());
+  int_mt cone_tests(inputs.size());
+
+  #pragma omp parallel
+  {
+    size_vt stamps(num_indices, 0);
+
+    #pragma omp for schedule(dynamic, 1)
+    for(size_t p=0; p<inputs.size(); ++p) {
+      node_pt source_ptr = inputs[p]->pin_ptr()->node_ptr();
+      size_t stamp = p + 1;
+      stamps[source_ptr->idx()] = stamp;
+      for(size_t i=_position[source_ptr->idx()]; i<_order.size(); ++i) {
+        node_pt node_ptr = _order[i];
+        if(stamps[node_ptr->idx()] != stamp) continue;
+        if(abs_node_idx[node_ptr->idx()] != OT_UNDEFINED_IDX) {
+          cone_outputs[p].push_back(abs_node_idx[node_ptr->idx()]);
+        }
+        const auto& tests = inputs[p]->is_clock() ? clock_tests[node_ptr->idx()] : 
+                                                    data_tests[node_ptr->idx()];
+        cone_tests[p].insert(cone_tests[p].end(), tests.begin(), tests.end());
+        for(auto& e : node_ptr->fanout()) {
+          if(e->edge_type() == CONSTRAINT_EDGE_TYPE) continue;
+          stamps[e->to_node_ptr()->idx()] = stamp;
+        }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  // Clock inputs of each test.
+  int_mt test_clocks(_test_ptrs.size());
+  for(size_t c=0, p=0; p<inputs.size(); ++p) {
+    if(!inputs[p]->is_clock()) continue;
+    for(const auto& t : cone_tests[p]) {
+      test_clocks[t].push_back(c);
+    }
+    ++c;
+  }
+
+  // Boundary arcs.
+  for(size_t p=0; p<inputs.size(); ++p) {
+    for(const auto& idx : cone_outputs[p]) {
+      _insert_abs_edge(inputs[p], _abs_nodeset[idx], false);
+    }
+    if(inputs[p]->is_clock()) continue;
+    int_vt is_clocked(_clock_abs_node_ptrs.size(), 0);
+    for(const auto& t : cone_tests[p]) {
+      for(const auto& c : test_clocks[t]) {
+        if(is_clocked[c]) continue;
+        is_clocked[c] = 1;
+        _insert_abs_edge(inputs[p], _clock_abs_node_ptrs[c], true);
+      }
+    }
+  }
+}
+
+// Procedure: _build_indices
+// Build the grids of the input slew and the output load. The grids are evenly spaced from zero
+// up to the largest transition and capacitance index among the lut templates of the late
+// library, extended to cover the slews asserted at the primary inputs and the loads asserted
+// at the primary outputs.
+void_t Abstractor::_build_indices() {
+
+  float_t max_slew(OT_FLT_ZERO), max_load(OT_FLT_ZERO);
+
+  celllib_pt celllib_ptr = _timer_ptr->celllib_ptr(LATE);
+
+  for(const auto& item : *celllib_ptr->lut_template_dict_ptr()) {
+    lut_template_pt lut_template_ptr = item.second;
+    if(LUTTemplate::is_transition_variable(lut_template_ptr->variable1())) {
+      for(const auto& v : lut_template_ptr->indices1()) max_slew = max(max_slew, v);
+    }
+    if(LUTTemplate::is_transition_variable(lut_template_ptr->variable2())) {
+      for(const auto& v : lut_template_ptr->indices2()) max_slew = max(max_slew, v);
+    }
+    if(LUTTemplate::is_capacitance_variable(lut_template_ptr->variable1())) {
+      for(const auto& v : lut_template_ptr->indices1()) max_load = max(max_load, v);
+    }
+    if(LUTTemplate::is_capacitance_variable(lut_template_ptr->variable2())) {
+      for(const auto& v : lut_template_ptr->indices2()) max_load = max(max_load, v);
+    }
+  }
+
+  for(const auto& item : _timer_ptr->circuit_ptr()->primary_input_dict()) {
+    EL_RF_ITER(el, rf) {
+      max_slew = max(max_slew, item.second->slew(el, rf));
+    }
+  }
+
+  for(const auto& item : _timer_ptr->circuit_ptr()->primary_output_dict()) {
+    EL_RF_ITER(el, rf) {
+      max_load = max(max_load, item.second->load(el, rf));
+    }
+  }
+
+  if(max_slew <= OT_FLT_ZERO) max_slew = OT_DEFAULT_ABS_MAX_SLEW;
+  if(max_load <= OT_FLT_ZERO) max_load = OT_DEFAULT_ABS_MAX_LOAD;
+
+  _slew_indices.resize(OT_DEFAULT_ABS_LUT_SIZE);
+  _load_indices.resize(OT_DEFAULT_ABS_LUT_SIZE);
+
+  for(size_t i=0; i<OT_DEFAULT_ABS_LUT_SIZE; ++i) {
+    _slew_indices[i] = max_slew * i / (OT_DEFAULT_ABS_LUT_SIZE - 1);
+    _load_indices[i] = max_load * i / (OT_DEFAULT_ABS_LUT_SIZE - 1);
+  }
+
+  for(const auto& e : _abs_edgeset) {
+    if(e->is_constraint()) e->resize(_slew_indices.size(), _slew_indices.size());
+    else e->resize(_slew_indices.size(), _load_indices.size());
+  }
+}
+
+// Procedure: _characterize_clock
+// Sweep every clock input over both edges and the slew grid and record the arrival time and the
+// slew at the clock pin of every sequential test it reaches. The values of clock c at slew k are
+// stored at (c*num_slews + k)*num_tests + t. These are combined with the data sweeps to
+// characterize the setup and hold checks.
+void_t Abstractor::_characterize_clock() {
+
+  if(_clock_abs_node_ptrs.empty() || _test_ptrs.empty()) return;
+
+  size_t num_clocks = _clock_abs_node_ptrs.size();
+  size_t num_tests = _test_ptrs.size();
+  size_t num_slews = _slew_indices.size();
+  size_t num_indices = _timer_ptr->nodeset().num_indices();
+
+  RF_RF_ITER(ck, rf) {
+    EL_ITER(el) {
+      _clock_at[ck][el][rf].assign(num_clocks * num_slews * num_tests, Utility::undefined_at(el));
+      _clock_slew[ck][el][rf].assign(num_clocks * num_slews * num_tests, Utility::undefined_slew(el));
+    }
+  }
+
+  #pragma omp parallel
+  {
+    size_vt stamps(num_indices, 0);
+    float_vt at[2][2], slew[2][2];
+    EL_RF_ITER(el, rf) {
+      at[el][rf].resize(num_indices);
+      slew[el][rf].resize(num_indices);
+    }
+
+    #pragma omp for schedule(dynamic, 1)
+    for(size_t s=0; s<num_clocks*2*num_slews; ++s) {
+
+      size_t c = s / (2*num_slews);
+      int ck = (s / num_slews) % 2;
+      size_t k = s % num_slews;
+      node_pt source_ptr = _clock_abs_node_ptrs[c]->pin_ptr()->node_ptr();
+
+      _sweep(source_ptr, ck, _slew_indices[k], OT_UNDEFINED_IDX, s + 1, stamps, at, slew);
+
+      for(size_t t=0; t<num_tests; ++t) {
+        size_t idx = _test_ptrs[t]->related_node_ptr()->idx();
+        if(stamps[idx] != s + 1) continue;
+        EL_RF_ITER(el, rf) {
+          _clock_at[ck][el][rf][(c*num_slews + k)*num_tests + t] = at[el][rf][idx];
+          _clock_slew[ck][el][rf][(c*num_slews + k)*num_tests + t] = slew[el][rf][idx];
+        }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _characterize_constraints
+// Sweep every data input that reaches a sequential test over both transitions and the slew grid
+// and characterize its setup and hold constraints with respect to each clock input it has a
+// constraint arc to. Only the tests reached by that clock input contribute. With the clock
+// arriving at the clock input at time zero, the setup constraint of a test is the setup
+// time plus the late data arrival minus the early clock arrival at the test, and the hold
+// constraint is the hold time plus the late clock arrival minus the early data arrival. The
+// constraint of the data input is the worst over all tests in its fanout cone.
+void_t Abstractor::_characterize_constraints() {
+
+  if(_clock_abs_node_ptrs.empty() || _test_ptrs.empty()) return;
+
+  vector < abs_edge_pt > edges;
+  size_vt clocks;
+  for(const auto& e : _abs_edgeset) {
+    if(!e->is_constraint()) continue;
+    edges.push_back(e);
+    clocks.push_back(
+      find(_clock_abs_node_ptrs.begin(), _clock_abs_node_ptrs.end(), e->to_abs_node_ptr()) - 
+      _clock_abs_node_ptrs.begin()
+    );
+  }
+
+  size_t num_tests = _test_ptrs.size();
+  size_t num_slews = _slew_indices.size();
+  size_t num_sweeps = edges.size() * 2 * num_slews;
+  size_t num_indices = _timer_ptr->nodeset().num_indices();
+
+  #pragma omp parallel
+  {
+    size_vt stamps(num_indices, 0);
+    float_vt at[2][2], slew[2][2];
+    EL_RF_ITER(el, rf) {
+      at[el][rf].resize(num_indices);
+      slew[el][rf].resize(num_indices);
+    }
+
+    #pragma omp for schedule(dynamic, 1)
+    for(size_t s=0; s<num_sweeps; ++s) {
+
+      abs_edge_pt e = edges[s / (2*num_slews)];
+      size_t c = clocks[s / (2*num_slews)];
+      int irf = (s / num_slews) % 2;
+      size_t i = s % num_slews;
+
+      _sweep(
+        e->from_abs_node_ptr()->pin_ptr()->node_ptr(), irf, _slew_indices[i], OT_UNDEFINED_IDX, 
+        s + 1, stamps, at, slew
+      );
+
+      for(size_t t=0; t<num_tests; ++t) {
+
+        test_pt test_ptr = _test_ptrs[t];
+        size_t D = test_ptr->constrained_node_ptr()->idx();
+
+        if(stamps[D] != s + 1) continue;
+
+        EL_ITER(el) {
+
+          timing_arc_pt timing_arc_ptr = test_ptr->timing_arc_ptr(el);
+
+          if(timing_arc_ptr == nullptr || !timing_arc_ptr->is_constraint()) continue;
+
+          int rrf = timing_arc_ptr->is_rising_edge_triggered() ? RISE : FALL;
+
+          RF_ITER(drf) {
+
+            if(!timing_arc_ptr->is_transition_defined(rrf, drf)) continue;
+            if(at[el][drf][D] == Utility::undefined_at(el)) continue;
+
+            RF_ITER(ck) {
+              for(size_t k=0; k<num_slews; ++k) {
+
+                float_t ck_at = _clock_at[ck][!el][rrf][(c*num_slews + k)*num_tests + t];
+                float_t ck_slew = _clock_slew[ck][!el][rrf][(c*num_slews + k)*num_tests + t];
+
+                if(ck_at == Utility::undefined_at(!el)) continue;
+
+                float_t constraint = timing_arc_ptr->constraint(rrf, drf, ck_slew, slew[el][drf][D]);
+
+                if(el == EARLY) {
+                  e->relax_value(el, ck, irf, i, k, constraint + ck_at - at[el][drf][D]);
+                }
+                else {
+                  e->relax_value(el, ck, irf, i, k, constraint + at[el][drf][D] - ck_at);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _characterize_loads
+// Tabulate the rc timing of every net driving a primary output over the load grid. For each
+// point of the grid, the leaf capacitance of every primary output on the net is moved to the
+// grid load as the timer asserts an output load, and only the rctree of the net is updated. The
+// elmore delay and the impulse at each pin and the load seen by the driver are stored at
+// j*num_slots + slot, where the slot of a pin is found by its node. A net without a rctree has
+// no wire delay and its driver sees the total leaf capacitance. The capacitances are restored
+// and the rctrees are updated back at the end, leaving the timer as it was.
+void_t Abstractor::_characterize_loads() {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+  size_t num_loads = _load_indices.size();
+
+  _load_slot.assign(_timer_ptr->nodeset().num_indices(), OT_UNDEFINED_IDX);
+  _num_load_slots = 0;
+
+  // Nets driving primary outputs.
+  vector < net_pt > nets;
+  for(const auto& item : circuit_ptr->primary_output_dict()) {
+    pin_pt pin_ptr = item.second->pin_ptr();
+    if(pin_ptr == nullptr || pin_ptr->net_ptr() == nullptr) continue;
+    pin_pt root_pin_ptr = pin_ptr->net_ptr()->root_pin_ptr();
+    if(root_pin_ptr == nullptr || root_pin_ptr->node_ptr() == nullptr) continue;
+    if(_load_slot[root_pin_ptr->node_ptr()->idx()] != OT_UNDEFINED_IDX) continue;
+    for(const auto& net_pin_ptr : pin_ptr->net_ptr()->pinlist()) {
+      if(net_pin_ptr->node_ptr() == nullptr) continue;
+      _load_slot[net_pin_ptr->node_ptr()->idx()] = _num_load_slots++;
+    }
+    nets.push_back(pin_ptr->net_ptr());
+  }
+
+  EL_RF_ITER(el, rf) {
+    _load_delay[el][rf].assign(num_loads * _num_load_slots, OT_FLT_ZERO);
+    _load_impulse[el][rf].assign(num_loads * _num_load_slots, OT_FLT_ZERO);
+    _load_cap[el][rf].assign(num_loads * _num_load_slots, OT_FLT_ZERO);
+  }
+
+  for(const auto& net_ptr : nets) {
+
+    rctree_pt rctree_ptr = net_ptr->rctree_ptr();
+    vector < primary_output_pt > pos;
+    float_vt caps[2][2];
+
+    for(const auto& pin_ptr : net_ptr->pinlist()) {
+      if(pin_ptr->primary_output_ptr() == nullptr) continue;
+      pos.push_back(pin_ptr->primary_output_ptr());
+      EL_RF_ITER(el, rf) {
+        caps[el][rf].push_back(pin_ptr->rctree_node_ptr() ? pin_ptr->rctree_node_ptr()->cap(el, rf) : OT_FLT_ZERO);
+      }
+    }
+
+    for(size_t j=0; j<num_loads; ++j) {
+
+      // Move the leaf capacitance of the primary outputs to the grid load.
+      float_t delta[2][2] = {{OT_FLT_ZERO, OT_FLT_ZERO}, {OT_FLT_ZERO, OT_FLT_ZERO}};
+      for(size_t p=0; p<pos.size(); ++p) {
+        EL_RF_ITER(el, rf) {
+          float_t d = _load_indices[j] - pos[p]->load(el, rf);
+          delta[el][rf] += d;
+          if(rctree_ptr && pos[p]->pin_ptr()->rctree_node_ptr()) {
+            rctree_ptr->set_cap(pos[p]->pin_ptr()->rctree_node_ptr(), el, rf, caps[el][rf][p] + d);
+          }
+        }
+      }
+
+      if(rctree_ptr) rctree_ptr->update_rc_timing();
+
+      for(const auto& pin_ptr : net_ptr->pinlist()) {
+        if(pin_ptr->node_ptr() == nullptr) continue;
+        size_t slot = j*_num_load_slots + _load_slot[pin_ptr->node_ptr()->idx()];
+        EL_RF_ITER(el, rf) {
+          if(rctree_ptr && pin_ptr->rctree_node_ptr()) {
+            _load_delay[el][rf][slot] = pin_ptr->rctree_node_ptr()->delay(el, rf);
+            _load_impulse[el][rf][slot] = pin_ptr->rctree_node_ptr()->impulse(el, rf);
+            _load_cap[el][rf][slot] = pin_ptr->rctree_node_ptr()->load(el, rf);
+          }
+          else if(pin_ptr->is_rctree_root()) {
+            _load_cap[el][rf][slot] = net_ptr->total_leaf_cap(el, rf) + delta[el][rf];
+          }
+          else {
+            _load_cap[el][rf][slot] = pin_ptr->load(el, rf);
+          }
+        }
+      }
+    }
+
+    // Restore the leaf capacitance of the primary outputs.
+    if(rctree_ptr == nullptr) continue;
+    for(size_t p=0; p<pos.size(); ++p) {
+      if(pos[p]->pin_ptr()->rctree_node_ptr() == nullptr) continue;
+      EL_RF_ITER(el, rf) {
+        rctree_ptr->set_cap(pos[p]->pin_ptr()->rctree_node_ptr(), el, rf, caps[el][rf][p]);
+      }
+    }
+    rctree_ptr->update_rc_timing();
+  }
+}
+
+// Procedure: _characterize_delays
+// Characterize the delay and the output slew of every arc from a primary input to a primary
+// output. Every primary input is swept over both transitions, the slew grid, and the load grid
+// in parallel, where the nets driving primary outputs take their rc timing at the grid load
+// from the tables of _characterize_loads.
+void_t Abstractor::_characterize_delays() {
+
+  _characterize_loads();
+
+  vector < abs_node_pt > inputs;
+  for(const auto& abs_node_ptr : _abs_nodeset) {
+    if(abs_node_ptr->is_primary_input() && abs_node_ptr->fanout().size()) {
+      inputs.push_back(abs_node_ptr);
+    }
+  }
+
+  size_t num_slews = _slew_indices.size();
+  size_t num_loads = _load_indices.size();
+  size_t num_points = 2 * num_slews * num_loads;
+  size_t num_sweeps = inputs.size() * num_points;
+  size_t num_indices = _timer_ptr->nodeset().num_indices();
+
+  #pragma omp parallel
+  {
+    size_vt stamps(num_indices, 0);
+    float_vt at[2][2], slew[2][2];
+    EL_RF_ITER(el, rf) {
+      at[el][rf].resize(num_indices);
+      slew[el][rf].resize(num_indices);
+    }
+
+    #pragma omp for schedule(dynamic, 1)
+    for(size_t s=0; s<num_sweeps; ++s) {
+
+      abs_node_pt abs_node_ptr = inputs[s / num_points];
+      int irf = (s / (num_slews*num_loads)) % 2;
+      size_t i = (s / num_loads) % num_slews;
+      size_t j = s % num_loads;
+
+      _sweep(abs_node_ptr->pin_ptr()->node_ptr(), irf, _slew_indices[i], j, s + 1, stamps, at, slew);
+
+      for(auto& e : abs_node_ptr->fanout()) {
+
+        if(e->is_constraint()) continue;
+
+        size_t idx = e->to_abs_node_ptr()->pin_ptr()->node_ptr()->idx();
+
+        if(stamps[idx] != s + 1) continue;
+
+        EL_RF_ITER(el, orf) {
+          if(at[el][orf][idx] == Utility::undefined_at(el)) continue;
+          e->set_value(el, irf, orf, i, j, at[el][orf][idx]);
+          e->set_slew(el, irf, orf, i, j, slew[el][orf][idx]);
+        }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _sweep
+// Propagate the slew and the arrival time from a source node with a given transition, zero
+// arrival time, and a given slew through the timing graph in topological order. The propagation
+// follows the forward propagation of the timer except that only the nodes reached from the
+// source contribute. Given a point of the load grid, the nets driving primary outputs take their
+// rc timing and driver load from the tables of that point instead of the timer. A node is reached by the sweep when its stamp equals the given stamp, and
+// the timing of a node is valid only if the node is reached.
+void_t Abstractor::_sweep(
+  node_pt source_ptr,
+  int source_rf,
+  float_ct source_slew,
+  int load_idx,
+  size_t stamp,
+  size_vrt stamps,
+  float_vt at[][2],
+  float_vt slew[][2]
+) const {
+
+  // Mark a node reached and reset its timing.
+  auto reach = [&] (size_t idx) {
+    if(stamps[idx] == stamp) return;
+    stamps[idx] = stamp;
+    EL_RF_ITER(el, rf) {
+      at[el][rf][idx] = Utility::undefined_at(el);
+      slew[el][rf][idx] = Utility::undefined_slew(el);
+    }
+  };
+
+  // Relax the timing of a node with a propagated value.
+  auto relax = [&] (size_t idx, int el, int rf, float_ct a, float_ct s) {
+    if(el == EARLY) {
+      if(a < at[el][rf][idx]) at[el][rf][idx] = a;
+      if(s < slew[el][rf][idx]) slew[el][rf][idx] = s;
+    }
+    else {
+      if(a > at[el][rf][idx]) at[el][rf][idx] = a;
+      if(s > slew[el][rf][idx]) slew[el][rf][idx] = s;
+    }
+  };
+
+  // Slot of a pin of a net driving primary outputs at the load grid point.
+  auto load_slot = [&] (size_t idx) -> int {
+    if(load_idx == OT_UNDEFINED_IDX || _load_slot[idx] == OT_UNDEFINED_IDX) return OT_UNDEFINED_IDX;
+    return load_idx * _num_load_slots + _load_slot[idx];
+  };
+
+  reach(source_ptr->idx());
+  EL_ITER(el) {
+    at[el][source_rf][source_ptr->idx()] = OT_FLT_ZERO;
+    slew[el][source_rf][source_ptr->idx()] = source_slew;
+  }
+
+  rctree_pt rctree_ptr;
+  timing_arc_pt timing_arc_ptr;
+  int slot;
+
+  for(size_t i=_position[source_ptr->idx()]; i<_order.size(); ++i) {
+
+    node_pt from_node_ptr = _order[i];
+    size_t u = from_node_ptr->idx();
+
+    if(stamps[u] != stamp) continue;
+
+    for(auto& e : from_node_ptr->fanout()) {
+
+      node_pt to_node_ptr = e->to_node_ptr();
+      size_t v = to_node_ptr->idx();
+
+      switch(e->edge_type()) {
+
+        // Case 1: RC tree propagation.
+        case RCTREE_EDGE_TYPE:
+          reach(v);
+          rctree_ptr = e->net_ptr()->rctree_ptr();
+          slot = load_slot(v);
+          EL_RF_ITER(el, rf) {
+            if(at[el][rf][u] == Utility::undefined_at(el)) continue;
+            if(rctree_ptr == nullptr) {
+              relax(v, el, rf, at[el][rf][u], slew[el][rf][u]);
+            }
+            else if(slot != OT_UNDEFINED_IDX) {
+              float_t si = slew[el][rf][u];
+              float_t so = sqrt(OT_SQUARE(si) + _load_impulse[el][rf][slot]);
+              relax(v, el, rf, at[el][rf][u] + _load_delay[el][rf][slot], si < OT_FLT_ZERO ? -so : so);
+            }
+            else {
+              rctree_node_pt rctree_node_ptr = to_node_ptr->pin_ptr()->rctree_node_ptr();
+              relax(
+                v, el, rf,
+                at[el][rf][u] + rctree_node_ptr->delay(el, rf),
+                rctree_ptr->slew(rctree_node_ptr, el, rf, slew[el][rf][u])
+              );
+            }
+          }
+        break;
+
+        // Case 2: Combinational propagation.
+        case COMBINATIONAL_EDGE_TYPE:
+          reach(v);
+          slot = load_slot(v);
+          EL_RF_RF_ITER(el, irf, orf) {
+            timing_arc_ptr = e->timing_arc_ptr(el);
+            if(!timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+            if(at[el][irf][u] == Utility::undefined_at(el)) continue;
+            float_t CL = slot == OT_UNDEFINED_IDX ? to_node_ptr->pin_ptr()->load(el, orf) : 
+                                                   _load_cap[el][orf][slot];
+            float_t si = slew[el][irf][u];
+            relax(
+              v, el, orf,
+              at[el][irf][u] + timing_arc_ptr->delay(irf, orf, si, CL),
+              timing_arc_ptr->slew(irf, orf, si, CL)
+            );
+          }
+        break;
+
+        // Case 3: Constraint.
+        default:
+        break;
+      }
+    }
+  }
+}
+
+// Function: _insert_abs_edge
+// Insert a boundary arc between two boundary pins.
+abs_edge_pt Abstractor::_insert_abs_edge(abs_node_pt from, abs_node_pt to, bool_ct is_constraint) {
+  int_t idx = _abs_edgeset.insert();
+  abs_edge_pt abs_edge_ptr = _abs_edgeset[idx];
+  abs_edge_ptr->set_idx(idx);
+  abs_edge_ptr->set_from_abs_node_ptr(from);
+  abs_edge_ptr->set_to_abs_node_ptr(to);
+  abs_edge_ptr->set_is_constraint(is_constraint);
+  from->insert_fanout(abs_edge_ptr);
+  return abs_edge_ptr;
+}
+
+// Procedure: build_celllib
+// Build the early or late model library of the macro. The library has a single cell named after
+// the macro with one pin per boundary pin. The input pin capacitance is the load seen at the
+// primary input. A delay arc from the clock input is rising- or falling-edge triggered if only
+// that clock edge reaches the output; other delay arcs are combinational with the timing sense
+// given by the transitions they propagate. Since a liberty table is indexed by the output
+// transition only, the table of a non-unate arc takes the worst over the input transitions.
+// The early library carries the hold checks and the late library the setup checks.
+void_t Abstractor::build_celllib(int el, string_crt name, celllib_pt celllib_ptr) {
+
+  celllib_ptr->set_name(name);
+  celllib_ptr->set_library_type(el == EARLY ? LibraryType::EARLY_LIBRARY : LibraryType::LATE_LIBRARY);
+
+  // Lut templates.
+  lut_template_pt delay_template_ptr = celllib_ptr->insert_lut_template("delay_template");
+  delay_template_ptr->set_variable1(INPUT_NET_TRANSITION);
+  delay_template_ptr->set_variable2(TOTAL_OUTPUT_NET_CAPACITANCE);
+  for(const auto& v : _slew_indices) delay_template_ptr->insert_index1(v);
+  for(const auto& v : _load_indices) delay_template_ptr->insert_index2(v);
+
+  lut_template_pt constraint_template_ptr = celllib_ptr->insert_lut_template("constraint_template");
+  constraint_template_ptr->set_variable1(CONSTRAINED_PIN_TRANSITION);
+  constraint_template_ptr->set_variable2(RELATED_PIN_TRANSITION);
+  for(const auto& v : _slew_indices) constraint_template_ptr->insert_index1(v);
+  for(const auto& v : _slew_indices) constraint_template_ptr->insert_index2(v);
+
+  // Fill a lut from the tables of an edge at the given transitions. The worst value over the
+  // given input transitions is taken, and an undefined entry falls back to zero.
+  auto fill = [&] (timing_lut_pt lut_ptr, lut_template_pt lut_template_ptr, int_ct rfs[2],
+                   abs_edge_pt e, bool_t is_slew, int orf) {
+    size_t n1 = lut_template_ptr->size1();
+    size_t n2 = lut_template_ptr->size2();
+    lut_ptr->resize(n1, n2);
+    lut_ptr->set_lut_template_ptr(lut_template_ptr);
+    for(size_t i=0; i<n1; ++i) lut_ptr->assign_index1(i, lut_template_ptr->indices1()[i]);
+    for(size_t j=0; j<n2; ++j) lut_ptr->assign_index2(j, lut_template_ptr->indices2()[j]);
+    for(size_t i=0; i<n1; ++i) {
+      for(size_t j=0; j<n2; ++j) {
+        float_t worst = is_slew ? Utility::undefined_slew(el) : e->undefined_value(el);
+        for(int r=0; r<2; ++r) {
+          if(rfs[r] == OT_UNDEFINED_IDX) continue;
+          float_t v = is_slew ? e->slew(el, rfs[r], orf, i, j) : e->value(el, rfs[r], orf, i, j);
+          worst = (el == EARLY && !e->is_constraint()) ? min(worst, v) : max(worst, v);
+        }
+        if(worst == (is_slew ? Utility::undefined_slew(el) : e->undefined_value(el))) {
+          worst = OT_FLT_ZERO;
+        }
+        lut_ptr->assign_value(i, j, worst);
+      }
+    }
+  };
+
+  // Insert a timing group to a cellpin and map its transitions to the timing arc.
+  auto insert_timing = [&] (cellpin_pt cellpin_ptr, string_crt from, timing_type_ce type,
+                            timing_sense_ce sense) {
+    timing_pt timing_ptr = cellpin_ptr->insert_timing();
+    timing_ptr->set_to_cellpin_name(cellpin_ptr->name());
+    timing_ptr->set_from_cellpin_name(from);
+    timing_ptr->set_timing_type(type);
+    timing_ptr->set_timing_sense(sense);
+    return timing_ptr;
+  };
+
+  auto insert_timing_arc = [&] (cellpin_pt cellpin_ptr, timing_pt timing_ptr) {
+    timing_arc_pt timing_arc_ptr = cellpin_ptr->insert_timing_arc(timing_ptr->from_cellpin_name());
+    timing_arc_ptr->set_to_cellpin_name(timing_ptr->to_cellpin_name());
+    RF_RF_ITER(irf, orf) {
+      if(timing_ptr->is_transition_defined(irf, orf)) {
+        timing_arc_ptr->set_timing_ptr(irf, orf, timing_ptr);
+      }
+    }
+  };
+
+  cell_pt cell_ptr = celllib_ptr->insert_cell(name);
+
+  // Boundary pins.
+  for(const auto& abs_node_ptr : _abs_nodeset) {
+    cellpin_pt cellpin_ptr = cell_ptr->insert_cellpin(abs_node_ptr->name());
+    if(abs_node_ptr->is_primary_input()) {
+      pin_pt pin_ptr = abs_node_ptr->pin_ptr();
+      cellpin_ptr->set_direction(INPUT_CELLPIN_DIRECTION);
+      cellpin_ptr->set_capacitance(max(pin_ptr->load(el, RISE), pin_ptr->load(el, FALL)));
+      cellpin_ptr->set_is_clock(abs_node_ptr->is_clock());
+    }
+    else {
+      cellpin_ptr->set_direction(OUTPUT_CELLPIN_DIRECTION);
+    }
+  }
+
+  // Boundary arcs. The transitions are classified with the late tables such that the early and
+  // late models carry the same arcs.
+  for(const auto& e : _abs_edgeset) {
+
+    bool_t is_defined[2][2];
+    RF_RF_ITER(irf, orf) {
+      is_defined[irf][orf] = e->is_transition_defined(LATE, irf, orf);
+    }
+
+    // Case 1: setup/hold check of a data input against a clock edge.
+    if(e->is_constraint()) {
+
+      cellpin_pt cellpin_ptr = cell_ptr->cellpin_ptr(e->from_abs_node_ptr()->name());
+
+      RF_ITER(ck) {
+
+        if(!is_defined[ck][RISE] && !is_defined[ck][FALL]) continue;
+
+        timing_type_e type;
+        if(el == EARLY) type = (ck == RISE) ? TimingType::HOLD_RISING : TimingType::HOLD_FALLING;
+        else type = (ck == RISE) ? TimingType::SETUP_RISING : TimingType::SETUP_FALLING;
+
+        timing_pt timing_ptr = insert_timing(cellpin_ptr, e->to_abs_node_ptr()->name(), type, NON_UNATE);
+        int_t rfs[2] = {ck, OT_UNDEFINED_IDX};
+
+        RF_ITER(drf) {
+          int_t orf = is_defined[ck][drf] ? drf : !drf;
+          timing_lut_pt lut_ptr = drf == RISE ? timing_ptr->rise_constraint_ptr() :
+                                                timing_ptr->fall_constraint_ptr();
+          fill(lut_ptr, constraint_template_ptr, rfs, e, false, orf);
+        }
+
+        insert_timing_arc(cellpin_ptr, timing_ptr);
+      }
+    }
+    // Case 2: delay arc to a primary output.
+    else {
+
+      if(!is_defined[RISE][RISE] && !is_defined[RISE][FALL] &&
+         !is_defined[FALL][RISE] && !is_defined[FALL][FALL]) continue;
+
+      cellpin_pt cellpin_ptr = cell_ptr->cellpin_ptr(e->to_abs_node_ptr()->name());
+
+      bool_t is_rise = is_defined[RISE][RISE] || is_defined[RISE][FALL];
+      bool_t is_fall = is_defined[FALL][RISE] || is_defined[FALL][FALL];
+
+      timing_type_e type = TimingType::COMBINATIONAL;
+      timing_sense_e sense = NON_UNATE;
+
+      if(e->from_abs_node_ptr()->is_clock() && is_rise != is_fall) {
+        type = is_rise ? TimingType::RISING_EDGE : TimingType::FALLING_EDGE;
+      }
+      else if(!is_defined[RISE][FALL] && !is_defined[FALL][RISE]) {
+        sense = POSITIVE_UNATE;
+      }
+      else if(!is_defined[RISE][RISE] && !is_defined[FALL][FALL]) {
+        sense = NEGATIVE_UNATE;
+      }
+
+      timing_pt timing_ptr = insert_timing(cellpin_ptr, e->from_abs_node_ptr()->name(), type, sense);
+
+      RF_ITER(orf) {
+        int_t o = (is_defined[RISE][orf] || is_defined[FALL][orf]) ? orf : !orf;
+        int_t rfs[2] = {
+          is_defined[RISE][o] ? RISE : OT_UNDEFINED_IDX,
+          is_defined[FALL][o] ? FALL : OT_UNDEFINED_IDX
+        };
+        fill(orf == RISE ? timing_ptr->cell_rise_ptr() : timing_ptr->cell_fall_ptr(),
+             delay_template_ptr, rfs, e, false, o);
+        fill(orf == RISE ? timing_ptr->rise_transition_ptr() : timing_ptr->fall_transition_ptr(),
+             delay_template_ptr, rfs, e, true, o);
+      }
+
+      insert_timing_arc(cellpin_ptr, timing_ptr);
+    }
+  }
+}
+
+// Procedure: write
+// Build the early and late model libraries in parallel and write them to the files
+// <name>_early.lib and <name>_late.lib.
+void_t Abstractor::write(string_crt name) {
+
+  celllib_t celllib[2];
+
+  #pragma omp parallel for schedule(static, 1)
+  for(int el=0; el<2; ++el) {
+    build_celllib(el, name, &celllib[el]);
+    celllib[el].write(name + (el == EARLY ? "_early.lib" : "_late.lib"));
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  // [BEG INFO]
+  LOG(INFO) << "Timing macro written to " << name << "_early.lib and " << name << "_late.lib";
+  // [END INFO]
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
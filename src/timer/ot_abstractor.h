@@ -0,0 +1,298 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_ABSTRACTOR_H_
+#define OT_ABSTRACTOR_H_
+
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: AbsNode
+// An abs node is a boundary pin of the timing macro, i.e., a primary input or a primary output
+// of the design being abstracted.
+class AbsNode {
+
+  public:
+
+    AbsNode();                                                      // Constructor.
+    ~AbsNode();                                                     // Destructor.
+
+    inline int_t idx() const;                                       // Query the idx.
+    inline pin_pt pin_ptr() const;                                  // Query the pin pointer.
+    inline abs_edgelist_rt fanout();                                // Query the fanout edges.
+
+    inline bool_t is_clock() const;                                 // Query the clock status.
+
+    inline void_t set_idx(int_ct);                                  // Set the idx.
+    inline void_t set_pin_ptr(pin_pt);                              // Set the pin pointer.
+    inline void_t set_is_clock(bool_ct);                            // Set the clock status.
+    inline void_t insert_fanout(abs_edge_pt);                       // Insert a fanout edge.
+
+    string_crt name() const;                                        // Query the name.
+    bool_t is_primary_input() const;                                // Query the pi status.
+
+  private:
+
+    int_t _idx;                                                     // Index.
+
+    pin_pt _pin_ptr;                                                // Boundary pin.
+
+    bool_t _is_clock;                                               // Clock port.
+
+    abs_edgelist_t _fanout;                                         // Fanout edges.
+};
+
+// Function: idx
+inline int_t AbsNode::idx() const {
+  return _idx;
+}
+
+// Function: pin_ptr
+inline pin_pt AbsNode::pin_ptr() const {
+  return _pin_ptr;
+}
+
+// Function: fanout
+inline abs_edgelist_rt AbsNode::fanout() {
+  return _fanout;
+}
+
+// Function: is_clock
+inline bool_t AbsNode::is_clock() const {
+  return _is_clock;
+}
+
+// Procedure: set_idx
+inline void_t AbsNode::set_idx(int_ct idx) {
+  _idx = idx;
+}
+
+// Procedure: set_pin_ptr
+inline void_t AbsNode::set_pin_ptr(pin_pt pin_ptr) {
+  _pin_ptr = pin_ptr;
+}
+
+// Procedure: set_is_clock
+inline void_t AbsNode::set_is_clock(bool_ct flag) {
+  _is_clock = flag;
+}
+
+// Procedure: insert_fanout
+inline void_t AbsNode::insert_fanout(abs_edge_pt abs_edge_ptr) {
+  _fanout.push_back(abs_edge_ptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: AbsEdge
+// An abs edge is a boundary-to-boundary timing arc of the macro. A delay edge connects a primary
+// input to a primary output and stores, per split and input/output transition, the delay and
+// the output slew tables indexed by the input slew and the output load. A constraint edge
+// connects a data input to the clock input of its domain and stores the setup (late) and hold (early) tables
+// indexed by the data slew and the clock slew, where the input transition is the clock edge
+// and the output transition is the data transition.
+class AbsEdge {
+
+  public:
+
+    AbsEdge();                                                      // Constructor.
+    ~AbsEdge();                                                     // Destructor.
+
+    inline int_t idx() const;                                       // Query the idx.
+    inline abs_node_pt from_abs_node_ptr() const;                   // Query the from node.
+    inline abs_node_pt to_abs_node_ptr() const;                     // Query the to node.
+
+    inline bool_t is_constraint() const;                            // Query the constraint status.
+
+    inline float_t value(int, int, int, size_t, size_t) const;      // Query the delay/constraint.
+    inline float_t slew(int, int, int, size_t, size_t) const;       // Query the output slew.
+
+    inline void_t set_idx(int_ct);                                  // Set the idx.
+    inline void_t set_from_abs_node_ptr(abs_node_pt);               // Set the from node.
+    inline void_t set_to_abs_node_ptr(abs_node_pt);                 // Set the to node.
+    inline void_t set_is_constraint(bool_ct);                       // Set the constraint status.
+    inline void_t set_value(int, int, int, size_t, size_t, float_ct);  // Set the delay.
+    inline void_t set_slew(int, int, int, size_t, size_t, float_ct);   // Set the output slew.
+
+    void_t resize(size_t, size_t);                                  // Resize the tables.
+    void_t relax_value(int, int, int, size_t, size_t, float_ct);    // Relax the constraint.
+
+    float_t undefined_value(int) const;                             // Query the undefined value.
+
+    bool_t is_transition_defined(int, int, int) const;              // Query the transition status.
+
+  private:
+
+    int_t _idx;                                                     // Index.
+
+    abs_node_pt _from_abs_node_ptr;                                 // From boundary pin.
+    abs_node_pt _to_abs_node_ptr;                                   // To boundary pin.
+
+    bool_t _is_constraint;                                          // Constraint edge.
+
+    float_mt _value[2][2][2];                                       // Delay/constraint (el/irf/orf).
+    float_mt _slew[2][2][2];                                        // Output slew (el/irf/orf).
+};
+
+// Function: idx
+inline int_t AbsEdge::idx() const {
+  return _idx;
+}
+
+// Function: from_abs_node_ptr
+inline abs_node_pt AbsEdge::from_abs_node_ptr() const {
+  return _from_abs_node_ptr;
+}
+
+// Function: to_abs_node_ptr
+inline abs_node_pt AbsEdge::to_abs_node_ptr() const {
+  return _to_abs_node_ptr;
+}
+
+// Function: is_constraint
+inline bool_t AbsEdge::is_constraint() const {
+  return _is_constraint;
+}
+
+// Function: value
+inline float_t AbsEdge::value(int el, int irf, int orf, size_t i, size_t j) const {
+  return _value[el][irf][orf][i][j];
+}
+
+// Function: slew
+inline float_t AbsEdge::slew(int el, int irf, int orf, size_t i, size_t j) const {
+  return _slew[el][irf][orf][i][j];
+}
+
+// Procedure: set_idx
+inline void_t AbsEdge::set_idx(int_ct idx) {
+  _idx = idx;
+}
+
+// Procedure: set_from_abs_node_ptr
+inline void_t AbsEdge::set_from_abs_node_ptr(abs_node_pt abs_node_ptr) {
+  _from_abs_node_ptr = abs_node_ptr;
+}
+
+// Procedure: set_to_abs_node_ptr
+inline void_t AbsEdge::set_to_abs_node_ptr(abs_node_pt abs_node_ptr) {
+  _to_abs_node_ptr = abs_node_ptr;
+}
+
+// Procedure: set_is_constraint
+inline void_t AbsEdge::set_is_constraint(bool_ct flag) {
+  _is_constraint = flag;
+}
+
+// Procedure: set_value
+inline void_t AbsEdge::set_value(int el, int irf, int orf, size_t i, size_t j, float_ct value) {
+  _value[el][irf][orf][i][j] = value;
+}
+
+// Procedure: set_slew
+inline void_t AbsEdge::set_slew(int el, int irf, int orf, size_t i, size_t j, float_ct slew) {
+  _slew[el][irf][orf][i][j] = slew;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: Abstractor
+// The abstractor extracts a timing macro model of the design loaded in a timer. The boundary
+// arcs (primary input to primary output, primary input to the setup/hold check against each
+// clock input, and clock input to primary output) are characterized over a grid of input slews
+// and output loads. Each characterization sweep propagates the slew and the arrival time from
+// a single primary input with a single transition and a single output load through the timing
+// graph of the timer in topological order using its own workspace, so sweeps are independent
+// and run in parallel. Only the nets driving primary outputs see the output load, and their rc
+// timing is tabulated over the load grid once before the sweeps.
+class Abstractor {
+
+  public:
+
+    Abstractor(timer_pt);                                           // Constructor.
+    ~Abstractor();                                                  // Destructor.
+
+    inline size_t num_abs_nodes() const;                            // Query the abs node count.
+    inline size_t num_abs_edges() const;                            // Query the abs edge count.
+
+    inline float_cvrt slew_indices() const;                         // Query the slew indices.
+    inline float_cvrt load_indices() const;                         // Query the load indices.
+
+    void_t extract();                                               // Extract the macro.
+    void_t build_celllib(int, string_crt, celllib_pt);              // Build a model library.
+    void_t write(string_crt);                                       // Write the model libraries.
+
+  private:
+
+    timer_pt _timer_ptr;                                            // Timer.
+
+    vector < abs_node_pt > _clock_abs_node_ptrs;                    // Clock inputs.
+
+    abs_nodeset_t _abs_nodeset;                                     // Boundary pins.
+    abs_edgeset_t _abs_edgeset;                                     // Boundary arcs.
+
+    node_ptr_vt _order;                                             // Topological order.
+    int_vt _position;                                               // Node position in the order.
+
+    test_ptr_vt _test_ptrs;                                         // Sequential tests.
+
+    float_vt _slew_indices;                                         // Input slew grid.
+    float_vt _load_indices;                                         // Output load grid.
+
+    float_vt _clock_at[2][2][2];                                    // Clock pin at (edge/el/rf).
+    float_vt _clock_slew[2][2][2];                                  // Clock pin slew (edge/el/rf).
+
+    int_vt _load_slot;                                              // Output net pin slot.
+    size_t _num_load_slots;                                         // Output net pin count.
+    float_vt _load_delay[2][2];                                     // Output net pin delay (el/rf).
+    float_vt _load_impulse[2][2];                                   // Output net pin impulse (el/rf).
+    float_vt _load_cap[2][2];                                       // Output net pin load (el/rf).
+
+    void_t _build_order();                                          // Build the topological order.
+    void_t _build_boundary();                                       // Build the boundary graph.
+    void_t _build_indices();                                        // Build the slew/load grids.
+    void_t _characterize_clock();                                   // Sweep the clock input.
+    void_t _characterize_constraints();                             // Sweep the setup/hold checks.
+    void_t _characterize_loads();                                   // Sweep the output nets.
+    void_t _characterize_delays();                                  // Sweep the delay arcs.
+    void_t _sweep(node_pt, int, float_ct, int, size_t, size_vrt, float_vt[][2], float_vt[][2]) const;
+
+    abs_edge_pt _insert_abs_edge(abs_node_pt, abs_node_pt, bool_ct);  // Insert a boundary arc.
+};
+
+// Function: num_abs_nodes
+inline size_t Abstractor::num_abs_nodes() const {
+  return _abs_nodeset.size();
+}
+
+// Function: num_abs_edges
+inline size_t Abstractor::num_abs_edges() const {
+  return _abs_edgeset.size();
+}
+
+// Function: slew_indices
+inline float_cvrt Abstractor::slew_indices() const {
+  return _slew_indices;
+}
+
+// Function: load_indices
+inline float_cvrt Abstractor::load_indices() const {
+  return _load_indices;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
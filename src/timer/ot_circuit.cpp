@@ -22,9 +22,10 @@ Circuit::Circuit():
   _gate_dict_uptr(new gate_dict_t(OT_DEFAULT_INSTANCE_DICTIONARY_SIZE)),
   _primary_input_dict_uptr (new primary_input_dict_t()),
   _primary_output_dict_uptr(new primary_output_dict_t()),
-  _clock_tree_uptr(new clock_tree_t()),
   _testset_uptr(new testset_t())
 {
+  _clock_tree_uptrs.emplace_back(new clock_tree_t());
+  _is_clock_network_overlapped = false;
 }
 
 // Destructor
@@ -72,6 +73,142 @@ pin_pt Circuit::clock_tree_root_pin_ptr() const {
   return clock_tree_ptr()->root_pin_ptr();
 }
 
+// Function: clock_tree_ptr
+// Query the clock tree (clock domain) that drives the given node. Nodes outside any clock tree
+// fall back to the default clock tree.
+clock_tree_pt Circuit::clock_tree_ptr(node_pt node_ptr) const {
+  if(node_ptr == nullptr || node_ptr->clock_tree_ptr() == nullptr) return clock_tree_ptr();
+  return node_ptr->clock_tree_ptr();
+}
+
+// Function: root_clock_tree_ptr
+// Query the clock tree that is rooted at the given pin, or nullptr if the pin is not a clock
+// source.
+clock_tree_pt Circuit::root_clock_tree_ptr(pin_pt pin_ptr) const {
+  if(pin_ptr == nullptr) return nullptr;
+  for(const auto& clock_tree_uptr : _clock_tree_uptrs) {
+    if(clock_tree_uptr->root_pin_ptr() == pin_ptr) return clock_tree_uptr.get();
+  }
+  return nullptr;
+}
+
+// Function: insert_clock_tree
+// Insert a clock tree rooted at the given primary input. The first clock defined in the design
+// takes over the default clock tree; a clock redefined on the same primary input only updates
+// the period. The clock network of a new domain is checked against those of the other domains,
+// and an overlap is reported and makes the clock trees update serially.
+clock_tree_pt Circuit::insert_clock_tree(primary_input_pt pi_ptr, float_ct period) {
+
+  CHECK(pi_ptr != nullptr);
+
+  auto clock_tree_ptr = root_clock_tree_ptr(pi_ptr->pin_ptr());
+
+  if(clock_tree_ptr == nullptr) {
+    if(_clock_tree_uptrs.front()->primary_input_ptr() == nullptr) {
+      clock_tree_ptr = _clock_tree_uptrs.front().get();
+    }
+    else {
+      _clock_tree_uptrs.emplace_back(new clock_tree_t());
+      clock_tree_ptr = _clock_tree_uptrs.back().get();
+    }
+    clock_tree_ptr->set_primary_input_ptr(pi_ptr);
+
+    for(const auto& clock_tree_uptr : _clock_tree_uptrs) {
+      if(clock_tree_uptr.get() == clock_tree_ptr) continue;
+      if(auto pin_ptr = _clock_network_overlap_pin_ptr(clock_tree_uptr.get(), clock_tree_ptr)) {
+        LOG(WARNING) << "Clock networks of " + clock_tree_uptr->primary_input_ptr()->name() + " and "
+                     + pi_ptr->name() + " overlap at " + pin_ptr->name() 
+                     + " (clock trees are updated serially)";
+        _is_clock_network_overlapped = true;
+      }
+    }
+  }
+
+  clock_tree_ptr->set_period(period);
+
+  return clock_tree_ptr;
+}
+
+// Function: _clock_network_overlap_pin_ptr
+// Return a pin that is reached by the clock networks of both given clock trees, or nullptr if the
+// networks are disjoint. A clock network is the fanout of the clock root up to the clock sinks,
+// which is the node set a clock tree claims when it is built.
+pin_pt Circuit::_clock_network_overlap_pin_ptr(clock_tree_pt a, clock_tree_pt b) const {
+
+  if(a->root_node_ptr() == nullptr || b->root_node_ptr() == nullptr) return nullptr;
+
+  unordered_set < node_pt > network;
+
+  // Visit the clock network of a clock tree, and return the first node the visitor accepts.
+  auto visit = [&] (clock_tree_pt clock_tree_ptr, function < bool_t(node_pt) > visitor) {
+    unordered_set < node_pt > visited {clock_tree_ptr->root_node_ptr()};
+    node_ptr_vt stack {clock_tree_ptr->root_node_ptr()};
+    while(!stack.empty()) {
+      auto u = stack.back();
+      stack.pop_back();
+      if(visitor(u)) return u;
+      if(u->is_clock_sink()) continue;
+      for(const auto& e : u->fanout()) {
+        if(visited.insert(e->to_node_ptr()).second) stack.push_back(e->to_node_ptr());
+      }
+    }
+    return (node_pt)nullptr;
+  };
+
+  visit(a, [&] (node_pt u) { network.insert(u); return false; });
+
+  auto node_ptr = visit(b, [&] (node_pt u) { return network.count(u) != 0; });
+
+  return node_ptr ? node_ptr->pin_ptr() : nullptr;
+}
+
+// Procedure: update_clock_trees
+// Update all clock trees that are out of date. Nodes owned by trees pending a full rebuild are
+// released in one sweep over the node set, and then each clock tree rebuilds (or locally updates)
+// its Euler tour and sparse table. The trees are updated independently in parallel, which
+// assumes the clock networks of different domains are disjoint, since a tree claims every node
+// of its network. The networks are checked when the trees are inserted, and overlapping networks
+// are updated serially in the insertion order, so a shared node belongs to the last such tree.
+void_t Circuit::update_clock_trees() const {
+
+  clock_tree_ptr_vt clock_tree_ptrs;
+  bool_t is_rebuild_pending(false);
+
+  for(const auto& clock_tree_uptr : _clock_tree_uptrs) {
+    if(clock_tree_uptr->is_clock_tree_unupdated() && clock_tree_uptr->root_node_ptr()) {
+      clock_tree_ptrs.push_back(clock_tree_uptr.get());
+      is_rebuild_pending |= clock_tree_uptr->is_clock_tree_rebuild_pending();
+    }
+  }
+
+  if(clock_tree_ptrs.empty()) return;
+
+  auto nodeset_ptr = clock_tree_ptrs.front()->root_node_ptr()->nodeset_ptr();
+
+  if(is_rebuild_pending) {
+    #pragma omp parallel for
+    for(size_t i=0; i<nodeset_ptr->num_indices(); ++i) {
+      auto node_ptr = (*nodeset_ptr)[i];
+      if(node_ptr == nullptr || node_ptr->clock_tree_ptr() == nullptr) continue;
+      if(!node_ptr->clock_tree_ptr()->is_clock_tree_rebuild_pending()) continue;
+      node_ptr->set_clock_tree_node_idx(OT_UNDEFINED_IDX);
+      node_ptr->set_clock_tree_ptr(nullptr);
+    } // Implicit synchronization barrier. --------------------------------------------------------
+  }
+  
+  if(is_clock_network_overlapped()) {
+    for(auto clock_tree_ptr : clock_tree_ptrs) {
+      clock_tree_ptr->update_clock_tree();
+    }
+    return;
+  }
+  
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(size_t i=0; i<clock_tree_ptrs.size(); ++i) {
+    clock_tree_ptrs[i]->update_clock_tree();
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
 // Function: insert_test
 // Insert a test into the circuit.
 test_pt Circuit::insert_test(string_crt from_pin_name, string_crt to_pin_name, timing_arc_pt timing_arc_ptr[]) const {
@@ -57,6 +57,10 @@ class Circuit {
     inline gate_dict_pt gate_dict_ptr() const;                                  // Query the gate dictionary pointer.
 
     inline clock_tree_pt clock_tree_ptr() const;                                // Query the clock source pointer.
+    inline clock_tree_upt_cvrt clock_tree_uptrs() const;                        // Query all clock trees.
+
+    clock_tree_pt clock_tree_ptr(node_pt) const;                                // Query the clock domain of a node.
+    clock_tree_pt root_clock_tree_ptr(pin_pt) const;                            // Query the clock tree rooted at a pin.
 
     inline primary_input_pt primary_input_ptr(string_crt) const;                // Query the pi pointer.
     inline primary_input_dict_pt primary_input_dict_ptr() const;                // Query the pi dictionary pointer.
@@ -75,6 +79,8 @@ class Circuit {
     inline size_t num_primary_inputs() const;                                   // Query the PI count.
     inline size_t num_primary_outputs() const;                                  // Query the PO count.
     inline size_t num_tests() const;                                            // Query the test count.
+    inline size_t num_clock_trees() const;                                      // Query the clock tree count.
+    inline bool_t is_clock_network_overlapped() const;                          // Query the clock network overlap.
   
     void_t remove_pin(string_crt) const;                                        // Remove a pin.
     void_t remove_net(string_crt) const;                                        // Remove a net.
@@ -97,6 +103,10 @@ class Circuit {
     test_pt insert_test(pin_pt, pin_pt, timing_arc_pt[]) const;                 // Insert a test.
     test_pt insert_test(pin_pt) const;                                          // Insert a test.
 
+    clock_tree_pt insert_clock_tree(primary_input_pt, float_ct);                // Insert a clock tree.
+
+    void_t update_clock_trees() const;                                          // Update all clock trees.
+
   private:
     
     string_t _name;                                                             // Name of the circuit.
@@ -107,8 +117,11 @@ class Circuit {
     gate_dict_upt _gate_dict_uptr;                                              // Gate dictionary.
     primary_input_dict_upt _primary_input_dict_uptr;                            // Primary input dictionary.
     primary_output_dict_upt _primary_output_dict_uptr;                          // Primary output dictionary.
-    clock_tree_upt _clock_tree_uptr;                                            // Clock source.
+    clock_tree_upt_vt _clock_tree_uptrs;                                        // Clock trees (domains).
     testset_upt _testset_uptr;                                                  // Constraint set.
+    bool_t _is_clock_network_overlapped;                                        // Clock network overlap.
+
+    pin_pt _clock_network_overlap_pin_ptr(clock_tree_pt, clock_tree_pt) const;  // Query the overlap pin.
 };
 
 // Function: name
@@ -202,8 +215,26 @@ inline gate_dict_pt Circuit::gate_dict_ptr() const {
 }
 
 // Function: clock_tree_ptr
+// Query the default clock tree, which is the first clock defined in the design.
 inline clock_tree_pt Circuit::clock_tree_ptr() const {
-  return _clock_tree_uptr.get();
+  return _clock_tree_uptrs.front().get();
+}
+
+// Function: clock_tree_uptrs
+inline clock_tree_upt_cvrt Circuit::clock_tree_uptrs() const {
+  return _clock_tree_uptrs;
+}
+
+// Function: num_clock_trees
+// Query the number of clock trees (clock domains).
+inline size_t Circuit::num_clock_trees() const {
+  return _clock_tree_uptrs.size();
+}
+
+// Function: is_clock_network_overlapped
+// Query if the clock networks of two domains have been found overlapping.
+inline bool_t Circuit::is_clock_network_overlapped() const {
+  return _is_clock_network_overlapped;
 }
 
 // Function: num_pins
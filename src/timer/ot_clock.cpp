@@ -19,6 +19,7 @@ namespace __OpenTimer {
 ClockTree::ClockTree() {
   _size = 0;
   _level = -1;
+  _num_blocks = 0;
   _primary_input_ptr = nullptr;
   _period = OT_DEFAULT_CLOCK_SOURCE_PERIOD;
   _is_clock_tree_updated = false;
@@ -43,67 +44,278 @@ int_t ClockTree::level(pin_pt pin_ptr) const {
 // Query the level of a clock tree node.
 int_t ClockTree::level(node_pt node_ptr) const {
   
-  if(node_ptr == nullptr || node_ptr->is_in_clock_tree() == false) {
+  if(node_ptr == nullptr || node_ptr->clock_tree_ptr() != this) {
     return OT_UNDEFINED_LEVEL;
   }
   
   return _L[node_ptr->clock_tree_node_idx()];
 }
 
+// Function: parent_node_ptr
+// Return the parent of a given clock tree node, or nullptr if the node is the root or is not in
+// the clock tree. The parent is the fanin one level above the node in the same clock tree.
+node_pt ClockTree::parent_node_ptr(node_pt node_ptr) const {
+
+  auto l = level(node_ptr);
+
+  if(l == OT_UNDEFINED_LEVEL || l == 0) return nullptr;
+
+  for(auto& e : node_ptr->fanin()) {
+    if(level(e->from_node_ptr()) == l - 1) return e->from_node_ptr();
+  }
+
+  return nullptr;
+}
+
 // Function: num_negations
 // Query the number of negations from the root to a given clock tree node.
 int_t ClockTree::num_negations(node_pt node_ptr) const {
   
-  if(node_ptr == nullptr || node_ptr->is_in_clock_tree() == false) {
+  if(node_ptr == nullptr || node_ptr->clock_tree_ptr() != this) {
     return 0;
   }
 
   return _N[node_ptr->clock_tree_node_idx()];
 }
 
+// Procedure: enable_clock_subtree_update
+// Enable the update of the clock subtree rooted at a given node. The subtree is re-traversed and
+// spliced into the Euler tour by the next update, leaving the rest of the clock tree untouched.
+void_t ClockTree::enable_clock_subtree_update(node_pt node_ptr) {
+  
+  // The entire clock tree will be rebuilt anyway.
+  if(is_clock_tree_rebuild_pending()) return;
+
+  if(node_ptr == nullptr || node_ptr->clock_tree_ptr() != this || node_ptr == root_node_ptr()) {
+    enable_clock_tree_update();
+    return;
+  }
+
+  _dirty_subtree_idxs.push_back(node_ptr->idx());
+}
+
 // Procedure: update_clock_tree
 // This procedure builds the parameters for the clock tree. The parameters include the LUT
-// of the sparse table for LCA retrieval.
+// of the sparse table for LCA retrieval. The caller is responsible for releasing the nodes
+// that were previously owned by this clock tree before a full rebuild (see 
+// Circuit::update_clock_trees), so that the clock trees of different domains can be rebuilt
+// independently. Edits confined to clock subtrees are updated locally.
 void_t ClockTree::update_clock_tree() {
 
   // No update needed if the clock tree has been updated.
   if(is_clock_tree_updated()) return;
 
-  node_pt _root(root_node_ptr());
+  if(!root_node_ptr()) return;
+  
+  if(is_clock_tree_rebuild_pending()) _rebuild_clock_tree();
+  else _update_clock_subtrees();
+
+  _dirty_subtree_idxs.clear();
+  
+  set_is_clock_tree_updated(true);
+}
+
+// Procedure: _rebuild_clock_tree
+// Rebuild the Euler tour and the sparse table of the entire clock tree.
+void_t ClockTree::_rebuild_clock_tree() {
 
-  if(!_root) return;
+  int_vt F;
   
   // Clear all the data storages.
-  for(const auto& u : *(_root->nodeset_ptr())) {
-    u->set_clock_tree_node_idx(OT_UNDEFINED_IDX);
-  }
-  _level = -1;
-  _size = 0;
   __clear_vector(_E);
   __clear_vector(_L);
   __clear_vector(_N);
-  __clear_matrix(_ST);
+  __clear_vector(_M);
+  __clear_vector(_ST);
 
-  _traverse(nullptr, _root, 0, 0);
-  _update_sparse_table();     
+  _traverse(root_node_ptr(), 0, 0, _E, _L, _N, F);
 
-  set_is_clock_tree_updated(true);
+  for(const auto& f : F) {
+    _E[f]->set_clock_tree_node_idx(f);
+    _E[f]->set_clock_tree_ptr(this);
+  }
+
+  _size = F.size();
+  _level = _L.empty() ? -1 : *std::max_element(_L.begin(), _L.end());
+
+  _update_sparse_table(0);     
 }
 
-// Procedure: _traverse
-// This procedure Builds the index of Euler path for clock tree traversal.
-void_t ClockTree::_traverse(node_pt p, node_pt u, int_ct d, int_ct n)
-{
-  _size = _size + 1;             // Increment the clock tree size.
+// Procedure: _update_clock_subtrees
+// Update the clock tree by re-traversing only the dirty subtrees. A subtree occupies a contiguous
+// span of the Euler tour that starts at the first occurrence of its root, so each dirty span is
+// released, re-traversed, and spliced into the tour. Clean spans are only shifted, and the sparse
+// table is rebuilt from the first modified position onwards.
+void_t ClockTree::_update_clock_subtrees() {
 
-  int_t is_negative_unate(0);
+  auto nodeset_ptr = root_node_ptr()->nodeset_ptr();
 
-  if(u->is_clock_sink()) {       // Reach the sink.
-    _insert_ELHN(u, d, n);
+  // A rebuild is needed for an empty tour.
+  if(_E.empty()) {
+    _rebuild_clock_tree();
     return;
   }
+  
+  // Collect the spans [beg, end) of the dirty subtrees that are still in the clock tree.
+  vector < pair<size_t, size_t> > spans;
+
+  for(const auto& idx : _dirty_subtree_idxs) {
+    auto node_ptr = (*nodeset_ptr)[idx];
+    if(node_ptr == nullptr || node_ptr->clock_tree_ptr() != this) continue;
+    auto beg = (size_t)node_ptr->clock_tree_node_idx();
+    spans.emplace_back(beg, _subtree_end(beg));
+  }
+
+  if(spans.empty()) return;
+
+  // Spans in an Euler tour are either nested or disjoint. Keep only the outermost ones.
+  std::sort(spans.begin(), spans.end());
+
+  size_t num_spans(0);
+  for(size_t i=0; i<spans.size(); ++i) {
+    if(num_spans && spans[i].first < spans[num_spans-1].second) continue;
+    spans[num_spans++] = spans[i];
+  }
+  spans.resize(num_spans);
+
+  // Release the nodes of the dirty spans. Nodes that are still reachable from the subtree roots
+  // are claimed again by the traversal below.
+  node_ptr_vt roots(num_spans);
+  int_vt depths(num_spans), negations(num_spans);
+
+  for(size_t i=0; i<num_spans; ++i) {
+    roots[i] = _E[spans[i].first];
+    depths[i] = _L[spans[i].first];
+    negations[i] = _N[spans[i].first];
+    for(size_t j=spans[i].first; j<spans[i].second; ++j) {
+      _E[j]->set_clock_tree_node_idx(OT_UNDEFINED_IDX);
+      _E[j]->set_clock_tree_ptr(nullptr);
+    }
+  }
+
+  // Splice the clean spans and the re-traversed dirty spans into a new tour.
+  node_ptr_vt E;
+  int_vt L, N, F;
+
+  E.reserve(_E.size());
+  L.reserve(_L.size());
+  N.reserve(_N.size());
+
+  size_t prev(0);
+  
+  for(size_t i=0; i<=num_spans; ++i) {
+
+    auto next = (i == num_spans) ? _E.size() : spans[i].first;
+    
+    // Clean span: shift the occurrence index of every node. A node first occurs where the tour
+    // steps down into it.
+    for(size_t j=prev; j<next; ++j) {
+      if(j == 0 || _L[j] > _L[j-1]) {
+        _E[j]->set_clock_tree_node_idx(E.size());
+      }
+      E.push_back(_E[j]);
+      L.push_back(_L[j]);
+      N.push_back(_N[j]);
+    }
+
+    if(i == num_spans) break;
+
+    // Dirty span: re-traverse the subtree.
+    auto offset = E.size();
+
+    // Every node of the old subtree is likewise entered by one step down in the tour.
+    for(size_t j=spans[i].first+1; j<spans[i].second; ++j) {
+      if(_L[j] > _L[j-1]) --_size;
+    }
+    --_size;
+    
+    F.clear();
+    _traverse(roots[i], depths[i], negations[i], E, L, N, F);
+
+    for(const auto& f : F) {
+      E[offset + f]->set_clock_tree_node_idx(offset + f);
+      E[offset + f]->set_clock_tree_ptr(this);
+    }
+
+    _size += F.size();
+    prev = spans[i].second;
+  }
 
-  for(auto& e : u->fanout()) {
+  _E.swap(E);
+  _L.swap(L);
+  _N.swap(N);
+  
+  _level = *std::max_element(_L.begin(), _L.end());
+
+  _update_sparse_table(spans.front().first);
+}
+
+// Function: _subtree_end
+// Return the end (exclusive) of the Euler tour span of the subtree whose root first occurs at
+// the given position. Within the span only the root resides at the depth of the root, so the
+// span ends right before the tour returns above that depth.
+size_t ClockTree::_subtree_end(size_t beg) const {
+  auto end = beg + 1;
+  while(end < _L.size() && _L[end] >= _L[beg]) ++end;
+  return end;
+}
+
+// Procedure: _traverse
+// This procedure Builds the index of Euler path for clock tree traversal starting at a given
+// subtree root of a given depth and negation count. The traversal is iterative with an explicit
+// stack so that deep clock trees do not overflow the call stack. The position of the first
+// occurrence of each visited node is stored in F.
+void_t ClockTree::_traverse(
+  node_pt root, int_ct depth, int_ct negations, 
+  node_ptr_vrt E, int_vrt L, int_vrt N, int_vrt F
+) {
+
+  // Stack frame of the traversal, which mimics the recursive call.
+  struct Frame {
+    node_pt u;
+    int_t d;
+    int_t n;
+    edgelist_t::iter_t iter;
+  };
+
+  auto base = E.size();
+
+  auto insert_ELN = [&] (node_pt u, int_ct d, int_ct n) {
+    E.push_back(u);
+    L.push_back(d);
+    N.push_back(n);
+  };
+
+  vector <Frame> stack;
+
+  // Enter a node: record the first occurrence and expand the node unless it is a sink.
+  auto enter = [&] (node_pt u, int_ct d, int_ct n) {
+    F.push_back(E.size() - base);
+    if(u->is_clock_sink()) {
+      insert_ELN(u, d, n);
+    }
+    else {
+      stack.push_back(Frame{u, d, n, u->fanout().begin()});
+    }
+  };
+
+  enter(root, depth, negations);
+
+  while(!stack.empty()) {
+
+    auto& f = stack.back();
+
+    // All fanouts have been visited.
+    if(!(f.iter != f.u->fanout().end())) {
+      insert_ELN(f.u, f.d, f.n);
+      stack.pop_back();
+      continue;
+    }
+
+    auto e = *f.iter;
+    ++f.iter;
+    
+    int_t is_negative_unate(0);
 
     // Keep track of the negation count.
     switch(e->timing_sense()) {
@@ -124,24 +336,10 @@ void_t ClockTree::_traverse(node_pt p, node_pt u, int_ct d, int_ct n)
       break;
     }
     
-    // Go to the next tree node.
-    _insert_ELHN(u, d, n);                          
-    _traverse(u, e->to_node_ptr(), d + 1, n + is_negative_unate);            
+    // Go to the next tree node. Notice that the frame reference is invalidated by the push.
+    insert_ELN(f.u, f.d, f.n);
+    enter(e->to_node_ptr(), f.d + 1, f.n + is_negative_unate);
   }
-
-  _insert_ELHN(u, d, n);                
-}
-
-// Procedure: _insert_ELHN
-void_t ClockTree::_insert_ELHN(node_pt node_ptr, int_ct depth, int_ct num_negations)
-{
-  if(node_ptr->clock_tree_node_idx() == OT_UNDEFINED_IDX) {
-    node_ptr->set_clock_tree_node_idx((int_t)_E.size());
-  }
-  _E.push_back(node_ptr);
-  _L.push_back(depth);
-  _N.push_back(num_negations);
-  _level = max(_level, depth);
 }
 
 // Function: lca_node_ptr
@@ -150,7 +348,7 @@ node_pt ClockTree::lca_node_ptr(node_pt u, node_pt v) const {
   
   if(u == nullptr || v == nullptr) return nullptr;
 
-  if(!u->is_in_clock_tree() || !v->is_in_clock_tree()) return nullptr;
+  if(u->clock_tree_ptr() != this || v->clock_tree_ptr() != this) return nullptr;
 
   if(u == v) return u;
 
@@ -158,11 +356,44 @@ node_pt ClockTree::lca_node_ptr(node_pt u, node_pt v) const {
     swap(u, v);
   }
 
-  int_t c = log2(v->clock_tree_node_idx() - u->clock_tree_node_idx() + 1);
-  int_t l = _ST[u->clock_tree_node_idx()][c];
-  int_t r = _ST[v->clock_tree_node_idx()-(1<<c)+1][c];
+  return _E[_rmq(u->clock_tree_node_idx(), v->clock_tree_node_idx())];
+}
+
+// Function: _argmin
+// Return the tour position of the shallower one of two given positions.
+int_t ClockTree::_argmin(int_ct l, int_ct r) const {
+  return _L[l] <= _L[r] ? l : r;
+}
+
+// Function: _block_rmq
+// Return the tour position of the minimum level in the range [l, r] within a single block. The
+// mask of r marks the positions on the minimum stack of its block, and the lowest marked position
+// at or after l is the minimum of the range.
+int_t ClockTree::_block_rmq(size_t l, size_t r) const {
+  size_t beg = l - l % OT_LCA_BLOCK_SIZE;
+  return beg + __builtin_ctzll(_M[r] & (~bitmask_t(0) << (l - beg)));
+}
+
+// Function: _rmq
+// Return the tour position of the minimum level in the range [l, r]. The range is split into two
+// partial blocks answered by the bitmasks and a run of full blocks answered by the sparse table.
+int_t ClockTree::_rmq(size_t l, size_t r) const {
+
+  size_t bl = l / OT_LCA_BLOCK_SIZE;
+  size_t br = r / OT_LCA_BLOCK_SIZE;
+
+  if(bl == br) return _block_rmq(l, r);
+
+  int_t p = _argmin(
+    _block_rmq(l, (bl + 1) * OT_LCA_BLOCK_SIZE - 1), _block_rmq(br * OT_LCA_BLOCK_SIZE, r)
+  );
+
+  if(bl + 1 < br) {
+    int_t k = 63 - __builtin_clzll(br - bl - 1);
+    p = _argmin(p, _argmin(_ST[k*_num_blocks + bl + 1], _ST[k*_num_blocks + br - (1<<k)]));
+  }
 
-  return _L[l] < _L[r] ? _E[l] : _E[r]; 
+  return p;
 }
 
 // Function: lca_node_ptr
@@ -196,28 +427,54 @@ pin_pt ClockTree::root_pin_ptr() const {
 } 
 
 // Procedure: _update_sparse_table
-// Establish the sparse table for storing the LCA information.
-void_t ClockTree::_update_sparse_table()
+// Establish the range-minimum structure over the Euler tour for the LCA retrieval. The tour is
+// split into blocks of 64 positions. Each position keeps a bitmask of the minimum stack of its
+// block, and a flat sparse table is built over the block minima, which takes linear memory and
+// answers queries in constant time. Masks of blocks that lie entirely before the given position
+// are kept as they are.
+void_t ClockTree::_update_sparse_table(size_t beg)
 {
-  unsigned_t sparse_table_len1 = _L.size();                      
-  unsigned_t sparse_table_len2 = (unsigned_t)floor(log2(_L.size())) + 1;    
-  _ST.resize(sparse_table_len1);              
-
-  // Initialize ST for the intervals with length 1. 
-  for(unsigned_t s=0; s < sparse_table_len1; s++) {
-    _ST[s].resize(sparse_table_len2);                       // Resize the sublen
-    _ST[s][0] = s;                                          // Self.
+  size_t N = _L.size();
+  
+  _num_blocks = (N + OT_LCA_BLOCK_SIZE - 1) / OT_LCA_BLOCK_SIZE;
+  _M.resize(N);
+
+  // Update the in-block masks from the block of the given position.
+  for(size_t b=beg/OT_LCA_BLOCK_SIZE; b<_num_blocks; ++b) {
+    size_t s = b * OT_LCA_BLOCK_SIZE;
+    size_t e = min(N, s + OT_LCA_BLOCK_SIZE);
+    bitmask_t stack(0);
+    for(size_t i=s; i<e; ++i) {
+      while(stack && _L[s + 63 - __builtin_clzll(stack)] > _L[i]) {
+        stack &= ~(bitmask_t(1) << (63 - __builtin_clzll(stack)));
+      }
+      stack |= bitmask_t(1) << (i - s);
+      _M[i] = stack;
+    }
   }
 
-  // Bottom-up dynamic programming.
-  for(unsigned_t l=1; l<sparse_table_len2; l++) {           // Iterates through all sublen.
-    for(unsigned_t i = 0; i+(1<<l)-1 < _ST.size(); i++) {   // Iterates through all elements.
-      if(_L[_ST[i][l-1]] < _L[_ST[ i+(1<<(l-1))][l-1]]) {   // Compare left / right interval.
-        _ST[i][l] = _ST[i][l-1];                            // Value in left interval is smaller.
-      }
-      else {
-        _ST[i][l] = _ST[i+(1<<(l-1))][l-1];                 // Value in right interval is smaller.
-      }
+  if(_num_blocks == 0) {
+    __clear_vector(_ST);
+    return;
+  }
+
+  // Build the sparse table over the block minima. The table is small (one entry per block per
+  // level) and is rebuilt in full.
+  size_t K = 64 - __builtin_clzll(_num_blocks);
+  
+  _ST.resize(K * _num_blocks);
+
+  for(size_t b=0; b<_num_blocks; ++b) {
+    size_t s = b * OT_LCA_BLOCK_SIZE;
+    size_t e = min(N, s + OT_LCA_BLOCK_SIZE);
+    _ST[b] = s + __builtin_ctzll(_M[e-1]);
+  }
+
+  for(size_t k=1; k<K; ++k) {
+    for(size_t b=0; b + (1<<k) <= _num_blocks; ++b) {
+      _ST[k*_num_blocks + b] = _argmin(
+        _ST[(k-1)*_num_blocks + b], _ST[(k-1)*_num_blocks + b + (1<<(k-1))]
+      );
     }
   }
 }
@@ -232,8 +489,8 @@ float_t ClockTree::cppr_credit(int el, int lnch_rf, int capt_rf, node_pt lncher,
   
   CHECK(capter != nullptr && lncher != nullptr);
   
-  // Unconnected FF.
-  if(!capter->is_in_clock_tree() || !lncher->is_in_clock_tree()) return OT_FLT_ZERO;
+  // Unconnected FF or launching/capturing FFs in different clock domains.
+  if(capter->clock_tree_ptr() != this || lncher->clock_tree_ptr() != this) return OT_FLT_ZERO;
 
   // Undefined clock tree.
   if(root_pin_ptr() == nullptr) return OT_FLT_ZERO;
@@ -36,11 +36,14 @@ class ClockTree {
     node_pt root_node_ptr() const;                                  // Query the root node pointer.
     node_pt lca_node_ptr(node_pt, node_pt) const;                   // Query the LCA of two nodes.
     node_pt lca_node_ptr(int, int, node_pt, node_pt) const;         // Query the LCA of two nodes.
+    node_pt parent_node_ptr(node_pt) const;                         // Query the parent of a node.
 
     inline void_t set_primary_input_ptr(primary_input_pt);          // Set the pi pointer.
     inline void_t set_period(float_ct);                             // Set the clock period.
     inline void_t set_is_clock_tree_updated(bool_ct);               // Set the update flag.
     inline void_t enable_clock_tree_update();                       // Enable the clock tree update.
+    
+    void_t enable_clock_subtree_update(node_pt);                    // Enable a clock subtree update.
 
     inline int_t level() const;                                     // Level of the clock tree.
     
@@ -58,16 +61,21 @@ class ClockTree {
 
     inline bool_t is_clock_tree_updated() const;                    // Query the update status.
     inline bool_t is_clock_tree_unupdated() const;                  // Query the update status.
+    inline bool_t is_clock_tree_rebuild_pending() const;            // Query the full rebuild status.
     
   private:
     
     int_t _level;                                                   // Clock tree level.
     int_vt _L;                                                      // Level of the ith visited node.
     int_vt _N;                                                      // Negation count of the ith visited node.
-    int_mt _ST;                                                     // Sparse table.
+    bitmask_vt _M;                                                  // In-block minimum stack masks.
+    int_vt _ST;                                                     // Sparse table of block minima.
+    size_t _num_blocks;                                             // Number of Euler tour blocks.
 
     bool_t _is_clock_tree_updated;                                  // Update flag.
 
+    int_vt _dirty_subtree_idxs;                                     // Roots (node idx) of dirty subtrees.
+
     node_ptr_vt _E;                                                 // The ith visited node.
 
     size_t _size;                                                   // Clock tree size.
@@ -75,9 +83,18 @@ class ClockTree {
     float_t _period;                                                // Clock period.
     primary_input_pt _primary_input_ptr;                            // Primary input pointer (root).
     
-    void_t _traverse(node_pt, node_pt, int_ct, int_ct);             // Traverse the clock tree.
-    void_t _update_sparse_table();                                  // Update the sparse table.
-    void_t _insert_ELHN(node_pt, int_ct, int_ct);                   // Insert new entries to E/L/H/N table.
+    void_t _rebuild_clock_tree();                                   // Rebuild the entire clock tree.
+    void_t _update_clock_subtrees();                                // Update the dirty clock subtrees.
+    void_t _traverse(                                               // Traverse a clock (sub)tree.
+      node_pt, int_ct, int_ct, node_ptr_vrt, int_vrt, int_vrt, int_vrt
+    );
+    void_t _update_sparse_table(size_t);                            // Update the sparse table.
+
+    int_t _argmin(int_ct, int_ct) const;                            // Query the shallower tour position.
+    int_t _block_rmq(size_t, size_t) const;                         // Query the in-block RMQ.
+    int_t _rmq(size_t, size_t) const;                               // Query the tour RMQ.
+
+    size_t _subtree_end(size_t) const;                              // Query the end of a subtree span.
 };
 
 // Function: primary_input_ptr
@@ -102,7 +119,14 @@ inline int_t ClockTree::level() const {
 
 // Function: is_clock_tree_updated
 inline bool_t ClockTree::is_clock_tree_updated() const {
-  return _is_clock_tree_updated;
+  return _is_clock_tree_updated && _dirty_subtree_idxs.empty();
+}
+
+// Function: is_clock_tree_rebuild_pending
+// Return true if the clock tree must be rebuilt from the root, in which case every node owned
+// by this clock tree is released before the rebuild.
+inline bool_t ClockTree::is_clock_tree_rebuild_pending() const {
+  return !_is_clock_tree_updated;
 }
 
 // Function: is_clock_tree_updated
@@ -128,6 +152,7 @@ inline void_t ClockTree::set_period(float_ct period) {
 // Procedure: enable_clock_tree_update
 inline void_t ClockTree::enable_clock_tree_update() {
   set_is_clock_tree_updated(false);
+  _dirty_subtree_idxs.clear();
 }
 
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
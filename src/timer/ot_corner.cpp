@@ -0,0 +1,110 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_corner.h"
+#include "ot_celllib.h"
+#include "ot_iterator.h"
+#include "ot_pin.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+Corner::Corner(string_crt name, size_t idx):
+  _name(name),
+  _idx(idx),
+  _res_scale(OT_FLT_ONE),
+  _cap_scale(OT_FLT_ONE),
+  _wns{ {OT_FLT_ZERO, OT_FLT_ZERO}, {OT_FLT_ZERO, OT_FLT_ZERO} },
+  _tns{ {OT_FLT_ZERO, OT_FLT_ZERO}, {OT_FLT_ZERO, OT_FLT_ZERO} },
+  _is_timing_updated(false),
+  _is_bound(true)
+{
+  _celllib_uptr[EARLY].reset(new celllib_t());
+  _celllib_uptr[LATE].reset(new celllib_t());
+  celllib_ptr(EARLY)->set_library_type(LibraryType::EARLY_LIBRARY);
+  celllib_ptr(LATE)->set_library_type(LibraryType::LATE_LIBRARY);
+}
+
+// Destructor.
+Corner::~Corner() {
+}
+
+// Procedure: read_celllib
+// Read the early or late cell library of the corner.
+void_t Corner::read_celllib(int el, string_crt fpath) {
+  celllib_ptr(el)->read(fpath);
+}
+
+// Procedure: map_celllib
+// Map every cell, cellpin, and timing arc of a given default library to the one of the same name
+// in the library of the corner. The ones that the corner library lacks are mapped to nullptr, so
+// that they are told apart from the cells of block models, which are mapped to themselves.
+void_t Corner::map_celllib(int el, celllib_pt base_celllib_ptr) {
+
+  for(LibraryCellIter i(base_celllib_ptr); i(); ++i) {
+
+    cell_pt cell_ptr = celllib_ptr(el)->cell_ptr(i.cell_ptr()->name());
+
+    _cell_ptr_map[el][i.cell_ptr()] = cell_ptr;
+
+    for(CellpinIter j(i.cell_ptr()); j(); ++j) {
+
+      cellpin_pt cellpin_ptr = cell_ptr ? cell_ptr->cellpin_ptr(j.cellpin_ptr()->name()) : nullptr;
+
+      _cellpin_ptr_map[el][j.cellpin_ptr()] = cellpin_ptr;
+
+      for(const auto& item : j.cellpin_ptr()->timing_arc_dict()) {
+        _timing_arc_ptr_map[el][item.second] = cellpin_ptr ? cellpin_ptr->timing_arc_dict()[item.first] : nullptr;
+      }
+    }
+  }
+}
+
+// Function: cell_ptr
+// Return the cell of the corner that corresponds to a given cell of the default libraries, the
+// cell itself if it belongs to a block model, or nullptr if the corner library lacks the cell.
+cell_pt Corner::cell_ptr(int el, cell_pt base_cell_ptr) const {
+  auto itr = _cell_ptr_map[el].find(base_cell_ptr);
+  return itr == _cell_ptr_map[el].end() ? base_cell_ptr : itr->second;
+}
+
+// Function: cellpin_ptr
+// Return the cellpin of the corner that corresponds to a given cellpin of the default libraries,
+// the cellpin itself if it belongs to a block model, or nullptr if the corner library lacks it.
+cellpin_pt Corner::cellpin_ptr(int el, cellpin_pt base_cellpin_ptr) const {
+  auto itr = _cellpin_ptr_map[el].find(base_cellpin_ptr);
+  return itr == _cellpin_ptr_map[el].end() ? base_cellpin_ptr : itr->second;
+}
+
+// Function: timing_arc_ptr
+// Return the timing arc of the corner that corresponds to a given timing arc of the default
+// libraries, the arc itself if it belongs to a block model, or nullptr if the corner lacks it.
+timing_arc_pt Corner::timing_arc_ptr(int el, timing_arc_pt base_timing_arc_ptr) const {
+  auto itr = _timing_arc_ptr_map[el].find(base_timing_arc_ptr);
+  return itr == _timing_arc_ptr_map[el].end() ? base_timing_arc_ptr : itr->second;
+}
+
+// Function: cap
+// Return the capacitance of a given pin in the corner, which is the capacitance of the corner
+// cellpin, or the load of the primary output. A cellpin that the corner lacks keeps the default
+// capacitance, and the corner is not bound anyway.
+float_t Corner::cap(pin_pt pin_ptr, int el, int rf) const {
+  if(pin_ptr->cellpin_ptr(el)) {
+    cellpin_pt cellpin_ptr = this->cellpin_ptr(el, pin_ptr->cellpin_ptr(el));
+    return cellpin_ptr ? cellpin_ptr->capacitance() : pin_ptr->cellpin_ptr(el)->capacitance();
+  }
+  return pin_ptr->cap(el, rf);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
@@ -0,0 +1,170 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_CORNER_H_
+#define OT_CORNER_H_
+
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: Corner
+// A corner is a process-voltage-temperature condition of the design. It owns its own early and
+// late cell libraries and the scale factors of the wire resistance and capacitance with respect
+// to the parasitics read from the spef file or estimated from the placement. All corners share
+// the netlist, the timing graph, and the rctrees of the timer, and are timed together with the
+// default libraries in the same propagation. A node, an edge, and a rctree node keep the timing
+// of all corners in one array indexed by [corner][el][rf], and an edge keeps the timing arcs
+// of its cell arc in each corner. The corner maps the cells, cellpins, and timing arcs of the
+// default libraries to its own ones of the same names. Cells outside the default libraries,
+// i.e., block models, are shared by all corners.
+class Corner {
+
+  public:
+
+    Corner(string_crt, size_t);                                           // Constructor.
+    ~Corner();                                                            // Destructor.
+
+    inline string_crt name() const;                                       // Query the name.
+    inline celllib_pt celllib_ptr(int) const;                             // Query the celllib pointer.
+
+    inline size_t idx() const;                                            // Query the corner index.
+
+    inline float_t res_scale() const;                                     // Query the res scale.
+    inline float_t cap_scale() const;                                     // Query the cap scale.
+    inline float_t wns(int, int) const;                                   // Query the wns.
+    inline float_t tns(int, int) const;                                   // Query the tns.
+
+    inline bool_t is_timing_updated() const;                              // Query the timing status.
+    inline bool_t is_bound() const;                                       // Query the binding status.
+
+    inline void_t set_res_scale(float_ct);                                // Set the res scale.
+    inline void_t set_cap_scale(float_ct);                                // Set the cap scale.
+    inline void_t set_wns(int, int, float_ct);                            // Set the wns.
+    inline void_t set_tns(int, int, float_ct);                            // Set the tns.
+    inline void_t set_is_timing_updated(bool_ct);                         // Set the timing status.
+    inline void_t set_is_bound(bool_ct);                                  // Set the binding status.
+
+    void_t read_celllib(int, string_crt);                                 // Read a celllib.
+    void_t map_celllib(int, celllib_pt);                                  // Map a default celllib.
+
+    cell_pt cell_ptr(int, cell_pt) const;                                 // Query the corner cell.
+    cellpin_pt cellpin_ptr(int, cellpin_pt) const;                        // Query the corner cellpin.
+    timing_arc_pt timing_arc_ptr(int, timing_arc_pt) const;               // Query the corner arc.
+
+    float_t cap(pin_pt, int, int) const;                                  // Query the pin capacitance.
+
+  private:
+
+    string_t _name;                                                       // Corner name.
+
+    size_t _idx;                                                          // Corner index.
+
+    celllib_upt _celllib_uptr[2];                                         // Early/Late celllib pointer.
+
+    float_t _res_scale;                                                   // Wire resistance scale.
+    float_t _cap_scale;                                                   // Wire capacitance scale.
+    float_t _wns[2][2];                                                   // Worst negative slack.
+    float_t _tns[2][2];                                                   // Total negative slack.
+
+    bool_t _is_timing_updated;                                            // Timing status.
+    bool_t _is_bound;                                                     // Binding status.
+
+    cell_ptr_umap_t _cell_ptr_map[2];                                     // Default to corner cells.
+    cellpin_ptr_umap_t _cellpin_ptr_map[2];                               // Default to corner cellpins.
+    timing_arc_ptr_umap_t _timing_arc_ptr_map[2];                         // Default to corner arcs.
+};
+
+// Function: name
+inline string_crt Corner::name() const {
+  return _name;
+}
+
+// Function: celllib_ptr
+inline celllib_pt Corner::celllib_ptr(int el) const {
+  return _celllib_uptr[el].get();
+}
+
+// Function: idx
+// Query the index of the corner in the corner dimension of the timing arrays.
+inline size_t Corner::idx() const {
+  return _idx;
+}
+
+// Function: res_scale
+inline float_t Corner::res_scale() const {
+  return _res_scale;
+}
+
+// Function: cap_scale
+inline float_t Corner::cap_scale() const {
+  return _cap_scale;
+}
+
+// Function: wns
+inline float_t Corner::wns(int el, int rf) const {
+  return _wns[el][rf];
+}
+
+// Function: tns
+inline float_t Corner::tns(int el, int rf) const {
+  return _tns[el][rf];
+}
+
+// Function: is_timing_updated
+inline bool_t Corner::is_timing_updated() const {
+  return _is_timing_updated;
+}
+
+// Function: is_bound
+// Query if every gate and cell arc of the design is bound to the libraries of the corner.
+inline bool_t Corner::is_bound() const {
+  return _is_bound;
+}
+
+// Procedure: set_res_scale
+inline void_t Corner::set_res_scale(float_ct scale) {
+  _res_scale = scale;
+}
+
+// Procedure: set_cap_scale
+inline void_t Corner::set_cap_scale(float_ct scale) {
+  _cap_scale = scale;
+}
+
+// Procedure: set_wns
+inline void_t Corner::set_wns(int el, int rf, float_ct wns) {
+  _wns[el][rf] = wns;
+}
+
+// Procedure: set_tns
+inline void_t Corner::set_tns(int el, int rf, float_ct tns) {
+  _tns[el][rf] = tns;
+}
+
+// Procedure: set_is_timing_updated
+inline void_t Corner::set_is_timing_updated(bool_ct flag) {
+  _is_timing_updated = flag;
+}
+
+// Procedure: set_is_bound
+inline void_t Corner::set_is_bound(bool_ct flag) {
+  _is_bound = flag;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -219,11 +219,14 @@ bool_pt CPPRThreadStorage::is_in_list_ptr(int thread_idx, size_t N) {
 //-------------------------------------------------------------------------------------------------
 
 // Constructor: CPPR
+// Paths whose post-CPPR slacks exceed the given cutoff slack are pruned from the search.
 CPPR::CPPR(
   endpoint_pt endpoint_ptr,
   pin_pt through_pin_ptr,
   clock_tree_pt clock_tree_ptr,
-  size_t K
+  size_t K,
+  path_slack_bound_pt path_slack_bound_ptr,
+  float_ct cutoff_slack
 )
 {
   CHECK(endpoint_ptr != nullptr);  
@@ -240,7 +243,8 @@ CPPR::CPPR(
   _nodeset_ptr = _D->nodeset_ptr();
   _num_indices = _nodeset_ptr->num_indices();
   _S_idx = (_num_indices << 1);
-  _cutoff_slack = OT_FLT_ZERO;
+  _cutoff_slack = cutoff_slack;
+  _path_slack_bound_ptr = path_slack_bound_ptr;
   _max_num_paths = K;
   
   // Assign the clock transition status.
@@ -508,6 +512,7 @@ void_t CPPR::update_worst_paths(size_t K, path_max_heap_rt max_heap) {
     report_worst_path(*path_ptr);
     max_heap.insert(path_ptr);
     max_heap.maintain_k_min(K);
+    if(path_slack_bound_ptr()) path_slack_bound_ptr()->tighten(K, max_heap);
     return;
   }
 
@@ -515,6 +520,102 @@ void_t CPPR::update_worst_paths(size_t K, path_max_heap_rt max_heap) {
   _update_prefix_tree(K, max_heap);
 }
 
+// Procedure: update_worst_slacks
+// This procedure maintains the K worst path slacks in a given slack heap, where each slack is
+// recorded together with the given endpoint index. No path trace is recovered.
+void_t CPPR::update_worst_slacks(size_t K, int_t idx, path_slack_heap_rt slack_heap) {
+  
+  if(K == 0) {
+    LOG(ERROR) << "Fail to update worst slacks (zero path idx exception)";
+    return;
+  }
+
+  slack_heap.maintain_k_min(K);
+
+  // Case 1: the worst path slack is above the cutoff slack value.
+  if(report_worst_slack(1) > cutoff_slack()) return;
+
+  // Case 2: the worst path slack is larger than the kth min.
+  if(slack_heap.size() == K && report_worst_slack(1) >= slack_heap.top().first) return;
+
+  // Case 3: only one critical slack has to be maintained.
+  if(K == 1) {
+    slack_heap.insert(report_worst_slack(1), idx);
+    slack_heap.maintain_k_min(K);
+    if(path_slack_bound_ptr()) path_slack_bound_ptr()->tighten(K, slack_heap);
+    return;
+  }
+
+  // Case 4: we have to maintain the top k critical slacks.
+  _update_prefix_tree(K, idx, slack_heap);
+}
+
+// Procedure: report_worst_paths
+// The procedure recovers the paths of ranks [beg, end) in the non-decreasing slack order of the
+// endpoint. Paths are ranked by the prefix tree once the object is constructed for more than one
+// path, so that the same ranks refer to the same paths across calls on identically configured
+// objects. Ranks that do not exist are skipped.
+void_t CPPR::report_worst_paths(size_t beg, size_t end, path_vrt paths) {
+
+  paths.clear();
+  
+  if(beg >= end) return;
+
+  // Case 1: the worst path slack is above the cutoff slack value.
+  if(report_worst_slack(1) > cutoff_slack()) return;
+
+  // Case 2: the object only ranks the first path.
+  if(prefix_tree_ptr() == nullptr) {
+    if(beg == 0) {
+      paths.resize(1);
+      report_worst_path(paths[0]);
+    }
+    return;
+  }
+
+  // Case 3: peel the prefix tree up to the end rank.
+  _update_prefix_tree(end);
+
+  for(size_t k=beg; k<min(end, num_popped_prefix_ptrs()); ++k) {
+    paths.emplace_back();
+    recover_path(prefix_tree()[k], paths.back());
+  }
+}
+
+// Function: rank_worst_paths
+// Peel the prefix tree up to the rank K and return the number of paths of ranks less than K,
+// i.e., the number of paths the endpoint contributes to its K worst paths. No path trace is
+// recovered.
+size_t CPPR::rank_worst_paths(size_t K) {
+
+  if(K == 0 || report_worst_slack(1) > cutoff_slack()) return 0;
+
+  if(prefix_tree_ptr() == nullptr) return 1;
+
+  _update_prefix_tree(K);
+
+  return min(K, num_popped_prefix_ptrs());
+}
+
+// Function: release_prefix_tree
+// Release the ownership of the prefix tree to the caller. The popped prefixes refer to the suffix
+// tree of this object by node indices only, and remain valid for any object that is constructed
+// with the same endpoint, through pin, and number of paths, since the suffix tree is rebuilt
+// identically.
+prefix_tree_pt CPPR::release_prefix_tree() {
+  auto prefix_tree_ptr = _prefix_tree_ptr;
+  _prefix_tree_ptr = nullptr;
+  return prefix_tree_ptr;
+}
+
+// Procedure: adopt_prefix_tree
+// Take the ownership of a prefix tree released by an identically constructed object, so that
+// the ranked paths are recovered without peeling the prefix tree again.
+void_t CPPR::adopt_prefix_tree(prefix_tree_pt prefix_tree_ptr) {
+  if(_prefix_tree_ptr) delete _prefix_tree_ptr;
+  _prefix_tree_ptr = prefix_tree_ptr;
+}
+
 // Function: get_slack
 // Return the kth post-cppr slack value for the endpoint. The input K is supposed to be less than
 // the configured maximum number of paths. The output slack should be less than the cutoff slack.
@@ -575,34 +676,14 @@ void_t CPPR::_update_prefix_tree(size_t K) {
   
   if(prefix_tree_ptr() == nullptr) return;
 
-  prefix_tree_ptr()->clear();
+  // The prefix tree pops the paths in a deterministic order, so the paths already ranked by an
+  // earlier call are the first K paths.
+  if(num_popped_prefix_ptrs() >= K) return;
 
-  float_t dvcost;
-  float_t credit;
-  float_t slack;
+  _init_prefix_tree();
 
   prefix_pt prefix_ptr;
 
-  // The prefix tree is not yet built. Generate the worst paths that originate from each of the 
-  // data path source. For each path we need to get the credit and we should be careful about
-  // the special case where the clock root feeds the data pin of the test.
-  if(_dist[_S_idx] <= cutoff_slack()) {
-
-    for(unsigned_t i=0; i!=_path_src.size(); ++i) {
-    
-      // Obtain the deviation cost, cppr credit, and path slack.
-      dvcost = _dist[_path_src[i]] - _dist[_S_idx] + _cppr_offset(_path_src[i]);
-      credit = _cppr_credit(_path_src[i]);
-      slack = _dist[_S_idx] + dvcost;
-
-      // Consider only paths with negative slack.
-      if(slack > cutoff_slack()) continue;
-
-      // Create a new path and insert it into the prefix tree.
-      prefix_tree_ptr()->insert(_S_idx, _path_src[i], nullptr, nullptr, credit, dvcost);
-    }
-  }
-
   // Spur the path and expands the neighboring space. The procedure iteratively generates the
   // current most critical path and performs spur operation along this path to generate another
   // set of paths (neighboring expansion).
@@ -627,34 +708,12 @@ void_t CPPR::_update_prefix_tree(size_t K, path_max_heap_rt max_heap) {
   
   if(prefix_tree_ptr() == nullptr) return;
 
-  prefix_tree_ptr()->clear();
+  _init_prefix_tree();
 
-  float_t dvcost;
-  float_t credit;
   float_t slack;
 
   prefix_pt prefix_ptr;
 
-  // The prefix tree is not yet built. Generate the worst paths that originate from each of the 
-  // data path source. For each path we need to get the credit and we should be careful about
-  // the special case where the clock root feeds the data pin of the test.
-  if(_dist[_S_idx] <= cutoff_slack()) {
-
-    for(unsigned_t i=0; i!=_path_src.size(); ++i) {
-    
-      // Obtain the deviation cost, cppr credit, and path slack.
-      dvcost = _dist[_path_src[i]] - _dist[_S_idx] + _cppr_offset(_path_src[i]);
-      credit = _cppr_credit(_path_src[i]);
-      slack = _dist[_S_idx] + dvcost;
-
-      // Consider only paths with negative slack.
-      if(slack > cutoff_slack()) continue;
-
-      // Create a new path and insert it into the prefix tree.
-      prefix_tree_ptr()->insert(_S_idx, _path_src[i], nullptr, nullptr, credit, dvcost);
-    }
-  }
-
   // Spur the path and expands the neighboring space. The procedure iteratively generates the
   // current most critical path and performs spur operation along this path to generate another
   // set of paths (neighboring expansion).
@@ -665,14 +724,49 @@ void_t CPPR::_update_prefix_tree(size_t K, path_max_heap_rt max_heap) {
     slack = prefix_ptr->devi_credit() + _dist[_S_idx];
     
     // The current minimum is already larger than the kth max, so there is no need to generate
-    // more paths from the spurring.
+    // more paths from the spurring. The same holds for the kth max shared by other threads.
     if(max_heap.size() == K && slack >= max_heap.top()->slack()) break;
+    if(slack > cutoff_slack()) break;
 
     // Otherwise we have to maintain the top k critical paths.
     path_pt path_ptr = new path_t();
     recover_path(prefix_ptr, *path_ptr);
     max_heap.insert(path_ptr);
     max_heap.maintain_k_min(K);
+    if(path_slack_bound_ptr()) path_slack_bound_ptr()->tighten(K, max_heap);
+
+    if(num_popped_prefix_ptrs() >= K) break;
+    
+    _spur(prefix_ptr);
+  }
+}
+
+// Procedure: _update_prefix_tree
+// Update the prefix tree and maintain the globally top-k critical path slacks in the given slack
+// heap. The procedure follows the same peeling as the path heap version but records only the
+// slack and the given endpoint index, so that no path trace is recovered.
+void_t CPPR::_update_prefix_tree(size_t K, int_t idx, path_slack_heap_rt slack_heap) {
+  
+  if(prefix_tree_ptr() == nullptr) return;
+
+  _init_prefix_tree();
+
+  float_t slack;
+
+  prefix_pt prefix_ptr;
+
+  while(prefix_tree_ptr()->num_heaped_prefix_ptrs()) {
+    
+    prefix_ptr = prefix_tree_ptr()->top();
+    prefix_tree_ptr()->pop(); 
+    slack = prefix_ptr->devi_credit() + _dist[_S_idx];
+    
+    if(slack_heap.size() == K && slack >= slack_heap.top().first) break;
+    if(slack > cutoff_slack()) break;
+
+    slack_heap.insert(slack, idx);
+    slack_heap.maintain_k_min(K);
+    if(path_slack_bound_ptr()) path_slack_bound_ptr()->tighten(K, slack_heap);
 
     if(num_popped_prefix_ptrs() >= K) break;
     
@@ -680,45 +774,151 @@ void_t CPPR::_update_prefix_tree(size_t K, path_max_heap_rt max_heap) {
   }
 }
 
+// Procedure: _init_prefix_tree
+// Clear the prefix tree and insert the worst path that originates from each of the data path
+// sources. For each path we need to get the credit and we should be careful about the special
+// case where the clock root feeds the data pin of the test. The data path sources are the
+// sidetracks of the super source, and only the worst one is heaped.
+void_t CPPR::_init_prefix_tree() {
+
+  prefix_tree_ptr()->clear();
+
+  float_t dvcost;
+  float_t slack;
+
+  if(_dist[_S_idx] > cutoff_slack()) return;
+
+  size_t beg = prefix_tree_ptr()->num_sidetracks();
+
+  for(unsigned_t i=0; i!=_path_src.size(); ++i) {
+  
+    // Obtain the deviation cost and path slack.
+    dvcost = _dist[_path_src[i]] - _dist[_S_idx] + _cppr_offset(_path_src[i]);
+    slack = _dist[_S_idx] + dvcost;
+
+    // Consider only paths with negative slack.
+    if(slack > cutoff_slack()) continue;
+
+    prefix_tree_ptr()->stage(_path_src[i], nullptr, dvcost);
+  }
+
+  int_t root = prefix_tree_ptr()->insert_staged(_S_idx, beg, OT_UNDEFINED_IDX);
+
+  if(root != OT_UNDEFINED_IDX) _spur(nullptr, root, prefix_tree_ptr()->heap_node(root).beg);
+}
+
 // Procedure: _spur
-// Spur is a procedure that takes a input prefix and perform all possible deviations on it.
-// This procedures incorporates the lazy strategy, which only keeps track of the prune 
-// values before we have seen all k prefixs. After k prefixs have been seen, the prune value
-// is froezn and shall be used to prune the search space.
+// Spur is a procedure that takes a popped prefix and generates its successors lazily, following
+// Eppstein's k shortest paths. The successors of a prefix are 1) the next sidetrack of the same
+// suffix tree node, 2) the children of its node in the sidetrack heap if the prefix deviates by
+// the cheapest sidetrack of its node, and 3) the cheapest deviation along its own suffix tree
+// path. None of them is cheaper than the prefix, so every other deviation is generated only when
+// a preceding one is popped.
 void_t CPPR::_spur(prefix_pt prefix_ptr) {
 
-  int_t u = prefix_ptr->to_idx();
+  int_t h = prefix_ptr->heap_node();
+  size_t i = prefix_ptr->sidetrack();
+  
+  // Copy the node since building a sidetrack heap may grow the node array.
+  sidetrack_heap_node_t node = prefix_tree_ptr()->heap_node(h);
+
+  // The next sidetrack of the same suffix tree node.
+  if(i + 1 < node.end) {
+    _spur(prefix_ptr->parent(), h, i + 1);
+  }
+
+  // The children in the sidetrack heap.
+  if(i == node.beg) {
+    if(node.left != OT_UNDEFINED_IDX) {
+      _spur(prefix_ptr->parent(), node.left, prefix_tree_ptr()->heap_node(node.left).beg);
+    }
+    if(node.right != OT_UNDEFINED_IDX) {
+      _spur(prefix_ptr->parent(), node.right, prefix_tree_ptr()->heap_node(node.right).beg);
+    }
+  }
+
+  // The cheapest deviation of the prefix itself.
+  int_t root = _sidetrack_heap(prefix_ptr->to_idx());
+
+  if(root != OT_UNDEFINED_IDX) {
+    _spur(prefix_ptr, root, prefix_tree_ptr()->heap_node(root).beg);
+  }
+}
+
+// Procedure: _spur
+// This is the subroutine of the spur procedure. Here we are given a parent prefix and a
+// sidetrack of a sidetrack heap node. The sidetrack is heaped as a child of the given prefix
+// unless its slack is above the cutoff slack. A null parent denotes the super source, whose
+// sidetracks are the data path sources.
+void_t CPPR::_spur(prefix_pt parent, int_t h, size_t i) {
+  
+  const auto& sidetrack = prefix_tree_ptr()->sidetrack(i);
+
+  float_t devi_credit = (parent ? parent->devi_credit() : OT_FLT_ZERO) + sidetrack.cost;
+  float_t slack = _dist[_S_idx] + devi_credit; 
+  
+  if(slack > cutoff_slack()) return;
+
+  float_t credit = parent ? parent->cppr_credit() : _cppr_credit(sidetrack.to_idx);
+  
+  prefix_tree_ptr()->insert(h, i, parent, credit, devi_credit); 
+}
+
+// Function: _sidetrack_heap
+// Return the sidetrack heap of the suffix tree path from the given node to the data pin. The heaps
+// of the nodes on the path that have not been visited are built from the data pin side, where
+// each node inserts its sorted sidetracks into the heap of its suffix.
+int_t CPPR::_sidetrack_heap(int_t u) {
+
   int_t T = _encode_idx(D_rf(), D()->idx());
+  int_t root = OT_UNDEFINED_IDX;
+  int_vt path;
+
+  while(u != T && !prefix_tree_ptr()->find_heap_root(u, root)) {
+    path.push_back(u);
+    u = _sffx[u];
+  }
+
+  for(auto w=path.rbegin(); w!=path.rend(); ++w) {
+    size_t beg = prefix_tree_ptr()->num_sidetracks();
+    _stage_sidetracks(*w);
+    root = prefix_tree_ptr()->insert_staged(*w, beg, root);
+    prefix_tree_ptr()->set_heap_root(*w, root);
+  }
+
+  return root;
+}
+
+// Procedure: _stage_sidetracks
+// Stage all deviations from the given suffix tree node. The deviation costs do not depend on the
+// prefix, and a deviation whose cost alone exceeds the cutoff slack is never taken.
+void_t CPPR::_stage_sidetracks(int_t u) {
+
   int_t v;
+  float_t devi_cost;
 
   timing_arc_pt timing_arc_ptr;
 
-  while(u != T) {
-
-    for(const auto& e : _decode_node_ptr(u)->fanout()) {
-      
-      v = e->to_node_ptr()->idx();
+  for(const auto& e : _decode_node_ptr(u)->fanout()) {
+    
+    RF_ITER(vrf) {
 
       switch (e->edge_type()) {
 
         // RC tree connection.
         case RCTREE_EDGE_TYPE:
-          v = _encode_idx(_decode_rf(u), v);
-          _spur(prefix_ptr, u, v, e);
+          if(vrf != _decode_rf(u)) continue;
         break;
 
         // Combinational connection.
         case COMBINATIONAL_EDGE_TYPE:
-          RF_ITER(vrf) {
-            timing_arc_ptr = e->timing_arc_ptr(D_el());
-            if(!timing_arc_ptr->is_transition_defined(_decode_rf(u), vrf)) continue;
-            v = _encode_idx(vrf, v);
-            _spur(prefix_ptr, u, v, e);
-          }
+          timing_arc_ptr = e->timing_arc_ptr(D_el());
+          if(!timing_arc_ptr->is_transition_defined(_decode_rf(u), vrf)) continue;
         break;
 
         // Constraint edge.
         case CONSTRAINT_EDGE_TYPE:
+          continue;
         break;
 
         // Assertion false.
@@ -726,26 +926,18 @@ void_t CPPR::_spur(prefix_pt prefix_ptr) {
           CHECK(false);
         break;
       }
-    }
-    u = _sffx[u];
-  }
-}
 
-// Procedure: _spur
-// This is the subroutine of the biggest spur procedure. Here we are given a prefix and a targeted
-// edge that is being spurred from the prefix. The newly spurred prefix is a children of the given
-// path prefix path in the prefix tree.
-void_t CPPR::_spur(prefix_pt prefix_ptr, int_t u, int_t v, edge_pt e) {
-  
-  if(v == _sffx[u] || _sffx[v] == OT_UNDEFINED_IDX || !_is_in_search_cone(v)) return;
+      v = _encode_idx(vrf, e->to_node_ptr()->idx());
 
-  float_t devi_cost = _devi_cost(u, v, e);
-  float_t devi_credit = prefix_ptr->devi_credit() + devi_cost;
-  float_t slack = _dist[_S_idx] + devi_credit; 
-  
-  if(slack > cutoff_slack()) return;
-  
-  prefix_tree_ptr()->insert(u, v, e, prefix_ptr, prefix_ptr->cppr_credit(), devi_credit); 
+      if(v == _sffx[u] || _sffx[v] == OT_UNDEFINED_IDX || !_is_in_search_cone(v)) continue;
+
+      devi_cost = _devi_cost(u, v, e);
+
+      if(_dist[_S_idx] + devi_cost > cutoff_slack()) continue;
+
+      prefix_tree_ptr()->stage(v, e, devi_cost);
+    }
+  }
 }
 
 // Function: _devi_cost
@@ -758,7 +950,9 @@ float_t CPPR::_devi_cost(int_t u, int_t v, edge_pt e) const {
 // Procedure: _prefetch_cutoff_slack
 // The procedure prefetch a upper bound of the cutoff slack by traversing the worst pre-cppr 
 // path and apply the cppr credit to this path in order to obtain the corresponding worst
-// cppr slack. The cutoff slack is then set to the value of this post-cppr slack.
+// cppr slack. The cutoff slack is then set to the value of this post-cppr slack. When a global
+// slack bound is attached, the cutoff already folds in the Kth worst slack of other endpoints
+// and the bound applies to the prefix tree as well.
 void_t CPPR::_prefetch_cutoff_slack() {
 
   if(prefix_tree_ptr()) return;
@@ -844,8 +1038,9 @@ void_t CPPR::_update_suffix_tree() {
       }
       
       // Perform the relaxation from all nodes that coming from either the "jumpin" list 
-      // or the "fanin" list of the node v.
-      if(vnode_ptr->num_jumpins()) _relax_jumpin(v, *_bucketlist);
+      // or the "fanin" list of the node v. The jumps of a dirty head are pending a rebuild and
+      // the relaxation falls back to the fanin.
+      if(vnode_ptr->num_jumpins() && !vnode_ptr->is_jump_dirty()) _relax_jumpin(v, *_bucketlist);
       else _relax_fanin(v, *_bucketlist);
     }
   }
@@ -1032,6 +1227,9 @@ float_t CPPR::_cppr_credit(int el, int lnch_rf, int capt_rf, node_pt lncher, nod
   // Undefined clock tree.
   if(clock_tree_ptr() == nullptr) return OT_FLT_ZERO;
 
+  // Launching and capturing FFs are in different clock domains and share no common clock path.
+  if(lncher->clock_tree_ptr() != capter->clock_tree_ptr()) return OT_FLT_ZERO;
+
   // Special case handling - the clock source might have data path injecting to the D pin. In 
   // this case we should use the D pin node as the launching node so that the LCA is obtained
   // appropriately.
@@ -1114,11 +1312,14 @@ void_t CPPR::_recover_jump_path(int_t beg, int_t end, path_rt path) {
   auto jumpper_rf(_decode_rf(beg));
 
   if(jumpper->num_jumpouts() == 0) return;
-  
-  CHECK(jumpper->num_jumpouts() == 1 && jumpper->num_fanouts() == 1);
 
   node_pt head = _decode_node_ptr(end);
 
+  // The suffix does not take the jump if its head is pending a rebuild.
+  if(jumpper->jumpout_ptr()->head()->item()->to_node_ptr() != head) return;
+  
+  CHECK(jumpper->num_jumpouts() == 1 && jumpper->num_fanouts() == 1);
+
   // Move forward by one step.
   edge_pt edge_ptr = jumpper->fanout_ptr()->head()->item();
   jumpper = edge_ptr->to_node_ptr();
@@ -1198,7 +1399,9 @@ Prefix::Prefix(int_t u, int_t v, edge_pt e, Prefix *p, float_t c, float_t w):
   _deviator(e),
   _parent(p),
   _cppr_credit(c),
-  _devi_credit(w)
+  _devi_credit(w),
+  _heap_node(OT_UNDEFINED_IDX),
+  _sidetrack(0)
 {
 }
 
@@ -1291,7 +1494,6 @@ PrefixTree::PrefixTree():
   _popper(new prefix_ptr_vt()),
   _heaper(new prefix_heap_t())
 {
-
 }
 
 // Destructor.
@@ -1313,12 +1515,104 @@ void_t PrefixTree::clear() {
 
   // Clear the heaped prefixes.
   _heaper->clear();
+
+  // Clear the sidetracks.
+  _sidetracks.clear();
+  _heap_nodes.clear();
+  _heap_roots.clear();
+}
+
+// Procedure: shrink
+// Keep only the first N popped prefixes and discard the heaped prefixes and the sidetracks, after
+// which the tree can no longer be peeled. The parent of a popped prefix is popped before the
+// prefix, so the kept prefixes remain a closed tree.
+void_t PrefixTree::shrink(size_t N) {
+
+  for(size_t i=N; i<_popper->size(); ++i) {
+    delete (*_popper)[i];
+  }
+  if(N < _popper->size()) _popper->resize(N);
+  _popper->shrink_to_fit();
+
+  _heaper->clear();
+
+  sidetrack_vt().swap(_sidetracks);
+  sidetrack_heap_node_vt().swap(_heap_nodes);
+  int_to_int_umap_t().swap(_heap_roots);
 }
 
 // Procedure: insert
-// Insert a new prefix into the prefix tree.
-void_t PrefixTree::insert(int_t u, int_t v, edge_pt e, Prefix* ptr, float_t cc, float_t dc) {
-  _heaper->insert(new prefix_t(u, v, e, ptr, cc, dc)); 
+// Insert a new prefix that deviates by the given sidetrack of the given sidetrack heap node.
+void_t PrefixTree::insert(int_t h, size_t i, Prefix* ptr, float_t cc, float_t dc) {
+  prefix_pt prefix = new prefix_t(_heap_nodes[h].from_idx, _sidetracks[i].to_idx, _sidetracks[i].edge, ptr, cc, dc);
+  prefix->set_sidetrack(h, i);
+  _heaper->insert(prefix); 
+}
+
+// Procedure: stage
+// Stage a sidetrack of the suffix tree node being visited.
+void_t PrefixTree::stage(int_t v, edge_pt e, float_t cost) {
+  _sidetracks.push_back({v, e, cost});
+}
+
+// Function: insert_staged
+// Sort the sidetracks of the node u staged from the given position by their costs and insert
+// them as one node into the given sidetrack heap, which is left unchanged. Return the new heap.
+int_t PrefixTree::insert_staged(int_t u, size_t beg, int_t root) {
+
+  if(beg >= _sidetracks.size()) return root;
+
+  sort(_sidetracks.begin() + beg, _sidetracks.end(), [] (sidetrack_crt a, sidetrack_crt b) {
+    return a.cost < b.cost;
+  });
+
+  _heap_nodes.push_back({u, beg, _sidetracks.size(), OT_UNDEFINED_IDX, OT_UNDEFINED_IDX, 1});
+
+  return _merge(_heap_nodes.size() - 1, root);
+}
+
+// Procedure: set_heap_root
+// Set the sidetrack heap of the suffix tree path from the given node.
+void_t PrefixTree::set_heap_root(int_t u, int_t root) {
+  _heap_roots[u] = root;
+}
+
+// Function: find_heap_root
+// Return true and the sidetrack heap of the given node if the heap has been built.
+bool_t PrefixTree::find_heap_root(int_t u, int_rt root) const {
+  auto itr = _heap_roots.find(u);
+  if(itr == _heap_roots.end()) return false;
+  root = itr->second;
+  return true;
+}
+
+// Function: _rank
+// Return the leftist rank of a heap node, where the empty heap has rank zero.
+int_t PrefixTree::_rank(int_t h) const {
+  return h == OT_UNDEFINED_IDX ? 0 : _heap_nodes[h].rank;
+}
+
+// Function: _merge
+// Merge two leftist heaps keyed by the cheapest sidetrack of each node. Nodes on the merge path
+// are copied rather than modified, so that the heaps sharing them remain unchanged.
+int_t PrefixTree::_merge(int_t a, int_t b) {
+
+  if(a == OT_UNDEFINED_IDX) return b;
+  if(b == OT_UNDEFINED_IDX) return a;
+
+  if(_sidetracks[_heap_nodes[b].beg].cost < _sidetracks[_heap_nodes[a].beg].cost) swap(a, b);
+
+  sidetrack_heap_node_t node = _heap_nodes[a];
+
+  node.right = _merge(node.right, b);
+
+  if(_rank(node.left) < _rank(node.right)) swap(node.left, node.right);
+
+  node.rank = _rank(node.right) + 1;
+
+  _heap_nodes.push_back(node);
+
+  return _heap_nodes.size() - 1;
 }
 
 // Procedure: pop
@@ -42,12 +42,16 @@ class Prefix {
     inline edge_pt deviator() const;                                          // Query the deviator.
     inline Prefix* parent() const;                                            // Query the parent.
 
+    inline int_t heap_node() const;                                           // Query the sidetrack heap node.
+    inline size_t sidetrack() const;                                          // Query the sidetrack.
+
     inline void_t set_from_idx(int_t);                                        // Set the explorer.
     inline void_t set_to_idx(int_t);                                          // Set the explorer.
     inline void_t set_cppr_credit(float_ct);                                  // Set the credit.
     inline void_t set_devi_credit(float_ct);                                  // Set the post-cppr devi_credit.
     inline void_t set_parent(prefix_pt);                                      // Set parent.
     inline void_t set_deviator(edge_pt);                                      // Set the deviator.
+    inline void_t set_sidetrack(int_t, size_t);                               // Set the sidetrack.
 
   private:
 
@@ -59,6 +63,9 @@ class Prefix {
 
     float_t _cppr_credit;                                                     // CPPR credit.
     float_t _devi_credit;                                                     // Post-CPPR devi_credit.
+
+    int_t _heap_node;                                                         // Sidetrack heap node.
+    size_t _sidetrack;                                                        // Sidetrack position.
 };
 
 // Function: from_explorer
@@ -95,6 +102,18 @@ inline prefix_pt Prefix::parent() const {
   return _parent;
 }
 
+// Function: heap_node
+// Query the sidetrack heap node the deviation of the prefix is taken from.
+inline int_t Prefix::heap_node() const {
+  return _heap_node;
+}
+
+// Function: sidetrack
+// Query the position of the deviation of the prefix in the sidetracks of the prefix tree.
+inline size_t Prefix::sidetrack() const {
+  return _sidetrack;
+}
+
 // Procedure: set_from_idx
 // Set the from explorer
 inline void_t Prefix::set_from_idx(int_t idx) {
@@ -131,6 +150,13 @@ inline void_t Prefix::set_deviator(edge_pt e) {
   _deviator = e;
 }
 
+// Procedure: set_sidetrack
+// Set the sidetrack heap node and the sidetrack position of the deviation of the prefix.
+inline void_t Prefix::set_sidetrack(int_t heap_node, size_t sidetrack) {
+  _heap_node = heap_node;
+  _sidetrack = sidetrack;
+}
+
 //-------------------------------------------------------------------------------------------------
 
 // Class: PrefixHeap
@@ -165,9 +191,39 @@ inline size_t PrefixHeap::size() const {
 
 //-------------------------------------------------------------------------------------------------
 
+// Class: Sidetrack
+// A deviation from a suffix tree node to a node other than its suffix, together with the
+// deviation cost, i.e., the slack increase of taking the deviation.
+struct Sidetrack {
+  int_t to_idx;                                                               // To explorer.
+  edge_pt edge;                                                               // Deviator.
+  float_t cost;                                                               // Deviation cost.
+};
+
+// Class: SidetrackHeapNode
+// A node of the persistent leftist heap of a suffix tree path. The node owns the sidetracks of
+// one suffix tree node, sorted by cost in the range [beg, end) of the prefix tree, and is keyed
+// by the cheapest one. The heap of a suffix tree node is the heap of its suffix with its own node
+// inserted, and the heaps of different suffix tree nodes share their common nodes.
+struct SidetrackHeapNode {
+  int_t from_idx;                                                             // From explorer.
+  size_t beg;                                                                 // First sidetrack.
+  size_t end;                                                                 // End of sidetracks.
+  int_t left;                                                                 // Left child.
+  int_t right;                                                                // Right child.
+  int_t rank;                                                                 // Leftist rank.
+};
+
+//-------------------------------------------------------------------------------------------------
+
 // Class: PrefixTree
-// The class for the prefix tree, which contains 1) a heap array for path peeling and 2) an array
-// storing the prefix pointers (ordered) popped from the heap during the peeling process.
+// The class for the prefix tree, which contains 1) a heap array for path peeling, 2) an array
+// storing the prefix pointers (ordered) popped from the heap during the peeling process, and 3)
+// the sidetracks of the suffix tree nodes visited by the peeling, organized in the fashion of
+// Eppstein's k shortest paths. The sidetracks of a suffix tree node are collected and sorted
+// only once, and the sidetracks along the suffix tree path of a node form a persistent heap.
+// Each heaped prefix remembers the sidetrack it deviates by, and its successors in the sidetrack
+// order, which are never cheaper, are generated only when the prefix is popped.
 class PrefixTree {
   
   public:
@@ -177,10 +233,20 @@ class PrefixTree {
     
     inline size_t num_popped_prefix_ptrs() const;                     // Query the popped prefixes.
     inline size_t num_heaped_prefix_ptrs() const;                     // Query the heaped prefixes.
+    inline size_t num_sidetracks() const;                             // Query the sidetracks.
     
+    inline sidetrack_crt sidetrack(size_t) const;                     // Query a sidetrack.
+    inline sidetrack_heap_node_crt heap_node(int_t) const;            // Query a heap node.
+
     void_t clear();                                                   // Clear tree.
+    void_t shrink(size_t);                                            // Keep the first popped.
     void_t pop();                                                     // Pop a prefix.
-    void_t insert(int_t, int_t, edge_pt, Prefix*, float_t, float_t);  // Insert a prefix.            
+    void_t insert(int_t, size_t, Prefix*, float_t, float_t);          // Insert a prefix.
+    void_t stage(int_t, edge_pt, float_t);                            // Stage a sidetrack.
+    void_t set_heap_root(int_t, int_t);                               // Set the heap of a node.
+
+    bool_t find_heap_root(int_t, int_rt) const;                       // Query the heap of a node.
+    int_t insert_staged(int_t, size_t, int_t);                        // Insert the staged sidetracks.
 
     prefix_pt top();                                                  // Top heap item.
 
@@ -193,6 +259,12 @@ class PrefixTree {
     prefix_ptr_vpt _popper;                                           // Popped prefixes.
     prefix_heap_pt _heaper;                                           // Heaped prefixes.
 
+    sidetrack_vt _sidetracks;                                         // Sorted sidetracks.
+    sidetrack_heap_node_vt _heap_nodes;                               // Sidetrack heap nodes.
+    int_to_int_umap_t _heap_roots;                                    // Heap of each node.
+
+    int_t _rank(int_t) const;                                         // Query the leftist rank.
+    int_t _merge(int_t, int_t);                                       // Merge two heaps.
 };
 
 // Function: num_popped_prefix_ptrs
@@ -207,6 +279,24 @@ inline size_t PrefixTree::num_heaped_prefix_ptrs() const {
   return _heaper->size();
 }
 
+// Function: num_sidetracks
+// Return the number of sidetracks, including the staged ones.
+inline size_t PrefixTree::num_sidetracks() const {
+  return _sidetracks.size();
+}
+
+// Function: sidetrack
+// Query the sidetrack at the given position.
+inline sidetrack_crt PrefixTree::sidetrack(size_t i) const {
+  return _sidetracks[i];
+}
+
+// Function: heap_node
+// Query the sidetrack heap node of the given index.
+inline sidetrack_heap_node_crt PrefixTree::heap_node(int_t h) const {
+  return _heap_nodes[h];
+}
+
 // Operator: []
 // Query the popped item.
 inline prefix_pt PrefixTree::operator [] (unsigned_t idx) {
@@ -225,6 +315,100 @@ inline prefix_pt PrefixTree::back() {
   return _popper->back();
 }
 
+// Class: CPPRTagPair
+// The class keeps the two worst arrival times of a node at a given timing split that are launched
+// under different tags, where a tag identifies the clock tree node and transition shared by the
+// launching paths at a given clock tree depth. The first entry is the worst arrival over all
+// tags and the second entry is the worst arrival whose tag differs from the first one.
+class CPPRTagPair {
+
+  public:
+
+    inline CPPRTagPair();                                                     // Constructor.
+
+    inline void_t reset(int);                                                 // Reset the pair.
+    inline void_t insert(int, float_ct, int_ct);                              // Insert an arrival.
+
+    inline float_t at(int_ct) const;                                          // Query the arrival.
+    inline float_t at_excluding(int_ct) const;                                // Query the arrival.
+    inline int_t tag(int_ct) const;                                           // Query the tag.
+
+  private:
+
+    float_t _at[2];                                                           // Arrival times.
+    int_t _tag[2];                                                            // Tags.
+
+    inline static bool_t _is_worse(int, float_ct, float_ct);                  // Compare arrivals.
+};
+
+// Constructor.
+inline CPPRTagPair::CPPRTagPair() {
+  reset(EARLY);
+}
+
+// Procedure: reset
+// Reset both entries to the undefined arrival time of the given timing split.
+inline void_t CPPRTagPair::reset(int el) {
+  _at[0] = _at[1] = Utility::undefined_at(el);
+  _tag[0] = _tag[1] = OT_UNDEFINED_IDX;
+}
+
+// Function: _is_worse
+// Return true if the arrival time a is worse than b, i.e., later for the late split and earlier
+// for the early split.
+inline bool_t CPPRTagPair::_is_worse(int el, float_ct a, float_ct b) {
+  return el == LATE ? a > b : a < b;
+}
+
+// Procedure: insert
+// Insert an arrival time of the given timing split launched under a given tag while keeping the
+// worst arrival and the worst arrival of a different tag. The split is not stored in the pair
+// since the caller already indexes the pairs by it.
+inline void_t CPPRTagPair::insert(int el, float_ct at, int_ct tag) {
+
+  if(tag == _tag[0]) {
+    if(_is_worse(el, at, _at[0])) _at[0] = at;
+  }
+  else if(tag == _tag[1]) {
+    if(_is_worse(el, at, _at[1])) _at[1] = at;
+    if(_is_worse(el, _at[1], _at[0])) {
+      swap(_at[0], _at[1]);
+      swap(_tag[0], _tag[1]);
+    }
+  }
+  else if(_is_worse(el, at, _at[0])) {
+    _at[1] = _at[0];
+    _tag[1] = _tag[0];
+    _at[0] = at;
+    _tag[0] = tag;
+  }
+  else if(_is_worse(el, at, _at[1])) {
+    _at[1] = at;
+    _tag[1] = tag;
+  }
+}
+
+// Function: at
+// Return the ith worst arrival time.
+inline float_t CPPRTagPair::at(int_ct i) const {
+  return _at[i];
+}
+
+// Function: at_excluding
+// Return the worst arrival time whose tag differs from the given tag. An undefined tag excludes
+// nothing.
+inline float_t CPPRTagPair::at_excluding(int_ct excluded_tag) const {
+  return (excluded_tag == OT_UNDEFINED_IDX || _tag[0] != excluded_tag) ? _at[0] : _at[1];
+}
+
+// Function: tag
+// Return the tag of the ith worst arrival time.
+inline int_t CPPRTagPair::tag(int_ct i) const {
+  return _tag[i];
+}
+
+//-------------------------------------------------------------------------------------------------
+
 // Class: CPPR
 // The class performs path-based tracing to discover the post-cppr critical paths for a given
 // endpoint. The class majorly conducts the path peeling, which doesn't change any value of the
@@ -234,7 +418,8 @@ class CPPR {
   
   public:
 
-    CPPR(endpoint_pt, pin_pt, clock_tree_pt, size_t K=1);                     // Constructor.
+    CPPR(endpoint_pt, pin_pt, clock_tree_pt, size_t K=1,                      // Constructor.
+         path_slack_bound_pt = nullptr, float_ct = OT_FLT_ZERO);
     ~CPPR();                                                                  // Destructor.
 
     inline endpoint_pt endpoint_ptr() const;                                  // Endpoint pointer.
@@ -255,13 +440,20 @@ class CPPR {
 
     size_t num_popped_prefix_ptrs() const;                                    // Query the number of ranked paths.    
     inline void_t set_cutoff_slack(float_ct);                                 // Set the cutoff slack.
+    inline path_slack_bound_pt path_slack_bound_ptr() const;                  // Query the global slack bound.
 
     void_t report_worst_path(path_rt);                                        // Report the worst path.
     void_t report_worst_paths(size_t, path_vrt);                              // Report the K worst paths.
     void_t recover_path(prefix_pt, path_rt);                                  // Recover the path.
     void_t update_worst_paths(size_t, path_max_heap_rt);                      // Update the worst paths.
+    void_t update_worst_slacks(size_t, int_t, path_slack_heap_rt);            // Update the worst slacks.
+    void_t report_worst_paths(size_t, size_t, path_vrt);                      // Report a rank range of paths.
+
+    size_t rank_worst_paths(size_t);                                          // Rank the K worst paths.
+    prefix_tree_pt release_prefix_tree();                                     // Release the prefix tree.
+    void_t adopt_prefix_tree(prefix_tree_pt);                                 // Adopt a prefix tree.
     
-    float_t cutoff_slack() const;                                             // Query the cutoff slack.
+    inline float_t cutoff_slack() const;                                      // Query the cutoff slack.
     float_t get_slack(size_t K = 1);                                          // Query the kth slack.
     float_t report_worst_slack(size_t K = 1);                                 // Query the K'th worst path slack.
 
@@ -296,6 +488,7 @@ class CPPR {
     nodeset_pt _nodeset_ptr;                                                  // Pointer to the node set.
 
     float_t _cutoff_slack;                                                    // The cutoff value for slack.
+    path_slack_bound_pt _path_slack_bound_ptr;                                // Global Kth worst slack bound.
     float_pt _dist;                                                           // Distance array type.
 
     int_pt _sffx;                                                             // Suffix array type.
@@ -320,11 +513,15 @@ class CPPR {
     void_t _relax_jumpin(int_t, int_mrt);                                     // Relaxation procedure.
     void_t _relax_fanin(int_t, int_mrt);                                      // Relaxation procedure.
     void_t _spur(prefix_pt);                                                  // Spur the search space.
-    void_t _spur(prefix_pt, int_t, int_t, edge_pt);                           // Spur the search space.
+    void_t _spur(prefix_pt, int_t, size_t);                                   // Spur a sidetrack.
+    int_t _sidetrack_heap(int_t);                                             // Query the sidetrack heap.
+    void_t _stage_sidetracks(int_t);                                          // Stage the sidetracks.
     void_t _update_search_cone();                                             // Update the search cone.
     void_t _update_suffix_tree();                                             // Update the suffix tree.
     void_t _update_prefix_tree(size_t);                                       // Update the prefix tree. 
     void_t _update_prefix_tree(size_t, path_max_heap_rt);                     // Update the prefix tree. 
+    void_t _update_prefix_tree(size_t, int_t, path_slack_heap_rt);            // Update the prefix tree. 
+    void_t _init_prefix_tree();                                               // Seed the prefix tree.
     void_t _update_worst_sources();                                           // Update the worst slack source.
     void_t _update_worst_source(int_t);                                       // Update the worst slack source.
     void_t _prefetch_cutoff_slack();                                          // Prefetch the cutoff slack.
@@ -463,10 +660,17 @@ inline clock_tree_pt CPPR::clock_tree_ptr() const {
   return _clock_tree_ptr;
 }
 
+// Function: path_slack_bound_ptr
+// Return the pointer to the global Kth worst slack bound shared by all CPPR objects.
+inline path_slack_bound_pt CPPR::path_slack_bound_ptr() const {
+  return _path_slack_bound_ptr;
+}
+
 // Function: cutoff_slack
-// Return the cutoff slack.
+// Return the cutoff slack. If the CPPR object participates in a global top-K search, the cutoff
+// is further tightened by the Kth worst slack found so far across all threads.
 inline float_t CPPR::cutoff_slack() const {
-  return _cutoff_slack;
+  return _path_slack_bound_ptr ? min(_cutoff_slack, _path_slack_bound_ptr->value()) : _cutoff_slack;
 }
 
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
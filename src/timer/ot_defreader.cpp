@@ -17,7 +17,8 @@ namespace __OpenTimer {
 
 // Constructor: DEFReader
 DEFReader::DEFReader():
-  _timer_ptr(nullptr)
+  _timer_ptr(nullptr),
+  _has_die(false)
 {
 
 }
@@ -36,14 +37,25 @@ void_t DEFReader::read(timer_pt timer_ptr, string_crt fpath) {
 // Procedure: read
 // Read the DEF file and initializes the data.
 void_t DEFReader::read(timer_pt timer_ptr, char_cpt fpath) {
+  parse(fpath);
+  apply(timer_ptr);
+}
+
+// Procedure: parse
+// Parse the DEF file into the buffer.
+void_t DEFReader::parse(string_crt fpath) {
+  parse(fpath.c_str());
+}
+
+// Procedure: parse
+// Parse the DEF file into the buffer. The procedure doesn't touch the timer and hence can run
+// concurrently with the construction of the circuit.
+void_t DEFReader::parse(char_cpt fpath) {
 
-  CHECK(timer_ptr != nullptr);
-  
   // [BEG INFO]
   LOG(INFO) <<  string_t("Loading ") + fpath;
   // [END INFO]
 
-  _timer_ptr = timer_ptr;
   _fpath = fpath; 
 
   file_pt ifp = fopen(fpath, "r");
@@ -64,6 +76,155 @@ void_t DEFReader::read(timer_pt timer_ptr, char_cpt fpath) {
   fclose(ifp);
 }
 
+// Procedure: apply
+// Apply the buffered die area, components, and pins to the timer.
+void_t DEFReader::apply(timer_pt timer_ptr) {
+
+  CHECK(timer_ptr != nullptr);
+
+  _timer_ptr = timer_ptr;
+
+  if(_has_die) {
+    _timer_ptr->circuit_ptr()->set_die(_die);
+  }
+
+  _apply_components();
+  _apply_pins();
+}
+
+// Function: _model
+// Return the index of the given model name, which is inserted if it has not been seen yet.
+size_t DEFReader::_model(char_cpt name) {
+  auto itr = _model_idx.find(name);
+  if(itr != _model_idx.end()) return itr->second;
+  _model_idx[name] = _models.size();
+  _models.push_back(name);
+  return _models.size() - 1;
+}
+
+// Procedure: _apply_components
+// Apply the buffered components to the gates. The gate of each component is looked up in 
+// parallel and the missing gates are inserted serially. The lef macro of each distinct model is 
+// looked up once, and then the attributes of the gates are updated in parallel batches.
+void_t DEFReader::_apply_components() {
+
+  if(_components.empty()) return;
+
+  int_t N = _components.size();
+  gate_ptr_vt gate_ptrs(N, nullptr);
+  macro_ptr_vt macro_ptrs(_models.size(), nullptr);
+
+  #pragma omp parallel for schedule(static, OT_DEFAULT_DEF_BATCH_SIZE)
+  for(int_t i=0; i<N; ++i) {
+    gate_ptrs[i] = _timer_ptr->gate_ptr(_components[i].name);
+  }
+
+  for(int_t i=0; i<N; ++i) {
+    if(gate_ptrs[i] == nullptr) {
+      gate_ptrs[i] = _timer_ptr->insert_gate(_components[i].name, _models[_components[i].model]);
+    }
+  }
+
+  for(size_t m=0; m<_models.size(); ++m) {
+    macro_ptrs[m] = _timer_ptr->techlib_ptr()->macro_ptr(_models[m]);
+  }
+
+  float_t unit = _timer_ptr->techlib_ptr()->database_unit() > 0.0 ? 
+                 _timer_ptr->techlib_ptr()->database_unit() : OT_FLT_ONE;
+
+  #pragma omp parallel for schedule(static, OT_DEFAULT_DEF_BATCH_SIZE)
+  for(int_t i=0; i<N; ++i) {
+
+    const auto& comp = _components[i];
+    gate_pt gate_ptr = gate_ptrs[i];
+
+    if(comp.mobility != UNDEFINED_MOBILITY) {
+      gate_ptr->set_mobility(comp.mobility);
+    }
+
+    if(comp.location.x() != OT_UNDEFINED_COORDINATE) {
+      gate_ptr->set_location(comp.location.x(), comp.location.y());
+      gate_ptr->set_orientation(comp.orientation);
+    }
+
+    if(comp.source != UNDEFINED_GATE_SOURCE) {
+      gate_ptr->set_source(comp.source);
+    }
+
+    if(comp.has_weight) {
+      gate_ptr->set_weight(comp.weight);
+    }
+
+    // The size of the gate follows its macro, where the width and height swap for the 
+    // orientations rotated by 90 degrees.
+    if(macro_pt macro_ptr = macro_ptrs[comp.model]) {
+      gate_ptr->set_macro_ptr(macro_ptr);
+      switch(gate_ptr->orientation()) {
+        case W_ORIENTATION:
+        case E_ORIENTATION:
+        case FW_ORIENTATION:
+        case FE_ORIENTATION:
+          gate_ptr->set_size(macro_ptr->height() * unit, macro_ptr->width() * unit);
+        break;
+        default:
+          gate_ptr->set_size(macro_ptr->width() * unit, macro_ptr->height() * unit);
+        break;
+      }
+    }
+  }
+}
+
+// Procedure: _apply_pins
+// Apply the buffered pins to the primary inputs and primary outputs. The pins are looked up in 
+// parallel, the missing ports are inserted serially, and the attributes are updated in parallel.
+void_t DEFReader::_apply_pins() {
+
+  if(_pins.empty()) return;
+
+  int_t N = _pins.size();
+  pin_ptr_vt pin_ptrs(N, nullptr);
+
+  #pragma omp parallel for schedule(static, OT_DEFAULT_DEF_BATCH_SIZE)
+  for(int_t i=0; i<N; ++i) {
+    pin_ptrs[i] = _timer_ptr->pin_ptr(_pins[i].name);
+  }
+
+  for(int_t i=0; i<N; ++i) {
+    if(pin_ptrs[i] != nullptr) continue;
+    switch(_pins[i].direction) {
+      case PRIMARY_INPUT_PIN_DIRECTION:
+        pin_ptrs[i] = _timer_ptr->insert_primary_input(_pins[i].name)->pin_ptr();
+      break;
+      case PRIMARY_OUTPUT_PIN_DIRECTION:
+        pin_ptrs[i] = _timer_ptr->insert_primary_output(_pins[i].name)->pin_ptr();
+      break;
+      default:
+        CHECK(false);
+      break;
+    }
+  }
+
+  #pragma omp parallel for schedule(static, OT_DEFAULT_DEF_BATCH_SIZE)
+  for(int_t i=0; i<N; ++i) {
+
+    const auto& pin = _pins[i];
+    pin_pt pin_ptr = pin_ptrs[i];
+
+    if(pin.use != UNDEFINED_PIN_USE) {
+      pin_ptr->set_use(pin.use);
+    }
+
+    if(pin.mobility != UNDEFINED_MOBILITY) {
+      pin_ptr->set_mobility(pin.mobility);
+    }
+
+    if(pin.location.x() != OT_UNDEFINED_COORDINATE) {
+      pin_ptr->set_location(pin.location.x(), pin.location.y());
+      pin_ptr->set_orientation(pin.orientation);
+    }
+  }
+}
+
 // Function: orientStr
 char* DEFReader::orientStr(int orient) {
   switch (orient) {
@@ -111,9 +272,8 @@ int DEFReader::die_area_cbk(defrCallbackType_e c, void* cl, void* ud) {
   printf("DIEAREA %d %d %d %d ;\n", box->xl(), box->yl(), box->xh(), box->yh());
   #endif
 
-  point_t llp(box->xl(), box->yl());
-  point_t urp(box->xh(), box->yh());
-  def_ptr->timer_ptr()->circuit_ptr()->set_die(llp, urp);
+  def_ptr->_has_die = true;
+  def_ptr->_die = rectangle_t(point_t(box->xl(), box->yl()), point_t(box->xh(), box->yh()));
 
   //struct defiPoints points;
   //printf("DIEAREA ");
@@ -151,23 +311,31 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
 
   // Specifies the component name in the design, which is an instance of modelName, the name of 
   // a model defined in the library. A modelName must be specified with each compName.
-  // Then, query the pointer to the gate from the timer and insert a new gate if the gate doesn't 
-  // exist in the current design.
+  // Then, buffer a record of the component, which is applied to the gate later on.
   #ifdef DEF_CALLBACK_VERBOSITY
   printf("- %s %s ", co->id(), co->name());
   #endif
-  
-  gate_pt gate_ptr = def_ptr->timer_ptr()->gate_ptr(co->id());
-  if(gate_ptr == nullptr) {
-    gate_ptr = def_ptr->timer_ptr()->insert_gate(co->id(), co->name());
-  }
+
+  def_ptr->_components.emplace_back();
+
+  auto& comp = def_ptr->_components.back();
+
+  comp.name = co->id();
+  comp.model = def_ptr->_model(co->name());
+  comp.mobility = UNDEFINED_MOBILITY;
+  comp.orientation = UNDEFINED_ORIENTATION;
+  comp.source = UNDEFINED_GATE_SOURCE;
+  comp.weight = OT_FLT_ZERO;
+  comp.has_weight = false;
 
   // co->changeIdAndName("idName", "modelName");
   // printf("%s %s ", co->id(), co->name());
+  #ifdef DEF_CALLBACK_VERBOSITY
   if (co->hasNets()) {
     for(int i = 0; i < co->numNets(); i++)
       printf("%s ", co->net(i));
   }
+  #endif
 
   // Specifies that the component has a location and cannot be moved by automatic tools, but can 
   // be moved using interactive commands. You must specify the component's location and orientation.
@@ -175,9 +343,9 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
     #ifdef DEF_CALLBACK_VERBOSITY
     printf("+ FIXED %d %d %s ", co->placementX(), co->placementY(), co->placementOrientStr());
     #endif
-    gate_ptr->set_mobility(FIXED_MOBILITY);
-    gate_ptr->set_location(co->placementX(), co->placementY());
-    gate_ptr->set_orientation(DEFReader::orientation_enum(co->placementOrient()));
+    comp.mobility = FIXED_MOBILITY;
+    comp.location = point_t(co->placementX(), co->placementY());
+    comp.orientation = DEFReader::orientation_enum(co->placementOrient());
   }
   // Specifies that the component has a location and is a part of a cover macro. A COVER component 
   // cannot be moved by automatic tools or interactive commands. You must specify the component's 
@@ -186,9 +354,9 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
     #ifdef DEF_CALLBACK_VERBOSITY
     printf("+ COVER %d %d %s ", co->placementX(), co->placementY(), DEFReader::orientStr(co->placementOrient()));
     #endif
-    gate_ptr->set_mobility(COVER_MOBILITY);
-    gate_ptr->set_location(co->placementX(), co->placementY());
-    gate_ptr->set_orientation(DEFReader::orientation_enum(co->placementOrient()));
+    comp.mobility = COVER_MOBILITY;
+    comp.location = point_t(co->placementX(), co->placementY());
+    comp.orientation = DEFReader::orientation_enum(co->placementOrient());
   }
   // Specifies that the component has a location, but can be moved using automatic layout tools. 
   // You must specify the component's location and orientation.
@@ -196,22 +364,22 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
     #ifdef DEF_CALLBACK_VERBOSITY
     printf("+ PLACED %d %d %s ", co->placementX(), co->placementY(), DEFReader::orientStr(co->placementOrient()));
     #endif
-    gate_ptr->set_mobility(PLACED_MOBILITY);
-    gate_ptr->set_location(co->placementX(), co->placementY());
-    gate_ptr->set_orientation(DEFReader::orientation_enum(co->placementOrient()));
+    comp.mobility = PLACED_MOBILITY;
+    comp.location = point_t(co->placementX(), co->placementY());
+    comp.orientation = DEFReader::orientation_enum(co->placementOrient());
   }
   // Specifies that the component doesn't have a location.
   if (co->isUnplaced()) {
     #ifdef DEF_CALLBACK_VERBOSITY
     printf("+ UNPLACED ");
     #endif
-    gate_ptr->set_mobility(UNPLACED_MOBILITY);
+    comp.mobility = UNPLACED_MOBILITY;
     if ((co->placementX() != -1) || (co->placementY() != -1)) {
       #ifdef DEF_CALLBACK_VERBOSITY
       printf("%d %d %s ", co->placementX(), co->placementY(), DEFReader::orientStr(co->placementOrient()));
       #endif
-      gate_ptr->set_location(co->placementX(), co->placementY());
-      gate_ptr->set_orientation(DEFReader::orientation_enum(co->placementOrient()));
+      comp.location = point_t(co->placementX(), co->placementY());
+      comp.orientation = DEFReader::orientation_enum(co->placementOrient());
     }
   }
 
@@ -228,16 +396,16 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
     printf("+ SOURCE %s ", co->source());
     #endif
     if(strcmp(co->source(), "NETLIST") == 0) {
-      gate_ptr->set_source(NETLIST_GATE_SOURCE);
+      comp.source = NETLIST_GATE_SOURCE;
     }
     else if(strcmp(co->source(), "DIST") == 0) {
-      gate_ptr->set_source(DIST_GATE_SOURCE);
+      comp.source = DIST_GATE_SOURCE;
     }
     else if(strcmp(co->source(), "USER") == 0) {
-      gate_ptr->set_source(USER_GATE_SOURCE);
+      comp.source = USER_GATE_SOURCE;
     }
     else if(strcmp(co->source(), "TIMING") == 0) {
-      gate_ptr->set_source(TIMING_GATE_SOURCE);
+      comp.source = TIMING_GATE_SOURCE;
     }
     else {
       CHECK(false);
@@ -252,7 +420,8 @@ int DEFReader::component_cbk(defrCallbackType_e c, defiComponent* co, void* ud)
     #ifdef DEF_CALLBACK_VERBOSITY
     printf("+ WEIGHT %d ", co->weight());
     #endif
-    gate_ptr->set_weight(co->weight());
+    comp.weight = co->weight();
+    comp.has_weight = true;
   }
   
   // BEG TODO--------------------------------------------------------------------------------------  
@@ -391,54 +560,59 @@ int DEFReader::pin_cbk(defrCallbackType_e c, void* cl, void* ud) {
     #endif
   }
   
-  // Query the pin pointer and insert the port if the corresponding pin doesn't exist
-  // in the current design.
-  pin_pt pin_ptr = def_ptr->timer_ptr()->pin_ptr(pin->pinName());
-  if(pin_ptr == nullptr) {
+  // Buffer a record of the pin, which is applied later on and inserts the port if the 
+  // corresponding pin doesn't exist in the current design.
+  def_ptr->_pins.emplace_back();
+
+  auto& port = def_ptr->_pins.back();
+
+  port.name = pin->pinName();
+  port.direction = UNDEFINED_PIN_DIRECTION;
+  port.use = UNDEFINED_PIN_USE;
+  port.mobility = UNDEFINED_MOBILITY;
+  port.orientation = UNDEFINED_ORIENTATION;
+
+  if (pin->hasDirection()) {
     // Primary input.
     if(strcmp(pin->direction(), "INPUT") == 0) {
-      pin_ptr = def_ptr->timer_ptr()->insert_primary_input(pin->pinName())->pin_ptr();
+      port.direction = PRIMARY_INPUT_PIN_DIRECTION;
     }
     // Primary output.
     else if(strcmp(pin->direction(), "OUTPUT") == 0) {
-      pin_ptr = def_ptr->timer_ptr()->insert_primary_output(pin->pinName())->pin_ptr();
-    }
-    // Unexpected behavior.
-    else {
-      CHECK(false);
+      port.direction = PRIMARY_OUTPUT_PIN_DIRECTION;
     }
   }
 
   // Query the use type of the pin, which could be one of SIGNAL, POWER, GROUND, CLOCK, TIEOFF, 
   // ANALOG, SCAN, and RESET.
   if (pin->hasUse()) {
-    #ifndef DEF_CALLBACK_VERBOSITY
+    #ifdef DEF_CALLBACK_VERBOSITY
     printf( "+ USE %s ", pin->use());
     #endif
 
     if(strcmp(pin->use(), "SIGNAL") == 0) {
-      pin_ptr->set_use(SIGNAL_PIN_USE);
+      port.use = SIGNAL_PIN_USE;
     }
     else if(strcmp(pin->use(), "POWER") == 0) {
-      pin_ptr->set_use(POWER_PIN_USE);
+      port.use = POWER_PIN_USE;
     }
     else if(strcmp(pin->use(), "GROUND") == 0) {
-      pin_ptr->set_use(GROUND_PIN_USE);
+      port.use = GROUND_PIN_USE;
     }
     else if(strcmp(pin->use(), "CLOCK") == 0) {
-      pin_ptr->set_use(CLOCK_PIN_USE);
+      port.use = CLOCK_PIN_USE;
     }
     else if(strcmp(pin->use(), "TIEOFF") == 0) {
-      pin_ptr->set_use(TIEOFF_PIN_USE);
+      port.use = TIEOFF_PIN_USE;
     }
     else if(strcmp(pin->use(), "ANALOG") == 0) {
-      pin_ptr->set_use(ANALOG_PIN_USE);
+      port.use = ANALOG_PIN_USE;
     }
     else if(strcmp(pin->use(), "SCAN") == 0) {
-      pin_ptr->set_use(SCAN_PIN_USE);
+      port.use = SCAN_PIN_USE;
     }
     else if(strcmp(pin->use(), "RESET") == 0) {
-      pin_ptr->set_use(RESET_PIN_USE);
+      port.use = RESET_PIN_USE;
     }
     else {
       CHECK(false);
@@ -571,9 +745,9 @@ int DEFReader::pin_cbk(defrCallbackType_e c, void* cl, void* ud) {
       printf( "+ PLACED ");
       printf( "( %d %d ) %s ", pin->placementX(), pin->placementY(), orientStr(pin->orient()));
       #endif
-      pin_ptr->set_mobility(PLACED_MOBILITY);
-      pin_ptr->set_location(pin->placementX(), pin->placementY());
-      pin_ptr->set_orientation(DEFReader::orientation_enum(pin->orient()));
+      port.mobility = PLACED_MOBILITY;
+      port.location = point_t(pin->placementX(), pin->placementY());
+      port.orientation = DEFReader::orientation_enum(pin->orient());
     }
     // Specifies the pin's location, orientation, and that it is a part of the cover macro. 
     // A COVER pin cannot be moved by automatic tools or by interactive commands. If you specify a 
@@ -583,9 +757,9 @@ int DEFReader::pin_cbk(defrCallbackType_e c, void* cl, void* ud) {
       printf( "+ COVER ");
       printf( "( %d %d ) %s ", pin->placementX(), pin->placementY(), orientStr(pin->orient()));
       #endif
-      pin_ptr->set_mobility(COVER_MOBILITY);
-      pin_ptr->set_location(pin->placementX(), pin->placementY());
-      pin_ptr->set_orientation(DEFReader::orientation_enum(pin->orient()));
+      port.mobility = COVER_MOBILITY;
+      port.location = point_t(pin->placementX(), pin->placementY());
+      port.orientation = DEFReader::orientation_enum(pin->orient());
     }
     // Specifies the pin's location, orientation, and that it's location cannot be moved by 
     // automatic tools, but can be moved by interactive commands. If you specify a placement 
@@ -595,16 +769,16 @@ int DEFReader::pin_cbk(defrCallbackType_e c, void* cl, void* ud) {
       printf( "+ FIXED ");
       printf( "( %d %d ) %s ", pin->placementX(), pin->placementY(), orientStr(pin->orient()));
       #endif
-      pin_ptr->set_mobility(FIXED_MOBILITY);
-      pin_ptr->set_location(pin->placementX(), pin->placementY());
-      pin_ptr->set_orientation(DEFReader::orientation_enum(pin->orient()));
+      port.mobility = FIXED_MOBILITY;
+      port.location = point_t(pin->placementX(), pin->placementY());
+      port.orientation = DEFReader::orientation_enum(pin->orient());
     }
     // The pin is not placed yet and it doesn't have a placement location.
     if (pin->isUnplaced()) {
       #ifdef DEF_CALLBACK_VERBOSITY
       printf( "+ UNPLACED ");
       #endif
-      pin_ptr->set_mobility(UNPLACED_MOBILITY);
+      port.mobility = UNPLACED_MOBILITY;
     }
   }
   
@@ -22,7 +22,36 @@
 
 namespace __OpenTimer {
 
+// Struct: DEFComponent
+// A component record buffered from the COMPONENTS section of a def file.
+struct DEFComponent {
+  string_t name;                                                                      // Component name.
+  size_t model;                                                                       // Model index.
+  point_t location;                                                                   // Location.
+  mobility_e mobility;                                                                // Mobility.
+  orientation_e orientation;                                                          // Orientation.
+  gate_source_e source;                                                               // Source.
+  float_t weight;                                                                     // Weight.
+  bool_t has_weight;                                                                  // Weight flag.
+};
+
+// Struct: DEFPin
+// A pin record buffered from the PINS section of a def file.
+struct DEFPin {
+  string_t name;                                                                      // Pin name.
+  pin_direction_e direction;                                                          // Direction.
+  pin_use_e use;                                                                      // Use.
+  point_t location;                                                                   // Location.
+  mobility_e mobility;                                                                // Mobility.
+  orientation_e orientation;                                                          // Orientation.
+};
+
 // Class: DEF
+// The reader ingests a def file in two phases. The parse phase runs the def parser, whose 
+// callbacks only buffer the die area, components, and pins, and hence can overlap with the
+// netlist construction. The apply phase then applies the buffered records to the timer in bulk,
+// where the name lookups and the attribute updates of components and pins run in parallel and
+// the lef macro of each model name is looked up once.
 class DEFReader {
   
   public:
@@ -32,8 +61,14 @@ class DEFReader {
 
     void_t read(timer_pt, string_crt);                                                // Read.
     void_t read(timer_pt, char_cpt);                                                  // Read.
+    void_t parse(string_crt);                                                         // Parse.
+    void_t parse(char_cpt);                                                           // Parse.
+    void_t apply(timer_pt);                                                           // Apply.
 
     inline timer_pt timer_ptr() const;                                                // Query the timer pointer.
+
+    inline size_t num_components() const;                                             // Query the component count.
+    inline size_t num_pins() const;                                                   // Query the pin count.
     
     static orientation_e orientation_enum(int);                                       // Get the orientation.
     static char* orientStr(int);                                                      // Tokenize.
@@ -46,6 +81,20 @@ class DEFReader {
 
     string_t _fpath;                                                                  // File path.
     timer_pt _timer_ptr;                                                              // Timer pointer.
+
+    bool_t _has_die;                                                                  // Die area flag.
+    rectangle_t _die;                                                                 // Die area.
+
+    def_component_vt _components;                                                     // Buffered components.
+    def_pin_vt _pins;                                                                 // Buffered pins.
+
+    string_vt _models;                                                                // Model names.
+    string_to_idx_umap_t _model_idx;                                                  // Model name cache.
+
+    size_t _model(char_cpt);                                                          // Intern a model name.
+
+    void_t _apply_components();                                                       // Apply the components.
+    void_t _apply_pins();                                                             // Apply the pins.
 };
 
 // Function: timer_ptr
@@ -54,12 +103,18 @@ inline timer_pt DEFReader::timer_ptr() const {
   return _timer_ptr;
 }
 
+// Function: num_components
+// Return the number of buffered components.
+inline size_t DEFReader::num_components() const {
+  return _components.size();
+}
 
-};
-
-
-
-
+// Function: num_pins
+// Return the number of buffered pins.
+inline size_t DEFReader::num_pins() const {
+  return _pins.size();
+}
 
+};
 
 #endif
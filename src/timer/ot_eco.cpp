@@ -0,0 +1,422 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_eco.h"
+#include "ot_circuit.h"
+#include "ot_iterator.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+EcoOperation::EcoOperation(eco_operation_type_ce type, string_crt name, string_crt arg):
+  _type(type),
+  _name(name),
+  _arg(arg)
+{
+}
+
+// Destructor.
+EcoOperation::~EcoOperation() {
+
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+Eco::Eco():
+  _is_open(false),
+  _circuit_ptr(nullptr)
+{
+}
+
+// Destructor.
+Eco::~Eco() {
+
+}
+
+// Procedure: open
+// Open a new transaction on a given circuit. The pending state of a previous transaction is
+// discarded.
+void_t Eco::open(circuit_pt circuit_ptr) {
+  close();
+  _circuit_ptr = circuit_ptr;
+  _is_open = true;
+}
+
+// Procedure: close
+// Close the transaction and clear the pending state.
+void_t Eco::close() {
+  _is_open = false;
+  _circuit_ptr = nullptr;
+  _inserted_gates.clear();
+  _removed_gates.clear();
+  _inserted_nets.clear();
+  _removed_nets.clear();
+  _repowered_gates.clear();
+  _pin_names.clear();
+  _removed_pins.clear();
+  _inserted_cell.clear();
+  _repowered_cell.clear();
+  _pin_gate.clear();
+  _gate_pins.clear();
+  _net_num_pins.clear();
+  _net_version.clear();
+  _is_removed_gate.clear();
+  _is_removed_net.clear();
+  _is_inserted_net.clear();
+  _pins.clear();
+}
+
+// Procedure: close
+// Close the transaction and turn the difference between the pending state and the netlist into
+// the operations that bring the netlist to the pending state. The operations are ordered such
+// that each one is legal on the netlist left by the previous ones: the pins are disconnected
+// before their gates and nets are removed, and the gates and nets are inserted before the pins
+// are connected. Each pin is disconnected and connected at most once.
+void_t Eco::close(eco_operation_vrt operations) {
+
+  operations.clear();
+
+  for(const auto& pin_name : _removed_pins) {
+    operations.emplace_back(DISCONNECT_PIN_ECO_OPERATION, pin_name, "");
+  }
+
+  for(const auto& pin_name : _pin_names) {
+    const auto& pin = _pins[pin_name];
+    if(!pin.net_name[0].empty() && _is_changed(pin)) {
+      operations.emplace_back(DISCONNECT_PIN_ECO_OPERATION, pin_name, "");
+    }
+  }
+
+  for(const auto& gate_name : _removed_gates) {
+    operations.emplace_back(REMOVE_GATE_ECO_OPERATION, gate_name, "");
+  }
+
+  for(const auto& net_name : _removed_nets) {
+    operations.emplace_back(REMOVE_NET_ECO_OPERATION, net_name, "");
+  }
+
+  for(const auto& gate_name : _inserted_gates) {
+    operations.emplace_back(INSERT_GATE_ECO_OPERATION, gate_name, _inserted_cell[gate_name]);
+  }
+
+  for(const auto& net_name : _inserted_nets) {
+    operations.emplace_back(INSERT_NET_ECO_OPERATION, net_name, "");
+  }
+
+  for(const auto& gate_name : _repowered_gates) {
+    operations.emplace_back(REPOWER_GATE_ECO_OPERATION, gate_name, _repowered_cell[gate_name]);
+  }
+
+  for(const auto& pin_name : _pin_names) {
+    const auto& pin = _pins[pin_name];
+    if(!pin.net_name[1].empty() && _is_changed(pin)) {
+      operations.emplace_back(CONNECT_PIN_ECO_OPERATION, pin_name, pin.net_name[1]);
+    }
+  }
+
+  close();
+}
+
+// Function: is_gate
+// Return true if the gate exists in the pending state.
+bool_t Eco::is_gate(string_crt gate_name) const {
+  if(_inserted_cell.find(gate_name) != _inserted_cell.end()) return true;
+  return _circuit_ptr->gate_ptr(gate_name) != nullptr &&
+         _is_removed_gate.find(gate_name) == _is_removed_gate.end();
+}
+
+// Function: is_net
+// Return true if the net exists in the pending state.
+bool_t Eco::is_net(string_crt net_name) const {
+  if(_is_inserted_net.find(net_name) != _is_inserted_net.end()) return true;
+  return _circuit_ptr->net_ptr(net_name) != nullptr &&
+         _is_removed_net.find(net_name) == _is_removed_net.end();
+}
+
+// Function: is_pin
+// Return true if the pin exists in the pending state, i.e., the pin is a primary input/output
+// or belongs to a gate that exists in the pending state.
+bool_t Eco::is_pin(string_crt pin_name) const {
+  if(_pin_gate.find(pin_name) != _pin_gate.end()) return true;
+  pin_pt pin_ptr = _circuit_ptr->pin_ptr(pin_name);
+  if(pin_ptr == nullptr) return false;
+  return pin_ptr->gate_ptr() == nullptr ||
+         _is_removed_gate.find(pin_ptr->gate_ptr()->name()) == _is_removed_gate.end();
+}
+
+// Function: _pin
+// Return the connection of a pin, which is initialized by the netlist upon the first query. A
+// pin of a gate inserted in the transaction is initially disconnected.
+eco_pin_t& Eco::_pin(string_crt pin_name) {
+
+  auto itr = _pins.find(pin_name);
+
+  if(itr != _pins.end()) return itr->second;
+
+  eco_pin_t& pin = _pins[pin_name];
+
+  if(_pin_gate.find(pin_name) == _pin_gate.end()) {
+    pin_pt pin_ptr = _circuit_ptr->pin_ptr(pin_name);
+    if(pin_ptr != nullptr && pin_ptr->net_ptr() != nullptr) {
+      pin.net_name[0] = pin.net_name[1] = pin_ptr->net_ptr()->name();
+    }
+  }
+
+  _pin_names.push_back(pin_name);
+
+  return pin;
+}
+
+// Function: _gate_pin_names
+// Return the pin names of a gate in the pending state.
+string_vt Eco::_gate_pin_names(string_crt gate_name) const {
+
+  auto itr = _gate_pins.find(gate_name);
+
+  if(itr != _gate_pins.end()) return itr->second;
+
+  string_vt pin_names;
+  gate_pt gate_ptr = _circuit_ptr->gate_ptr(gate_name);
+
+  if(gate_ptr != nullptr && gate_ptr->cell_ptr() != nullptr) {
+    for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
+      pin_names.push_back(gate_name + ":" + i.cellpin_ptr()->name());
+    }
+  }
+
+  return pin_names;
+}
+
+// Function: _num_pins
+// Return the reference to the pending number of pins of a net, which is initialized by the
+// netlist upon the first query.
+size_t& Eco::_num_pins(string_crt net_name) {
+
+  auto itr = _net_num_pins.find(net_name);
+
+  if(itr != _net_num_pins.end()) return itr->second;
+
+  net_pt net_ptr = _circuit_ptr->net_ptr(net_name);
+
+  return _net_num_pins[net_name] = (net_ptr == nullptr ? 0 : net_ptr->num_pins());
+}
+
+// Function: _version
+// Return the version of a net name, which is the number of times the net has been removed.
+size_t Eco::_version(string_crt net_name) const {
+  auto itr = _net_version.find(net_name);
+  return itr == _net_version.end() ? 0 : itr->second;
+}
+
+// Procedure: _erase
+// Erase a name from an ordered vector of names.
+void_t Eco::_erase(string_vrt names, string_crt name) const {
+  names.erase(remove(names.begin(), names.end(), name), names.end());
+}
+
+// Function: _is_changed
+// Return true if the pending connection of a pin differs from its initial connection.
+bool_t Eco::_is_changed(const eco_pin_t& pin) const {
+  return pin.net_name[0] != pin.net_name[1] || pin.net_version[0] != pin.net_version[1];
+}
+
+// Function: insert_gate
+// Record a gate insertion. The pins of the gate are given by the cell if the cell is found in
+// the library. A gate that was removed earlier in the transaction can be inserted again.
+bool_t Eco::insert_gate(string_crt gate_name, string_crt cell_name, cell_pt cell_ptr) {
+
+  if(is_gate(gate_name)) {
+    LOG(ERROR) << "Failed to insert gate " << gate_name << " (existing gate exception)";
+    return false;
+  }
+
+  _inserted_gates.push_back(gate_name);
+  _inserted_cell[gate_name] = cell_name;
+
+  auto& pin_names = _gate_pins[gate_name];
+
+  if(cell_ptr != nullptr) {
+    for(CellpinIter i(cell_ptr); i(); ++i) {
+      pin_names.push_back(gate_name + ":" + i.cellpin_ptr()->name());
+      _pin_gate[pin_names.back()] = gate_name;
+    }
+  }
+
+  return true;
+}
+
+// Function: insert_net
+// Record a net insertion. A net that was removed earlier in the transaction can be inserted
+// again and starts with no pins.
+bool_t Eco::insert_net(string_crt net_name) {
+
+  if(is_net(net_name)) {
+    LOG(ERROR) << "Failed to insert net " << net_name << " (existing net exception)";
+    return false;
+  }
+
+  _inserted_nets.push_back(net_name);
+  _is_inserted_net.insert(net_name);
+  _net_num_pins[net_name] = 0;
+
+  return true;
+}
+
+// Function: repower_gate
+// Record a gate resize. A repeated resize keeps only the last cell, and a gate inserted in the
+// transaction is inserted with the new cell directly.
+bool_t Eco::repower_gate(string_crt gate_name, string_crt cell_name) {
+
+  if(!is_gate(gate_name)) {
+    LOG(ERROR) << "Failed to repower gate " << gate_name << " (nullptr exception)";
+    return false;
+  }
+
+  if(_inserted_cell.find(gate_name) != _inserted_cell.end()) {
+    _inserted_cell[gate_name] = cell_name;
+    return true;
+  }
+
+  if(_repowered_cell.find(gate_name) == _repowered_cell.end()) {
+    _repowered_gates.push_back(gate_name);
+  }
+  _repowered_cell[gate_name] = cell_name;
+
+  return true;
+}
+
+// Function: remove_gate
+// Record a gate removal. All pins of the gate must have been disconnected in the pending state.
+// Removing a gate inserted in the same transaction cancels the insertion, and a pending resize
+// of the gate is dropped.
+bool_t Eco::remove_gate(string_crt gate_name) {
+
+  if(!is_gate(gate_name)) {
+    LOG(ERROR) << "Failed to remove gate " << gate_name << " (nullptr exception)";
+    return false;
+  }
+
+  string_vt pin_names = _gate_pin_names(gate_name);
+
+  for(const auto& pin_name : pin_names) {
+    if(!_pin(pin_name).net_name[1].empty()) {
+      LOG(ERROR) << "Failed to remove gate " << gate_name << " (non-disconnected pin exception)";
+      return false;
+    }
+  }
+
+  if(_repowered_cell.erase(gate_name)) {
+    _erase(_repowered_gates, gate_name);
+  }
+
+  // Case 1: the gate was inserted in the transaction.
+  if(_inserted_cell.erase(gate_name)) {
+    _erase(_inserted_gates, gate_name);
+    for(const auto& pin_name : pin_names) {
+      _pin_gate.erase(pin_name);
+    }
+    _gate_pins.erase(gate_name);
+  }
+  // Case 2: the gate is in the netlist. A pin connected in the netlist is disconnected before
+  // the gate is removed, and a pin of the same name belongs to the next gate of the same name.
+  else {
+    _removed_gates.push_back(gate_name);
+    _is_removed_gate.insert(gate_name);
+    for(const auto& pin_name : pin_names) {
+      auto& pin = _pin(pin_name);
+      if(!pin.net_name[0].empty()) {
+        _removed_pins.push_back(pin_name);
+      }
+      pin = eco_pin_t();
+    }
+  }
+
+  return true;
+}
+
+// Function: remove_net
+// Record a net removal. The net must have no pins in the pending state. Removing a net inserted
+// in the same transaction cancels the insertion.
+bool_t Eco::remove_net(string_crt net_name) {
+
+  if(!is_net(net_name)) {
+    LOG(ERROR) << "Failed to remove net " << net_name << " (nullptr exception)";
+    return false;
+  }
+
+  if(_num_pins(net_name) != 0) {
+    LOG(ERROR) << "Failed to remove net " << net_name << " (non-empty net exception)";
+    return false;
+  }
+
+  if(_is_inserted_net.erase(net_name)) {
+    _erase(_inserted_nets, net_name);
+  }
+  else {
+    _removed_nets.push_back(net_name);
+    _is_removed_net.insert(net_name);
+  }
+
+  ++_net_version[net_name];
+
+  return true;
+}
+
+// Function: connect_pin
+// Record a pin connection. The pin must be disconnected in the pending state.
+bool_t Eco::connect_pin(string_crt pin_name, string_crt net_name) {
+
+  if(!is_pin(pin_name) || !is_net(net_name)) {
+    LOG(ERROR) << "Failed to connect pin " << pin_name << " to net " << net_name
+               << " (nullptr exception)";
+    return false;
+  }
+
+  auto& pin = _pin(pin_name);
+
+  if(!pin.net_name[1].empty()) {
+    LOG(ERROR) << "Failed to connect a pin to a net (non-disconnected pin exception)";
+    return false;
+  }
+
+  pin.net_name[1] = net_name;
+  pin.net_version[1] = _version(net_name);
+  ++_num_pins(net_name);
+
+  return true;
+}
+
+// Function: disconnect_pin
+// Record a pin disconnection. Disconnecting a disconnected pin has no effect.
+bool_t Eco::disconnect_pin(string_crt pin_name) {
+
+  if(!is_pin(pin_name)) {
+    LOG(ERROR) << "Failed to disconnect pin " << pin_name << " (nullptr exception)";
+    return false;
+  }
+
+  auto& pin = _pin(pin_name);
+
+  if(pin.net_name[1].empty()) return true;
+
+  --_num_pins(pin.net_name[1]);
+  pin.net_name[1].clear();
+  pin.net_version[1] = 0;
+
+  return true;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
@@ -0,0 +1,161 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_ECO_H_
+#define OT_ECO_H_
+
+#include "ot_utility.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: EcoOperation
+// An eco operation describes a netlist modification by names, which is applied to the netlist
+// when the eco transaction is committed.
+class EcoOperation {
+
+  public:
+
+    EcoOperation(eco_operation_type_ce, string_crt, string_crt);    // Constructor.
+    ~EcoOperation();                                                  // Destructor.
+
+    inline eco_operation_type_e type() const;                         // Query the operation type.
+
+    inline string_crt name() const;                                   // Query the object name.
+    inline string_crt arg() const;                                    // Query the operation argument.
+
+  private:
+
+    eco_operation_type_e _type;                                       // Operation type.
+
+    string_t _name;                                                   // Gate/net/pin name.
+    string_t _arg;                                                    // Cell/net name.
+};
+
+// Function: type
+// Return the type of the operation.
+inline eco_operation_type_e EcoOperation::type() const {
+  return _type;
+}
+
+// Function: name
+// Return the name of the object the operation applies to.
+inline string_crt EcoOperation::name() const {
+  return _name;
+}
+
+// Function: arg
+// Return the argument of the operation, which is the cell name for insert_gate and
+// repower_gate and the net name for connect_pin.
+inline string_crt EcoOperation::arg() const {
+  return _arg;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: EcoPin
+// The net connection of a pin before and after the eco transaction. A net name is paired with
+// its version, which is bumped when the net is removed, such that a pin reconnected to a new net
+// of the same name differs from its initial connection.
+struct EcoPin {
+  string_t net_name[2];                                               // Initial/pending net.
+  size_t net_version[2];                                              // Initial/pending version.
+};
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: Eco
+// The class records the netlist modifications issued between Timer::begin_eco and
+// Timer::commit_eco. Instead of a log of the modifications, the class keeps the pending state
+// of the netlist, i.e., the gates and nets inserted or removed, the cell of each resized gate,
+// and the net of each pin that was connected or disconnected. Every modification is validated
+// against the pending state rather than the netlist, e.g., a gate removed earlier in the same
+// transaction can be inserted again but no longer resized. On commit, the difference between
+// the pending state and the netlist is turned into one operation per modified object, so that
+// intermediate edits that cancel out never reach the timing graph.
+class Eco {
+
+  public:
+
+    Eco();                                                            // Constructor.
+    ~Eco();                                                           // Destructor.
+
+    inline bool_t is_open() const;                                    // Query the transaction status.
+
+    void_t open(circuit_pt);                                          // Open a transaction.
+    void_t close();                                                   // Close the transaction.
+    void_t close(eco_operation_vrt);                                  // Close and release the operations.
+
+    bool_t insert_gate(string_crt, string_crt, cell_pt);              // Record a gate insertion.
+    bool_t insert_net(string_crt);                                    // Record a net insertion.
+    bool_t repower_gate(string_crt, string_crt);                      // Record a gate resize.
+    bool_t remove_gate(string_crt);                                   // Record a gate removal.
+    bool_t remove_net(string_crt);                                    // Record a net removal.
+    bool_t connect_pin(string_crt, string_crt);                       // Record a pin connection.
+    bool_t disconnect_pin(string_crt);                                // Record a pin disconnection.
+
+    bool_t is_gate(string_crt) const;                                 // Query the gate existence.
+    bool_t is_net(string_crt) const;                                  // Query the net existence.
+    bool_t is_pin(string_crt) const;                                  // Query the pin existence.
+
+  private:
+
+    bool_t _is_open;                                                  // Transaction status.
+
+    circuit_pt _circuit_ptr;                                          // Circuit pointer.
+
+    string_vt _inserted_gates;                                        // Inserted gates in order.
+    string_vt _removed_gates;                                         // Removed gates in order.
+    string_vt _inserted_nets;                                         // Inserted nets in order.
+    string_vt _removed_nets;                                          // Removed nets in order.
+    string_vt _repowered_gates;                                       // Resized gates in order.
+    string_vt _pin_names;                                             // Modified pins in order.
+    string_vt _removed_pins;                                          // Connected pins of removed gates.
+
+    string_to_string_umap_t _inserted_cell;                           // Cell per inserted gate.
+    string_to_string_umap_t _repowered_cell;                          // Cell per resized gate.
+    string_to_string_umap_t _pin_gate;                                // Gate per pin of inserted gates.
+    string_to_string_vt_umap_t _gate_pins;                            // Pins per inserted gate.
+    string_to_idx_umap_t _net_num_pins;                               // Pending number of pins per net.
+    string_to_idx_umap_t _net_version;                                // Version per removed net.
+
+    string_uset_t _is_removed_gate;                                   // Removed gates.
+    string_uset_t _is_removed_net;                                    // Removed nets.
+    string_uset_t _is_inserted_net;                                   // Inserted nets.
+
+    string_to_eco_pin_umap_t _pins;                                   // Modified pins.
+
+    eco_pin_t& _pin(string_crt);                                      // Query the pin connection.
+
+    string_vt _gate_pin_names(string_crt) const;                      // Query the pins of a gate.
+
+    size_t& _num_pins(string_crt);                                    // Query the pending number of pins.
+    size_t _version(string_crt) const;                                // Query the net version.
+
+    void_t _erase(string_vrt, string_crt) const;                      // Erase a name from a vector.
+
+    bool_t _is_changed(const eco_pin_t&) const;                       // Query the connection change.
+};
+
+// Function: is_open
+// Return true if an eco transaction is open.
+inline bool_t Eco::is_open() const {
+  return _is_open;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
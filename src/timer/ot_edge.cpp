@@ -22,6 +22,7 @@ Edge::Edge() {
     for(int from_rf=0; from_rf<2; from_rf++) {
       for(int to_rf=0; to_rf<2; to_rf++) {
         _delay[el][from_rf][to_rf] = OT_DEFAULT_EDGE_DELAY;
+        _propagated_delay[el][from_rf][to_rf] = OT_DEFAULT_EDGE_DELAY;
       }
     }
     _timing_arc_ptr[el] = NULL;
@@ -47,6 +48,14 @@ timing_pt Edge::timing_ptr(int el, int irf, int orf) {
   return timing_arc_ptr(el)->timing_ptr(irf, orf);
 }
 
+// Procedure: resize_corner_timing
+// Resize the timing arcs and the delays of the edge to a given number of corners. The timing
+// arcs of the new corners are unbound and their delays are zero.
+void_t Edge::resize_corner_timing(size_t num_corners) {
+  _corner_timing_arc_ptrs.resize(num_corners << 1, nullptr);
+  _corner_delays.resize(num_corners << 4, OT_DEFAULT_EDGE_DELAY);
+}
+
 //-------------------------------------------------------------------------------------------------
 
 // Constructor.
@@ -30,6 +30,10 @@ class Edge {
     ~Edge();                                                // Destructor.
 
     inline float_t delay(int, int, int) const;              // Query the delay.
+    inline float_t propagated_delay(int, int, int) const;   // Query the last propagated delay.
+    inline float_t corner_delay(size_t, int, int, int) const;            // Query the corner delay.
+    inline float_t corner_propagated_delay(size_t, int, int, int) const; // Query the last propagated corner delay.
+    inline float_cvrt corner_delays() const;                // Query the corner delays.
 
     inline edge_type_e type() const;                        // Query the egde type.
     inline edge_type_e edge_type() const;                   // Query the edge type.
@@ -39,6 +43,9 @@ class Edge {
     inline node_pt to_node_ptr() const;                     // Query the to-node pointer.
 
     inline timing_arc_pt timing_arc_ptr(int) const;         // Query the timing-arc pointer.
+    inline timing_arc_pt corner_timing_arc_ptr(size_t, int) const;  // Query the corner timing-arc pointer.
+
+    inline size_t num_corners() const;                      // Query the corner count.
 
     inline net_pt net_ptr() const;                          // Query the net pointer.
 
@@ -50,9 +57,14 @@ class Edge {
     inline void_t set_edge_type(edge_type_ce);              // Set the edge type.
     inline void_t set_timing_sense(timing_sense_ce);        // Set the timing sense.
     inline void_t set_delay(int, int, int, float_ct);       // Set the delay
+    inline void_t set_propagated_delay(int, int, int, float_ct); // Set the last propagated delay.
     inline void_t set_from_node_ptr(node_pt);               // Set the from-node pointer.
     inline void_t set_to_node_ptr(node_pt);                 // Set the to-node pointer.
     inline void_t set_timing_arc_ptr(int, timing_arc_pt);   // Set the timing-arc pointer.
+    inline void_t set_corner_timing_arc_ptr(size_t, int, timing_arc_pt);   // Set the corner timing-arc pointer.
+    inline void_t set_corner_delay(size_t, int, int, int, float_ct);       // Set the corner delay.
+    inline void_t set_corner_propagated_delay(size_t, int, int, int, float_ct); // Set the last propagated corner delay.
+    inline void_t set_corner_delays(float_cvrt);            // Set the corner delays.
     inline void_t set_net_ptr(net_pt);                      // Set the net pointer (net arc).
     inline void_t set_fanin_satellite(edgelist_iter_t);     // Set the fanin satellite.
     inline void_t set_fanout_satellite(edgelist_iter_t);    // Set the fanout satellite.
@@ -60,6 +72,8 @@ class Edge {
     
     timing_pt timing_ptr(int, int, int);                    // Query the timing ptr.
 
+    void_t resize_corner_timing(size_t);                    // Resize the corner timing.
+
     Net & operator = (const Net &) = delete;                // Disable copy assignment.
 
   private:
@@ -68,6 +82,7 @@ class Edge {
     timing_sense_e _timing_sense;                           // Timing sense.
 
     float_t _delay[2][2][2];                                // Delay (el/irf/orf).
+    float_t _propagated_delay[2][2][2];                     // Delay last seen by the from-node.
 
     net_pt _net_ptr;                                        // Net pointer (net arc).
 
@@ -79,6 +94,11 @@ class Edge {
     edgelist_iter_t _edgelist_satellite;                    // Edgelist satellite.
 
     timing_arc_pt _timing_arc_ptr[2];                       // Timing-arc pointer.
+
+    timing_arcs_vt _corner_timing_arc_ptrs;                 // Corner timing-arc pointers (corner/el).
+    float_vt _corner_delays;                                // Corner delays (corner/delay/el/irf/orf).
+
+    inline size_t _corner_delay_idx(size_t, int, int, int, int) const;   // Query the corner delay idx.
 };
 
 // Procedure: set_type
@@ -101,6 +121,11 @@ inline void_t Edge::set_delay(int el, int irf, int orf, float_ct delay) {
   __numeric_guard(_delay[el][irf][orf] = delay);
 }
 
+// Procedure: set_propagated_delay
+inline void_t Edge::set_propagated_delay(int el, int irf, int orf, float_ct delay) {
+  _propagated_delay[el][irf][orf] = delay;
+}
+
 // Procedure: set_from_node_ptr
 // Set the from node pointer.
 inline void_t Edge::set_from_node_ptr(node_pt node_ptr) {
@@ -167,6 +192,12 @@ inline float_t Edge::delay(int el, int irf, int orf) const {
   return _delay[el][irf][orf];
 }
 
+// Function: propagated_delay
+// Return the delay that was last propagated to the required arrival time of the from-node.
+inline float_t Edge::propagated_delay(int el, int irf, int orf) const {
+  return _propagated_delay[el][irf][orf];
+}
+
 // Function: from_node_ptr
 // Return the from node pointer.
 inline node_pt Edge::from_node_ptr() const {
@@ -185,6 +216,60 @@ inline timing_arc_pt Edge::timing_arc_ptr(int el) const {
   return _timing_arc_ptr[el];
 }
 
+// Function: corner_timing_arc_ptr
+// Return the timing arc pointer of a corner, or nullptr if the corner lacks the timing arc.
+inline timing_arc_pt Edge::corner_timing_arc_ptr(size_t c, int el) const {
+  return _corner_timing_arc_ptrs[(c << 1) | el];
+}
+
+// Function: num_corners
+inline size_t Edge::num_corners() const {
+  return _corner_delays.size() >> 4;
+}
+
+// Function: _corner_delay_idx
+// Return the index of a corner delay, where the delay is the current delay (0) or the delay
+// last propagated to the required arrival time of the from-node (1).
+inline size_t Edge::_corner_delay_idx(size_t c, int d, int el, int irf, int orf) const {
+  return (c << 4) | (d << 3) | (el << 2) | (irf << 1) | orf;
+}
+
+// Function: corner_delay
+inline float_t Edge::corner_delay(size_t c, int el, int irf, int orf) const {
+  return _corner_delays[_corner_delay_idx(c, 0, el, irf, orf)];
+}
+
+// Function: corner_propagated_delay
+inline float_t Edge::corner_propagated_delay(size_t c, int el, int irf, int orf) const {
+  return _corner_delays[_corner_delay_idx(c, 1, el, irf, orf)];
+}
+
+// Function: corner_delays
+// Return the delays of all corners as a whole, e.g., for the state journal.
+inline float_cvrt Edge::corner_delays() const {
+  return _corner_delays;
+}
+
+// Procedure: set_corner_timing_arc_ptr
+inline void_t Edge::set_corner_timing_arc_ptr(size_t c, int el, timing_arc_pt timing_arc_ptr) {
+  _corner_timing_arc_ptrs[(c << 1) | el] = timing_arc_ptr;
+}
+
+// Procedure: set_corner_delay
+inline void_t Edge::set_corner_delay(size_t c, int el, int irf, int orf, float_ct delay) {
+  _corner_delays[_corner_delay_idx(c, 0, el, irf, orf)] = delay;
+}
+
+// Procedure: set_corner_propagated_delay
+inline void_t Edge::set_corner_propagated_delay(size_t c, int el, int irf, int orf, float_ct delay) {
+  _corner_delays[_corner_delay_idx(c, 1, el, irf, orf)] = delay;
+}
+
+// Procedure: set_corner_delays
+inline void_t Edge::set_corner_delays(float_cvrt delays) {
+  _corner_delays = delays;
+}
+
 // Function: net_ptr
 // Return the net pointer.
 inline net_pt Edge::net_ptr() const {
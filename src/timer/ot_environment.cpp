@@ -89,6 +89,22 @@ void_t Environment::parse_environment_tau2015(int argc, char **argv) {
   ss >> token;                                              // verilog file path.
   _verilog_fpath = _tau2015_wrapper_fdir + token;
 
+  // Optional block models of a hierarchical design, one per line in the form of
+  // <model_name> <early.lib> <late.lib>.
+  _model_names.clear();
+  EL_ITER(el) {
+    _model_celllib_fpaths[el].clear();
+  }
+
+  while(getline(ifs, line)) {
+    string_t name, early_token, late_token;
+    stringstream model_ss(line);
+    if(!(model_ss >> name >> early_token >> late_token)) continue;
+    _model_names.push_back(name);
+    _model_celllib_fpaths[EARLY].push_back(_tau2015_wrapper_fdir + early_token);
+    _model_celllib_fpaths[LATE].push_back(_tau2015_wrapper_fdir + late_token);
+  }
+
   ifs.close();
 }
 
@@ -60,6 +60,10 @@ class Environment {
     inline string_crt lef_fpath() const;                    // Query the lef file path.
     inline string_crt def_fpath() const;                    // Query the def file path.
     inline string_crt tau2016_macro_name() const;           // Query the abs file path.
+    inline string_crt model_name(size_t) const;             // Query the block model name.
+    inline string_crt model_celllib_fpath(int, size_t) const;  // Query the model library path.
+
+    inline size_t num_models() const;                       // Query the block model count.
 
     inline file_pt rpt_fptr();                              // Query the report file ptr.
 
@@ -84,6 +88,9 @@ class Environment {
     string_t _lef_fpath;                                    // LEF file path.
     string_t _def_fpath;                                    // DEF file path.
 
+    string_vt _model_names;                                 // Block model names.
+    string_vt _model_celllib_fpaths[2];                     // Early/Late model library paths.
+
     file_pt _rpt_fptr;                                      // Report file ptr.
 };
 
@@ -219,6 +226,24 @@ inline string_crt Environment::tau2016_macro_name() const {
   return _tau2016_macro_name;
 }
 
+// Function: model_name
+// Return the name of the i-th block model.
+inline string_crt Environment::model_name(size_t i) const {
+  return _model_names[i];
+}
+
+// Function: model_celllib_fpath
+// Return the early or late library file path of the i-th block model.
+inline string_crt Environment::model_celllib_fpath(int el, size_t i) const {
+  return _model_celllib_fpaths[el][i];
+}
+
+// Function: num_models
+// Return the number of block models.
+inline size_t Environment::num_models() const {
+  return _model_names.size();
+}
+
 // Function: num_threads
 // Return the number of threads.
 inline int Environment::num_threads() const {
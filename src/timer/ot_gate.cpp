@@ -19,6 +19,9 @@ namespace __OpenTimer {
 Gate::Gate(string_crt key):
   _name(key),
   _weight(OT_FLT_ZERO),
+  _width(OT_FLT_ZERO),
+  _height(OT_FLT_ZERO),
+  _macro_ptr(nullptr),
   _cell_ptr{nullptr, nullptr},
   _mobility(UNDEFINED_MOBILITY),
   _orientation(UNDEFINED_ORIENTATION),
@@ -33,14 +33,21 @@ class Gate {
     inline cell_pt cell_ptr(int) const;                                     // Query the cell pointer.
 
     inline point_crt location() const;                                      // Query the location.
+    inline point_t center() const;                                          // Query the center.
     
     inline mobility_e mobility() const;                                     // Query the mobility.
     inline orientation_e orientation() const;                               // Query the orientation.
     inline gate_source_e source() const;                                    // Query the gate source.
 
     inline float_t weight() const;                                          // Query the weight.
+    inline float_t width() const;                                           // Query the width.
+    inline float_t height() const;                                          // Query the height.
+
+    inline macro_pt macro_ptr() const;                                      // Query the macro pointer.
 
     inline void_t set_weight(float_ct);                                     // Set the weight.
+    inline void_t set_size(float_ct, float_ct);                             // Set the size.
+    inline void_t set_macro_ptr(macro_pt);                                  // Set the macro pointer.
     inline void_t set_cell_ptr(int, cell_pt);                               // Set the cell pointer.
     inline void_t set_source(gate_source_ce);                               // Set the gate source.
     inline void_t set_mobility(mobility_ce);                                // Set the mobility.
@@ -56,6 +63,10 @@ class Gate {
     point_t _location;                                                      // Location.
 
     float_t _weight;                                                        // Weight.
+    float_t _width;                                                         // Width.
+    float_t _height;                                                        // Height.
+
+    macro_pt _macro_ptr;                                                    // Lef macro pointer.
 
     cell_pt _cell_ptr[2];                                                   // Cell pointer.
 
@@ -125,6 +136,14 @@ inline point_crt Gate::location() const {
   return _location;
 }
 
+// Function: center
+// Query the center of the placed gate. The gate occupies its oriented size from the location,
+// and the center falls back to the location if the size is unknown.
+inline point_t Gate::center() const {
+  if(_location.x() == OT_UNDEFINED_COORDINATE) return _location;
+  return point_t(_location.x() + _width / OT_FLT_TWO, _location.y() + _height / OT_FLT_TWO);
+}
+
 // Procedure: set_location
 // Set the location.
 inline void_t Gate::set_location(point_t::value_t x, point_t::value_t y) {
@@ -150,6 +169,37 @@ inline float_t Gate::weight() const {
   return _weight;
 }
 
+// Function: width
+// Query the width of the oriented gate in the database unit.
+inline float_t Gate::width() const {
+  return _width;
+}
+
+// Function: height
+// Query the height of the oriented gate in the database unit.
+inline float_t Gate::height() const {
+  return _height;
+}
+
+// Procedure: set_size
+// Set the width and height of the oriented gate in the database unit.
+inline void_t Gate::set_size(float_ct width, float_ct height) {
+  _width = width;
+  _height = height;
+}
+
+// Function: macro_ptr
+// Query the lef macro of the gate.
+inline macro_pt Gate::macro_ptr() const {
+  return _macro_ptr;
+}
+
+// Procedure: set_macro_ptr
+// Set the lef macro of the gate.
+inline void_t Gate::set_macro_ptr(macro_pt macro_ptr) {
+  _macro_ptr = macro_ptr;
+}
+
 // Function: mobility
 // Return the mobility.
 inline mobility_e Gate::mobility() const {
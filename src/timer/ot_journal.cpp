@@ -0,0 +1,242 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_journal.h"
+#include "ot_node.h"
+#include "ot_edge.h"
+#include "ot_test.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+JournalNodeRecord::JournalNodeRecord(node_pt node_ptr):
+  _node_ptr(node_ptr),
+  _corner_timing(node_ptr->corner_timing())
+{
+  EL_RF_ITER(el, rf) {
+    _slew[el][rf] = node_ptr->slew(el, rf);
+    _at[el][rf] = node_ptr->at(el, rf);
+    _rat[el][rf] = node_ptr->rat(el, rf);
+    _propagated_slew[el][rf] = node_ptr->propagated_slew(el, rf);
+    _propagated_at[el][rf] = node_ptr->propagated_at(el, rf);
+    _propagated_rat[el][rf] = node_ptr->propagated_rat(el, rf);
+    _is_at_clocked[el][rf] = node_ptr->is_at_clocked(el, rf);
+    _at_parent_rf[el][rf] = node_ptr->at_parent_rf(el, rf);
+    _at_parent_ptr[el][rf] = node_ptr->at_parent_ptr(el, rf);
+  }
+
+  _fanin_ptrs.reserve(node_ptr->num_fanins());
+  _delays.reserve(node_ptr->num_fanins() << 3);
+  _propagated_delays.reserve(node_ptr->num_fanins() << 3);
+
+  for(const auto& e : node_ptr->fanin()) {
+    _fanin_ptrs.push_back(e);
+    EL_RF_RF_ITER(el, irf, orf) {
+      _delays.push_back(e->delay(el, irf, orf));
+      _propagated_delays.push_back(e->propagated_delay(el, irf, orf));
+    }
+    _corner_delays.insert(_corner_delays.end(), e->corner_delays().begin(), e->corner_delays().end());
+  }
+}
+
+// Destructor.
+JournalNodeRecord::~JournalNodeRecord() {
+
+}
+
+// Procedure: restore
+// Write the recorded timing back to the node and its fanin edges. The fanin edges must be the
+// same as when the record was made, which holds for frames without structural changes.
+void_t JournalNodeRecord::restore() const {
+
+  EL_RF_ITER(el, rf) {
+    _node_ptr->set_slew(el, rf, _slew[el][rf]);
+    _node_ptr->set_at(el, rf, _at[el][rf]);
+    _node_ptr->set_rat(el, rf, _rat[el][rf]);
+    _node_ptr->set_propagated_slew(el, rf, _propagated_slew[el][rf]);
+    _node_ptr->set_propagated_at(el, rf, _propagated_at[el][rf]);
+    _node_ptr->set_propagated_rat(el, rf, _propagated_rat[el][rf]);
+    _node_ptr->set_is_at_clocked(el, rf, _is_at_clocked[el][rf]);
+    _node_ptr->set_at_parent_rf(el, rf, _at_parent_rf[el][rf]);
+    _node_ptr->set_at_parent_ptr(el, rf, _at_parent_ptr[el][rf]);
+  }
+
+  _node_ptr->set_corner_timing(_corner_timing);
+
+  size_t k = 0, c = 0;
+  for(const auto& e : _fanin_ptrs) {
+    EL_RF_RF_ITER(el, irf, orf) {
+      e->set_delay(el, irf, orf, _delays[k]);
+      e->set_propagated_delay(el, irf, orf, _propagated_delays[k++]);
+    }
+    auto n = e->corner_delays().size();
+    e->set_corner_delays(float_vt(_corner_delays.begin() + c, _corner_delays.begin() + c + n));
+    c += n;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+JournalTestRecord::JournalTestRecord(test_pt test_ptr):
+  _test_ptr(test_ptr),
+  _corner_rat(test_ptr->corner_rat())
+{
+  EL_RF_ITER(el, rf) {
+    _rat[el][rf] = test_ptr->rat(el, rf);
+    _slack[el][rf] = test_ptr->endpoint_ptr(el, rf)->slack();
+  }
+}
+
+// Destructor.
+JournalTestRecord::~JournalTestRecord() {
+
+}
+
+// Procedure: restore
+// Write the recorded rat and endpoint slacks back to the test. The caller is responsible for
+// the position of the endpoints in the endpoint heap.
+void_t JournalTestRecord::restore() const {
+  EL_RF_ITER(el, rf) {
+    _test_ptr->set_rat(el, rf, _rat[el][rf]);
+    _test_ptr->endpoint_ptr(el, rf)->set_slack(_slack[el][rf]);
+  }
+  _test_ptr->set_corner_rat(_corner_rat);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+JournalFrame::JournalFrame(int_ct serial):
+  _serial(serial),
+  _is_structural(false),
+  _is_reversible(true)
+{
+}
+
+// Destructor.
+JournalFrame::~JournalFrame() {
+
+}
+
+// Procedure: merge
+// Append the content of a later frame to this frame, such that popping this frame also undoes
+// the changes of the later frame. Records are restored in the reverse order, so a node recorded
+// in both frames ends up with the value recorded by this frame.
+void_t JournalFrame::merge(journal_frame_rt rhs) {
+
+  _is_structural = _is_structural || rhs.is_structural();
+  _is_reversible = _is_reversible && rhs.is_reversible();
+
+  _node_records.insert(
+    _node_records.end(), 
+    std::make_move_iterator(rhs.node_records().begin()), 
+    std::make_move_iterator(rhs.node_records().end())
+  );
+  
+  _test_records.insert(
+    _test_records.end(), rhs.test_records().begin(), rhs.test_records().end()
+  );
+
+  for(auto& u : rhs.undos()) {
+    _undos.push_back(std::move(u));
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+Journal::Journal():
+  _is_suspended(false),
+  _num_serials(0)
+{
+}
+
+// Destructor.
+Journal::~Journal() {
+
+}
+
+// Procedure: push
+// Push a new frame onto the stack.
+void_t Journal::push() {
+  _frames.emplace_back(++_num_serials);
+}
+
+// Procedure: pop
+// Move the top frame out of the stack.
+void_t Journal::pop(journal_frame_rt frame) {
+  CHECK(!_frames.empty());
+  frame = std::move(_frames.back());
+  _frames.pop_back();
+}
+
+// Procedure: merge
+// Merge the top frame into the frame below it. If the top frame is the only frame, its content
+// is dropped and the changes are kept.
+void_t Journal::merge() {
+  CHECK(!_frames.empty());
+  if(_frames.size() >= 2) {
+    _frames[_frames.size() - 2].merge(_frames.back());
+  }
+  _frames.pop_back();
+}
+
+// Procedure: insert_node_record
+// Record the timing of a node and the test it constrains, unless the node has already been
+// recorded in the top frame. The procedure is not thread-safe.
+void_t Journal::insert_node_record(node_pt node_ptr) {
+
+  if(!is_recording()) return;
+
+  size_t idx = node_ptr->idx();
+
+  if(idx >= _node_serial.size()) {
+    _node_serial.resize(idx + 1, 0);
+  }
+
+  if(_node_serial[idx] == top().serial()) return;
+
+  _node_serial[idx] = top().serial();
+
+  top().node_records().emplace_back(node_ptr);
+
+  if(node_ptr->is_constrained()) {
+    top().test_records().emplace_back(node_ptr->pin_ptr()->test_ptr());
+  }
+}
+
+// Procedure: insert_undo
+// Record an operation that undoes a netlist modification.
+void_t Journal::insert_undo(journal_undo_t&& undo) {
+  if(!is_recording()) return;
+  top().undos().push_back(std::move(undo));
+}
+
+// Procedure: set_is_structural
+// Mark the top frame as containing modifications to the graph topology.
+void_t Journal::set_is_structural() {
+  if(!is_recording()) return;
+  top().set_is_structural(true);
+}
+
+// Procedure: set_is_irreversible
+// Mark the top frame as containing modifications that cannot be undone.
+void_t Journal::set_is_irreversible() {
+  if(!is_recording()) return;
+  top().set_is_reversible(false);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
@@ -0,0 +1,247 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_JOURNAL_H_
+#define OT_JOURNAL_H_
+
+#include "ot_utility.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: JournalNodeRecord
+// A node record keeps the timing of a node and the delays of its fanin edges as they were before
+// the node was first recomputed in a journal frame, together with the values last propagated
+// from them, against which the timing change epsilon is applied.
+class JournalNodeRecord {
+
+  public:
+
+    JournalNodeRecord(node_pt);                                       // Constructor.
+    ~JournalNodeRecord();                                             // Destructor.
+    JournalNodeRecord(JournalNodeRecord&&) = default;                 // Move constructor.
+    JournalNodeRecord& operator = (JournalNodeRecord&&) = default;    // Move assignment.
+
+    inline node_pt node_ptr() const;                                  // Query the node pointer.
+
+    void_t restore() const;                                           // Restore the node timing.
+
+  private:
+
+    node_pt _node_ptr;                                                // Node pointer.
+
+    float_t _slew[2][2];                                              // Slew.
+    float_t _at[2][2];                                                // Arrival time.
+    float_t _rat[2][2];                                               // Required arrival time.
+    float_t _propagated_slew[2][2];                                   // Last propagated slew.
+    float_t _propagated_at[2][2];                                     // Last propagated at.
+    float_t _propagated_rat[2][2];                                    // Last propagated rat.
+
+    bool_t _is_at_clocked[2][2];                                      // Clock tree propagated.
+
+    int _at_parent_rf[2][2];                                          // Parent node transition.
+    node_pt _at_parent_ptr[2][2];                                     // Parent node pointer.
+
+    float_vt _corner_timing;                                          // Corner timing.
+
+    edge_ptr_vt _fanin_ptrs;                                          // Fanin edges.
+    float_vt _delays;                                                 // Fanin edge delays.
+    float_vt _propagated_delays;                                      // Last propagated delays.
+    float_vt _corner_delays;                                          // Fanin edge corner delays.
+};
+
+// Function: node_ptr
+inline node_pt JournalNodeRecord::node_ptr() const {
+  return _node_ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: JournalTestRecord
+// A test record keeps the required arrival time of a test and the slacks of its endpoints.
+class JournalTestRecord {
+
+  public:
+
+    JournalTestRecord(test_pt);                                       // Constructor.
+    ~JournalTestRecord();                                             // Destructor.
+
+    inline test_pt test_ptr() const;                                  // Query the test pointer.
+
+    void_t restore() const;                                           // Restore the test timing.
+
+  private:
+
+    test_pt _test_ptr;                                                // Test pointer.
+
+    float_t _rat[2][2];                                               // Required arrival time.
+    float_t _slack[2][2];                                             // Endpoint slack.
+
+    float_vt _corner_rat;                                             // Corner rat.
+};
+
+// Function: test_ptr
+inline test_pt JournalTestRecord::test_ptr() const {
+  return _test_ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: JournalFrame
+// A journal frame stores everything that is changed between a push_state and the matching
+// pop_state. Timing values are kept as records and netlist modifications are kept as undo
+// operations that are applied in the reverse order.
+class JournalFrame {
+
+  public:
+
+    JournalFrame(int_ct);                                             // Constructor.
+    ~JournalFrame();                                                  // Destructor.
+    JournalFrame(JournalFrame&&) = default;                           // Move constructor.
+    JournalFrame& operator = (JournalFrame&&) = default;              // Move assignment.
+
+    inline int_t serial() const;                                      // Query the frame serial.
+
+    inline bool_t is_structural() const;                              // Query the structural status.
+    inline bool_t is_reversible() const;                              // Query the reversible status.
+
+    inline journal_node_record_vt& node_records();                    // Query the node records.
+    inline journal_test_record_vt& test_records();                    // Query the test records.
+    inline journal_undo_vt& undos();                                  // Query the undo operations.
+
+    inline void_t set_is_structural(bool_ct);                         // Set the structural status.
+    inline void_t set_is_reversible(bool_ct);                         // Set the reversible status.
+
+    void_t merge(journal_frame_rt);                                   // Merge a later frame.
+
+  private:
+
+    int_t _serial;                                                    // Frame serial.
+
+    bool_t _is_structural;                                            // Graph topology changed.
+    bool_t _is_reversible;                                            // All changes can be undone.
+
+    journal_node_record_vt _node_records;                             // Node records.
+    journal_test_record_vt _test_records;                             // Test records.
+    journal_undo_vt _undos;                                           // Undo operations.
+};
+
+// Function: serial
+inline int_t JournalFrame::serial() const {
+  return _serial;
+}
+
+// Function: is_structural
+// Return true if the frame contains modifications that insert or remove edges.
+inline bool_t JournalFrame::is_structural() const {
+  return _is_structural;
+}
+
+// Function: is_reversible
+// Return true if every modification in the frame has an undo operation.
+inline bool_t JournalFrame::is_reversible() const {
+  return _is_reversible;
+}
+
+// Function: node_records
+inline journal_node_record_vt& JournalFrame::node_records() {
+  return _node_records;
+}
+
+// Function: test_records
+inline journal_test_record_vt& JournalFrame::test_records() {
+  return _test_records;
+}
+
+// Function: undos
+inline journal_undo_vt& JournalFrame::undos() {
+  return _undos;
+}
+
+// Procedure: set_is_structural
+inline void_t JournalFrame::set_is_structural(bool_ct flag) {
+  _is_structural = flag;
+}
+
+// Procedure: set_is_reversible
+inline void_t JournalFrame::set_is_reversible(bool_ct flag) {
+  _is_reversible = flag;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: Journal
+// The journal is a stack of frames. While there is at least one frame, the timer records the
+// timing of every node it recomputes into the top frame, at most once per node and frame.
+class Journal {
+
+  public:
+
+    Journal();                                                        // Constructor.
+    ~Journal();                                                       // Destructor.
+
+    inline size_t num_frames() const;                                 // Query the number of frames.
+
+    inline bool_t is_recording() const;                               // Query the recording status.
+
+    inline journal_frame_rt top();                                    // Query the top frame.
+
+    inline void_t set_is_suspended(bool_ct);                          // Suspend the recording.
+
+    void_t push();                                                    // Push a new frame.
+    void_t pop(journal_frame_rt);                                     // Pop the top frame.
+    void_t merge();                                                   // Merge the top frame.
+    void_t insert_node_record(node_pt);                               // Record a node.
+    void_t insert_undo(journal_undo_t&&);                             // Record an undo operation.
+    void_t set_is_structural();                                       // Mark a structural change.
+    void_t set_is_irreversible();                                     // Mark an irreversible change.
+
+  private:
+
+    bool_t _is_suspended;                                             // Suspension status.
+
+    int_t _num_serials;                                               // Serial counter.
+
+    int_vt _node_serial;                                              // Latest frame of a node record.
+
+    journal_frame_vt _frames;                                         // Frame stack.
+};
+
+// Function: num_frames
+inline size_t Journal::num_frames() const {
+  return _frames.size();
+}
+
+// Function: is_recording
+// Return true if there is an open frame and the recording is not suspended.
+inline bool_t Journal::is_recording() const {
+  return !_frames.empty() && !_is_suspended;
+}
+
+// Function: top
+inline journal_frame_rt Journal::top() {
+  CHECK(!_frames.empty());
+  return _frames.back();
+}
+
+// Procedure: set_is_suspended
+inline void_t Journal::set_is_suspended(bool_ct flag) {
+  _is_suspended = flag;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
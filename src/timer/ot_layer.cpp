@@ -17,7 +17,14 @@ namespace __OpenTimer {
 
 // Constructor.
 Layer::Layer(string_crt key):
-  _name(key)
+  _name(key),
+  _idx(0),
+  _width(OT_FLT_ZERO),
+  _resistance(OT_FLT_ZERO),
+  _capacitance(OT_FLT_ZERO),
+  _edge_capacitance(OT_FLT_ZERO),
+  _layer_direction(UNDEFINED_LAYER_DIRECTION),
+  _layer_type(UNDEFINED_LAYER_TYPE)
 {
 
 }
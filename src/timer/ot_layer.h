@@ -29,6 +29,9 @@ class Layer {
     
     inline string_crt name() const;                         // Query the site name.
 
+    inline size_t idx() const;                              // Query the order in the lef file.
+    inline void_t set_idx(size_t);                          // Set the order in the lef file.
+
     inline void_t set_type(layer_type_e);                   // Set the layer type.
     inline void_t set_direction(layer_direction_e);         // Set the layer direction.
     inline void_t set_width(float_ct);                      // Set the width.
@@ -36,12 +39,18 @@ class Layer {
     inline void_t set_ypitch(float_ct);                     // Set the pitch.
     inline void_t set_xoffset(float_ct);                    // Set offset. 
     inline void_t set_yoffset(float_ct);                    // Set offset. 
+    inline void_t set_resistance(float_ct);                 // Set the sheet resistance.
+    inline void_t set_capacitance(float_ct);                // Set the area capacitance.
+    inline void_t set_edge_capacitance(float_ct);           // Set the edge capacitance.
 
     inline float_t width() const;                           // Query the width.
     inline float_t xpitch() const;                          // Query the pitch.
     inline float_t ypitch() const;                          // Query the pitch.
     inline float_t xoffset() const;                         // Query the offset.
     inline float_t yoffset() const;                         // Query the offset.
+    inline float_t resistance() const;                      // Query the sheet resistance.
+    inline float_t capacitance() const;                     // Query the area capacitance.
+    inline float_t edge_capacitance() const;                // Query the edge capacitance.
 
     inline layer_type_e layer_type() const;                 // Layer type.
     inline layer_direction_e layer_direction() const;       // Layer direction.
@@ -50,11 +59,16 @@ class Layer {
 
     string_t _name;                                         // name. 
 
+    size_t _idx;                                            // Order in the lef file.
+
     float_t _width;                                         // Width.
     float_t _xpitch;                                        // Pitch.
     float_t _ypitch;                                        // Pitch.
     float_t _xoffset;                                       // Offset.
     float_t _yoffset;                                       // Offset.
+    float_t _resistance;                                    // Resistance per square.
+    float_t _capacitance;                                   // Capacitance per square distance.
+    float_t _edge_capacitance;                              // Capacitance per edge distance.
 
     layer_direction_e _layer_direction;                     // Layer direction.
     layer_type_e _layer_type;                               // Layer type.
@@ -66,6 +80,17 @@ inline string_crt Layer::name() const {
   return _name;
 }
 
+// Function: idx
+// Query the order of the layer in the lef file, which lists the layers from the bottom up.
+inline size_t Layer::idx() const {
+  return _idx;
+}
+
+// Procedure: set_idx
+inline void_t Layer::set_idx(size_t idx) {
+  _idx = idx;
+}
+
 // Function: width
 inline float_t Layer::width() const {
   return _width;
@@ -91,6 +116,24 @@ inline float_t Layer::yoffset() const {
   return _yoffset;
 }
 
+// Function: resistance
+// Query the sheet resistance of the wire in ohms per square.
+inline float_t Layer::resistance() const {
+  return _resistance;
+}
+
+// Function: capacitance
+// Query the area capacitance of the wire in picofarads per square micron.
+inline float_t Layer::capacitance() const {
+  return _capacitance;
+}
+
+// Function: edge_capacitance
+// Query the peripheral capacitance of the wire in picofarads per micron.
+inline float_t Layer::edge_capacitance() const {
+  return _edge_capacitance;
+}
+
 // Procedure: set_type
 inline void_t Layer::set_type(layer_type_e layer_type) {
   _layer_type = layer_type;
@@ -121,6 +164,21 @@ inline void_t Layer::set_yoffset(float_ct offset) {
   _yoffset = offset;
 }
 
+// Procedure: set_resistance
+inline void_t Layer::set_resistance(float_ct resistance) {
+  _resistance = resistance;
+}
+
+// Procedure: set_capacitance
+inline void_t Layer::set_capacitance(float_ct capacitance) {
+  _capacitance = capacitance;
+}
+
+// Procedure: set_edge_capacitance
+inline void_t Layer::set_edge_capacitance(float_ct capacitance) {
+  _edge_capacitance = capacitance;
+}
+
 // Procedure: set_direction
 inline void_t Layer::set_direction(layer_direction_e layer_direction) {
   _layer_direction = layer_direction;
@@ -521,16 +521,19 @@ int LEFReader::layer_cbk(lefrCallbackType_e c, lefiLayer* layer, void* ud) {
     #ifdef LEF_CALLBACK_VERBOSITY
     printf("  TYPE %s ;\n", layer->type());
     #endif
-    if(strcmp(layer->type(), "ROUTINE")) {
+    if(strcmp(layer->type(), "ROUTING") == 0) {
       reader->layer_cursor()->set_type(ROUTING_LAYER_TYPE);
     }
-    else if(strcmp(layer->type(), "CUT")) {
+    else if(strcmp(layer->type(), "CUT") == 0) {
       reader->layer_cursor()->set_type(CUT_LAYER_TYPE);
     }
-    else if(strcmp(layer->type(), "OVERLAP")) {
+    else if(strcmp(layer->type(), "IMPLANT") == 0) {
+      reader->layer_cursor()->set_type(IMPLANT_LAYER_TYPE);
+    }
+    else if(strcmp(layer->type(), "OVERLAP") == 0) {
       reader->layer_cursor()->set_type(OVERLAP_LAYER_TYPE);
     }
-    else if(strcmp(layer->type(), "MASTERSLICE")) {
+    else if(strcmp(layer->type(), "MASTERSLICE") == 0) {
       reader->layer_cursor()->set_type(MASTERSLICE_LAYER_TYPE);
     }
     else {
@@ -856,14 +859,24 @@ int LEFReader::layer_cbk(lefrCallbackType_e c, lefiLayer* layer, void* ud) {
       CHECK(false);
     }
   }
-  if (layer->hasResistance())
-     printf("  RESISTANCE RPERSQ %g ;\n",
-             layer->resistance());
-  if (layer->hasCapacitance())
-     printf("  CAPACITANCE CPERSQDIST %g ;\n",
-             layer->capacitance());
-  if (layer->hasEdgeCap())
-     printf("  EDGECAPACITANCE %g ;\n", layer->edgeCap());
+  if (layer->hasResistance()) {
+    #ifdef LEF_CALLBACK_VERBOSITY
+    printf("  RESISTANCE RPERSQ %g ;\n", layer->resistance());
+    #endif
+    reader->layer_cursor()->set_resistance(layer->resistance());
+  }
+  if (layer->hasCapacitance()) {
+    #ifdef LEF_CALLBACK_VERBOSITY
+    printf("  CAPACITANCE CPERSQDIST %g ;\n", layer->capacitance());
+    #endif
+    reader->layer_cursor()->set_capacitance(layer->capacitance());
+  }
+  if (layer->hasEdgeCap()) {
+    #ifdef LEF_CALLBACK_VERBOSITY
+    printf("  EDGECAPACITANCE %g ;\n", layer->edgeCap());
+    #endif
+    reader->layer_cursor()->set_edge_capacitance(layer->edgeCap());
+  }
   if (layer->hasHeight())
      printf("  TYPE %g ;\n", layer->height());
   if (layer->hasThickness())
@@ -0,0 +1,48 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_model.h"
+#include "ot_celllib.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+Model::Model(string_crt name):
+  _name(name)
+{
+  _celllib_uptr[EARLY].reset(new celllib_t());
+  _celllib_uptr[LATE].reset(new celllib_t());
+  celllib_ptr(EARLY)->set_library_type(LibraryType::EARLY_LIBRARY);
+  celllib_ptr(LATE)->set_library_type(LibraryType::LATE_LIBRARY);
+}
+
+// Destructor.
+Model::~Model() {
+}
+
+// Function: cell_ptr
+// Return the pointer to the cell of the model in the early or late library, or nullptr if the
+// library does not define a cell of the model name.
+cell_pt Model::cell_ptr(int el) const {
+  return celllib_ptr(el)->cell_ptr(_name);
+}
+
+// Procedure: read_celllib
+// Read the early or late cell library of the model.
+void_t Model::read_celllib(int el, string_crt fpath) {
+  celllib_ptr(el)->read(fpath);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
@@ -0,0 +1,63 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_MODEL_H_
+#define OT_MODEL_H_
+
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: Model
+// A model is the abstract timing model of a block in a hierarchical design, e.g., the macro
+// written by write_macro. It is a cell whose pins are the boundary pins of the block and whose
+// timing arcs are the boundary arcs of the block. The model owns the early and late libraries it
+// is read from, apart from the libraries of the timer and the corners, such that a block can be
+// re-extracted and swapped in without touching the other cells.
+class Model {
+
+  public:
+
+    Model(string_crt);                                                    // Constructor.
+    ~Model();                                                             // Destructor.
+
+    inline string_crt name() const;                                       // Query the name.
+    inline celllib_pt celllib_ptr(int) const;                             // Query the celllib pointer.
+
+    cell_pt cell_ptr(int) const;                                          // Query the cell pointer.
+
+    void_t read_celllib(int, string_crt);                                 // Read a celllib.
+
+  private:
+
+    string_t _name;                                                       // Model (cell) name.
+
+    celllib_upt _celllib_uptr[2];                                         // Early/Late celllib pointer.
+};
+
+// Function: name
+inline string_crt Model::name() const {
+  return _name;
+}
+
+// Function: celllib_ptr
+inline celllib_pt Model::celllib_ptr(int el) const {
+  return _celllib_uptr[el].get();
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -22,6 +22,8 @@ Net::Net(string_crt key):
                   {OT_DEFAULT_NET_LCAP, OT_DEFAULT_NET_LCAP}},
   _root_pin_ptr(nullptr),
   _rctree_ptr(nullptr),
+  _is_rctree_estimated(false),
+  _is_rctree_estimation_dirty(false),
   _pinlist_ptr(new pinlist_t())
 {
 }
@@ -38,6 +40,7 @@ void_t Net::destroy_rctree() {
     delete _rctree_ptr;
     _rctree_ptr = nullptr;
   }
+  _is_rctree_estimated = false;
 }
 
 // Procedure: insert_pin_ptr
@@ -131,7 +134,53 @@ bool_t Net::has_primary_output() const {
   return false;
 }
 
+// Function: HPWL
+// Return the half-perimeter wirelength of the bounding box of all placed pins of the net.
+float_t Net::HPWL() const {
 
-};  // End of OpenTimer namespace. ----------------------------------------------------------------
+  float_t lx(OT_FLT_MAX), ly(OT_FLT_MAX), ux(OT_FLT_MIN), uy(OT_FLT_MIN);
+  size_t num_placed_pins(0);
+
+  for(const auto& pin_ptr : pinlist()) {
+    if(!pin_ptr->is_placed()) continue;
+    point_t p = pin_ptr->placement();
+    lx = min(lx, p.x());
+    ly = min(ly, p.y());
+    ux = max(ux, p.x());
+    uy = max(uy, p.y());
+    ++num_placed_pins;
+  }
+
+  return num_placed_pins < 2 ? OT_FLT_ZERO : (ux - lx) + (uy - ly);
+}
+
+// Function: STWL
+// Return the wirelength of the single-trunk Steiner tree over all placed pins of the net. The 
+// trunk runs through the median of the pins either horizontally or vertically, whichever is 
+// shorter, and each pin is connected to the trunk by a perpendicular branch.
+float_t Net::STWL() const {
+
+  float_vt xs, ys;
 
+  for(const auto& pin_ptr : pinlist()) {
+    if(!pin_ptr->is_placed()) continue;
+    point_t p = pin_ptr->placement();
+    xs.push_back(p.x());
+    ys.push_back(p.y());
+  }
+
+  if(xs.size() < 2) return OT_FLT_ZERO;
+
+  auto trunk = [] (float_vt& along, float_vt& across) {
+    auto m = across.begin() + across.size() / 2;
+    nth_element(across.begin(), m, across.end());
+    float_t wl = *max_element(along.begin(), along.end()) - *min_element(along.begin(), along.end());
+    for(const auto& v : across) wl += fabs(v - *m);
+    return wl;
+  };
+
+  return min(trunk(xs, ys), trunk(ys, xs));
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
 
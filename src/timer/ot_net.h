@@ -49,11 +49,16 @@ class Net {
     inline pin_pt root_pin_ptr() const;                         // Query the root pin pointer.
 
     inline size_t num_pins() const;                             // Query the number of pins.
+
+    inline bool_t is_rctree_estimated() const;                  // Query if the rctree is estimated.
+    inline bool_t is_rctree_estimation_dirty() const;           // Query the estimation dirty status.
     
     inline void_t dupdate_total_leaf_cap(int, int, float_ct);   // Add the load capacitance.
     inline void_t set_total_leaf_cap(int, int, float_ct);       // Set the load capacitance.
     inline void_t set_root_pin_ptr(pin_pt);                     // Set the root pin pointer.
     inline void_t set_rctree_ptr(rctree_pt);                    // Set the rctree pointer.
+    inline void_t set_is_rctree_estimated(bool_ct);             // Set the rctree estimation flag.
+    inline void_t set_is_rctree_estimation_dirty(bool_ct);      // Set the estimation dirty status.
 
     bool_t has_primary_output() const;                          // Query the pinlist status.
     bool_t has_primary_input() const;                           // Query the pinlist status.
@@ -68,6 +73,8 @@ class Net {
 
     pin_pt _root_pin_ptr;                                       // Root pin pointer of the rctree.
     rctree_pt _rctree_ptr;                                      // RC-tree pointer.
+    bool_t _is_rctree_estimated;                                // RC-tree estimated from placement.
+    bool_t _is_rctree_estimation_dirty;                         // RC-tree must be re-estimated.
     pinlist_pt _pinlist_ptr;                                    // Pin ptr list type.
 };
 
@@ -139,6 +146,30 @@ inline rctree_pt Net::rctree_ptr() const {
   return _rctree_ptr;
 }
 
+// Function: is_rctree_estimated
+// Return true if the rctree is estimated from the placement rather than read from a spef file.
+inline bool_t Net::is_rctree_estimated() const {
+  return _is_rctree_estimated;
+}
+
+// Procedure: set_is_rctree_estimated
+// Set the flag that indicates the rctree is estimated from the placement.
+inline void_t Net::set_is_rctree_estimated(bool_ct flag) {
+  _is_rctree_estimated = flag;
+}
+
+// Function: is_rctree_estimation_dirty
+// Return true if the placement of the net has changed since its rctree was estimated.
+inline bool_t Net::is_rctree_estimation_dirty() const {
+  return _is_rctree_estimation_dirty;
+}
+
+// Procedure: set_is_rctree_estimation_dirty
+// Set the flag that indicates the rctree must be re-estimated.
+inline void_t Net::set_is_rctree_estimation_dirty(bool_ct flag) {
+  _is_rctree_estimation_dirty = flag;
+}
+
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
 
 #endif
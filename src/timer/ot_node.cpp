@@ -29,6 +29,9 @@ Node::Node() {
       _at  [el][rf] = OT_FLT_MIN;
       _rat [el][rf] = OT_FLT_MAX;
     }
+    _propagated_slew[el][rf] = _slew[el][rf];
+    _propagated_at  [el][rf] = _at  [el][rf];
+    _propagated_rat [el][rf] = _rat [el][rf];
     _is_at_clocked[el][rf] = false;
     _at_parent_rf[el][rf] = UNDEFINED_TRANS;
     _at_parent_ptr[el][rf] = nullptr;
@@ -36,7 +39,10 @@ Node::Node() {
 
   _idx = OT_UNDEFINED_IDX;
   _clock_tree_node_idx = OT_UNDEFINED_IDX;
+  _clock_tree_ptr = nullptr;
   _level = OT_DEFAULT_NODE_LEVEL;
+  _is_timing_dirty = true;
+  _is_jump_dirty = false;
 
   _pin_ptr = nullptr;
   _pipeline_satellite = nullptr;
@@ -90,6 +96,61 @@ void_t Node::remove_rat() {
   }
 }
 
+// Procedure: resize_corner_timing
+// Resize the timing of the node to a given number of corners. The timing of the new corners is
+// undefined.
+void_t Node::resize_corner_timing(size_t num_corners) {
+
+  size_t c = this->num_corners();
+
+  if(c == num_corners) return;
+
+  _corner_timing.resize(num_corners * (NUM_CORNER_TIMINGS << 2));
+
+  for(; c<num_corners; ++c) {
+    EL_RF_ITER(el, rf) {
+      float_t slew = (el == EARLY) ? OT_FLT_MAX : OT_FLT_MIN;
+      float_t rat = (el == EARLY) ? OT_FLT_MIN : OT_FLT_MAX;
+      set_corner_slew(c, el, rf, slew);
+      set_corner_at(c, el, rf, slew);
+      set_corner_rat(c, el, rf, rat);
+      set_corner_propagated_slew(c, el, rf, slew);
+      set_corner_propagated_at(c, el, rf, slew);
+      set_corner_propagated_rat(c, el, rf, rat);
+    }
+  }
+}
+
+// Procedure: remove_corner_slew
+// Remove the slew of every corner.
+void_t Node::remove_corner_slew() {
+  for(size_t c=0; c<num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      set_corner_slew(c, el, rf, (el == EARLY) ? OT_FLT_MAX : OT_FLT_MIN);
+    }
+  }
+}
+
+// Procedure: remove_corner_at
+// Remove the arrival time of every corner.
+void_t Node::remove_corner_at() {
+  for(size_t c=0; c<num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      set_corner_at(c, el, rf, (el == EARLY) ? OT_FLT_MAX : OT_FLT_MIN);
+    }
+  }
+}
+
+// Procedure: remove_corner_rat
+// Remove the required arrival time of every corner.
+void_t Node::remove_corner_rat() {
+  for(size_t c=0; c<num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      set_corner_rat(c, el, rf, (el == EARLY) ? OT_FLT_MIN : OT_FLT_MAX);
+    }
+  }
+}
+
 // Procedure: remove_fanin
 // Remove an edge from the fanin of the node.
 void_t Node::remove_fanin(edge_pt edge_ptr) {
@@ -294,6 +355,29 @@ void_t Node::relax_slew(int el, int rf, float_ct numeric) {
   };
 }
 
+// Procedure: relax_corner_slew
+// Update the slew of a corner.
+void_t Node::relax_corner_slew(size_t c, int el, int rf, float_ct numeric) {
+  if(el == EARLY ? numeric < corner_slew(c, el, rf) : numeric > corner_slew(c, el, rf)) {
+    set_corner_slew(c, el, rf, numeric);
+  }
+}
+
+// Procedure: relax_corner_at
+// Update the arrival time of a corner.
+void_t Node::relax_corner_at(size_t c, int el, int rf, float_ct numeric) {
+  if(el == EARLY ? numeric < corner_at(c, el, rf) : numeric > corner_at(c, el, rf)) {
+    set_corner_at(c, el, rf, numeric);
+  }
+}
+
+// Procedure: relax_corner_rat
+// Update the required arrival time of a corner.
+void_t Node::relax_corner_rat(size_t c, int el, int rf, float_ct numeric) {
+  if(el == EARLY ? numeric > corner_rat(c, el, rf) : numeric < corner_rat(c, el, rf)) {
+    set_corner_rat(c, el, rf, numeric);
+  }
+}
 
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
 
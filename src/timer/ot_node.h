@@ -45,6 +45,13 @@ class Node {
     void_t remove_fanout(edge_pt);                          // Remove the fanout edge of a node.
     void_t remove_jumpin(jump_pt);                          // Remove the jump of a node.
     void_t remove_jumpout(jump_pt);                         // Remove the jump of a node.
+    void_t resize_corner_timing(size_t);                    // Resize the corner timing.
+    void_t remove_corner_slew();                            // Remove the corner slew.
+    void_t remove_corner_at();                              // Remove the corner at.
+    void_t remove_corner_rat();                             // Remove the corner rat.
+    void_t relax_corner_slew(size_t, int, int, float_ct);   // Update the corner slew.
+    void_t relax_corner_at(size_t, int, int, float_ct);     // Update the corner at.
+    void_t relax_corner_rat(size_t, int, int, float_ct);    // Update the corner rat.
     
     bool_t is_clock_tree_leaf() const;                      // Query if the node is a clock tree leaf.
     bool_t is_in_clock_tree() const;                        // Query if the node is in a clock tree.
@@ -67,10 +74,24 @@ class Node {
     inline float_t rat(int, int) const;                     // Query the required arrival time.
     inline float_t slack(int, int) const;                   // Query the slack.
     inline float_t at_diff(int, int, int, int) const;       // Query the arrival time difference.
+    inline float_t propagated_slew(int, int) const;         // Query the last propagated slew.
+    inline float_t propagated_at(int, int) const;           // Query the last propagated at.
+    inline float_t propagated_rat(int, int) const;          // Query the last propagated rat.
+    inline float_t corner_slew(size_t, int, int) const;     // Query the corner slew.
+    inline float_t corner_at(size_t, int, int) const;       // Query the corner at.
+    inline float_t corner_rat(size_t, int, int) const;      // Query the corner rat.
+    inline float_t corner_slack(size_t, int, int) const;    // Query the corner slack.
+    inline float_t corner_propagated_slew(size_t, int, int) const; // Query the last propagated corner slew.
+    inline float_t corner_propagated_at(size_t, int, int) const;   // Query the last propagated corner at.
+    inline float_t corner_propagated_rat(size_t, int, int) const;  // Query the last propagated corner rat.
+    inline float_cvrt corner_timing() const;                // Query the corner timing.
+
+    inline size_t num_corners() const;                      // Query the corner count.
     
     inline int_t idx() const;                               // Query the node idx.
     inline int_t level() const;                             // Query the level.
     inline int_t clock_tree_node_idx() const;               // Query the clock tree idx.
+    inline clock_tree_pt clock_tree_ptr() const;            // Query the clock tree (domain).
 
     inline pin_pt pin_ptr() const;                          // Query the pin pointer.
 
@@ -92,17 +113,26 @@ class Node {
     inline bool_t is_in_pipeline() const;                   // Query the satellite status.
     inline bool_t is_idx_set() const;                       // Query the index status.
     inline bool_t is_at_clocked(int, int) const;            // Query the at status.
+    inline bool_t is_timing_dirty() const;                  // Query the timing dirty status.
+    inline bool_t is_jump_dirty() const;                    // Query the jump dirty status.
     
     inline void_t set_idx(int_t);                           // Set the node idx.
     inline void_t set_level(int_t);                         // Set the level.
     inline void_t set_pin_ptr(pin_pt);                      // Set the pin pointer.
     inline void_t set_clock_tree_node_idx(int_t);           // Set the clock tree idx.
+    inline void_t set_clock_tree_ptr(clock_tree_pt);        // Set the clock tree (domain).
     inline void_t set_slew(int, int, float_ct);             // Set the slew.
     inline void_t set_at(int, int, float_ct);               // Set the arrival time.
     inline void_t set_rat(int, int, float_ct);              // Set the required arrival time.
+    inline void_t set_propagated_slew(int, int, float_ct);  // Set the last propagated slew.
+    inline void_t set_propagated_at(int, int, float_ct);    // Set the last propagated at.
+    inline void_t set_propagated_rat(int, int, float_ct);   // Set the last propagated rat.
     inline void_t set_nodelist_satellite(nodelist_iter_t);  // Set the nodelist satellite. 
     inline void_t set_pipeline_satellite(nodelist_iter_t);  // Set the pipeline satellite.
     inline void_t set_is_at_clocked(int, int, bool_ct);     // Set the at direction.
+    inline void_t set_is_timing_dirty(bool_ct);             // Set the timing dirty status.
+    inline void_t set_is_jump_dirty(bool_ct);               // Set the jump dirty status.
+    inline bool_t mark_jump_dirty();                        // Mark the jump dirty (atomic).
     inline void_t set_at_parent_rf(int, int, int);          // Set the at parent transition.
     inline void_t set_at_parent_ptr(int, int, node_pt);     // Set the at parent transition.
     inline void_t set_nodeset_ptr(nodeset_pt);              // Set the nodeset pointer.
@@ -110,6 +140,13 @@ class Node {
     inline void_t remove_at(int, int);                      // Unset the at.
     inline void_t remove_rat(int, int);                     // Unset the rat.
     inline void_t add_rat(int, int, float_ct);              // Add the rat.
+    inline void_t set_corner_slew(size_t, int, int, float_ct); // Set the corner slew.
+    inline void_t set_corner_at(size_t, int, int, float_ct);   // Set the corner at.
+    inline void_t set_corner_rat(size_t, int, int, float_ct);  // Set the corner rat.
+    inline void_t set_corner_propagated_slew(size_t, int, int, float_ct); // Set the last propagated corner slew.
+    inline void_t set_corner_propagated_at(size_t, int, int, float_ct);   // Set the last propagated corner at.
+    inline void_t set_corner_propagated_rat(size_t, int, int, float_ct);  // Set the last propagated corner rat.
+    inline void_t set_corner_timing(float_cvrt);            // Set the corner timing.
 
     Node & operator = (const Node &) = delete;              // Disable copy assignment.
 
@@ -119,7 +156,29 @@ class Node {
     float_t _at[2][2];                                      // Arrival time.
     float_t _rat[2][2];                                     // Required arrival time.
 
+    float_t _propagated_slew[2][2];                         // Slew last seen by the fanout.
+    float_t _propagated_at[2][2];                           // At last seen by the fanout.
+    float_t _propagated_rat[2][2];                          // Rat last seen by the fanin.
+
+    // Timing of every corner in one array indexed by [corner][timing][el][rf], where the timing
+    // is one of the six below.
+    enum { 
+      CORNER_SLEW, 
+      CORNER_AT, 
+      CORNER_RAT, 
+      CORNER_PROPAGATED_SLEW, 
+      CORNER_PROPAGATED_AT, 
+      CORNER_PROPAGATED_RAT, 
+      NUM_CORNER_TIMINGS 
+    };
+
+    float_vt _corner_timing;                                // Corner timing.
+
+    inline size_t _corner_timing_idx(size_t, int, int, int) const;  // Query the corner timing idx.
+
     bool_t _is_at_clocked[2][2];                            // Clock tree propagated.
+    bool_t _is_timing_dirty;                                // Timing must be recomputed.
+    bool_t _is_jump_dirty;                                  // Jumps must be re-induced.
 
     pin_pt _pin_ptr;                                        // Pin pointer.
     
@@ -127,6 +186,8 @@ class Node {
     int_t _level;                                           // Level in the pipeline.
     int_t _clock_tree_node_idx;                             // Clock tree occurrence idx.
 
+    clock_tree_pt _clock_tree_ptr;                          // Clock tree the node belongs to.
+
     edgelist_pt _fanin_ptr;                                 // Fanin edgelist.
     edgelist_pt _fanout_ptr;                                // Fanout edgelist.
 
@@ -177,6 +238,25 @@ inline float_t Node::at_diff(int lhs_el, int lhs_rf, int rhs_el, int rhs_rf) con
   return at(lhs_el, lhs_rf) - at(rhs_el, rhs_rf);
 }
 
+// Function: propagated_slew
+// Return the slew that was last propagated to the fanout. The fanout timing was computed from
+// this value, which may differ from the current slew by at most the timing change epsilon.
+inline float_t Node::propagated_slew(int el, int rf) const {
+  return _propagated_slew[el][rf];
+}
+
+// Function: propagated_at
+// Return the arrival time that was last propagated to the fanout.
+inline float_t Node::propagated_at(int el, int rf) const {
+  return _propagated_at[el][rf];
+}
+
+// Function: propagated_rat
+// Return the required arrival time that was last propagated to the fanin.
+inline float_t Node::propagated_rat(int el, int rf) const {
+  return _propagated_rat[el][rf];
+}
+
 // Function: pin_ptr
 // Return the pin pointer.
 inline pin_pt Node::pin_ptr() const {
@@ -323,6 +403,24 @@ inline void_t Node::set_rat(int el, int rf, float_ct rat) {
   __numeric_guard(_rat[el][rf] = rat);
 }
 
+// Procedure: set_propagated_slew
+// Set the slew that was last propagated to the fanout.
+inline void_t Node::set_propagated_slew(int el, int rf, float_ct slew) {
+  _propagated_slew[el][rf] = slew;
+}
+
+// Procedure: set_propagated_at
+// Set the arrival time that was last propagated to the fanout.
+inline void_t Node::set_propagated_at(int el, int rf, float_ct at) {
+  _propagated_at[el][rf] = at;
+}
+
+// Procedure: set_propagated_rat
+// Set the required arrival time that was last propagated to the fanin.
+inline void_t Node::set_propagated_rat(int el, int rf, float_ct rat) {
+  _propagated_rat[el][rf] = rat;
+}
+
 // Procedure: add_rat
 // Add the required arrival time.
 inline void_t Node::add_rat(int el, int rf, float_ct delata) {
@@ -362,6 +460,12 @@ inline void_t Node::set_clock_tree_node_idx(int_t idx) {
   _clock_tree_node_idx = idx;
 }
 
+// Procedure: set_clock_tree_ptr
+// Set the clock tree (clock domain) the node belongs to.
+inline void_t Node::set_clock_tree_ptr(clock_tree_pt clock_tree_ptr) {
+  _clock_tree_ptr = clock_tree_ptr;
+}
+
 // Procedure: set_level
 // Set the level.
 inline void_t Node::set_level(int_t level) {
@@ -379,6 +483,11 @@ inline int_t Node::clock_tree_node_idx() const {
   return _clock_tree_node_idx;
 }
 
+// Function: clock_tree_ptr
+inline clock_tree_pt Node::clock_tree_ptr() const {
+  return _clock_tree_ptr;
+}
+
 // Function: level
 // Query the level.
 inline int_t Node::level() const {
@@ -391,6 +500,40 @@ inline bool_t Node::is_in_pipeline() const {
   return _pipeline_satellite != nullptr;
 }
 
+// Function: is_timing_dirty
+// Return true if the timing of the node must be recomputed regardless of its fanin changes.
+inline bool_t Node::is_timing_dirty() const {
+  return _is_timing_dirty;
+}
+
+// Procedure: set_is_timing_dirty
+// Set the timing dirty status of the node.
+inline void_t Node::set_is_timing_dirty(bool_ct flag) {
+  _is_timing_dirty = flag;
+}
+
+// Function: is_jump_dirty
+// Return true if the jumps passing through or ending at the node are pending a rebuild.
+inline bool_t Node::is_jump_dirty() const {
+  return _is_jump_dirty;
+}
+
+// Procedure: set_is_jump_dirty
+// Set the jump dirty status of the node.
+inline void_t Node::set_is_jump_dirty(bool_ct flag) {
+  _is_jump_dirty = flag;
+}
+
+// Function: mark_jump_dirty
+// Atomically mark the jumps of the node dirty and return the previous status. The function is
+// safe to call from concurrent propagation tasks.
+inline bool_t Node::mark_jump_dirty() {
+  bool_t is_dirty;
+  #pragma omp atomic capture
+  { is_dirty = _is_jump_dirty; _is_jump_dirty = true; }
+  return is_dirty;
+}
+
 // Function: is_idx_set
 // Query the index status.
 inline bool_t Node::is_idx_set() const {
@@ -402,6 +545,93 @@ inline bool_t Node::is_at_clocked(int el, int rf) const {
   return _is_at_clocked[el][rf];
 }
 
+// Function: _corner_timing_idx
+inline size_t Node::_corner_timing_idx(size_t c, int t, int el, int rf) const {
+  return (((c * NUM_CORNER_TIMINGS + t) << 2) | (el << 1) | rf);
+}
+
+// Function: num_corners
+inline size_t Node::num_corners() const {
+  return _corner_timing.size() / (NUM_CORNER_TIMINGS << 2);
+}
+
+// Function: corner_slew
+inline float_t Node::corner_slew(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_SLEW, el, rf)];
+}
+
+// Function: corner_at
+inline float_t Node::corner_at(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_AT, el, rf)];
+}
+
+// Function: corner_rat
+inline float_t Node::corner_rat(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_RAT, el, rf)];
+}
+
+// Function: corner_slack
+inline float_t Node::corner_slack(size_t c, int el, int rf) const {
+  return (el == EARLY) ? corner_at(c, el, rf) - corner_rat(c, el, rf) : 
+                         corner_rat(c, el, rf) - corner_at(c, el, rf);
+}
+
+// Function: corner_propagated_slew
+inline float_t Node::corner_propagated_slew(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_SLEW, el, rf)];
+}
+
+// Function: corner_propagated_at
+inline float_t Node::corner_propagated_at(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_AT, el, rf)];
+}
+
+// Function: corner_propagated_rat
+inline float_t Node::corner_propagated_rat(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_RAT, el, rf)];
+}
+
+// Function: corner_timing
+// Query the timing of all corners as a whole, e.g., for the state journal.
+inline float_cvrt Node::corner_timing() const {
+  return _corner_timing;
+}
+
+// Procedure: set_corner_slew
+inline void_t Node::set_corner_slew(size_t c, int el, int rf, float_ct slew) {
+  _corner_timing[_corner_timing_idx(c, CORNER_SLEW, el, rf)] = slew;
+}
+
+// Procedure: set_corner_at
+inline void_t Node::set_corner_at(size_t c, int el, int rf, float_ct at) {
+  _corner_timing[_corner_timing_idx(c, CORNER_AT, el, rf)] = at;
+}
+
+// Procedure: set_corner_rat
+inline void_t Node::set_corner_rat(size_t c, int el, int rf, float_ct rat) {
+  _corner_timing[_corner_timing_idx(c, CORNER_RAT, el, rf)] = rat;
+}
+
+// Procedure: set_corner_propagated_slew
+inline void_t Node::set_corner_propagated_slew(size_t c, int el, int rf, float_ct slew) {
+  _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_SLEW, el, rf)] = slew;
+}
+
+// Procedure: set_corner_propagated_at
+inline void_t Node::set_corner_propagated_at(size_t c, int el, int rf, float_ct at) {
+  _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_AT, el, rf)] = at;
+}
+
+// Procedure: set_corner_propagated_rat
+inline void_t Node::set_corner_propagated_rat(size_t c, int el, int rf, float_ct rat) {
+  _corner_timing[_corner_timing_idx(c, CORNER_PROPAGATED_RAT, el, rf)] = rat;
+}
+
+// Procedure: set_corner_timing
+inline void_t Node::set_corner_timing(float_cvrt timing) {
+  _corner_timing = timing;
+}
+
 
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
 
@@ -0,0 +1,731 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_partitioner.h"
+#include "ot_timer.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+Partitioner::Partitioner(timer_pt timer_ptr):
+  _timer_ptr(timer_ptr),
+  _num_partitions(0)
+{
+  CHECK(_timer_ptr != nullptr);
+}
+
+// Destructor.
+Partitioner::~Partitioner() {
+}
+
+// Procedure: partition
+// Partition the design into the given number of partitions.
+void_t Partitioner::partition(size_t num_partitions) {
+
+  CHECK(num_partitions > 0) << "Failed to partition the design (zero partition exception)";
+
+  // [BEG INFO]
+  LOG(INFO) << "Partitioning the design into " << num_partitions << " partitions ...";
+  // [END INFO]
+
+  _num_partitions = num_partitions;
+
+  _build_clusters();
+  _build_nets();
+  _initialize();
+  _refine();
+
+  // [BEG INFO]
+  LOG(INFO) << "Partitioned " << _gate_ptrs.size() << " gates with "
+            << num_boundary_nets() << " boundary nets";
+  // [END INFO]
+}
+
+// Function: num_boundary_nets
+size_t Partitioner::num_boundary_nets() const {
+  size_t num_boundary_nets = 0;
+  for(size_t j=0; j<_net_ptrs.size(); ++j) {
+    if(_is_boundary_net(j)) ++num_boundary_nets;
+  }
+  return num_boundary_nets;
+}
+
+// Procedure: _build_clusters
+// Build the clusters of gates that move together. A gate driving a clock tree node is shared.
+// The loads of a net that reaches a primary output are clustered with the driver such that no
+// primary output sits on a boundary net.
+void_t Partitioner::_build_clusters() {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+
+  // Gates and nets sorted by name for a deterministic partition.
+  _gate_ptrs.clear();
+  _net_ptrs.clear();
+  _gate_idx.clear();
+  _net_idx.clear();
+
+  for(CircuitGateIter i(circuit_ptr); i(); ++i) _gate_ptrs.push_back(i.gate_ptr());
+  for(CircuitNetIter i(circuit_ptr); i(); ++i) _net_ptrs.push_back(i.net_ptr());
+
+  sort(_gate_ptrs.begin(), _gate_ptrs.end(), [] (gate_pt a, gate_pt b) {
+    return a->name() < b->name();
+  });
+  sort(_net_ptrs.begin(), _net_ptrs.end(), [] (net_pt a, net_pt b) {
+    return a->name() < b->name();
+  });
+
+  for(size_t i=0; i<_gate_ptrs.size(); ++i) _gate_idx[_gate_ptrs[i]] = i;
+  for(size_t j=0; j<_net_ptrs.size(); ++j) _net_idx[_net_ptrs[j]] = j;
+
+  // Shared gates.
+  _is_shared.assign(_gate_ptrs.size(), false);
+
+  for(size_t i=0; i<_gate_ptrs.size(); ++i) {
+    for(CellpinIter c(_gate_ptrs[i]->cell_ptr()); c(); ++c) {
+      if(c.cellpin_ptr()->direction() != OUTPUT_CELLPIN_DIRECTION) continue;
+      pin_pt pin_ptr = circuit_ptr->pin_ptr(_gate_ptrs[i]->name() + ":" + c.cellpin_ptr()->name());
+      if(pin_ptr && pin_ptr->node_ptr() && pin_ptr->node_ptr()->is_in_clock_tree()) {
+        _is_shared[i] = true;
+      }
+    }
+  }
+
+  // Union of the gates on the nets to primary outputs.
+  int_vt parent(_gate_ptrs.size());
+  iota(parent.begin(), parent.end(), 0);
+
+  function < int_t (int_t) > find = [&] (int_t x) {
+    return parent[x] == x ? x : parent[x] = find(parent[x]);
+  };
+
+  for(const auto& net_ptr : _net_ptrs) {
+
+    bool_t has_primary_output = false;
+    for(const auto& pin_ptr : net_ptr->pinlist()) {
+      if(pin_ptr->is_primary_output()) has_primary_output = true;
+    }
+
+    if(!has_primary_output) continue;
+
+    int_t root = OT_UNDEFINED_IDX;
+    for(const auto& pin_ptr : net_ptr->pinlist()) {
+      if(pin_ptr->gate_ptr() == nullptr) continue;
+      int_t i = _gate_idx[pin_ptr->gate_ptr()];
+      if(_is_shared[i]) continue;
+      if(root == OT_UNDEFINED_IDX) root = find(i);
+      else parent[find(i)] = root;
+    }
+  }
+
+  // Clusters.
+  int_vt cluster_idx(_gate_ptrs.size(), OT_UNDEFINED_IDX);
+
+  _clusters.clear();
+  _gate_cluster.assign(_gate_ptrs.size(), OT_UNDEFINED_IDX);
+
+  for(size_t i=0; i<_gate_ptrs.size(); ++i) {
+    if(_is_shared[i]) continue;
+    int_t root = find(i);
+    if(cluster_idx[root] == OT_UNDEFINED_IDX) {
+      cluster_idx[root] = _clusters.size();
+      _clusters.emplace_back();
+    }
+    _gate_cluster[i] = cluster_idx[root];
+    _clusters[cluster_idx[root]].push_back(i);
+  }
+}
+
+// Procedure: _build_nets
+// Build the nets of each cluster. A net driven by a primary input or a shared gate is replicated
+// in every partition and does not contribute to the boundary.
+void_t Partitioner::_build_nets() {
+
+  _net_driver.assign(_net_ptrs.size(), OT_UNDEFINED_IDX);
+  _net_has_shared_sink.assign(_net_ptrs.size(), false);
+  _cluster_nets.assign(_clusters.size(), int_vt());
+  _cluster_num_sinks.assign(_clusters.size(), int_vt());
+
+  for(size_t j=0; j<_net_ptrs.size(); ++j) {
+
+    net_pt net_ptr = _net_ptrs[j];
+    pin_pt root_pin_ptr = net_ptr->root_pin_ptr();
+
+    if(root_pin_ptr == nullptr || root_pin_ptr->gate_ptr() == nullptr) continue;
+
+    int_t driver = _gate_idx[root_pin_ptr->gate_ptr()];
+
+    if(_is_shared[driver]) continue;
+
+    _net_driver[j] = _gate_cluster[driver];
+
+    // Sink pins per cluster.
+    unordered_map < int_t, int_t > num_sinks {{_net_driver[j], 0}};
+
+    for(const auto& pin_ptr : net_ptr->pinlist()) {
+      if(pin_ptr == root_pin_ptr || pin_ptr->gate_ptr() == nullptr) continue;
+      int_t i = _gate_idx[pin_ptr->gate_ptr()];
+      if(_is_shared[i]) {
+        _net_has_shared_sink[j] = true;
+      }
+      else {
+        ++num_sinks[_gate_cluster[i]];
+      }
+    }
+
+    for(const auto& item : num_sinks) {
+      _cluster_nets[item.first].push_back(j);
+      _cluster_num_sinks[item.first].push_back(item.second);
+    }
+  }
+}
+
+// Procedure: _initialize
+// Assign the clusters to balanced slices of the topological order of the timing graph, which
+// keeps most of the nets inside a partition and makes the boundary flow forward.
+void_t Partitioner::_initialize() {
+
+  nodeset_rt nodeset = _timer_ptr->nodeset();
+  size_t num_indices = nodeset.num_indices();
+  size_t num_partitions = _num_partitions;
+
+  // Topological position of the nodes.
+  node_ptr_vt order;
+  int_vt num_fanins(num_indices, 0);
+  int_vt position(num_indices, OT_UNDEFINED_IDX);
+
+  for(const auto& node_ptr : nodeset) {
+    num_fanins[node_ptr->idx()] = node_ptr->num_fanins();
+    if(node_ptr->num_fanins() == 0) {
+      position[node_ptr->idx()] = order.size();
+      order.push_back(node_ptr);
+    }
+  }
+
+  for(size_t i=0; i<order.size(); ++i) {
+    for(auto& e : order[i]->fanout()) {
+      node_pt to_node_ptr = e->to_node_ptr();
+      if(--num_fanins[to_node_ptr->idx()] == 0) {
+        position[to_node_ptr->idx()] = order.size();
+        order.push_back(to_node_ptr);
+      }
+    }
+  }
+
+  // Key of a cluster: the earliest position of the output pins of its gates.
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+  int_vt keys(_clusters.size(), INT_MAX);
+
+  for(size_t c=0; c<_clusters.size(); ++c) {
+    for(const auto& i : _clusters[c]) {
+      for(CellpinIter p(_gate_ptrs[i]->cell_ptr()); p(); ++p) {
+        if(p.cellpin_ptr()->direction() != OUTPUT_CELLPIN_DIRECTION) continue;
+        pin_pt pin_ptr = circuit_ptr->pin_ptr(_gate_ptrs[i]->name() + ":" + p.cellpin_ptr()->name());
+        if(pin_ptr == nullptr || pin_ptr->node_ptr() == nullptr) continue;
+        int_t pos = position[pin_ptr->node_ptr()->idx()];
+        if(pos != OT_UNDEFINED_IDX) keys[c] = min(keys[c], pos);
+      }
+    }
+  }
+
+  int_vt clusters(_clusters.size());
+  iota(clusters.begin(), clusters.end(), 0);
+  stable_sort(clusters.begin(), clusters.end(), [&] (int_t a, int_t b) {
+    return keys[a] < keys[b];
+  });
+
+  // Balanced slices.
+  size_t num_gates = 0;
+  for(const auto& cluster : _clusters) num_gates += cluster.size();
+
+  size_t prefix = 0;
+  _cluster_partition.assign(_clusters.size(), 0);
+  _weights.assign(num_partitions, 0);
+
+  for(const auto& c : clusters) {
+    size_t p = num_gates ? min(num_partitions - 1, prefix * num_partitions / num_gates) : 0;
+    _cluster_partition[c] = p;
+    _weights[p] += _clusters[c].size();
+    prefix += _clusters[c].size();
+  }
+
+  // Sink pins per net and partition.
+  _num_sinks.assign(_net_ptrs.size() * num_partitions, 0);
+
+  for(size_t c=0; c<_clusters.size(); ++c) {
+    for(size_t k=0; k<_cluster_nets[c].size(); ++k) {
+      _num_sinks[_cluster_nets[c][k] * num_partitions + _cluster_partition[c]] += _cluster_num_sinks[c][k];
+    }
+  }
+}
+
+// Procedure: _refine
+// Refine the partitions by greedy moves. A cluster moves to the adjacent partition that reduces
+// the boundary most as long as the gate count of each partition stays within the imbalance.
+void_t Partitioner::_refine() {
+
+  if(_num_partitions < 2) return;
+
+  size_t num_gates = accumulate(_weights.begin(), _weights.end(), size_t(0));
+  float_t average = (float_t)num_gates / _num_partitions;
+  size_t upper = ceil(average * (1.0f + OT_DEFAULT_PARTITION_IMBALANCE));
+  size_t lower = floor(average * (1.0f - OT_DEFAULT_PARTITION_IMBALANCE));
+
+  for(int pass=0; pass<OT_DEFAULT_PARTITION_NUM_PASSES; ++pass) {
+
+    size_t num_moves = 0;
+
+    for(size_t c=0; c<_clusters.size(); ++c) {
+
+      int_t from = _cluster_partition[c];
+      size_t weight = _clusters[c].size();
+
+      if(_weights[from] < lower + weight) continue;
+
+      // Adjacent partitions.
+      int_vt candidates;
+      for(const auto& j : _cluster_nets[c]) {
+        int_t d = _net_partition(j);
+        if(d != from) candidates.push_back(d);
+        for(size_t q=0; q<_num_partitions; ++q) {
+          if(q != (size_t)from && _num_sinks[j * _num_partitions + q]) candidates.push_back(q);
+        }
+      }
+
+      sort(candidates.begin(), candidates.end());
+      candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+      // Best move.
+      int_t cost = 0;
+      for(const auto& j : _cluster_nets[c]) cost += _net_cost(j);
+
+      int_t best_gain = 0;
+      int_t best_to = from;
+
+      for(const auto& to : candidates) {
+        if(_weights[to] + weight > upper) continue;
+        _move(c, to);
+        int_t gain = cost;
+        for(const auto& j : _cluster_nets[c]) gain -= _net_cost(j);
+        _move(c, from);
+        if(gain > best_gain) {
+          best_gain = gain;
+          best_to = to;
+        }
+      }
+
+      if(best_to != from) {
+        _move(c, best_to);
+        ++num_moves;
+      }
+    }
+
+    if(num_moves == 0) break;
+  }
+}
+
+// Procedure: _move
+// Move a cluster to a partition.
+void_t Partitioner::_move(int_t c, int_t to) {
+
+  int_t from = _cluster_partition[c];
+
+  for(size_t k=0; k<_cluster_nets[c].size(); ++k) {
+    _num_sinks[_cluster_nets[c][k] * _num_partitions + from] -= _cluster_num_sinks[c][k];
+    _num_sinks[_cluster_nets[c][k] * _num_partitions + to] += _cluster_num_sinks[c][k];
+  }
+
+  _weights[from] -= _clusters[c].size();
+  _weights[to] += _clusters[c].size();
+  _cluster_partition[c] = to;
+}
+
+// Function: _net_cost
+// The boundary cost of a net is the number of partitions loaded by the net other than the
+// partition of its driver.
+int_t Partitioner::_net_cost(int_t j) const {
+  int_t d = _net_partition(j);
+  int_t cost = 0;
+  for(size_t q=0; q<_num_partitions; ++q) {
+    if(q != (size_t)d && _num_sinks[j * _num_partitions + q]) ++cost;
+  }
+  return cost;
+}
+
+// Function: _net_partition
+// Return the partition of the net driver or undefined if the net is replicated.
+int_t Partitioner::_net_partition(int_t j) const {
+  if(_net_driver[j] == OT_UNDEFINED_IDX) return OT_UNDEFINED_IDX;
+  return _cluster_partition[_net_driver[j]];
+}
+
+// Function: _is_gate_in
+bool_t Partitioner::_is_gate_in(gate_pt gate_ptr, size_t p) const {
+  int_t i = _gate_idx.at(gate_ptr);
+  return _is_shared[i] || _cluster_partition[_gate_cluster[i]] == (int_t)p;
+}
+
+// Function: _is_pin_in
+// A gate pin lives with its gate, a primary input lives in every partition, and a primary output
+// lives with the driver of its net.
+bool_t Partitioner::_is_pin_in(pin_pt pin_ptr, size_t p) const {
+  if(pin_ptr->gate_ptr()) return _is_gate_in(pin_ptr->gate_ptr(), p);
+  if(pin_ptr->is_primary_output() && pin_ptr->net_ptr()) {
+    int_t d = _net_partition(_net_idx.at(pin_ptr->net_ptr()));
+    return d == OT_UNDEFINED_IDX || d == (int_t)p;
+  }
+  return true;
+}
+
+// Function: _is_net_in
+bool_t Partitioner::_is_net_in(int_t j, size_t p) const {
+  int_t d = _net_partition(j);
+  if(d == OT_UNDEFINED_IDX || d == (int_t)p || _net_has_shared_sink[j]) return true;
+  return _num_sinks[j * _num_partitions + p] > 0;
+}
+
+// Function: _is_boundary_net
+bool_t Partitioner::_is_boundary_net(int_t j) const {
+  int_t d = _net_partition(j);
+  if(d == OT_UNDEFINED_IDX) return false;
+  if(_net_has_shared_sink[j] && _num_partitions > 1) return true;
+  return _net_cost(j) > 0;
+}
+
+// Procedure: write
+// Write each partition to the files <prefix>.<i>.v, <prefix>.<i>.spef, <prefix>.<i>.timing, and
+// <prefix>.<i>.partition, where the last one lists the boundary ports and the shared pins.
+void_t Partitioner::write(string_crt prefix) {
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(size_t p=0; p<_num_partitions; ++p) {
+    string_t fpath = prefix + "." + to_string(p);
+    _write_verilog(fpath + ".v", p);
+    _write_spef(fpath + ".spef", p);
+    _write_timing(fpath + ".timing", p);
+    _write_boundary(fpath + ".partition", p);
+  }
+}
+
+// Procedure: _write_verilog
+// Write the netlist of a partition. Every primary input is kept, and each boundary net becomes
+// an input port of its loading partitions and an output port of its driving partition.
+void_t Partitioner::_write_verilog(string_crt fpath, size_t p) const {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+
+  file_pt fptr = fopen(fpath.c_str(), "w");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + fpath;
+    return;
+  }
+
+  string_vt inputs, outputs, wires;
+
+  for(const auto& item : circuit_ptr->primary_input_dict()) {
+    inputs.push_back(item.first);
+  }
+
+  for(const auto& item : circuit_ptr->primary_output_dict()) {
+    if(item.second->pin_ptr() && _is_pin_in(item.second->pin_ptr(), p)) {
+      outputs.push_back(item.first);
+    }
+  }
+
+  for(size_t j=0; j<_net_ptrs.size(); ++j) {
+    if(!_is_net_in(j, p)) continue;
+    string_crt name = _net_ptrs[j]->name();
+    if(circuit_ptr->primary_input_ptr(name)) continue;
+    if(_is_boundary_net(j)) {
+      if(_net_partition(j) != (int_t)p) inputs.push_back(name);
+      else if(!circuit_ptr->primary_output_ptr(name)) outputs.push_back(name);
+    }
+    else if(!circuit_ptr->primary_output_ptr(name)) {
+      wires.push_back(name);
+    }
+  }
+
+  sort(inputs.begin(), inputs.end());
+  sort(outputs.begin(), outputs.end());
+
+  // Module header.
+  fprintf(fptr, "module %s (", circuit_ptr->name().c_str());
+  string_vt ports(inputs);
+  ports.insert(ports.end(), outputs.begin(), outputs.end());
+  for(size_t i=0; i<ports.size(); ++i) {
+    fprintf(fptr, "%s%s", i ? ", " : "", ports[i].c_str());
+  }
+  fprintf(fptr, ");\n");
+
+  for(const auto& name : inputs) fprintf(fptr, "input %s;\n", name.c_str());
+  for(const auto& name : outputs) fprintf(fptr, "output %s;\n", name.c_str());
+  for(const auto& name : wires) fprintf(fptr, "wire %s;\n", name.c_str());
+
+  // Gates.
+  for(const auto& gate_ptr : _gate_ptrs) {
+    if(!_is_gate_in(gate_ptr, p)) continue;
+    fprintf(fptr, "%s %s (", gate_ptr->cell_ptr()->name().c_str(), gate_ptr->name().c_str());
+    bool_t is_first = true;
+    for(CellpinIter c(gate_ptr->cell_ptr()); c(); ++c) {
+      pin_pt pin_ptr = circuit_ptr->pin_ptr(gate_ptr->name() + ":" + c.cellpin_ptr()->name());
+      if(pin_ptr == nullptr || pin_ptr->net_ptr() == nullptr) continue;
+      fprintf(fptr, "%s .%s(%s)", is_first ? "" : ",", c.cellpin_ptr()->name().c_str(),
+              pin_ptr->net_ptr()->name().c_str());
+      is_first = false;
+    }
+    fprintf(fptr, " );\n");
+  }
+
+  fprintf(fptr, "endmodule\n");
+  fclose(fptr);
+}
+
+// Procedure: _write_spef
+// Write the parasitics of a partition from the rctrees of the timer. The capacitance of a tap
+// node excludes the pin capacitance added by the spef reader, except for the loads living in
+// other partitions, which are folded into their node. A loading partition drives the boundary
+// net from an input port at the root, and the driving partition extends the root to the output
+// port through a zero resistance. Nets without parasitics that lose a load or gain a port are
+// written as a star of zero resistances.
+void_t Partitioner::_write_spef(string_crt fpath, size_t p) const {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+
+  file_pt fptr = fopen(fpath.c_str(), "w");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + fpath;
+    return;
+  }
+
+  fprintf(fptr, "*SPEF \"IEEE 1481-1998\"\n");
+  fprintf(fptr, "*DESIGN \"%s\"\n", circuit_ptr->name().c_str());
+  fprintf(fptr, "*T_UNIT 1 PS\n*C_UNIT 1 FF\n*R_UNIT 1 KOHM\n*L_UNIT 1 UH\n\n");
+
+  for(size_t j=0; j<_net_ptrs.size(); ++j) {
+
+    if(!_is_net_in(j, p)) continue;
+
+    net_pt net_ptr = _net_ptrs[j];
+    rctree_pt rctree_ptr = net_ptr->rctree_ptr();
+    string_crt name = net_ptr->name();
+
+    bool_t is_boundary = _is_boundary_net(j);
+    bool_t is_source = is_boundary && _net_partition(j) == (int_t)p;
+    bool_t is_sink = is_boundary && !is_source;
+    bool_t has_port = is_source && !circuit_ptr->primary_output_ptr(name);
+
+    vector < pair<string_t, char> > conns;
+    vector < pair<string_t, float_t> > caps;
+    vector < pair<pair<string_t, string_t>, float_t> > reses;
+
+    auto conn = [&] (pin_pt pin_ptr, string_crt node) {
+      if(pin_ptr->is_primary_input()) conns.emplace_back(node, 'I');
+      else if(pin_ptr->is_primary_output()) conns.emplace_back(node, 'O');
+      else conns.emplace_back(node, pin_ptr->is_rctree_root() ? 'O' : 'I');
+    };
+
+    string_t root;
+
+    if(rctree_ptr && rctree_ptr->root_ptr()) {
+
+      auto node_name = [&] (rctree_node_pt node_ptr) -> string_t {
+        return (is_sink && node_ptr == rctree_ptr->root_ptr()) ? name : node_ptr->name();
+      };
+
+      for(const auto& item : rctree_ptr->rctree_node_dict()) {
+        rctree_node_pt node_ptr = item.second;
+        pin_pt pin_ptr = node_ptr->pin_ptr();
+        float_t cap = node_ptr->cap(LATE, RISE);
+        if(pin_ptr && pin_ptr->is_rctree_root()) {
+          if(!is_sink) conn(pin_ptr, node_name(node_ptr));
+        }
+        else if(pin_ptr && _is_pin_in(pin_ptr, p)) {
+          cap -= pin_ptr->cap(LATE, RISE);
+          conn(pin_ptr, node_name(node_ptr));
+        }
+        caps.emplace_back(node_name(node_ptr), cap);
+      }
+
+      // The edges are stored in both directions.
+      for(RCTreeEdgeIter i(rctree_ptr); i(); ++i) {
+        rctree_edge_pt e = i.rctree_edge_ptr();
+        if(e->from_rctree_node_ptr()->name() > e->to_rctree_node_ptr()->name()) continue;
+        reses.push_back({{node_name(e->from_rctree_node_ptr()), node_name(e->to_rctree_node_ptr())}, e->res()});
+      }
+
+      root = node_name(rctree_ptr->root_ptr());
+    }
+    else if(!is_sink && net_ptr->root_pin_ptr()) {
+
+      bool_t has_folded_pin = false;
+      for(const auto& pin_ptr : net_ptr->pinlist()) {
+        if(!_is_pin_in(pin_ptr, p)) has_folded_pin = true;
+      }
+
+      if(!has_folded_pin && !has_port) continue;
+
+      root = net_ptr->root_pin_ptr()->name();
+
+      for(const auto& pin_ptr : net_ptr->pinlist()) {
+        if(pin_ptr == net_ptr->root_pin_ptr()) {
+          conn(pin_ptr, root);
+          caps.emplace_back(root, OT_FLT_ZERO);
+        }
+        else {
+          if(_is_pin_in(pin_ptr, p)) {
+            conn(pin_ptr, pin_ptr->name());
+            caps.emplace_back(pin_ptr->name(), OT_FLT_ZERO);
+          }
+          else {
+            caps.emplace_back(pin_ptr->name(), pin_ptr->cap(LATE, RISE));
+          }
+          reses.push_back({{root, pin_ptr->name()}, OT_FLT_ZERO});
+        }
+      }
+    }
+    else continue;
+
+    if(is_sink) {
+      conns.emplace_back(name, 'I');
+    }
+
+    if(has_port) {
+      conns.emplace_back(name, 'O');
+      caps.emplace_back(name, OT_FLT_ZERO);
+      reses.push_back({{root, name}, OT_FLT_ZERO});
+    }
+
+    float_t total_cap = OT_FLT_ZERO;
+    for(const auto& cap : caps) total_cap += cap.second;
+
+    fprintf(fptr, "*D_NET %s %.9g\n", name.c_str(), total_cap);
+
+    fprintf(fptr, "*CONN\n");
+    for(const auto& c : conns) {
+      bool_t is_port = circuit_ptr->primary_input_ptr(c.first) ||
+                       circuit_ptr->primary_output_ptr(c.first) || c.first == name;
+      fprintf(fptr, "*%c %s %c\n", is_port ? 'P' : 'I', c.first.c_str(), c.second);
+    }
+
+    fprintf(fptr, "*CAP\n");
+    for(size_t i=0; i<caps.size(); ++i) {
+      fprintf(fptr, "%zu %s %.9g\n", i+1, caps[i].first.c_str(), caps[i].second);
+    }
+
+    fprintf(fptr, "*RES\n");
+    for(size_t i=0; i<reses.size(); ++i) {
+      fprintf(fptr, "%zu %s %s %.9g\n", i+1, reses[i].first.first.c_str(),
+              reses[i].first.second.c_str(), reses[i].second);
+    }
+
+    fprintf(fptr, "*END\n\n");
+  }
+
+  fclose(fptr);
+}
+
+// Procedure: _write_timing
+// Write the timing assertions of a partition. The boundary ports are asserted by the master of
+// the distributed timing at run time.
+void_t Partitioner::_write_timing(string_crt fpath, size_t p) const {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+
+  file_pt fptr = fopen(fpath.c_str(), "w");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + fpath;
+    return;
+  }
+
+  for(const auto& clock_tree_uptr : circuit_ptr->clock_tree_uptrs()) {
+    if(clock_tree_uptr->primary_input_ptr() == nullptr) continue;
+    fprintf(fptr, "clock %s %.9g\n", clock_tree_uptr->primary_input_ptr()->name().c_str(),
+            clock_tree_uptr->period());
+  }
+
+  for(const auto& item : circuit_ptr->primary_input_dict()) {
+    primary_input_pt pi_ptr = item.second;
+    fprintf(fptr, "at %s %.9g %.9g %.9g %.9g\n", item.first.c_str(),
+            pi_ptr->at(EARLY, RISE), pi_ptr->at(EARLY, FALL),
+            pi_ptr->at(LATE, RISE), pi_ptr->at(LATE, FALL));
+    fprintf(fptr, "slew %s %.9g %.9g %.9g %.9g\n", item.first.c_str(),
+            pi_ptr->slew(EARLY, RISE), pi_ptr->slew(EARLY, FALL),
+            pi_ptr->slew(LATE, RISE), pi_ptr->slew(LATE, FALL));
+  }
+
+  for(const auto& item : circuit_ptr->primary_output_dict()) {
+    primary_output_pt po_ptr = item.second;
+    if(po_ptr->pin_ptr() == nullptr || !_is_pin_in(po_ptr->pin_ptr(), p)) continue;
+    fprintf(fptr, "rat %s %.9g %.9g %.9g %.9g\n", item.first.c_str(),
+            po_ptr->rat(EARLY, RISE), po_ptr->rat(EARLY, FALL),
+            po_ptr->rat(LATE, RISE), po_ptr->rat(LATE, FALL));
+    fprintf(fptr, "load %s %.9g\n", item.first.c_str(), po_ptr->load(LATE, RISE));
+  }
+
+  fclose(fptr);
+}
+
+// Procedure: _write_boundary
+// Write the boundary of a partition: the input and output ports of the boundary nets, and the
+// pins replicated in every partition, whose timing is merged by the master.
+void_t Partitioner::_write_boundary(string_crt fpath, size_t p) const {
+
+  circuit_pt circuit_ptr = _timer_ptr->circuit_ptr();
+
+  file_pt fptr = fopen(fpath.c_str(), "w");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + fpath;
+    return;
+  }
+
+  fprintf(fptr, "partition %zu %zu\n", p, _num_partitions);
+
+  for(size_t j=0; j<_net_ptrs.size(); ++j) {
+    if(!_is_boundary_net(j) || !_is_net_in(j, p)) continue;
+    string_crt name = _net_ptrs[j]->name();
+    if(_net_partition(j) != (int_t)p) {
+      fprintf(fptr, "input %s\n", name.c_str());
+    }
+    else if(!circuit_ptr->primary_output_ptr(name)) {
+      fprintf(fptr, "output %s\n", name.c_str());
+    }
+  }
+
+  for(const auto& item : circuit_ptr->primary_input_dict()) {
+    fprintf(fptr, "shared %s\n", item.first.c_str());
+  }
+
+  for(const auto& item : circuit_ptr->primary_output_dict()) {
+    pin_pt pin_ptr = item.second->pin_ptr();
+    if(pin_ptr == nullptr || pin_ptr->net_ptr() == nullptr) continue;
+    if(_net_partition(_net_idx.at(pin_ptr->net_ptr())) == OT_UNDEFINED_IDX) {
+      fprintf(fptr, "shared %s\n", item.first.c_str());
+    }
+  }
+
+  for(size_t i=0; i<_gate_ptrs.size(); ++i) {
+    if(!_is_shared[i]) continue;
+    for(CellpinIter c(_gate_ptrs[i]->cell_ptr()); c(); ++c) {
+      string_t name = _gate_ptrs[i]->name() + ":" + c.cellpin_ptr()->name();
+      if(circuit_ptr->pin_ptr(name)) fprintf(fptr, "shared %s\n", name.c_str());
+    }
+  }
+
+  fclose(fptr);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
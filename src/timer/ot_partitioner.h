@@ -0,0 +1,104 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_PARTITIONER_H_
+#define OT_PARTITIONER_H_
+
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: Partitioner
+// The partitioner splits the design loaded in a timer into partitions for the distributed
+// timing. Gates of the clock tree are shared, i.e., replicated in every partition together with
+// the nets they drive and the nets driven by primary inputs, such that each partition sees the
+// complete clock network. Other gates are assigned to exactly one partition. A net driven in one
+// partition and loaded in another one is a boundary net. It is cut at its driver: the driving
+// partition sees the net as a primary output attached to the driver through a zero resistance,
+// and each loading partition sees it as a primary input driving the full parasitics of the net.
+// Loads of the net that live in other partitions are folded into the capacitance of their rc
+// node. The partitions start from balanced slices of the topological order and are refined by
+// moving gates between partitions to reduce the number of boundary nets.
+class Partitioner {
+
+  public:
+
+    Partitioner(timer_pt);                                          // Constructor.
+    ~Partitioner();                                                 // Destructor.
+
+    inline size_t num_partitions() const;                           // Query the partition count.
+    inline size_t num_gates(size_t) const;                          // Query the gate count.
+
+    size_t num_boundary_nets() const;                               // Query the boundary net count.
+
+    void_t partition(size_t);                                       // Partition the design.
+    void_t write(string_crt);                                       // Write the partitions.
+
+  private:
+
+    timer_pt _timer_ptr;                                            // Timer.
+
+    size_t _num_partitions;                                         // Partition count.
+
+    gate_ptr_vt _gate_ptrs;                                         // Gates.
+    net_ptr_vt _net_ptrs;                                           // Nets.
+
+    unordered_map < gate_pt, int_t > _gate_idx;                     // Gate index.
+    unordered_map < net_pt, int_t > _net_idx;                       // Net index.
+
+    bool_vt _is_shared;                                             // Shared gate (clock tree).
+    int_vt _gate_cluster;                                           // Cluster of a gate.
+    int_mt _clusters;                                               // Gates of a cluster.
+    int_vt _cluster_partition;                                      // Partition of a cluster.
+    int_mt _cluster_nets;                                           // Nets of a cluster.
+    int_mt _cluster_num_sinks;                                      // Sink pins on these nets.
+    size_vt _weights;                                               // Gate count of a partition.
+
+    int_vt _net_driver;                                             // Driving cluster of a net.
+    bool_vt _net_has_shared_sink;                                   // Net loads a shared gate.
+    int_vt _num_sinks;                                              // Sink pins per net/partition.
+
+    void_t _build_clusters();                                       // Build the gate clusters.
+    void_t _build_nets();                                           // Build the net connectivity.
+    void_t _initialize();                                           // Slice the topological order.
+    void_t _refine();                                               // Reduce the boundary nets.
+    void_t _move(int_t, int_t);                                     // Move a cluster.
+    void_t _write_verilog(string_crt, size_t) const;                // Write a partition netlist.
+    void_t _write_spef(string_crt, size_t) const;                   // Write a partition spef.
+    void_t _write_timing(string_crt, size_t) const;                 // Write a partition timing.
+    void_t _write_boundary(string_crt, size_t) const;               // Write a partition boundary.
+
+    int_t _net_cost(int_t) const;                                   // Boundary cost of a net.
+    int_t _net_partition(int_t) const;                              // Driving partition of a net.
+
+    bool_t _is_gate_in(gate_pt, size_t) const;                      // Query the gate membership.
+    bool_t _is_pin_in(pin_pt, size_t) const;                        // Query the pin membership.
+    bool_t _is_net_in(int_t, size_t) const;                         // Query the net membership.
+    bool_t _is_boundary_net(int_t) const;                           // Query the boundary status.
+};
+
+// Function: num_partitions
+inline size_t Partitioner::num_partitions() const {
+  return _num_partitions;
+}
+
+// Function: num_gates
+inline size_t Partitioner::num_gates(size_t p) const {
+  return _weights[p];
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -107,6 +107,44 @@ void_t PathMaxHeap::emplace_path_ptrs(path_cache_rt path_cache) {
 
 //-------------------------------------------------------------------------------------------------
 
+// Constructor.
+PathSlackBound::PathSlackBound():
+  _value(OT_FLT_MAX)
+{
+}
+
+// Procedure: tighten
+// Lower the bound to the given slack if it is smaller than the current one.
+void_t PathSlackBound::tighten(float_ct slack) {
+  auto curr = _value.load(std::memory_order_relaxed);
+  while(slack < curr && !_value.compare_exchange_weak(curr, slack, std::memory_order_relaxed));
+}
+
+// Procedure: tighten
+// Lower the bound to the maximum slack of the given heap once the heap holds K paths.
+void_t PathSlackBound::tighten(size_t K, path_max_heap_rt max_heap) {
+  if(max_heap.size() == K) tighten(max_heap.top()->slack());
+}
+
+// Procedure: tighten
+// Lower the bound to the maximum slack of the given slack heap once the heap holds K records.
+void_t PathSlackBound::tighten(size_t K, path_slack_heap_rt slack_heap) {
+  if(slack_heap.size() == K) tighten(slack_heap.top().first);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Procedure: emplace_records
+// Move all records into the given vector and empty the heap.
+void_t PathSlackHeap::emplace_records(path_slack_record_vrt records) {
+  while(!_heap.empty()) {
+    records.push_back(_heap.top());
+    _heap.pop();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
 // Constructor.
 PathCache::PathCache()
 {
@@ -198,6 +198,82 @@ inline path_pt PathMaxHeap::top() const {
 
 //-------------------------------------------------------------------------------------------------
 
+// Class: PathSlackBound
+// The class keeps the globally K-th worst path slack seen so far by all threads that peel paths
+// into their own max heaps. Any heap holding K paths gives an upper bound of the global K-th
+// worst slack, so the bound only goes down and can be tightened lock-free.
+class PathSlackBound {
+
+  public:
+
+    PathSlackBound();                                       // Constructor.
+
+    inline float_t value() const;                           // Query the bound.
+
+    void_t tighten(float_ct);                               // Tighten the bound.
+    void_t tighten(size_t, path_max_heap_rt);               // Tighten the bound from a heap.
+    void_t tighten(size_t, path_slack_heap_rt);             // Tighten the bound from a heap.
+
+  private:
+
+    atomic <float_t> _value;                                // Kth worst slack bound.
+};
+
+// Function: value
+inline float_t PathSlackBound::value() const {
+  return _value.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: PathSlackHeap
+// The class maintains the K minimum path slacks as compact (slack, endpoint) records without the
+// path traces. It is used to rank paths before their traces are recovered.
+class PathSlackHeap {
+
+  public:
+
+    inline size_t size() const;                             // Return the size of PQ.
+    inline path_slack_record_t top() const;                 // Return the maximum record.
+
+    inline void_t insert(float_ct, int_ct);                 // Insert a record into the PQ.
+    inline void_t pop();                                    // Extract the maximum record.
+    inline void_t maintain_k_min(size_t k);                 // Maintain the k minimum records.
+
+    void_t emplace_records(path_slack_record_vrt);          // Emplace the records to a vector.
+
+  private:
+
+    std::priority_queue < path_slack_record_t > _heap;      // Slack records.
+};
+
+// Function: size
+inline size_t PathSlackHeap::size() const {
+  return _heap.size();
+}
+
+// Function: top
+inline path_slack_record_t PathSlackHeap::top() const {
+  return _heap.top();
+}
+
+// Procedure: insert
+inline void_t PathSlackHeap::insert(float_ct slack, int_ct idx) {
+  _heap.emplace(slack, idx);
+}
+
+// Procedure: pop
+inline void_t PathSlackHeap::pop() {
+  _heap.pop();
+}
+
+// Procedure: maintain_k_min
+inline void_t PathSlackHeap::maintain_k_min(size_t k) {
+  while(_heap.size() > k) _heap.pop();
+}
+
+//-------------------------------------------------------------------------------------------------
+
 // Class: PathCache
 // The class for caching paths for an endpoint. The cached path is stored in the pointer
 // vector "path_ptrs" and will be automatically "freed" by the destructor.
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_path_writer.h"
+#include "ot_node.h"
+#include "ot_pin.h"
+
+namespace __OpenTimer {
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+PathTextWriter::PathTextWriter(file_pt fptr):
+  _fptr(fptr),
+  _num_paths(0)
+{
+}
+
+// Procedure: begin
+// Write the header of the path report.
+void_t PathTextWriter::begin(size_t num_paths) {
+  _num_paths = 0;
+  fprintf(_fptr, "report_worst_paths %lu\n", num_paths);
+}
+
+// Procedure: write
+// Write the path type, slack, and the trace from the source to the endpoint.
+void_t PathTextWriter::write(path_rt path) {
+
+  ++_num_paths;
+
+  switch(path.path_type()) {
+    case RAT_PATH_TYPE:
+      fprintf(_fptr, "Path %lu: RAT %.3f %lu %c\n", _num_paths, path.slack(), path.size(), (path.el() ? 'L' : 'E'));
+    break;
+    case SETUP_PATH_TYPE:
+      fprintf(_fptr, "Path %lu: Setup %.3f %lu %c\n", _num_paths, path.slack(), path.size(), (path.el() ? 'L' : 'E'));
+    break;
+    case HOLD_PATH_TYPE:
+      fprintf(_fptr, "Path %lu: Hold %.3f %lu %c\n", _num_paths, path.slack(), path.size(), (path.el() ? 'L' : 'E'));
+    break;
+    default:
+      CHECK(false);
+    break;
+  }
+
+  for(auto i=path.rbegin(); i!=path.rend(); ++i) {
+    fprintf(_fptr, "%s %c\n", i->second->pin_ptr()->name().c_str(), i->first ? 'F' : 'R');
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+PathBinaryWriter::PathBinaryWriter(file_pt fptr):
+  _fptr(fptr)
+{
+}
+
+// Procedure: begin
+// Write the magic and the path count.
+void_t PathBinaryWriter::begin(size_t num_paths) {
+  _pin_ids.clear();
+  fwrite("OTPATHS1", 1, 8, _fptr);
+  _write(num_paths, 8);
+}
+
+// Procedure: write
+// Write the compact encoding of a path.
+void_t PathBinaryWriter::write(path_rt path) {
+
+  float_t slack = path.slack();
+  uint32_t bits;
+
+  static_assert(sizeof(bits) == sizeof(slack), "Slack is not a 32-bit float");
+  memcpy(&bits, &slack, sizeof(bits));
+
+  _write(path.path_type(), 1);
+  _write(path.el(), 1);
+  _write(path.rf(), 1);
+  _write(bits, 4);
+  _write(path.size(), 4);
+
+  for(auto i=path.rbegin(); i!=path.rend(); ++i) {
+
+    pin_pt pin_ptr = i->second->pin_ptr();
+    auto itr = _pin_ids.find(pin_ptr);
+    bool_t is_new = (itr == _pin_ids.end());
+    uint32_t id = is_new ? _pin_ids.size() : itr->second;
+
+    _write((id << 1) | (i->first ? 1 : 0), 4);
+
+    if(is_new) {
+      _pin_ids[pin_ptr] = id;
+      uint16_t len = pin_ptr->name().size();
+      _write(len, 2);
+      fwrite(pin_ptr->name().data(), 1, len, _fptr);
+    }
+  }
+}
+
+// Procedure: _write
+// Write the lowest given number of bytes of a number in the little-endian byte order.
+void_t PathBinaryWriter::_write(uint64_t value, size_t num_bytes) {
+  unsigned char bytes[8];
+  for(size_t i=0; i<num_bytes; ++i) {
+    bytes[i] = static_cast<unsigned char>(value >> (i << 3));
+  }
+  fwrite(bytes, 1, num_bytes, _fptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+PathCallbackWriter::PathCallbackWriter(path_callback_t callback):
+  _callback(callback)
+{
+}
+
+// Procedure: write
+// Forward the path to the callback.
+void_t PathCallbackWriter::write(path_rt path) {
+  _callback(path);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
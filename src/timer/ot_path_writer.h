@@ -0,0 +1,108 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_PATH_WRITER_H_
+#define OT_PATH_WRITER_H_
+
+#include "ot_typedef.h"
+#include "ot_utility.h"
+#include "ot_path.h"
+
+namespace __OpenTimer {
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: PathWriter
+// The interface of a path sink. The timer calls begin with the number of paths to be streamed,
+// then write once for each path in non-decreasing slack order, and finally end. The path object
+// is only valid during the write call.
+class PathWriter {
+
+  public:
+
+    virtual ~PathWriter() = default;                        // Destructor.
+
+    virtual void_t begin(size_t) {}                         // Begin the stream.
+    virtual void_t write(path_rt) = 0;                      // Write a path.
+    virtual void_t end() {}                                 // End the stream.
+};
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: PathTextWriter
+// The class writes paths in the text format of report_worst_paths.
+class PathTextWriter : public PathWriter {
+
+  public:
+
+    PathTextWriter(file_pt);                                // Constructor.
+
+    void_t begin(size_t) override;                          // Begin the stream.
+    void_t write(path_rt) override;                         // Write a path.
+
+  private:
+
+    file_pt _fptr;                                          // Output file.
+    size_t _num_paths;                                      // Number of written paths.
+};
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: PathBinaryWriter
+// The class writes paths in a compact binary encoding. The stream starts with the 8-byte magic
+// "OTPATHS1" and the path count (uint64). Each path is written as the path type, the early/late
+// split, and the rise/fall transition (uint8 each), the slack (float32), and the trace length
+// (uint32), followed by one uint32 per pin from the source to the endpoint that encodes the pin
+// id shifted by one with the transition (0 rise, 1 fall) in the lowest bit. Pin ids are assigned
+// in the order of first appearance, and the first appearance of a pin is immediately followed by
+// its name as a uint16 length and the name bytes. Numbers are in the little-endian byte order
+// regardless of the host, and the slack is the IEEE-754 single-precision bit pattern.
+class PathBinaryWriter : public PathWriter {
+
+  public:
+
+    PathBinaryWriter(file_pt);                              // Constructor.
+
+    void_t begin(size_t) override;                          // Begin the stream.
+    void_t write(path_rt) override;                         // Write a path.
+
+  private:
+
+    file_pt _fptr;                                          // Output file.
+
+    unordered_map < pin_pt, uint32_t > _pin_ids;            // Pin id table.
+
+    void_t _write(uint64_t, size_t);                        // Write a little-endian number.
+};
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: PathCallbackWriter
+// The class forwards every streamed path to a user callback.
+class PathCallbackWriter : public PathWriter {
+
+  public:
+
+    PathCallbackWriter(path_callback_t);                    // Constructor.
+
+    void_t write(path_rt) override;                         // Write a path.
+
+  private:
+
+    path_callback_t _callback;                              // Path callback.
+};
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
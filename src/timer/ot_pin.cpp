@@ -12,6 +12,7 @@
  ******************************************************************************/
 
 #include "ot_pin.h"
+#include "ot_gate.h"
 
 namespace __OpenTimer {
 
@@ -100,6 +101,20 @@ float_t Pin::load(int el, int rf) const {
   return cap(el, rf);
 }
 
+// Function: placement
+// Return the placement location of the pin. A pin that is placed on its own, such as a primary
+// input or a primary output, takes its own location. A gate pin takes the center of its gate.
+point_t Pin::placement() const {
+  if(location().x() != OT_UNDEFINED_COORDINATE || gate_ptr() == nullptr) return location();
+  return gate_ptr()->center();
+}
+
+// Function: is_placed
+// Return true if the pin has a defined placement location.
+bool_t Pin::is_placed() const {
+  return placement().x() != OT_UNDEFINED_COORDINATE;
+}
+
 };  // End of namespace __OpenTimer. ----------------------------------------------------------------
 
 
@@ -65,11 +65,14 @@ class Pin {
     float_t cap(int, int) const;                                            // Query the pin capacitance.
     float_t load(int, int) const;                                           // Query the load capacitance.
 
+    point_t placement() const;                                              // Query the placement location.
+
     bool_t is_rctree_root() const;                                          // Query if the pin is a rc root.
     bool_t is_constrained() const;                                          // Query if the pin is a constrained pin.
     bool_t is_clock_sink() const;                                           // Query if the pin is a clock sink pin.
     bool_t is_primary_input() const;                                        // Query if the pin is a primary input pin.
     bool_t is_primary_output() const;                                       // Query if the pin is a primary output pin.
+    bool_t is_placed() const;                                               // Query if the pin has a placement.
     
     Pin & operator = (const Pin &) = delete;                                // Disable copy assignment.
 
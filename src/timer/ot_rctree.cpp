@@ -12,6 +12,7 @@
  ******************************************************************************/
 
 #include "ot_rctree.h"
+#include "ot_corner.h"
 
 namespace __OpenTimer {
 
@@ -56,6 +57,12 @@ void_t RCTreeNode::insert_fanin(rctree_edge_pt edge_ptr) {
   edge_ptr->set_fanin_satellite(satellite);
 }
 
+// Procedure: reset_corner_timing
+// Reset the timing of the given number of corners to zeros.
+void_t RCTreeNode::reset_corner_timing(size_t num_corners) {
+  _corner_timing.assign(num_corners * (NUM_CORNER_TIMINGS << 2), OT_FLT_ZERO);
+}
+
 // Function: parent_edge
 // Query the parent edge.
 rctree_edge_pt RCTreeNode::parent_edge() const {
@@ -101,6 +108,7 @@ RCTreeEdge::~RCTreeEdge() {
 RCTree::RCTree():
   _root_ptr(nullptr),
   _is_rc_timing_updated(false),
+  _is_corner_rc_timing_updated(false),
   _rctree_node_dict_ptr(new rctree_node_dict_t()),
   _rctree_edgelist_ptr(new rctree_edgelist_t())
 {
@@ -155,6 +163,20 @@ float_t RCTree::load(int el, int rf) const {
   return (root_ptr() == nullptr) ? OT_FLT_ZERO : root_ptr()->load(el, rf);
 }
 
+// Function: corner_load
+// Query the total load capacitance of a corner.
+float_t RCTree::corner_load(size_t c, int el, int rf) const {
+  return (root_ptr() == nullptr) ? OT_FLT_ZERO : root_ptr()->corner_load(c, el, rf);
+}
+
+// Function: corner_slew
+// Query the slew of a corner at a given rctree node.
+float_t RCTree::corner_slew(rctree_node_pt rctree_node_ptr, size_t c, int el, int rf, float_ct si) const {
+  CHECK(rctree_node_ptr != nullptr);
+  return si < OT_FLT_ZERO ? -sqrt(OT_SQUARE(si) + rctree_node_ptr->corner_impulse(c, el, rf)) : 
+                             sqrt(OT_SQUARE(si) + rctree_node_ptr->corner_impulse(c, el, rf));
+}
+
 // Function: slew
 // Query the slew at a given rctree node.
 float_t RCTree::slew(rctree_node_pt rctree_node_ptr, int el, int rf, float_ct si) const {
@@ -211,6 +233,46 @@ void_t RCTree::update_rc_timing() {
   set_is_rc_timing_updated(true);
 }
 
+// Procedure: update_corner_rc_timing
+// Update the rc timing of all corners in one pass of each traversal of the rctree. The wire
+// resistance and the wire capacitance of a corner are the parasitics as read or estimated
+// multiplied by the corner scales, and the pin capacitance at each tap is taken from the corner
+// libraries. The parasitics of the rctree itself are never modified.
+void_t RCTree::update_corner_rc_timing(corner_upt_cvrt corner_uptrs) {
+
+  CHECK(root_ptr() != nullptr);
+
+  if(is_corner_rc_timing_updated()) return;
+
+  for(const auto& item : rctree_node_dict()) {
+    rctree_node_pt rctree_node_ptr = item.second;
+    pin_pt pin_ptr = rctree_node_ptr->pin_ptr();
+    bool_t is_tap = (pin_ptr != nullptr && !pin_ptr->is_rctree_root());
+    rctree_node_ptr->reset_corner_timing(corner_uptrs.size());
+    for(const auto& corner_uptr : corner_uptrs) {
+      auto c = corner_uptr->idx();
+      EL_RF_ITER(el, rf) {
+        auto wire_cap = rctree_node_ptr->cap(el, rf) - (is_tap ? pin_ptr->cap(el, rf) : OT_FLT_ZERO);
+        rctree_node_ptr->set_corner_cap(
+          c, 
+          el, 
+          rf, 
+          wire_cap * corner_uptr->cap_scale() + (is_tap ? corner_uptr->cap(pin_ptr, el, rf) : OT_FLT_ZERO)
+        );
+      }
+    }
+  }
+
+  if(!corner_uptrs.empty()) {
+    _update_corner_load(nullptr, root_ptr(), corner_uptrs);
+    _update_corner_delay(nullptr, root_ptr(), corner_uptrs);
+    _update_corner_ldelay(nullptr, root_ptr(), corner_uptrs);
+    _update_corner_response(nullptr, root_ptr(), corner_uptrs);
+  }
+
+  _is_corner_rc_timing_updated = true;
+}
+
 // Function: insert_rctree_edge
 rctree_edge_pt RCTree::insert_rctree_edge(string_crt from_node_name, string_crt to_node_name, float_ct res) {
   return insert_rctree_edge(rctree_node_ptr(from_node_name), rctree_node_ptr(to_node_name), res);
@@ -359,6 +421,143 @@ void_t RCTree::_update_response(rctree_node_pt parent, rctree_node_pt from_rctre
   }
 }
 
+// Procedure: _update_corner_load
+// Compute the load capacitance of each rctree node in all corners.
+void_t RCTree::_update_corner_load(
+  rctree_node_pt parent, rctree_node_pt from_rctree_node_ptr, corner_upt_cvrt corner_uptrs
+) {
+
+  for(const auto& e : from_rctree_node_ptr->fanout()) {
+    auto to_rctree_node_ptr = e->to_rctree_node_ptr();
+    if(to_rctree_node_ptr != parent) {
+      _update_corner_load(from_rctree_node_ptr, to_rctree_node_ptr, corner_uptrs);
+      for(const auto& corner_uptr : corner_uptrs) {
+        auto c = corner_uptr->idx();
+        EL_RF_ITER(el, rf) {
+          from_rctree_node_ptr->set_corner_load(
+            c, 
+            el, 
+            rf, 
+            from_rctree_node_ptr->corner_load(c, el, rf) + to_rctree_node_ptr->corner_load(c, el, rf)
+          );
+        }
+      }
+    }
+  }
+
+  for(const auto& corner_uptr : corner_uptrs) {
+    auto c = corner_uptr->idx();
+    EL_RF_ITER(el, rf) {
+      from_rctree_node_ptr->set_corner_load(
+        c, 
+        el, 
+        rf, 
+        from_rctree_node_ptr->corner_load(c, el, rf) + from_rctree_node_ptr->corner_cap(c, el, rf)
+      );
+    }
+  }
+}
+
+// Procedure: _update_corner_delay
+// Compute the Elmore delay of each rctree node in all corners.
+void_t RCTree::_update_corner_delay(
+  rctree_node_pt parent, rctree_node_pt from_rctree_node_ptr, corner_upt_cvrt corner_uptrs
+) {
+  
+  for(const auto& e : from_rctree_node_ptr->fanout()) {
+    auto to_rctree_node_ptr = e->to_rctree_node_ptr();
+    if(to_rctree_node_ptr != parent) {
+      for(const auto& corner_uptr : corner_uptrs) {
+        auto c = corner_uptr->idx();
+        auto res = e->res() * corner_uptr->res_scale();
+        EL_RF_ITER(el, rf) {
+          to_rctree_node_ptr->set_corner_delay(
+            c, 
+            el, 
+            rf, 
+            from_rctree_node_ptr->corner_delay(c, el, rf) + res * to_rctree_node_ptr->corner_load(c, el, rf)
+          );
+        }
+      }
+      _update_corner_delay(from_rctree_node_ptr, to_rctree_node_ptr, corner_uptrs);
+    }
+  }
+}
+
+// Procedure: _update_corner_ldelay
+// Compute the load delay of each rctree node in all corners.
+void_t RCTree::_update_corner_ldelay(
+  rctree_node_pt parent, rctree_node_pt from_rctree_node_ptr, corner_upt_cvrt corner_uptrs
+) {
+
+  for(const auto& e : from_rctree_node_ptr->fanout()) {
+    auto to_rctree_node_ptr = e->to_rctree_node_ptr();
+    if(to_rctree_node_ptr != parent) {
+      _update_corner_ldelay(from_rctree_node_ptr, to_rctree_node_ptr, corner_uptrs);
+      for(const auto& corner_uptr : corner_uptrs) {
+        auto c = corner_uptr->idx();
+        EL_RF_ITER(el, rf) {
+          from_rctree_node_ptr->set_corner_ldelay(
+            c, 
+            el, 
+            rf, 
+            from_rctree_node_ptr->corner_ldelay(c, el, rf) + to_rctree_node_ptr->corner_ldelay(c, el, rf)
+          );
+        }
+      }
+    }
+  }
+
+  for(const auto& corner_uptr : corner_uptrs) {
+    auto c = corner_uptr->idx();
+    EL_RF_ITER(el, rf) {
+      from_rctree_node_ptr->set_corner_ldelay(
+        c, 
+        el, 
+        rf, 
+        from_rctree_node_ptr->corner_ldelay(c, el, rf) + 
+        from_rctree_node_ptr->corner_cap(c, el, rf) * from_rctree_node_ptr->corner_delay(c, el, rf)
+      );
+    }
+  }
+}
+
+// Procedure: _update_corner_response
+// Compute the impulse and second moment of the input response of each rctree node in all
+// corners.
+void_t RCTree::_update_corner_response(
+  rctree_node_pt parent, rctree_node_pt from_rctree_node_ptr, corner_upt_cvrt corner_uptrs
+) {
+
+  for(const auto& e : from_rctree_node_ptr->fanout()) {
+    auto to_rctree_node_ptr = e->to_rctree_node_ptr();
+    if(to_rctree_node_ptr != parent) {
+      for(const auto& corner_uptr : corner_uptrs) {
+        auto c = corner_uptr->idx();
+        auto res = e->res() * corner_uptr->res_scale();
+        EL_RF_ITER(el, rf) {
+          to_rctree_node_ptr->set_corner_beta(
+            c, 
+            el, 
+            rf, 
+            from_rctree_node_ptr->corner_beta(c, el, rf) + res * to_rctree_node_ptr->corner_ldelay(c, el, rf)
+          );
+        }
+      }
+      _update_corner_response(from_rctree_node_ptr, to_rctree_node_ptr, corner_uptrs);
+    }
+  }
+
+  for(const auto& corner_uptr : corner_uptrs) {
+    auto c = corner_uptr->idx();
+    EL_RF_ITER(el, rf) {
+      auto impulse = OT_FLT_TWO * from_rctree_node_ptr->corner_beta(c, el, rf) - 
+                     OT_SQUARE(from_rctree_node_ptr->corner_delay(c, el, rf));
+      from_rctree_node_ptr->set_corner_impulse(c, el, rf, impulse);
+    }
+  }
+}
+
 // Function: estimate_delay
 // Estimate the new delay value if a new lump capacitance value, new_cap, is applied to this
 // rc tree node. Notice that this function should be called only when the timing is up-to-date.
@@ -45,6 +45,12 @@ class RCTreeNode {
     inline void_t add_ldelay(int, int, float_ct);           // Add the load delay.
     inline void_t add_impulse(int, int, float_ct);          // Add the impulse.
     inline void_t set_pin_ptr(pin_pt);                      // Set pin pointer.
+    inline void_t set_corner_cap(size_t, int, int, float_ct);       // Set the corner capacitance.
+    inline void_t set_corner_load(size_t, int, int, float_ct);      // Set the corner load capacitance.
+    inline void_t set_corner_delay(size_t, int, int, float_ct);     // Set the corner delay.
+    inline void_t set_corner_ldelay(size_t, int, int, float_ct);    // Set the corner load delay.
+    inline void_t set_corner_beta(size_t, int, int, float_ct);      // Set the corner second moment.
+    inline void_t set_corner_impulse(size_t, int, int, float_ct);   // Set the corner impulse.
 
     inline string_crt name() const;                         // Query the name.
 
@@ -56,6 +62,14 @@ class RCTreeNode {
     inline float_t delay(int, int) const;                   // Query the delay.
     inline float_t ldelay(int, int) const;                  // Query the load delay.
     inline float_t impulse(int, int) const;                 // Query the impulse.
+    inline float_t corner_cap(size_t, int, int) const;        // Query the corner capacitance.
+    inline float_t corner_load(size_t, int, int) const;       // Query the corner load capacitance.
+    inline float_t corner_delay(size_t, int, int) const;      // Query the corner delay.
+    inline float_t corner_ldelay(size_t, int, int) const;     // Query the corner load delay.
+    inline float_t corner_beta(size_t, int, int) const;       // Query the corner second moment.
+    inline float_t corner_impulse(size_t, int, int) const;    // Query the corner impulse.
+
+    inline size_t num_corners() const;                      // Query the corner count.
     
     inline pin_pt pin_ptr() const;                          // Query the pin pointer.
 
@@ -72,6 +86,7 @@ class RCTreeNode {
 
     void_t insert_fanout(rctree_edge_pt);                   // Insert a fanout edge.
     void_t insert_fanin(rctree_edge_pt);                    // Insert a fanin edge.
+    void_t reset_corner_timing(size_t);                     // Reset the corner timing.
 
     rctree_edge_pt parent_edge() const;                     // Query the parent edge.
     rctree_node_pt parent() const;                          // Query the parent node.
@@ -88,6 +103,22 @@ class RCTreeNode {
     float_t _ldelay[2][2];                                  // Load delay.
     float_t _impulse[2][2];                                 // Impulse.
 
+    // Timing of every corner in one array indexed by [corner][timing][el][rf], where the timing
+    // is one of the six below.
+    enum {
+      CORNER_CAP,
+      CORNER_LOAD,
+      CORNER_DELAY,
+      CORNER_LDELAY,
+      CORNER_BETA,
+      CORNER_IMPULSE,
+      NUM_CORNER_TIMINGS
+    };
+
+    float_vt _corner_timing;                                // Corner timing.
+
+    inline size_t _corner_timing_idx(size_t, int, int, int) const;  // Query the corner timing idx.
+
     pin_pt _pin_ptr;                                        // Pin pointer.
 
     rctree_edgelist_pt _fanin_ptr;                          // Fanin.
@@ -236,6 +267,76 @@ inline float_t RCTreeNode::impulse(int el, int rf) const {
   return _impulse[el][rf];
 }
 
+// Function: _corner_timing_idx
+inline size_t RCTreeNode::_corner_timing_idx(size_t c, int t, int el, int rf) const {
+  return (((c * NUM_CORNER_TIMINGS + t) << 2) | (el << 1) | rf);
+}
+
+// Function: num_corners
+inline size_t RCTreeNode::num_corners() const {
+  return _corner_timing.size() / (NUM_CORNER_TIMINGS << 2);
+}
+
+// Function: corner_cap
+inline float_t RCTreeNode::corner_cap(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_CAP, el, rf)];
+}
+
+// Procedure: set_corner_cap
+inline void_t RCTreeNode::set_corner_cap(size_t c, int el, int rf, float_ct cap) {
+  _corner_timing[_corner_timing_idx(c, CORNER_CAP, el, rf)] = cap;
+}
+
+// Function: corner_load
+inline float_t RCTreeNode::corner_load(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_LOAD, el, rf)];
+}
+
+// Procedure: set_corner_load
+inline void_t RCTreeNode::set_corner_load(size_t c, int el, int rf, float_ct load) {
+  _corner_timing[_corner_timing_idx(c, CORNER_LOAD, el, rf)] = load;
+}
+
+// Function: corner_delay
+inline float_t RCTreeNode::corner_delay(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_DELAY, el, rf)];
+}
+
+// Procedure: set_corner_delay
+inline void_t RCTreeNode::set_corner_delay(size_t c, int el, int rf, float_ct delay) {
+  _corner_timing[_corner_timing_idx(c, CORNER_DELAY, el, rf)] = delay;
+}
+
+// Function: corner_ldelay
+inline float_t RCTreeNode::corner_ldelay(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_LDELAY, el, rf)];
+}
+
+// Procedure: set_corner_ldelay
+inline void_t RCTreeNode::set_corner_ldelay(size_t c, int el, int rf, float_ct ldelay) {
+  _corner_timing[_corner_timing_idx(c, CORNER_LDELAY, el, rf)] = ldelay;
+}
+
+// Function: corner_beta
+inline float_t RCTreeNode::corner_beta(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_BETA, el, rf)];
+}
+
+// Procedure: set_corner_beta
+inline void_t RCTreeNode::set_corner_beta(size_t c, int el, int rf, float_ct beta) {
+  _corner_timing[_corner_timing_idx(c, CORNER_BETA, el, rf)] = beta;
+}
+
+// Function: corner_impulse
+inline float_t RCTreeNode::corner_impulse(size_t c, int el, int rf) const {
+  return _corner_timing[_corner_timing_idx(c, CORNER_IMPULSE, el, rf)];
+}
+
+// Procedure: set_corner_impulse
+inline void_t RCTreeNode::set_corner_impulse(size_t c, int el, int rf, float_ct impulse) {
+  _corner_timing[_corner_timing_idx(c, CORNER_IMPULSE, el, rf)] = impulse;
+}
+
 // Function: slew
 inline float_t RCTreeNode::slew(int el, int rf, float_ct input_slew) const {
   return sqrt( OT_SQUARE(input_slew) + impulse(el, rf) );
@@ -374,6 +475,7 @@ class RCTree {
 
     void_t clear();                                                              // Clear the RC tree.
     void_t update_rc_timing();                                                   // Update the timing data.
+    void_t update_corner_rc_timing(corner_upt_cvrt);                             // Update the corner timing.
     void_t remove_rc_timing();                                                   // Remove all timing data.
     void_t insert_rctree_segment(string_crt, string_crt, float_ct);              // Insert a RC tree segm.
     void_t set_cap(rctree_node_pt, int, int, float_ct);                          // Change the cap at a node.
@@ -383,6 +485,7 @@ class RCTree {
     inline void_t set_is_rc_timing_updated(bool_ct);                             // Set the rc timing status.
 
     inline bool_t is_rc_timing_updated() const;                                  // Query the rc timing status.
+    inline bool_t is_corner_rc_timing_updated() const;                           // Query the corner status.
 
     rctree_edge_pt insert_rctree_edge(string_crt, string_crt, float_ct);         // Insert a RC tree edge.
     rctree_edge_pt insert_rctree_edge(rctree_node_pt, rctree_node_pt, float_ct); // Insert a RC tree edge.
@@ -395,8 +498,11 @@ class RCTree {
     inline rctree_node_dict_pt rctree_node_dict_ptr() const;                     // Query the ptr.
     inline rctree_node_dict_rt rctree_node_dict() const;                         // Query the ref.
     inline rctree_edgelist_pt rctree_edgelist_ptr() const;                       // Query the rctree edgelist ptr.
+    inline float_vpt propagated_values_ptr();                                    // Query the propagated values.
 
     float_t load(int, int) const;                                                // Query the net capacitance.
+    float_t corner_load(size_t, int, int) const;                                 // Query the corner net cap.
+    float_t corner_slew(rctree_node_pt, size_t, int, int, float_ct) const;       // Query the corner slew.
     float_t slew(rctree_node_pt, int, int, float_ct) const;                      // Query the node slew.
     float_t slew(string_crt, int, int, float_ct) const;                          // Query the node slew.
     float_t delay(rctree_node_pt, int, int) const;                               // Query the node delay.
@@ -415,10 +521,17 @@ class RCTree {
     void_t _update_delay(rctree_node_pt, rctree_node_pt);                        // Update the delay.
     void_t _update_ldelay(rctree_node_pt, rctree_node_pt);                       // Update the load delay.
     void_t _update_response(rctree_node_pt, rctree_node_pt);                     // Update the moment and impulse.
+    void_t _update_corner_load(rctree_node_pt, rctree_node_pt, corner_upt_cvrt); // Update the corner load.
+    void_t _update_corner_delay(rctree_node_pt, rctree_node_pt, corner_upt_cvrt);// Update the corner delay.
+    void_t _update_corner_ldelay(rctree_node_pt, rctree_node_pt, corner_upt_cvrt); // Update the corner ldelay.
+    void_t _update_corner_response(rctree_node_pt, rctree_node_pt, corner_upt_cvrt); // Update the corner impulse.
 
     bool_t _is_rc_timing_updated;                                                // RC timing status.
+    bool_t _is_corner_rc_timing_updated;                                         // Corner RC timing status.
     rctree_node_dict_pt _rctree_node_dict_ptr;                                   // RC node dictionary.
     rctree_edgelist_pt _rctree_edgelist_ptr;                                     // RC tree edge list.
+
+    float_vt _propagated_values;                                                 // RC timing last seen by the fanout.
 };
 
 // Procedure: set_root_ptr
@@ -427,8 +540,11 @@ inline void_t RCTree::set_root_ptr(rctree_node_pt root_ptr) {
 }
 
 // Procedure: set_is_rc_timing_updated
+// Set the rc timing status. Any change of the parasitics outdates the rc timing of the corners
+// as well.
 inline void_t RCTree::set_is_rc_timing_updated(bool_ct flag) {
   _is_rc_timing_updated = flag;
+  if(!flag) _is_corner_rc_timing_updated = false;
 }
 
 // Function: is_rc_timing_updated
@@ -436,6 +552,11 @@ inline bool_t RCTree::is_rc_timing_updated() const {
   return _is_rc_timing_updated;
 }
 
+// Function: is_corner_rc_timing_updated
+inline bool_t RCTree::is_corner_rc_timing_updated() const {
+  return _is_corner_rc_timing_updated;
+}
+
 // Function: rctree_node_dict_ptr
 inline rctree_node_dict_pt RCTree::rctree_node_dict_ptr() const {
   return _rctree_node_dict_ptr;
@@ -451,6 +572,12 @@ inline rctree_edgelist_pt RCTree::rctree_edgelist_ptr() const {
   return _rctree_edgelist_ptr;
 }
 
+// Function: propagated_values_ptr
+// The load and the sink timing that were last propagated to the fanout of the root.
+inline float_vpt RCTree::propagated_values_ptr() {
+  return &_propagated_values;
+}
+
 // Function: root_ptr
 inline rctree_node_pt RCTree::root_ptr() const {
   return _root_ptr;
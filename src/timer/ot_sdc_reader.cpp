@@ -0,0 +1,381 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_sdc_reader.h"
+
+namespace __OpenTimer {
+
+// Constructor: SDCReader
+SDCReader::SDCReader():
+  _timer_ptr(nullptr)
+{
+
+}
+
+// Destructor: ~SDCReader
+SDCReader::~SDCReader() {
+
+}
+
+// Procedure: read
+// Read the sdc file and apply the constraints to the timer.
+void_t SDCReader::read(timer_pt timer_ptr, string_crt fpath) {
+  parse(fpath);
+  apply(timer_ptr);
+}
+
+// Procedure: parse
+// Parse the sdc file into the buffer. The procedure doesn't touch the timer and hence can run
+// concurrently with the construction of the circuit.
+void_t SDCReader::parse(string_crt fpath) {
+
+  // [BEG INFO]
+  LOG(INFO) << "Loading " + Utility::realpath(fpath);
+  // [END INFO]
+
+  SDC sdc;
+
+  sdc.set_create_clock_cbk(create_clock_cbk);
+  sdc.set_set_input_delay_cbk(set_input_delay_cbk);
+  sdc.set_set_output_delay_cbk(set_output_delay_cbk);
+  sdc.set_set_load_cbk(set_load_cbk);
+  sdc.set_set_driving_cell_cbk(set_driving_cell_cbk);
+
+  sdc.read(fpath.c_str(), this);
+}
+
+// Procedure: apply
+// Apply the buffered constraints to the primary inputs and primary outputs. The clock of each 
+// create_clock is inserted at its source ports, and a constraint relative to a clock falling 
+// edge is shifted by half of the period. The required arrival time of an output delay is the 
+// period minus the delay in the late split and the negated delay in the early split.
+void_t SDCReader::apply(timer_pt timer_ptr) {
+
+  CHECK(timer_ptr != nullptr);
+
+  _timer_ptr = timer_ptr;
+
+  // Index the port names.
+  named_pin_ptr_vt pi_table, po_table;
+
+  for(const auto& item : *(_timer_ptr->circuit_ptr()->primary_input_dict_ptr())) {
+    pi_table.emplace_back(item.first, item.second->pin_ptr());
+  }
+
+  for(const auto& item : *(_timer_ptr->circuit_ptr()->primary_output_dict_ptr())) {
+    po_table.emplace_back(item.first, item.second->pin_ptr());
+  }
+
+  std::sort(pi_table.begin(), pi_table.end());
+  std::sort(po_table.begin(), po_table.end());
+  
+  // Expand the port patterns by batches of tasks.
+  int_t N = _constraints.size();
+  pin_ptr_mt pin_ptrs(N);
+
+  for(int_t b=0; b<N; b+=OT_DEFAULT_SDC_BATCH_SIZE) {
+    #pragma omp task firstprivate(b) shared(pi_table, po_table, pin_ptrs, N)
+    {
+      for(int_t i=b; i<std::min(N, b + OT_DEFAULT_SDC_BATCH_SIZE); ++i) {
+        switch(_constraints[i].type) {
+          case RAT_TIMING_ASSERTION:
+          case LOAD_TIMING_ASSERTION:
+            _expand(_constraints[i].patterns, po_table, pin_ptrs[i]);
+          break;
+
+          default:
+            _expand(_constraints[i].patterns, pi_table, pin_ptrs[i]);
+          break;
+        }
+      }
+    }
+  }
+  #pragma omp taskwait
+
+  // Apply the constraints in the order of the file.
+  string_to_float_umap_t periods;
+
+  for(int_t i=0; i<N; ++i) {
+
+    const auto& constraint = _constraints[i];
+
+    if(pin_ptrs[i].empty() && !constraint.patterns.empty()) {
+      LOG(WARNING) << "No port matches " + constraint.patterns.front() + " (skipped)";
+    }
+    
+    auto period = periods.find(constraint.clock) == periods.end() ? OT_FLT_ZERO 
+                                                                  : periods[constraint.clock];
+    auto offset = constraint.is_clock_fall ? period / OT_FLT_TWO : OT_FLT_ZERO;
+
+    switch(constraint.type) {
+
+      case CLOCK_TIMING_ASSERTION:
+        periods[constraint.clock] = constraint.value[EARLY][RISE];
+        for(auto pin_ptr : pin_ptrs[i]) {
+          _timer_ptr->circuit_ptr()->insert_clock_tree(pin_ptr->primary_input_ptr(), 
+                                                       constraint.value[EARLY][RISE]);
+        }
+      break;
+
+      case AT_TIMING_ASSERTION:
+        for(auto pin_ptr : pin_ptrs[i]) {
+          EL_RF_ITER(el, rf) {
+            if(!constraint.mask[el][rf]) continue;
+            _timer_ptr->set_at(pin_ptr, el, rf, constraint.value[el][rf] + offset);
+          }
+        }
+      break;
+
+      case SLEW_TIMING_ASSERTION:
+        for(auto pin_ptr : pin_ptrs[i]) {
+          EL_RF_ITER(el, rf) {
+            if(!constraint.mask[el][rf]) continue;
+            _timer_ptr->set_slew(pin_ptr, el, rf, constraint.value[el][rf]);
+          }
+        }
+      break;
+
+      case RAT_TIMING_ASSERTION:
+        for(auto pin_ptr : pin_ptrs[i]) {
+          EL_RF_ITER(el, rf) {
+            if(!constraint.mask[el][rf]) continue;
+            _timer_ptr->set_rat(pin_ptr, el, rf, el == EARLY ? offset - constraint.value[el][rf] 
+                                                             : period + offset - constraint.value[el][rf]);
+          }
+        }
+      break;
+
+      case LOAD_TIMING_ASSERTION:
+        for(auto pin_ptr : pin_ptrs[i]) {
+          EL_RF_ITER(el, rf) {
+            if(!constraint.mask[el][rf]) continue;
+            _timer_ptr->set_load(pin_ptr->primary_output_ptr(), el, rf, constraint.value[el][rf]);
+          }
+        }
+      break;
+
+      default:
+      break;
+    }
+  }
+}
+
+// Procedure: _expand
+// Expand the port patterns against the sorted name table. A pattern without wildcards is found
+// by a binary search, and a pattern with the wildcards "*" and "?" is matched against the range 
+// of names sharing its literal prefix.
+void_t SDCReader::_expand(string_vt& patterns, named_pin_ptr_vt& table, pin_ptr_vt& pin_ptrs) const {
+
+  auto less = [] (const named_pin_ptr_vt::value_type& item, string_crt key) {
+    return item.first < key;
+  };
+
+  for(const auto& pattern : patterns) {
+    
+    auto w = pattern.find_first_of("*?");
+    auto prefix = pattern.substr(0, w);
+    auto itr = std::lower_bound(table.begin(), table.end(), prefix, less);
+
+    if(w == string_t::npos) {
+      if(itr != table.end() && itr->first == pattern) {
+        pin_ptrs.push_back(itr->second);
+      }
+      continue;
+    }
+
+    for(; itr != table.end() && itr->first.compare(0, prefix.size(), prefix) == 0; ++itr) {
+      if(_is_matched(pattern.c_str(), itr->first.c_str())) {
+        pin_ptrs.push_back(itr->second);
+      }
+    }
+  }
+}
+
+// Function: _is_matched
+// Return true if the name matches the pattern, where "*" matches any string and "?" matches any
+// single character.
+bool_t SDCReader::_is_matched(char_cpt pattern, char_cpt name) {
+
+  char_cpt star = nullptr;
+  char_cpt back = nullptr;
+
+  while(*name) {
+    if(*pattern == '?' || *pattern == *name) {
+      ++pattern;
+      ++name;
+    }
+    else if(*pattern == '*') {
+      star = pattern++;
+      back = name;
+    }
+    else if(star) {
+      pattern = star + 1;
+      name = ++back;
+    }
+    else return false;
+  }
+
+  while(*pattern == '*') ++pattern;
+
+  return *pattern == '\0';
+}
+
+// Procedure: _set_mask
+// Set the mask of the splits and transitions. A constraint applies to both splits if neither 
+// -min nor -max is given, and to both transitions if neither -rise nor -fall is given.
+void_t SDCReader::_set_mask(sdc_constraint_t& constraint, bool_t is_min, bool_t is_max, 
+                            bool_t is_rise, bool_t is_fall) {
+  EL_RF_ITER(el, rf) {
+    constraint.mask[el][rf] = (el == EARLY ? (is_min || !is_max) : (is_max || !is_min)) &&
+                              (rf == RISE ? (is_rise || !is_fall) : (is_fall || !is_rise));
+  }
+}
+
+// Function: _insert
+// Insert a new constraint of the given type on the given objects.
+sdc_constraint_t& SDCReader::_insert(timing_assertion_type_e type, std::vector<char*>& objects) {
+
+  _constraints.emplace_back();
+
+  auto& constraint = _constraints.back();
+
+  constraint.type = type;
+  constraint.is_clock_fall = false;
+  for(auto object : objects) {
+    constraint.patterns.emplace_back(object);
+  }
+  EL_RF_ITER(el, rf) {
+    constraint.mask[el][rf] = true;
+    constraint.value[el][rf] = OT_FLT_ZERO;
+  }
+
+  return constraint;
+}
+
+// Function: create_clock_cbk
+// Callback function for create_clock. A clock without a name is named by its first source.
+int SDCReader::create_clock_cbk(void* obj, void* ud) {
+  
+  auto reader = static_cast<CreateClock*>(obj);
+  auto sdc_ptr = static_cast<SDCReader*>(ud);
+
+  auto& constraint = sdc_ptr->_insert(CLOCK_TIMING_ASSERTION, reader->objects);
+
+  if(reader->clock_name) {
+    constraint.clock = reader->clock_name;
+  }
+  else if(!reader->objects.empty()) {
+    constraint.clock = reader->objects.front();
+  }
+
+  EL_RF_ITER(el, rf) {
+    constraint.value[el][rf] = reader->period;
+  }
+  
+  return 0;
+}
+
+// Function: set_input_delay_cbk
+// Callback function for set_input_delay.
+int SDCReader::set_input_delay_cbk(void* obj, void* ud) {
+
+  auto reader = static_cast<SetInputDelay*>(obj);
+  auto sdc_ptr = static_cast<SDCReader*>(ud);
+
+  auto& constraint = sdc_ptr->_insert(AT_TIMING_ASSERTION, reader->objects);
+
+  if(reader->clock_name) {
+    constraint.clock = reader->clock_name;
+  }
+  constraint.is_clock_fall = reader->is_clock_fall;
+
+  _set_mask(constraint, reader->is_min, reader->is_max, reader->is_rise, reader->is_fall);
+
+  EL_RF_ITER(el, rf) {
+    constraint.value[el][rf] = reader->delay_value;
+  }
+
+  return 0;
+}
+
+// Function: set_output_delay_cbk
+// Callback function for set_output_delay.
+int SDCReader::set_output_delay_cbk(void* obj, void* ud) {
+
+  auto reader = static_cast<SetOutputDelay*>(obj);
+  auto sdc_ptr = static_cast<SDCReader*>(ud);
+
+  auto& constraint = sdc_ptr->_insert(RAT_TIMING_ASSERTION, reader->objects);
+
+  if(reader->clock_name) {
+    constraint.clock = reader->clock_name;
+  }
+  constraint.is_clock_fall = reader->is_clock_fall;
+
+  _set_mask(constraint, reader->is_min, reader->is_max, reader->is_rise, reader->is_fall);
+
+  EL_RF_ITER(el, rf) {
+    constraint.value[el][rf] = reader->delay_value;
+  }
+
+  return 0;
+}
+
+// Function: set_load_cbk
+// Callback function for set_load.
+int SDCReader::set_load_cbk(void* obj, void* ud) {
+  
+  auto reader = static_cast<SetLoad*>(obj);
+  auto sdc_ptr = static_cast<SDCReader*>(ud);
+
+  auto& constraint = sdc_ptr->_insert(LOAD_TIMING_ASSERTION, reader->objects);
+
+  _set_mask(constraint, reader->is_min, reader->is_max, false, false);
+
+  EL_RF_ITER(el, rf) {
+    constraint.value[el][rf] = reader->value;
+  }
+
+  return 0;
+}
+
+// Function: set_driving_cell_cbk
+// Callback function for set_driving_cell. Only the input transitions are applied as the slews of
+// the ports, and the driving cell itself is not modeled.
+int SDCReader::set_driving_cell_cbk(void* obj, void* ud) {
+  
+  auto reader = static_cast<SetDrivingCell*>(obj);
+  auto sdc_ptr = static_cast<SDCReader*>(ud);
+
+  bool_t has_rise = (reader->rise_time != FLT_MAX);
+  bool_t has_fall = (reader->fall_time != FLT_MAX);
+
+  if(!has_rise && !has_fall) {
+    LOG(WARNING) << "Ignore set_driving_cell without input transitions";
+    return 0;
+  }
+
+  auto& constraint = sdc_ptr->_insert(SLEW_TIMING_ASSERTION, reader->objects);
+
+  _set_mask(constraint, reader->is_min, reader->is_max, has_rise, has_fall);
+
+  EL_RF_ITER(el, rf) {
+    constraint.value[el][rf] = (rf == RISE) ? reader->rise_time : reader->fall_time;
+  }
+
+  return 0;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
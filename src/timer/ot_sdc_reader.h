@@ -0,0 +1,92 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_SDC_READER_H_
+#define OT_SDC_READER_H_
+
+#include "ot_circuit.h"
+#include "ot_typedef.h"
+#include "ot_sdc.h"
+
+namespace __OpenTimer {
+
+// Struct: SDCConstraint
+// A port constraint buffered from a sdc file. The value of a clock is its period, and the value 
+// of an output delay is the external delay from which the required arrival time is derived.
+struct SDCConstraint {
+  timing_assertion_type_e type;                                                       // Type.
+  bool_t mask[2][2];                                                                  // Split/trans mask.
+  float_t value[2][2];                                                                // Value.
+  bool_t is_clock_fall;                                                               // Clock fall flag.
+  string_t clock;                                                                     // Clock name.
+  string_vt patterns;                                                                 // Port patterns.
+};
+
+// Class: SDCReader
+// The reader ingests the port constraints of a sdc file, i.e., create_clock, set_input_delay,
+// set_output_delay, set_load, and set_driving_cell with input transitions. The parse phase 
+// buffers the constraints and hence can overlap with the netlist construction. The apply phase
+// indexes the port names in sorted tables, expands the get_ports patterns in parallel batches
+// over the name range of the literal prefix of each pattern, and applies the constraints in the
+// order of the file. The values are in the units of the cell library as in the .timing file.
+class SDCReader {
+
+  public:
+
+    SDCReader();                                                                      // Constructor.
+    ~SDCReader();                                                                     // Destructor.
+
+    void_t read(timer_pt, string_crt);                                                // Read.
+    void_t parse(string_crt);                                                         // Parse.
+    void_t apply(timer_pt);                                                           // Apply.
+
+    inline timer_pt timer_ptr() const;                                                // Query the timer pointer.
+
+    inline size_t num_constraints() const;                                            // Query the constraint count.
+
+    static int create_clock_cbk(void*, void*);                                        // create_clock.
+    static int set_input_delay_cbk(void*, void*);                                     // set_input_delay.
+    static int set_output_delay_cbk(void*, void*);                                    // set_output_delay.
+    static int set_load_cbk(void*, void*);                                            // set_load.
+    static int set_driving_cell_cbk(void*, void*);                                    // set_driving_cell.
+
+  private:
+
+    timer_pt _timer_ptr;                                                              // Timer pointer.
+
+    sdc_constraint_vt _constraints;                                                   // Buffered constraints.
+
+    sdc_constraint_t& _insert(timing_assertion_type_e, std::vector<char*>&);          // Insert a constraint.
+
+    void_t _expand(string_vt&, named_pin_ptr_vt&, pin_ptr_vt&) const;                // Expand the patterns.
+
+    static void_t _set_mask(sdc_constraint_t&, bool_t, bool_t, bool_t, bool_t);      // Set the mask.
+    static bool_t _is_matched(char_cpt, char_cpt);                                    // Match a pattern.
+};
+
+// Function: timer_ptr
+// Return the timer pointer.
+inline timer_pt SDCReader::timer_ptr() const {
+  return _timer_ptr;
+}
+
+// Function: num_constraints
+// Return the number of buffered constraints.
+inline size_t SDCReader::num_constraints() const {
+  return _constraints.size();
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
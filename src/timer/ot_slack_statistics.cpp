@@ -0,0 +1,237 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_slack_statistics.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+SlackStatistics::SlackStatistics(size_t num_bins, float_ct lower, float_ct upper, size_t num_domains):
+  _num_bins(num_bins),
+  _lower(lower),
+  _upper(upper),
+  _domain_names(num_domains)
+{
+  CHECK(num_bins > 0 && lower < upper);
+
+  EL_ITER(el) {
+    _min[el] = OT_FLT_MAX;
+    _max[el] = OT_FLT_MIN;
+    _num_underflows[el] = 0;
+    _num_overflows[el] = 0;
+    _bins[el].resize(num_bins, 0);
+    _num_endpoints[el].resize(num_domains, 0);
+    _num_failing_endpoints[el].resize(num_domains, 0);
+    _tns[el].resize(num_domains, OT_FLT_ZERO);
+    _wns[el].resize(num_domains, OT_FLT_ZERO);
+  }
+}
+
+// Function: num_endpoints
+// Return the number of sampled endpoints across all clock domains.
+size_t SlackStatistics::num_endpoints(int el) const {
+  return accumulate(_num_endpoints[el].begin(), _num_endpoints[el].end(), size_t(0));
+}
+
+// Function: num_failing_endpoints
+// Return the number of endpoints with negative slack across all clock domains.
+size_t SlackStatistics::num_failing_endpoints(int el) const {
+  return accumulate(_num_failing_endpoints[el].begin(), _num_failing_endpoints[el].end(), size_t(0));
+}
+
+// Function: tns
+// Return the total negative endpoint slack across all clock domains.
+float_t SlackStatistics::tns(int el) const {
+  return accumulate(_tns[el].begin(), _tns[el].end(), OT_FLT_ZERO);
+}
+
+// Function: wns
+// Return the worst negative endpoint slack across all clock domains.
+float_t SlackStatistics::wns(int el) const {
+  return _wns[el].empty() ? OT_FLT_ZERO : *min_element(_wns[el].begin(), _wns[el].end());
+}
+
+// Function: percentile
+// Return the slack below which the given percentage (0-100) of the endpoints fall. The value is
+// linearly interpolated within the bin that contains the rank. Samples outside the histogram
+// range are interpolated between the range bound and the extreme sample.
+float_t SlackStatistics::percentile(int el, float_ct q) const {
+
+  size_t N = _num_underflows[el] + _num_overflows[el] + 
+             accumulate(_bins[el].begin(), _bins[el].end(), size_t(0));
+
+  if(N == 0) return OT_UNDEFINED_FLT;
+
+  auto target = min(max(q, OT_FLT_ZERO), 100.0f) / 100.0f * N;
+  
+  // Locate the region [lo, hi) with count c whose cumulative count reaches the target.
+  auto interpolate = [&] (float_ct lo, float_ct hi, float_ct c, float_ct cum) -> float_t {
+    return c > 0 ? lo + (hi - lo) * min(1.0f, (target - cum) / c) : lo;
+  };
+
+  float_t cum = _num_underflows[el];
+
+  if(_num_underflows[el] && target <= cum) {
+    return interpolate(_min[el], _lower, _num_underflows[el], OT_FLT_ZERO);
+  }
+
+  for(size_t b=0; b<_num_bins; ++b) {
+    if(_bins[el][b] && target <= cum + _bins[el][b]) {
+      return interpolate(_lower + b*bin_width(), _lower + (b+1)*bin_width(), _bins[el][b], cum);
+    }
+    cum += _bins[el][b];
+  }
+
+  return _num_overflows[el] ? interpolate(_upper, _max[el], _num_overflows[el], cum) : _upper;
+}
+
+// Function: is_configured
+// Return true if the statistics are binned with the given number of bins and range.
+bool_t SlackStatistics::is_configured(size_t num_bins, float_ct lower, float_ct upper) const {
+  return _num_bins == num_bins && _lower == lower && _upper == upper;
+}
+
+// Procedure: insert
+// Insert the slack of an endpoint at a given timing split in a given clock domain.
+void_t SlackStatistics::insert(size_t d, int el, float_ct slack) {
+
+  _min[el] = min(_min[el], slack);
+  _max[el] = max(_max[el], slack);
+
+  if(slack < _lower) {
+    ++_num_underflows[el];
+  }
+  else if(slack >= _upper) {
+    ++_num_overflows[el];
+  }
+  else {
+    ++_bins[el][min(_num_bins - 1, static_cast<size_t>((slack - _lower) / bin_width()))];
+  }
+
+  ++_num_endpoints[el][d];
+
+  if(slack < OT_FLT_ZERO) {
+    ++_num_failing_endpoints[el][d];
+    _tns[el][d] += slack;
+    _wns[el][d] = min(_wns[el][d], slack);
+  }
+}
+
+// Procedure: merge
+// Merge the statistics of the same configuration into this object.
+void_t SlackStatistics::merge(const SlackStatistics& rhs) {
+
+  CHECK(rhs.is_configured(_num_bins, _lower, _upper) && rhs.num_domains() == num_domains());
+
+  EL_ITER(el) {
+    _min[el] = min(_min[el], rhs._min[el]);
+    _max[el] = max(_max[el], rhs._max[el]);
+    _num_underflows[el] += rhs._num_underflows[el];
+    _num_overflows[el] += rhs._num_overflows[el];
+    for(size_t b=0; b<_num_bins; ++b) {
+      _bins[el][b] += rhs._bins[el][b];
+    }
+    for(size_t d=0; d<num_domains(); ++d) {
+      _num_endpoints[el][d] += rhs._num_endpoints[el][d];
+      _num_failing_endpoints[el][d] += rhs._num_failing_endpoints[el][d];
+      _tns[el][d] += rhs._tns[el][d];
+      _wns[el][d] = min(_wns[el][d], rhs._wns[el][d]);
+    }
+  }
+}
+
+// Procedure: print
+// Print the statistics in a human-readable text format.
+void_t SlackStatistics::print(file_pt fptr) const {
+
+  fprintf(fptr, "slack_statistics %lu %.3f %.3f\n", _num_bins, _lower, _upper);
+
+  EL_ITER(el) {
+
+    auto c = el ? 'L' : 'E';
+
+    fprintf(fptr, "Split %c: endpoints %lu failing %lu tns %.3f wns %.3f\n", c, num_endpoints(el), 
+            num_failing_endpoints(el), tns(el), wns(el));
+
+    for(size_t d=0; d<num_domains(); ++d) {
+      fprintf(fptr, "Domain %s %c: endpoints %lu failing %lu tns %.3f wns %.3f\n", 
+              _domain_names[d].c_str(), c, _num_endpoints[el][d], _num_failing_endpoints[el][d],
+              _tns[el][d], _wns[el][d]);
+    }
+
+    if(num_endpoints(el)) {
+      fprintf(fptr, "Percentile %c: p1 %.3f p10 %.3f p50 %.3f p90 %.3f p99 %.3f\n", c, 
+              percentile(el, 1.0f), percentile(el, 10.0f), percentile(el, 50.0f), 
+              percentile(el, 90.0f), percentile(el, 99.0f));
+    }
+
+    fprintf(fptr, "Histogram %c: underflow %lu overflow %lu\n", c, _num_underflows[el], _num_overflows[el]);
+
+    for(size_t b=0; b<_num_bins; ++b) {
+      fprintf(fptr, "[%.3f, %.3f) %lu\n", _lower + b*bin_width(), _lower + (b+1)*bin_width(), _bins[el][b]);
+    }
+  }
+}
+
+// Procedure: write
+// Write the statistics in a compact binary encoding. The stream starts with the 8-byte magic
+// "OTSLKST1", the bin count (uint64), the histogram range (float32 x2), and the domain count
+// (uint64). For each timing split (early first) follow the underflow and overflow counts 
+// (uint64 x2), the minimum and maximum samples (float32 x2), and the bin counts (uint64 each).
+// Each domain is then written as its name (uint16 length and the name bytes) followed by, per
+// timing split, the endpoint and failing counts (uint64 x2) and the tns and wns (float32 x2).
+// Numbers are in the host byte order.
+void_t SlackStatistics::write(file_pt fptr) const {
+
+  uint64_t u64;
+  uint16_t u16;
+
+  fwrite("OTSLKST1", 1, 8, fptr);
+  
+  u64 = _num_bins;
+  fwrite(&u64, sizeof(u64), 1, fptr);
+  fwrite(&_lower, sizeof(float_t), 1, fptr);
+  fwrite(&_upper, sizeof(float_t), 1, fptr);
+  u64 = num_domains();
+  fwrite(&u64, sizeof(u64), 1, fptr);
+
+  EL_ITER(el) {
+    u64 = _num_underflows[el];
+    fwrite(&u64, sizeof(u64), 1, fptr);
+    u64 = _num_overflows[el];
+    fwrite(&u64, sizeof(u64), 1, fptr);
+    fwrite(&_min[el], sizeof(float_t), 1, fptr);
+    fwrite(&_max[el], sizeof(float_t), 1, fptr);
+    for(size_t b=0; b<_num_bins; ++b) {
+      u64 = _bins[el][b];
+      fwrite(&u64, sizeof(u64), 1, fptr);
+    }
+  }
+
+  for(size_t d=0; d<num_domains(); ++d) {
+    u16 = static_cast<uint16_t>(min(_domain_names[d].size(), size_t(UINT16_MAX)));
+    fwrite(&u16, sizeof(u16), 1, fptr);
+    fwrite(_domain_names[d].data(), 1, u16, fptr);
+    EL_ITER(el) {
+      u64 = _num_endpoints[el][d];
+      fwrite(&u64, sizeof(u64), 1, fptr);
+      u64 = _num_failing_endpoints[el][d];
+      fwrite(&u64, sizeof(u64), 1, fptr);
+      fwrite(&_tns[el][d], sizeof(float_t), 1, fptr);
+      fwrite(&_wns[el][d], sizeof(float_t), 1, fptr);
+    }
+  }
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
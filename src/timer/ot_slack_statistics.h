@@ -0,0 +1,162 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_SLACK_STATISTICS_H_
+#define OT_SLACK_STATISTICS_H_
+
+#include "ot_utility.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: SlackStatistics
+// The class summarizes the endpoint slacks of the design. Each endpoint (a test at a given timing
+// split and transition) with a finite slack is one sample. The samples of each timing split are
+// binned into a fixed-width histogram over [lower, upper), and the TNS, WNS, and failing count
+// are accumulated per clock domain. Percentiles are interpolated within the histogram bins, so
+// their error is bounded by the bin width inside the range.
+class SlackStatistics {
+
+  public:
+
+    SlackStatistics(size_t, float_ct, float_ct, size_t);                  // Constructor.
+
+    inline size_t num_bins() const;                                       // Query the bin count.
+    inline size_t num_domains() const;                                    // Query the domain count.
+    inline size_t bin_count(int, size_t) const;                           // Query the bin count.
+    inline size_t num_underflows(int) const;                              // Query the underflow count.
+    inline size_t num_overflows(int) const;                               // Query the overflow count.
+    inline size_t num_endpoints(size_t, int) const;                       // Query the endpoint count.
+    inline size_t num_failing_endpoints(size_t, int) const;               // Query the failing count.
+
+    inline float_t lower() const;                                         // Query the lower bound.
+    inline float_t upper() const;                                         // Query the upper bound.
+    inline float_t bin_width() const;                                     // Query the bin width.
+    inline float_t tns(size_t, int) const;                                // Query the domain tns.
+    inline float_t wns(size_t, int) const;                                // Query the domain wns.
+
+    inline string_crt domain_name(size_t) const;                          // Query the domain name.
+
+    inline void_t set_domain_name(size_t, string_crt);                    // Set the domain name.
+    
+    size_t num_endpoints(int) const;                                      // Query the endpoint count.
+    size_t num_failing_endpoints(int) const;                              // Query the failing count.
+
+    float_t tns(int) const;                                               // Query the tns.
+    float_t wns(int) const;                                               // Query the wns.
+    float_t percentile(int, float_ct) const;                              // Query a percentile.
+
+    bool_t is_configured(size_t, float_ct, float_ct) const;               // Query the configuration.
+
+    void_t insert(size_t, int, float_ct);                                 // Insert a sample.
+    void_t merge(const SlackStatistics&);                                 // Merge the statistics.
+    void_t print(file_pt) const;                                          // Print the statistics.
+    void_t write(file_pt) const;                                          // Write the statistics.
+
+  private:
+
+    size_t _num_bins;                                                     // Number of bins.
+
+    float_t _lower;                                                       // Histogram lower bound.
+    float_t _upper;                                                       // Histogram upper bound.
+    float_t _min[2];                                                      // Minimum sample.
+    float_t _max[2];                                                      // Maximum sample.
+
+    size_t _num_underflows[2];                                            // Samples below the range.
+    size_t _num_overflows[2];                                             // Samples above the range.
+
+    size_vt _bins[2];                                                     // Histogram bins.
+    size_vt _num_endpoints[2];                                            // Domain endpoint counts.
+    size_vt _num_failing_endpoints[2];                                    // Domain failing counts.
+
+    float_vt _tns[2];                                                     // Domain tns.
+    float_vt _wns[2];                                                     // Domain wns.
+
+    string_vt _domain_names;                                              // Domain names.
+};
+
+// Function: num_bins
+inline size_t SlackStatistics::num_bins() const {
+  return _num_bins;
+}
+
+// Function: num_domains
+inline size_t SlackStatistics::num_domains() const {
+  return _domain_names.size();
+}
+
+// Function: bin_count
+inline size_t SlackStatistics::bin_count(int el, size_t b) const {
+  return _bins[el][b];
+}
+
+// Function: num_underflows
+inline size_t SlackStatistics::num_underflows(int el) const {
+  return _num_underflows[el];
+}
+
+// Function: num_overflows
+inline size_t SlackStatistics::num_overflows(int el) const {
+  return _num_overflows[el];
+}
+
+// Function: num_endpoints
+inline size_t SlackStatistics::num_endpoints(size_t d, int el) const {
+  return _num_endpoints[el][d];
+}
+
+// Function: num_failing_endpoints
+inline size_t SlackStatistics::num_failing_endpoints(size_t d, int el) const {
+  return _num_failing_endpoints[el][d];
+}
+
+// Function: lower
+inline float_t SlackStatistics::lower() const {
+  return _lower;
+}
+
+// Function: upper
+inline float_t SlackStatistics::upper() const {
+  return _upper;
+}
+
+// Function: bin_width
+inline float_t SlackStatistics::bin_width() const {
+  return (_upper - _lower) / _num_bins;
+}
+
+// Function: tns
+inline float_t SlackStatistics::tns(size_t d, int el) const {
+  return _tns[el][d];
+}
+
+// Function: wns
+inline float_t SlackStatistics::wns(size_t d, int el) const {
+  return _wns[el][d];
+}
+
+// Function: domain_name
+inline string_crt SlackStatistics::domain_name(size_t d) const {
+  return _domain_names[d];
+}
+
+// Procedure: set_domain_name
+inline void_t SlackStatistics::set_domain_name(size_t d, string_crt name) {
+  _domain_names[d] = name;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,139 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_spatial_grid.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+// Create a grid of about the given number of bins over the bounding box. The bins are close
+// to square in the database unit of the box.
+SpatialGrid::SpatialGrid(rectangle_crt box, size_t num_bins) {
+
+  float_t w = max(box.width(), OT_FLT_ONE);
+  float_t h = max(box.height(), OT_FLT_ONE);
+  float_t n = max(num_bins, (size_t)1);
+
+  _num_cols = max((size_t)1, (size_t)ceil(sqrt(n * w / h)));
+  _num_rows = max((size_t)1, (size_t)ceil(n / _num_cols));
+
+  _lx = box.lower_left_point().x();
+  _ly = box.lower_left_point().y();
+  _bin_width = w / _num_cols;
+  _bin_height = h / _num_rows;
+
+  _bins.resize(_num_cols * _num_rows);
+}
+
+// Destructor.
+SpatialGrid::~SpatialGrid() {
+}
+
+// Function: _col
+// Return the column that covers the x coordinate.
+size_t SpatialGrid::_col(float_ct x) const {
+  if(x <= _lx) return 0;
+  return min(_num_cols - 1, (size_t)((x - _lx) / _bin_width));
+}
+
+// Function: _row
+// Return the row that covers the y coordinate.
+size_t SpatialGrid::_row(float_ct y) const {
+  if(y <= _ly) return 0;
+  return min(_num_rows - 1, (size_t)((y - _ly) / _bin_height));
+}
+
+// Procedure: insert
+// Insert a placed pin into the bin that covers its placement. An indexed pin is updated instead.
+void_t SpatialGrid::insert(pin_pt pin_ptr) {
+  
+  if(contains(pin_ptr)) {
+    update(pin_ptr);
+    return;
+  }
+
+  if(!pin_ptr->is_placed()) return;
+
+  auto p = pin_ptr->placement();
+  auto b = _row(p.y()) * _num_cols + _col(p.x());
+  
+  _bins[b].push_back(pin_ptr);
+  _bin_idx[pin_ptr] = b;
+}
+
+// Procedure: remove
+// Remove a pin from the grid.
+void_t SpatialGrid::remove(pin_pt pin_ptr) {
+
+  auto itr = _bin_idx.find(pin_ptr);
+
+  if(itr == _bin_idx.end()) return;
+
+  auto& bin = _bins[itr->second];
+  
+  *std::find(bin.begin(), bin.end(), pin_ptr) = bin.back();
+  bin.pop_back();
+
+  _bin_idx.erase(itr);
+}
+
+// Procedure: update
+// Move a pin to the bin that covers its current placement.
+void_t SpatialGrid::update(pin_pt pin_ptr) {
+  
+  auto itr = _bin_idx.find(pin_ptr);
+
+  if(itr == _bin_idx.end()) {
+    insert(pin_ptr);
+    return;
+  }
+
+  if(!pin_ptr->is_placed()) {
+    remove(pin_ptr);
+    return;
+  }
+
+  auto p = pin_ptr->placement();
+  auto b = _row(p.y()) * _num_cols + _col(p.x());
+
+  if(b == itr->second) return;
+
+  remove(pin_ptr);
+  _bins[b].push_back(pin_ptr);
+  _bin_idx[pin_ptr] = b;
+}
+
+// Procedure: query
+// Append the pins whose placement is inside the region (boundary inclusive) to the vector.
+void_t SpatialGrid::query(rectangle_crt region, pin_ptr_vrt pin_ptrs) const {
+
+  const auto& ll = region.lower_left_point();
+  const auto& ur = region.upper_right_point();
+
+  if(ll.x() > ur.x() || ll.y() > ur.y()) return;
+
+  for(auto r=_row(ll.y()); r<=_row(ur.y()); ++r) {
+    for(auto c=_col(ll.x()); c<=_col(ur.x()); ++c) {
+      for(const auto& pin_ptr : _bins[r * _num_cols + c]) {
+        auto p = pin_ptr->placement();
+        if(p.x() >= ll.x() && p.x() <= ur.x() && p.y() >= ll.y() && p.y() <= ur.y()) {
+          pin_ptrs.push_back(pin_ptr);
+        }
+      }
+    }
+  }
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
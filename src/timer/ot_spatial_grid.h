@@ -0,0 +1,89 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_SPATIAL_GRID_H_
+#define OT_SPATIAL_GRID_H_
+
+#include "ot_utility.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+#include "ot_pin.h"
+
+namespace __OpenTimer {
+
+// Class: SpatialGrid
+// The class indexes placed pins by a uniform grid of bins over a bounding box. Each pin resides
+// in the bin that covers its placement, and pins outside the box are clamped to the border bins.
+// A pin is moved between bins in constant time when its placement changes, and a region query
+// visits only the bins that overlap the region.
+class SpatialGrid {
+
+  public:
+
+    SpatialGrid(rectangle_crt, size_t);                                   // Constructor.
+    ~SpatialGrid();                                                       // Destructor.
+
+    inline size_t num_cols() const;                                       // Query the column count.
+    inline size_t num_rows() const;                                       // Query the row count.
+    inline size_t num_pins() const;                                       // Query the pin count.
+
+    inline bool_t contains(pin_pt) const;                                 // Query if a pin is indexed.
+
+    void_t insert(pin_pt);                                                // Insert a pin.
+    void_t remove(pin_pt);                                                // Remove a pin.
+    void_t update(pin_pt);                                                // Update a pin.
+    void_t query(rectangle_crt, pin_ptr_vrt) const;                       // Query the pins in a region.
+
+  private:
+
+    float_t _lx;                                                          // Lower-left x.
+    float_t _ly;                                                          // Lower-left y.
+    float_t _bin_width;                                                   // Bin width.
+    float_t _bin_height;                                                  // Bin height.
+
+    size_t _num_cols;                                                     // Number of columns.
+    size_t _num_rows;                                                     // Number of rows.
+
+    pin_ptr_mt _bins;                                                     // Pins in each bin.
+    pin_ptr_to_idx_umap_t _bin_idx;                                       // Bin of each pin.
+
+    size_t _col(float_ct) const;                                          // Query the column index.
+    size_t _row(float_ct) const;                                          // Query the row index.
+};
+
+// Function: num_cols
+inline size_t SpatialGrid::num_cols() const {
+  return _num_cols;
+}
+
+// Function: num_rows
+inline size_t SpatialGrid::num_rows() const {
+  return _num_rows;
+}
+
+// Function: num_pins
+inline size_t SpatialGrid::num_pins() const {
+  return _bin_idx.size();
+}
+
+// Function: contains
+// Return true if the pin is in the grid.
+inline bool_t SpatialGrid::contains(pin_pt pin_ptr) const {
+  return _bin_idx.find(pin_ptr) != _bin_idx.end();
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -17,6 +17,7 @@ namespace __OpenTimer {
 
 // Constructor: TechLib
 TechLib::TechLib():
+  _database_unit(0.0),
   _site_dict_uptr(new site_dict_t()),
   _layer_dict_uptr(new layer_dict_t()),
   _macro_dict_uptr(new macro_dict_t())
@@ -36,9 +37,11 @@ macro_pt TechLib::insert_macro(string_crt name) const {
 }
 
 // Function: insert_layer
-// Insert a layer into the circuit.
+// Insert a layer into the circuit. A new layer is numbered in the order of insertion.
 layer_pt TechLib::insert_layer(string_crt name) const {
+  auto num_layers = layer_dict_ptr()->size();
   layer_pt layer_ptr = layer_dict_ptr()->insert(name, name);
+  if(layer_dict_ptr()->size() > num_layers) layer_ptr->set_idx(num_layers);
   return layer_ptr;
 }
 
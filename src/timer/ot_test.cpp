@@ -12,6 +12,7 @@
  ******************************************************************************/
 
 #include "ot_test.h"
+#include "ot_corner.h"
 
 namespace __OpenTimer {
 
@@ -112,6 +113,52 @@ void_t Test::update_rat(int el, int rf, clock_tree_pt clock_tree_ptr) {
   else set_rat(el, rf, related_at + period - constraint);
 }
 
+// Procedure: update_corner_rat
+// Update the pre-cppr required arrival time of a corner in the same way as the default one,
+// except that the constraint comes from the corner library and the clock arrival time and the
+// slews come from the corner timing of the nodes. The rat is left undefined if the corner lacks
+// the constraint arc, i.e., the corner is not bound to the design.
+void_t Test::update_corner_rat(corner_pt corner_ptr, clock_tree_pt clock_tree_ptr) {
+
+  CHECK(constrained_pin_ptr() != nullptr && corner_ptr != nullptr);
+
+  auto c = corner_ptr->idx();
+
+  if(_corner_rat.size() < ((c + 1) << 2)) {
+    _corner_rat.resize((c + 1) << 2, OT_FLT_ZERO);
+  }
+
+  // Case 1: primary output test.
+  if(related_pin_ptr() == nullptr) {
+    EL_RF_ITER(el, rf) {
+      _corner_rat[(c << 2) | (el << 1) | rf] = rat(el, rf);
+    }
+    return;
+  }
+
+  // Case 2: sequential test.
+  node_pt D = constrained_pin_ptr()->node_ptr();
+  node_pt CK = related_pin_ptr()->node_ptr();
+
+  float_t period = clock_tree_ptr == nullptr ? OT_FLT_ZERO : clock_tree_ptr->period();
+
+  EL_RF_ITER(el, rf) {
+    auto arc = corner_ptr->timing_arc_ptr(el, timing_arc_ptr(el));
+    if(arc == nullptr) {
+      _corner_rat[(c << 2) | (el << 1) | rf] = (el == EARLY) ? OT_FLT_MIN : OT_FLT_MAX;
+      continue;
+    }
+    int_t related_el = !el;
+    int_t related_rf = arc->is_rising_edge_triggered() ? RISE : FALL;
+    auto related_at = CK->corner_at(c, related_el, related_rf);
+    auto constraint = arc->constraint(
+      related_rf, rf, CK->corner_slew(c, related_el, related_rf), D->corner_slew(c, el, rf)
+    );
+    _corner_rat[(c << 2) | (el << 1) | rf] = (el == EARLY) ? constraint + related_at : 
+                                                             related_at + period - constraint;
+  }
+}
+
 //-------------------------------------------------------------------------------------------------
 
 // Constructor: Endpoint
@@ -241,17 +288,96 @@ void_t EndpointMinHeap::_bubble_down(int_t i) {
 }
 
 // Procedure: top
-// Extract the top k items to a given vector array. This won't affect the original
-// heap structure.
-void_t EndpointMinHeap::top(size_t K, endpoint_ptr_vrt endpoint_ptrs) {
+// Extract the top k items to a given vector array in non-decreasing order of slack. The heap
+// is not modified. The procedure performs a best-first walk over the implicit heap array: an
+// auxiliary heap keeps the frontier of visited slots, and extracting a slot exposes its two
+// children. Only the top k items and their children are visited, which takes O(k log k).
+void_t EndpointMinHeap::top(size_t K, endpoint_ptr_vrt endpoint_ptrs) const {
+
   endpoint_ptrs.clear();
+
+  K = min(K, size());
+
+  if(K == 0) return;
+
   endpoint_ptrs.reserve(K);
-  while(size() && endpoint_ptrs.size() < K) {
-    endpoint_ptrs.push_back(top());
-    pop();
+
+  using slot_t = pair < float_t, int_t >;
+
+  std::priority_queue < slot_t, vector < slot_t >, std::greater < slot_t > > frontier;
+
+  frontier.emplace(_heap[1].key(), 1);
+
+  while(endpoint_ptrs.size() < K) {
+
+    auto i = frontier.top().second;
+    frontier.pop();
+    
+    endpoint_ptrs.push_back(_heap[i].value());
+
+    for(int_t c = i << 1; c <= (i << 1 | 1) && c <= (int_t)size(); ++c) {
+      frontier.emplace(_heap[c].key(), c);
+    }
   }
-  for(unsigned_t i=0; i<endpoint_ptrs.size(); i++) {
-    insert(endpoint_ptrs[i]);
+}
+
+// Procedure: parallel_top
+// Extract the top k items to a given vector array in non-decreasing order of slack. The heap
+// is not modified. The heap array is partitioned among threads, each thread selects the top k 
+// items of its partition, and the partial results are merged. The procedure is preferred over
+// the best-first walk when k is a large fraction of the heap size.
+void_t EndpointMinHeap::parallel_top(size_t K, endpoint_ptr_vrt endpoint_ptrs) const {
+
+  endpoint_ptrs.clear();
+  
+  K = min(K, size());
+
+  if(K == 0) return;
+
+  auto compare = [&] (int_t i, int_t j) -> bool_t {
+    return _heap[i].key() < _heap[j].key();
+  };
+
+  int_t num_partitions = omp_get_max_threads();
+  int_t partition_size = (size() + num_partitions - 1) / num_partitions;
+
+  vector < int_vt > partitions(num_partitions);
+
+  #pragma omp parallel for schedule(static, 1)
+  for(int_t p=0; p<num_partitions; ++p) {
+    
+    int_t beg = 1 + p*partition_size;
+    int_t end = min(beg + partition_size, (int_t)size() + 1);
+
+    if(beg >= end) continue;
+
+    auto& slots = partitions[p];
+
+    slots.resize(end - beg);
+    for(int_t i=beg; i<end; ++i) slots[i - beg] = i;
+
+    if(slots.size() > K) {
+      std::nth_element(slots.begin(), slots.begin() + K, slots.end(), compare);
+      slots.resize(K);
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  int_vt slots;
+  slots.reserve(K * num_partitions);
+  for(const auto& partition : partitions) {
+    slots.insert(slots.end(), partition.begin(), partition.end());
+  }
+
+  if(slots.size() > K) {
+    std::nth_element(slots.begin(), slots.begin() + K, slots.end(), compare);
+    slots.resize(K);
+  }
+
+  std::sort(slots.begin(), slots.end(), compare);
+
+  endpoint_ptrs.reserve(K);
+  for(const auto& i : slots) {
+    endpoint_ptrs.push_back(_heap[i].value());
   }
 }
 
@@ -158,6 +158,11 @@ class Test {
 
     inline float_t rat(int, int) const;                                 // Query the rat value.
     inline float_t slack(int, int) const;                               // Query the slack.
+    inline float_t corner_rat(size_t, int, int) const;                  // Query the corner rat.
+
+    inline float_cvrt corner_rat() const;                               // Query the corner rats.
+
+    inline void_t set_corner_rat(float_cvrt);                           // Set the corner rats.
 
     inline endpoint_pt endpoint_ptr(int, int);                          // Query the endpoint pointer.
 
@@ -165,6 +170,7 @@ class Test {
 
     void_t update_rat(clock_tree_pt);                                   // Update the rat.
     void_t update_rat(int, int, clock_tree_pt);                         // Update the rat.
+    void_t update_corner_rat(corner_pt, clock_tree_pt);                 // Update the corner rat.
 
     node_pt constrained_node_ptr() const;                               // Node for D pin.
     node_pt related_node_ptr() const;                                   // Node for CK pin.
@@ -175,6 +181,8 @@ class Test {
 
     float_t _rat[2][2];
 
+    float_vt _corner_rat;                                               // Corner rat [corner][el][rf].
+
     endpoint_t _endpoint[2][2];                                         // Endpoints.
 
     pin_pt _constrained_pin_ptr;                                        // Constrained pin pointer.
@@ -260,6 +268,23 @@ inline float_t Test::slack(int el, int rf) const {
   return _endpoint[el][rf].slack();
 }
 
+// Function: corner_rat
+// Query the pre-cppr rat of a corner.
+inline float_t Test::corner_rat(size_t c, int el, int rf) const {
+  return _corner_rat[(c << 2) | (el << 1) | rf];
+}
+
+// Function: corner_rat
+// Query the pre-cppr rats of all corners.
+inline float_cvrt Test::corner_rat() const {
+  return _corner_rat;
+}
+
+// Procedure: set_corner_rat
+inline void_t Test::set_corner_rat(float_cvrt rat) {
+  _corner_rat = rat;
+}
+
 // Function: endpoint_ptr
 // Query the endpoint pointer.
 inline endpoint_pt Test::endpoint_ptr(int el, int rf) {
@@ -340,7 +365,8 @@ class EndpointMinHeap {
     void_t insert(endpoint_pt);                                 // Insert an item into the PQ.
     void_t pop();                                               // Extract the maximum element.
     void_t update(endpoint_pt);                                 // Update an item.
-    void_t top(size_t, endpoint_ptr_vrt);                       // Find the top k elements.
+    void_t top(size_t, endpoint_ptr_vrt) const;                 // Find the top k elements.
+    void_t parallel_top(size_t, endpoint_ptr_vrt) const;        // Find the top k elements.
     void_t remove(endpoint_pt);                                 // Remove a given endpoint.
 
   private:
@@ -12,6 +12,8 @@
  ******************************************************************************/
 
 #include "ot_timer.h"
+#include "ot_abstractor.h"
+#include "ot_partitioner.h"
 
 namespace __OpenTimer {
 
@@ -19,12 +21,18 @@ namespace __OpenTimer {
 Timer::Timer():
   _name(PACKAGE_STRING),
   _environment_uptr (new environment_t()),
+  _is_slack_statistics_updated (false),
   _techlib_uptr (new techlib_t()),
   _circuit_uptr (new circuit_t()),
   _pipeline_uptr (new pipeline_t()),
+  _eco_uptr (new eco_t()),
+  _journal_uptr (new journal_t()),
+  _wire_estimator_uptr (new wire_estimator_t()),
+  _is_corner_timing_updated (false),
   _nodeset_uptr (new nodeset_t()),
   _jumpset_uptr (new jumpset_t()),
-  _endpoint_minheap_uptr (new endpoint_minheap_t())
+  _endpoint_minheap_uptr (new endpoint_minheap_t()),
+  _is_timing_view_topology_dirty (true)
 {
   _celllib_uptr[EARLY].reset(new celllib_t());
   _celllib_uptr[LATE].reset(new celllib_t());
@@ -40,6 +48,8 @@ Timer::Timer():
     _is_wns_updated[el][rf] = false;
     _cutoff_slack[el][rf] = OT_FLT_ZERO;
   }
+
+  _timing_change_epsilon = OT_DEFAULT_TIMING_CHANGE_EPSILON;
   
   //LOG(INFO) << string("An OpenTimer object created ") + Utility::getcwd();
   omp_set_num_threads(OT_MAX_NUM_THREADS);
@@ -179,10 +189,13 @@ void_t Timer::set_slew(pin_pt pin_ptr, int el, int rf, float_ct slew) {
   
   // Case 1: the pin is binding to a PI port assertion.
   if(pin_ptr->is_primary_input()) {
+    auto prev = pin_ptr->primary_input_ptr()->slew(el, rf);
+    journal_ptr()->insert_undo([=] () { set_slew(pin_ptr, el, rf, prev); });
     pin_ptr->primary_input_ptr()->set_slew(el, rf, slew); 
   }
   // Case 2: regular pin at the gate.
   else {
+    _journal_node(pin_ptr->node_ptr());
     LOG(WARNING) << "Assert slew on a non-PI pin (may be ignored)";
     pin_ptr->node_ptr()->set_slew(el, rf, slew);
   }
@@ -226,10 +239,13 @@ void_t Timer::set_at(pin_pt pin_ptr, int el, int rf, float_ct at) {
   
   // Case 1: the pin is binding to a PI port assertion.
   if(pin_ptr->is_primary_input()) {
+    auto prev = pin_ptr->primary_input_ptr()->at(el, rf);
+    journal_ptr()->insert_undo([=] () { set_at(pin_ptr, el, rf, prev); });
     pin_ptr->primary_input_ptr()->set_at(el, rf, at); 
   }
   // Case 2: regular pin at the gate.
   else {
+    _journal_node(pin_ptr->node_ptr());
     LOG(WARNING) << "Assert arrival time on a non-PI pin (may be ignored)";
     pin_ptr->node_ptr()->set_at(el, rf, at);
   }
@@ -273,10 +289,13 @@ void_t Timer::set_rat(pin_pt pin_ptr, int el, int rf, float_ct rat) {
   
   // Case 1: the pin is binding to a PI port assertion.
   if(pin_ptr->is_primary_output()) {
+    auto prev = pin_ptr->primary_output_ptr()->rat(el, rf);
+    journal_ptr()->insert_undo([=] () { set_rat(pin_ptr, el, rf, prev); });
     pin_ptr->primary_output_ptr()->set_rat(el, rf, rat); 
   }
   // Case 2: regular pin at the gate.
   else {
+    _journal_node(pin_ptr->node_ptr());
     LOG(WARNING) << "Assert required arrival time on a non-PO pin (may be ignored)";
     pin_ptr->node_ptr()->set_rat(el, rf, rat);
   }
@@ -319,7 +338,10 @@ void_t Timer::set_load(primary_output_pt po_ptr, int el, int rf, float_ct load)
   }
 
   // Adjust the delta capacitance.
-  auto delta = load - po_ptr->load(el, rf);
+  auto prev = po_ptr->load(el, rf);
+  auto delta = load - prev;
+
+  journal_ptr()->insert_undo([=] () { set_load(po_ptr, el, rf, prev); });
 
   // Assert a new primary output load.
   po_ptr->set_load(el, rf, load); 
@@ -390,9 +412,15 @@ void_t Timer::set_late_celllib_fpath(char_cpt fpath) {
 }
 
 // Function: cell_ptr
-// Query the cell pointer to a given timing split and name.
+// Query the cell pointer to a given timing split and name. The cell is looked up in the library
+// first and then in the block models.
 cell_pt Timer::cell_ptr(int el, string_crt name) const {
-  return celllib_ptr(el)->cell_ptr(name);
+
+  if(cell_pt ptr = celllib_ptr(el)->cell_ptr(name)) return ptr;
+
+  model_pt ptr = model_ptr(name);
+
+  return ptr ? ptr->cell_ptr(el) : nullptr;
 }
 
 // Function: pin_ptr
@@ -407,11 +435,10 @@ primary_input_pt Timer::primary_input_ptr(string_crt name) const {
   return circuit_ptr()->primary_input_ptr(name);
 }
 
-// Function: _clock_tree_root_node_ptr
-// Return the clock tree root node pointer.
-node_pt Timer::_clock_tree_root_node_ptr() const {
-  pin_pt pin_ptr = circuit_ptr()->clock_tree_root_pin_ptr();
-  return pin_ptr ? pin_ptr->node_ptr() : nullptr;
+// Function: _is_clock_tree_root
+// Return true if the given node is the root of any clock tree (clock domain).
+bool_t Timer::_is_clock_tree_root(node_pt node_ptr) const {
+  return node_ptr && circuit_ptr()->root_clock_tree_ptr(node_ptr->pin_ptr()) != nullptr;
 }
 
 // Procedure: _read_def
@@ -432,6 +459,8 @@ void_t Timer::_enable_lazy_evaluation() {
     _is_tns_updated[el][rf] = false;
     _is_wns_updated[el][rf] = false;
   }
+  _is_slack_statistics_updated = false;
+  _is_corner_timing_updated = false;
 }
 
 // Procedure: _parse_verilog
@@ -447,6 +476,13 @@ void_t Timer::_parse_verilog(string_crt fpath, verilog_pt verilog_ptr) {
 
 // Procedure: _parse_spef
 void_t Timer::_parse_spef(string_crt fpath, spef_pt spef_ptr) {
+  
+  // The spef file is optional as the parasitics can be estimated from the placement.
+  if(!__is_file_available(fpath)) {
+    LOG(WARNING) << "Ignore parsing spef (file not available)";
+    return;
+  }
+
   spef_ptr->read_spef(fpath);
 }
 
@@ -521,7 +557,8 @@ void_t Timer::_init_circuit_from_verilog(verilog_pt verilog_ptr) {
 
   // Step 4: Scan the gate through verilog file. Insert a new gate for each gate
   // being iterated and a set of pins corresponding to each cellpin of the gate. Then,
-  // for each pin-net mapping specified in the gate, connect the pin to the net.
+  // for each pin-net mapping specified in the gate, connect the pin to the net. A gate
+  // that instantiates a block model has its boundary pins connected in the same way.
   for(VerilogModuleIter i(verilog_ptr); i(); ++i) {
     for(VerilogModuleGateIter j(i.module_ptr()); j(); ++j) {
       insert_gate(j.gate_ptr()->name(), j.gate_ptr()->cell_name());
@@ -538,101 +575,133 @@ void_t Timer::_init_circuit_from_verilog(verilog_pt verilog_ptr) {
 // This procedure reads the relevant timing information which is needed to propagate the timing
 // from the primary inputs and primary outputs.
 void_t Timer::_init_io_timing(string_crt fpath) {
+  TimingReader timing_reader;
+  timing_reader.read(fpath);
+  _init_io_timing(timing_reader);
+}
 
-  LOG(INFO) << "Loading " + Utility::realpath(fpath);
-  
-  ifstream_t ifs(fpath);
+// Procedure: _init_io_timing
+// This procedure applies the timing assertions to the primary inputs and primary outputs. The 
+// ports are looked up by batches of tasks, and the assertions are then applied in the order of 
+// the file such that a later assertion overrides an earlier one on the same port.
+void_t Timer::_init_io_timing(timing_reader_crt timing_reader) {
 
-  LOG_IF(FATAL, !ifs.good()) << "Failed to open " + Utility::realpath(fpath);
+  const auto& assertions = timing_reader.assertions();
 
-  string_t line, token, pi, po, clock;
-  float_t at[2][2], slew[2][2], rat[2][2], load, period; 
+  int_t N = assertions.size();
+  pin_ptr_vt pin_ptrs(N, nullptr);
   
-  while (getline(ifs, line)) {
-    stringstream ss(line);
-    ss >> token;
-
-    if(token == "clock") {
-      ss >> pi >> period;
-      auto pi_ptr = circuit_ptr()->primary_input_ptr(pi);
-
-      if(pi_ptr == nullptr) {
-        LOG(WARNING) << string("Ignore setting clock timing on non-existing PI ") + pi;
-        continue;
+  for(int_t b=0; b<N; b+=OT_DEFAULT_TIMING_BATCH_SIZE) {
+    #pragma omp task firstprivate(b) shared(assertions, pin_ptrs, N)
+    {
+      for(int_t i=b; i<std::min(N, b + OT_DEFAULT_TIMING_BATCH_SIZE); ++i) {
+        switch(assertions[i].type) {
+          case CLOCK_TIMING_ASSERTION:
+          case AT_TIMING_ASSERTION:
+          case SLEW_TIMING_ASSERTION:
+            if(auto pi_ptr = circuit_ptr()->primary_input_ptr(assertions[i].name)) {
+              pin_ptrs[i] = pi_ptr->pin_ptr();
+            }
+          break;
+          
+          case RAT_TIMING_ASSERTION:
+          case LOAD_TIMING_ASSERTION:
+            if(auto po_ptr = circuit_ptr()->primary_output_ptr(assertions[i].name)) {
+              pin_ptrs[i] = po_ptr->pin_ptr();
+            }
+          break;
+
+          default:
+          break;
+        }
       }
-
-      circuit_ptr()->clock_tree_ptr()->set_period(period);
-      circuit_ptr()->clock_tree_ptr()->set_primary_input_ptr(pi_ptr);
     }
-    else if(token == "at") {
-      ss >> pi >> at[EARLY][RISE] >> at[EARLY][FALL] >> at[LATE][RISE] >> at[LATE][FALL];
-      auto pi_ptr = circuit_ptr()->primary_input_ptr(pi);
+  }
+  #pragma omp taskwait
 
-      if(pi_ptr == nullptr) {
-        LOG(WARNING) << string("Ignore setting arrival time on non-existing PI ") + pi;
-        continue;
-      }
+  for(int_t i=0; i<N; ++i) {
 
-      set_at(pi_ptr->pin_ptr(), EARLY, RISE, at[EARLY][RISE]);
-      set_at(pi_ptr->pin_ptr(), EARLY, FALL, at[EARLY][FALL]);
-      set_at(pi_ptr->pin_ptr(), LATE, RISE, at[LATE][RISE]);
-      set_at(pi_ptr->pin_ptr(), LATE, FALL, at[LATE][FALL]);
-    }
-    else if(token == "slew") {
-      ss >> pi >> slew[EARLY][RISE] >> slew[EARLY][FALL] >> slew[LATE][RISE] >> slew[LATE][FALL];
-      auto pi_ptr = circuit_ptr()->primary_input_ptr(pi);
+    const auto& assertion = assertions[i];
+    auto pin_ptr = pin_ptrs[i];
 
-      if(pi_ptr == nullptr) {
-        LOG(WARNING) << string("Ignore setting slew on non-existing PI ") + pi; 
-        continue;
-      }
+    switch(assertion.type) {
+      case CLOCK_TIMING_ASSERTION:
+        if(pin_ptr == nullptr) {
+          LOG(WARNING) << string("Ignore setting clock timing on non-existing PI ") + assertion.name;
+          continue;
+        }
+        circuit_ptr()->insert_clock_tree(pin_ptr->primary_input_ptr(), assertion.value[EARLY][RISE]);
+      break;
 
-      set_slew(pi_ptr->pin_ptr(), EARLY, RISE, slew[EARLY][RISE]);
-      set_slew(pi_ptr->pin_ptr(), EARLY, FALL, slew[EARLY][FALL]);
-      set_slew(pi_ptr->pin_ptr(), LATE, RISE, slew[LATE][RISE]);
-      set_slew(pi_ptr->pin_ptr(), LATE, FALL, slew[LATE][FALL]);
-    }
-    else if(token == "rat") {
-      ss >> po >> rat[EARLY][RISE] >> rat[EARLY][FALL] >> rat[LATE][RISE] >> rat[LATE][FALL];
-      auto po_ptr = circuit_ptr()->primary_output_ptr(po);
-      
-      if(po_ptr == nullptr) {
-        LOG(WARNING) << string("Ignore setting required arrival time on non-existing PO ") + po; 
-        continue;
-      }
+      case AT_TIMING_ASSERTION:
+        if(pin_ptr == nullptr) {
+          LOG(WARNING) << string("Ignore setting arrival time on non-existing PI ") + assertion.name;
+          continue;
+        }
+        EL_RF_ITER(el, rf) {
+          set_at(pin_ptr, el, rf, assertion.value[el][rf]);
+        }
+      break;
 
-      set_rat(po_ptr->pin_ptr(), EARLY, RISE, rat[EARLY][RISE]);
-      set_rat(po_ptr->pin_ptr(), EARLY, FALL, rat[EARLY][FALL]);
-      set_rat(po_ptr->pin_ptr(), LATE, RISE, rat[LATE][RISE]);
-      set_rat(po_ptr->pin_ptr(), LATE, FALL, rat[LATE][FALL]);
-    }
-    else if(token == "load") {
-      ss >> po >> load;
-      
-      auto po_ptr = circuit_ptr()->primary_output_ptr(po);
+      case SLEW_TIMING_ASSERTION:
+        if(pin_ptr == nullptr) {
+          LOG(WARNING) << string("Ignore setting slew on non-existing PI ") + assertion.name; 
+          continue;
+        }
+        EL_RF_ITER(el, rf) {
+          set_slew(pin_ptr, el, rf, assertion.value[el][rf]);
+        }
+      break;
 
-      if(po_ptr == nullptr) {
-        LOG(WARNING) << string("Ignore setting load on non-existing PO ") + po; 
-        continue;
-      }
+      case RAT_TIMING_ASSERTION:
+        if(pin_ptr == nullptr) {
+          LOG(WARNING) << string("Ignore setting required arrival time on non-existing PO ") 
+                       + assertion.name; 
+          continue;
+        }
+        EL_RF_ITER(el, rf) {
+          set_rat(pin_ptr, el, rf, assertion.value[el][rf]);
+        }
+      break;
 
-      set_load(po_ptr, EARLY, RISE, load);
-      set_load(po_ptr, EARLY, FALL, load);
-      set_load(po_ptr, LATE, RISE, load);
-      set_load(po_ptr, LATE, FALL, load);
-    }
-    else {
-      LOG(WARNING) << "Unexpected keyword \"" + token + "\" in .timing file (skipped)";
+      case LOAD_TIMING_ASSERTION:
+        if(pin_ptr == nullptr) {
+          LOG(WARNING) << string("Ignore setting load on non-existing PO ") + assertion.name; 
+          continue;
+        }
+        EL_RF_ITER(el, rf) {
+          set_load(pin_ptr->primary_output_ptr(), el, rf, assertion.value[el][rf]);
+        }
+      break;
+
+      default:
+        if(!assertion.name.empty()) {
+          LOG(WARNING) << "Unexpected keyword \"" + assertion.name + "\" in .timing file (skipped)";
+        }
+      break;
     }
   }
-
-  ifs.close();
 }
 
 // Procedure: _update_clock_tree
-// Initialize the clock tree.
+// Initialize the clock trees of all clock domains.
 void_t Timer::_update_clock_tree() {
-  circuit_ptr()->clock_tree_ptr()->update_clock_tree();
+  circuit_ptr()->update_clock_trees();
+}
+
+// Procedure: _enable_clock_tree_update
+// Enable the clock tree update for a pin that is being connected to or disconnected from a net.
+// Only the fanout of the net root changes, so the update is confined to the clock subtree rooted
+// at the net root if the root is in a clock tree. A clock pin moved to a net outside the clock
+// tree has already invalidated the subtree of its previous root on the disconnection.
+void_t Timer::_enable_clock_tree_update(net_pt net_ptr) {
+
+  auto root_pin_ptr = net_ptr->root_pin_ptr();
+
+  if(root_pin_ptr != nullptr && root_pin_ptr->node_ptr()->is_in_clock_tree()) {
+    auto root_node_ptr = root_pin_ptr->node_ptr();
+    root_node_ptr->clock_tree_ptr()->enable_clock_subtree_update(root_node_ptr);
+  }
 }
 
 // Procedure: _update_node_level
@@ -702,6 +771,9 @@ void_t Timer::_init_full_timing_update() {
     // Remove the node from the pipeline.
     _remove_frontier(node_ptr);
 
+    // Every node is recomputed in the full timing update.
+    node_ptr->set_is_timing_dirty(true);
+
     // Insert the starter to the pipeline.
     if(node_ptr->num_fanins() == 0) {
       node_ptr->set_level(0);
@@ -725,53 +797,36 @@ void_t Timer::update_timing(bool_t is_incremental) {
     _init_full_timing_update();
   }
 
+  // Re-estimate the parasitics of the nets whose placement has changed.
+  _update_rctree_estimations();
+
   // The incremental timing is performed only if there exists at least one node in the pipeline.
   if(pipeline().empty()) return;
 
   // Update the clock tree for any changes on the clock tree.
   _update_clock_tree();
 
-  // Pipeline construction stage. The pipeline is constructed by those nodes that are expanded 
-  // from the fanout of thoses nodes residing in the lowest pipeline.
-  _update_forward_propagate_pipeline();
-
-  // Forward propagation stage. The forward propagation consists of five major tasks:
-  // 1) propagate the rc timing, 2) propagate the slew, 3) propagate the delay, and 4) propagate 
-  // the arrival time.
-  #pragma omp parallel
-  {
-    #pragma omp single
-    {
-      for(auto l=pipeline().min_level(); l<=pipeline().max_level()+4; ++l) {
-
-        // Task 1: RC timing propagation at the level "l"
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_rc_timing(l); }
-    
-        // Task 2: Slew propagation at the level "l-1".
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_slew(l-1); }
-
-        // Task 3: Delay propagation at the level "l-1".
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_delay(l-1); }
-    
-        // Task 4: Arrival time propagation at the level "l-2".
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_at(l-2); }
-        
-        // Task 5: Jump propagation at the level "l-3".
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_jump(l-3); }
-        
-        // Task 6: CPPR credit propagation at the level "l-4".
-        #pragma omp task firstprivate(l)
-        { _forward_propagate_test(l-4); }
-
-        #pragma omp taskwait
-      }
-    } 
-  } // Implicit synchronization barrier. ----------------------------------------------------------
+  // The nodes that have been inserted into the pipeline by the timing modifiers are the sources
+  // of the timing change. They must be recomputed regardless of their fanin changes.
+  _init_timing_change();
+
+  _is_fanin_changed.resize(nodeset().num_indices(), 0);
+  _is_fanout_changed.resize(nodeset().num_indices(), 0);
+  _num_pending_fanins.resize(nodeset().num_indices(), 0);
+
+  // Forward propagation stage. The forward propagation consists of six major tasks on each
+  // node: 1) propagate the rc timing, 2) propagate the slew, 3) propagate the delay, 4) propagate
+  // the arrival time, 5) propagate the jump, and 6) propagate the test. An incremental update
+  // visits only the nodes whose fanin has changed. A full update recomputes every node anyway,
+  // so the whole graph is pipelined up front and each node is fired as soon as all its pipelined
+  // fanins are done instead of synchronizing the pipeline level by level.
+  if(is_incremental) {
+    _forward_propagate_events();
+  }
+  else {
+    _update_forward_propagate_pipeline();
+    _forward_propagate_dataflow();
+  }
 
   // Update test stage. After the forward propagation we have already had the timing data for
   // slew, arrival time, and all rc delay. On the basis of these timing information, we can 
@@ -780,24 +835,32 @@ void_t Timer::update_timing(bool_t is_incremental) {
   //_update_pipelined_tests();
 
   // Backward propagation stage. The backward propagation consists of two major tasks:
-  // 1) propagate the level (inserting all nodes in the fanin cone) and then 2) propagate the
-  // required arrival time.
+  // 1) propagate the required arrival time on nodes whose fanout has changed and then 2) insert
+  // into the pipeline those fanin nodes whose required arrival time is affected by the change.
   #pragma omp parallel 
   {
     #pragma omp single 
     {
       for(auto l=pipeline().max_level(); l>=pipeline().min_level(); --l) {
 
-        // Task 1: Insert the fanin cone.
-        #pragma omp task firstprivate(l)
-        { _backward_propagate_fanin(l); }
+        nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
 
-        // Task 2: Required arrival time propagation.
-        #pragma omp task firstprivate(l)
-        { _backward_propagate_rat(l); }
+        if(nodelist_ptr == nullptr) continue;
+
+        // Task 1: Required arrival time propagation.
+        for(NodelistIter i(nodelist_ptr); i(); ++i) {
+          if(_is_fanout_changed[i.node_ptr()->idx()]) {
+            auto node_ptr = i.node_ptr();
+            #pragma omp task firstprivate(node_ptr)
+            { _backward_propagate_change(node_ptr); }
+          }
+        }
         
         // Synchronization.
         #pragma omp taskwait
+        
+        // Task 2: Insert the affected fanin nodes.
+        _backward_propagate_fanin(l);
       }
     }
   } // Implicit synchronization barrier. ----------------------------------------------------------
@@ -805,197 +868,869 @@ void_t Timer::update_timing(bool_t is_incremental) {
   // Trigger lazy evaluation flag.
   _enable_lazy_evaluation();
 
+  // Publish the timing of the pipelined nodes as a new epoch of the timing view. Every node whose
+  // change flag has been set resides in the pipeline, so the flags are cleared here rather than
+  // across the whole graph at the next update.
+  for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
+    nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
+    if(nodelist_ptr == nullptr) continue;
+    for(NodelistIter i(nodelist_ptr); i(); ++i) {
+      _mark_timing_view(i.node_ptr());
+      _is_fanin_changed[i.node_ptr()->idx()] = 0;
+      _is_fanout_changed[i.node_ptr()->idx()] = 0;
+    }
+  }
+  _publish_timing_view();
+
   // The timing has been up-to-date. We then remove all nodes from the pipeline.
   _remove_all_frontiers();
 
   CHECK(pipeline_ptr()->num_nodes() == 0);
 }
 
-// Procedure: _update_tns
-// Update the total negative slack for any transition and timing split. The procedure applies
-// the parallel reduction to compute the value.
-void_t Timer::_update_tns() {
-  EL_RF_ITER(el, rf) {
-    _update_tns(el, rf);
+// Function: corner_ptr
+// Return the pointer to the corner of a given name, or nullptr if no such corner exists.
+corner_pt Timer::corner_ptr(string_crt name) const {
+  for(const auto& corner_uptr : _corner_uptrs) {
+    if(corner_uptr->name() == name) return corner_uptr.get();
   }
+  return nullptr;
 }
 
-// Procedure: _update_tns
-// Update the total negative slack for a given transition and a timing split. The procedure
-// applies the parallel reduction to obtain the vlaue.
-void_t Timer::_update_tns(int el, int rf) {
-  
-  if(_is_tns_updated[el][rf]) return;
+// Function: insert_corner
+// Create a new corner from a pair of early and late cell libraries. Every cell, cellpin, and
+// timing arc of the default libraries in use by the design must be present in both corner
+// libraries under the same name; otherwise the corner is rejected and nullptr is returned. The
+// timing arcs of the corner are bound to the shared edges, every node and rctree is pipelined, and
+// the next timing update propagates the new corner together with the existing ones. The wire
+// resistance and capacitance scales of the new corner default to one.
+corner_pt Timer::insert_corner(string_crt name, string_crt early_fpath, string_crt late_fpath) {
 
-  float_t tns(OT_FLT_ZERO);
+  if(name.empty() || name == OT_DEFAULT_CORNER_NAME || corner_ptr(name) != nullptr) {
+    LOG(ERROR) << "Failed to insert corner " + name + " (name conflict exception)";
+    return nullptr;
+  }
 
-  #pragma omp parallel for reduction(+ : tns)
-  for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
-    if(nodeset()[i] == nullptr || nodeset()[i]->slack(el, rf) >= OT_FLT_ZERO) continue;
-    tns = tns + nodeset()[i]->slack(el, rf);
-  } // Implicit synchronization barrier. ----------------------------------------------------------
+  corner_upt corner_uptr(new corner_t(name, _corner_uptrs.size()));
+  corner_pt corner_ptr = corner_uptr.get();
 
-  _tns[el][rf] = tns;
-  _is_tns_updated[el][rf] = true;
-}
+  #pragma omp parallel sections
+  {
+    #pragma omp section
+    { corner_ptr->read_celllib(EARLY, early_fpath); }
+    #pragma omp section
+    { corner_ptr->read_celllib(LATE, late_fpath); }
+  }
 
-// Procedure: _update_wns
-// Update the total negative slack for any transition and timing split. The procedure apply
-// the parallel reduction to compute the value.
-void_t Timer::_update_wns() {
-  EL_RF_ITER(el, rf) {
-    _update_wns(el, rf);
+  EL_ITER(el) {
+    corner_ptr->map_celllib(el, _celllib_uptr[el].get());
   }
-}
 
-// Procedure: _update_wns
-// The procedure updates the worst negative slack at a given transition and a timing split
-// using parallel reduction algorithm.
-void_t Timer::_update_wns(int el, int rf) {
+  if(!_is_corner_bound(corner_ptr)) {
+    LOG(ERROR) << "Failed to insert corner " + name + " (cell binding exception)";
+    return nullptr;
+  }
 
-  if(_is_wns_updated[el][rf]) return;
+  journal_ptr()->set_is_irreversible();
 
-  float_t wns(OT_FLT_ZERO);
+  _corner_uptrs.push_back(std::move(corner_uptr));
   
-  #pragma omp parallel for reduction(min : wns)
-  for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
-    if(nodeset()[i] == nullptr || nodeset()[i]->slack(el, rf) >= OT_FLT_ZERO) continue;
-    if(nodeset()[i]->slack(el, rf) < wns) {
-      wns = nodeset()[i]->slack(el, rf);
-    }
-  } // Implicit synchronization barrier. ----------------------------------------------------------
+  for(EdgelistIter i(_edgelist_ptr); i(); ++i) {
+    _bind_corner_arcs(i.edge_ptr());
+  }
 
-  _wns[el][rf] = wns;
-  _is_wns_updated[el][rf] = true;
+  for(CircuitNetIter i(circuit_ptr()); i(); ++i) {
+    i.net_ptr()->enable_rc_timing_update();
+  }
+
+  for(const auto& node_ptr : nodeset()) {
+    _insert_frontier(node_ptr);
+  }
+
+  return corner_ptr;
 }
 
-// Function: insert_primary_input
-// Create a new primary input port in the design. The function return the pointer to the port.
-// Each primary input is associated with a pin and node.
-primary_input_pt Timer::insert_primary_input(string_crt name) {
+// Procedure: insert_corner
+// Create a new corner from the command "<name> <early.lib> <late.lib>" followed by the options
+// "-res <float>" and "-cap <float>", which scale the wire resistance and capacitance of every
+// net in the corner.
+void_t Timer::insert_corner(int argc, char **argv) {
 
-  // Insert a new primary input port into the circuit.
-  primary_input_pt pi_ptr = circuit_ptr()->insert_primary_input(name);
+  string_vt args;
+  float_t res_scale(OT_FLT_ONE), cap_scale(OT_FLT_ONE);
 
-  // Create a new pin corresponding to the primary input port.
-  pin_pt pin_ptr = circuit_ptr()->insert_pin(name);       // Get the pin pointer.
-  pin_ptr->set_direction(PRIMARY_INPUT_PIN_DIRECTION);    // Set the pin direction.
-  pin_ptr->set_primary_input_ptr(pi_ptr);                 // Set the pi pointer.
-  pi_ptr->set_pin_ptr(pin_ptr);                           // Set the pin pointer.
-  node_pt node_ptr = _insert_node(pin_ptr);               // Attach a node to the pin.
-  _insert_frontier(node_ptr);                             // Insert the frontier node.
+  for(int i=0; i<argc; ++i) {
+    if(strcmp(argv[i], "-res") == 0 && i+1 < argc) res_scale = atof(argv[++i]);
+    else if(strcmp(argv[i], "-cap") == 0 && i+1 < argc) cap_scale = atof(argv[++i]);
+    else args.push_back(argv[i]);
+  }
 
-  // Create a new net for the primary input pin.
-  net_pt net_ptr = insert_net(name);
-  connect_pin(pin_ptr, net_ptr);
+  if(args.size() != 3) {
+    LOG(ERROR) << "Failed to insert corner (argument exception)";
+    return;
+  }
 
-  return pi_ptr;
+  corner_pt corner_ptr = insert_corner(args[0], args[1], args[2]);
+
+  if(corner_ptr == nullptr) return;
+
+  corner_ptr->set_res_scale(res_scale);
+  corner_ptr->set_cap_scale(cap_scale);
 }
 
-// Procedure: splice_driver
-// This procedure replace a primary input with a driver. The original primary input will be 
-// isolated (not being removed) and the corresponding RC network, if any, is reattached to the
-// output pin of the driver. In other words, the output pin of the driver can be conceptually
-// viewed as the original primary input.
-void_t Timer::splice_driver(string_crt pi_name, string_crt gate_name, string_crt cell_name) {
-  
-  primary_input_pt pi_ptr = circuit_ptr()->primary_input_ptr(pi_name);
+// Function: _is_corner_bound
+// Return true if every gate of the design and every timing arc of its cell edges and tests is
+// bound in the libraries of a given corner. The cells of block models are shared by all corners
+// and are always bound. The first missing cell or timing arc is logged.
+bool_t Timer::_is_corner_bound(corner_pt corner_ptr) const {
 
-  if(pi_ptr == nullptr) {
-    LOG(ERROR) << "Fail to splice driver (non-PI exception)";
-    return;
-  }
-  
-  // Insert the gate for the driver.
-  gate_pt gate_ptr = insert_gate(gate_name, cell_name); 
-  
-  // Obtain the driver's output pin.
-  string_t driver_output_name; 
-  for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
-    if(i.cellpin_ptr()->direction() == OUTPUT_CELLPIN_DIRECTION) {
-      driver_output_name = gate_name + ":" + i.cellpin_ptr()->name();
-      break;
+  for(CircuitGateIter i(circuit_ptr()); i(); ++i) {
+    EL_ITER(el) {
+      cell_pt cell_ptr = i.gate_ptr()->cell_ptr(el);
+      if(cell_ptr == nullptr || corner_ptr->cell_ptr(el, cell_ptr) != nullptr) continue;
+      LOG(ERROR) << "Corner " + corner_ptr->name() + " lacks cell " + cell_ptr->name() + " of gate " 
+                 << i.gate_ptr()->name();
+      return false;
     }
   }
-  
-  CHECK(driver_output_name != "");
 
-  // If the primary input pin is already isolated (no net and thus no RC), nothing to be done.
-  if(pi_ptr->pin_ptr()->net_ptr() == nullptr) return;
+  for(EdgelistIter i(_edgelist_ptr); i(); ++i) {
+    edge_pt edge_ptr = i.edge_ptr();
+    if(edge_ptr->edge_type() == RCTREE_EDGE_TYPE) continue;
+    EL_ITER(el) {
+      if(corner_ptr->timing_arc_ptr(el, edge_ptr->timing_arc_ptr(el)) != nullptr) continue;
+      LOG(ERROR) << "Corner " + corner_ptr->name() + " lacks timing arc " 
+                 << edge_ptr->from_node_ptr()->pin_ptr()->name() + "->" 
+                 << edge_ptr->to_node_ptr()->pin_ptr()->name();
+      return false;
+    }
+  }
 
-  // Storage declaration.
-  pin_pt driver_output_pin_ptr = circuit_ptr()->pin_ptr(driver_output_name);
-  net_pt pi_net_ptr = pi_ptr->pin_ptr()->net_ptr();
-  rctree_node_pt rctree_node_ptr = pi_ptr->pin_ptr()->rctree_node_ptr();
-  rctree_pt rctree_ptr = pi_ptr->pin_ptr()->net_ptr()->rctree_ptr();
+  return true;
+}
 
-  // Net/Pin-level modification. Here we disconnect the PI from its net. Notice that the PI will
-  // be disconnected from the RC network as well.
-  disconnect_pin(pi_ptr->pin_ptr());
-  connect_pin(driver_output_pin_ptr, pi_net_ptr);
+// Procedure: _bind_corner_arcs
+// Bind the timing arcs of every corner to a given edge, i.e., the corner arcs that correspond to
+// the timing arcs of the edge in the default libraries, and size the corner delays of the edge.
+void_t Timer::_bind_corner_arcs(edge_pt edge_ptr) const {
 
-  // RC-level modification.
-  driver_output_pin_ptr->set_rctree_node_ptr(rctree_node_ptr);
-  if(rctree_node_ptr) {
-    rctree_node_ptr->set_pin_ptr(driver_output_pin_ptr);
+  edge_ptr->resize_corner_timing(num_corners());
 
-    CHECK(rctree_ptr != nullptr);
+  if(edge_ptr->edge_type() == RCTREE_EDGE_TYPE) return;
 
-    rctree_ptr->rehash_rctree_node(rctree_node_ptr->name(), driver_output_name);
+  for(const auto& corner_uptr : _corner_uptrs) {
+    EL_ITER(el) {
+      edge_ptr->set_corner_timing_arc_ptr(
+        corner_uptr->idx(), el, corner_uptr->timing_arc_ptr(el, edge_ptr->timing_arc_ptr(el))
+      );
+    }
   }
-  
-  CHECK(pi_ptr->pin_ptr()->node_ptr()->num_fanouts() == 0);
 }
 
-// Function: primary_output_ptr
-// Query the pointer to a given name of primary output port.
-primary_output_pt Timer::primary_output_ptr(string_crt name) const {
-  return circuit_ptr()->primary_output_ptr(name);
-}
+// Procedure: update_corners
+// Update the timing of every corner. The corners are timed together with the default libraries
+// in the same forward and backward propagation, so this updates the timing of the design once and
+// then reduces the node slacks of each corner to its wns and tns. A corner is checked to be bound
+// to every gate of the design, which a repower or a gate insertion may have broken since the
+// corner was inserted; an unbound corner is flagged and left out of the report rather than mixing
+// the timing of two libraries. The results are kept until the next timing update or state
+// restore. Notice that the corner rat and slack are pre-cppr, and the paths and cppr apply to the
+// default libraries only.
+void_t Timer::update_corners() {
 
-// Function: insert_primary_output
-// Create a new primary output port in the design. The function return the pointer to the port.
-// Each primary output is associated with a pin and node.
-primary_output_pt Timer::insert_primary_output(string_crt name) {
+  update_timing();
 
-  // Insert a new primary output port into the circuit.
-  primary_output_pt po_ptr = circuit_ptr()->insert_primary_output(name);
+  if(_is_corner_timing_updated) return;
 
-  // Create a new pin corresponding to the primary output port.
-  pin_pt pin_ptr = circuit_ptr()->insert_pin(name);       // Get the pin pointer.
-  pin_ptr->set_direction(PRIMARY_OUTPUT_PIN_DIRECTION);   // Set the pin direction.
-  pin_ptr->set_primary_output_ptr(po_ptr);                // Set the po pointer.
-  po_ptr->set_pin_ptr(pin_ptr);                           // Set the pin pointer.
-  _insert_node(pin_ptr);                                  // Attach a node to the pin.
+  for(const auto& corner_uptr : _corner_uptrs) {
 
-  // Create a new net for the primary output pin.
-  net_pt net_ptr = insert_net(name);
-  connect_pin(pin_ptr, net_ptr);
+    corner_pt corner_ptr = corner_uptr.get();
+    size_t c = corner_ptr->idx();
 
-  // Create a test for the primary output.
-  circuit_ptr()->insert_test(pin_ptr);
+    corner_ptr->set_is_bound(_is_corner_bound(corner_ptr));
 
-  return po_ptr;
-}
+    EL_RF_ITER(el, rf) {
 
-// Function: gate_ptr
-// Query the gate pointer by a given name.
-gate_pt Timer::gate_ptr(string_crt gate_name) const {
-  return circuit_ptr()->gate_ptr(gate_name);  
-}
+      float_t wns(OT_FLT_ZERO), tns(OT_FLT_ZERO);
 
-// Function: insert_gate
-// Create a new gate in the design. This newly-created gate is "not yet" connected to
-// any other gates or wires. The new gate name is guaranteed not to conflict with any
-// exisiting names in the current design.
-gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
-  
-  // Insert a new gate.
-  gate_pt gate_ptr = circuit_ptr()->insert_gate(gate_name);
+      #pragma omp parallel for reduction(min : wns) reduction(+ : tns)
+      for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
+        if(nodeset()[i] == nullptr || nodeset()[i]->num_corners() <= c) continue;
+        float_t s = nodeset()[i]->corner_slack(c, el, rf);
+        if(s >= OT_FLT_ZERO) continue;
+        tns = tns + s;
+        if(s < wns) wns = s;
+      } // Implicit synchronization barrier. ------------------------------------------------------
+
+      corner_ptr->set_wns(el, rf, wns);
+      corner_ptr->set_tns(el, rf, tns);
+    }
+
+    corner_ptr->set_is_timing_updated(true);
+  }
+
+  _is_corner_timing_updated = true;
+}
+
+// Procedure: write_macro
+// Extract the timing macro of the design and write its early and late models in liberty format
+// to the files <name>_early.lib and <name>_late.lib. The rctrees of the nets driving primary
+// outputs are swept over the output loads during the characterization and restored afterwards.
+void_t Timer::write_macro(string_crt name) {
+
+  update_timing();
+
+  abstractor_t abstractor(this);
+  abstractor.extract();
+  abstractor.write(name);
+}
+
+// Procedure: write_partitions
+// Partition the design for the distributed timing and write each partition as a standalone
+// design to the files <prefix>.<i>.{v,spef,timing,partition}. The parasitics are written from
+// the rctrees of the timer, which is therefore updated beforehand.
+void_t Timer::write_partitions(size_t num_partitions, string_crt prefix) {
+
+  update_timing();
+
+  partitioner_t partitioner(this);
+  partitioner.partition(num_partitions);
+  partitioner.write(prefix);
+}
+
+// Function: model_ptr
+// Return the pointer to the block model of a given name, or nullptr if no such model exists.
+model_pt Timer::model_ptr(string_crt name) const {
+  for(const auto& model_uptr : _model_uptrs) {
+    if(model_uptr->name() == name) return model_uptr.get();
+  }
+  return nullptr;
+}
+
+// Function: read_model
+// Read the abstract timing model of a block, e.g., the early and late libraries written by
+// write_macro, where the model name is the name of the cell in both libraries. Gates of the
+// top-level netlist that instantiate a cell of this name not found in the timer libraries are
+// bound to the model, with the boundary pins connected to the nets of the instance. Reading a
+// model of an existing name hot-swaps it, i.e., every gate bound to the old model is bound to
+// the new one in place, and only the cell edges of these gates are rebuilt in the timing graph.
+model_pt Timer::read_model(string_crt name, string_crt early_fpath, string_crt late_fpath) {
+
+  model_upt model_uptr(new model_t(name));
+
+  #pragma omp parallel sections
+  {
+    #pragma omp section
+    { model_uptr->read_celllib(EARLY, early_fpath); }
+    #pragma omp section
+    { model_uptr->read_celllib(LATE, late_fpath); }
+  }
+
+  return _insert_model(std::move(model_uptr));
+}
+
+// Function: _insert_model
+// Insert a block model whose libraries have been read, or hot-swap the model of the same name.
+// A model named after a cell of the timer libraries is rejected, since the cell lookup prefers
+// the libraries and the model would never be bound.
+model_pt Timer::_insert_model(model_upt model_uptr) {
+
+  string_t name = model_uptr->name();
+
+  if(model_uptr->cell_ptr(EARLY) == nullptr || model_uptr->cell_ptr(LATE) == nullptr) {
+    LOG(ERROR) << "Failed to read model " + name + " (cell not found exception)";
+    return nullptr;
+  }
+
+  bool_t is_name_conflict = false;
+  EL_ITER(el) {
+    is_name_conflict |= (_celllib_uptr[el]->cell_ptr(name) != nullptr);
+    for(const auto& corner_uptr : _corner_uptrs) {
+      is_name_conflict |= (corner_uptr->celllib_ptr(el)->cell_ptr(name) != nullptr);
+    }
+  }
+
+  if(is_name_conflict) {
+    LOG(ERROR) << "Failed to read model " + name + " (library cell name conflict exception)";
+    return nullptr;
+  }
+
+  auto itr = std::find_if(_model_uptrs.begin(), _model_uptrs.end(), 
+    [&] (const model_upt& ptr) { return ptr->name() == name; }
+  );
+
+  // Case 1: a new model.
+  if(itr == _model_uptrs.end()) {
+    _model_uptrs.push_back(std::move(model_uptr));
+    return _model_uptrs.back().get();
+  }
+
+  // Case 2: hot-swap an existing model. The new model must keep the boundary pins of the old
+  // one, and the cells of the old model are released only after every gate has been rebound.
+  cell_pt old_cell_ptr = (*itr)->cell_ptr(LATE);
+  cell_pt new_cell_ptr = model_uptr->cell_ptr(LATE);
+
+  bool_t is_pin_compatible = (old_cell_ptr->num_cellpins() == new_cell_ptr->num_cellpins());
+
+  for(CellpinIter i(old_cell_ptr); i() && is_pin_compatible; ++i) {
+    cellpin_pt cellpin_ptr = new_cell_ptr->cellpin_ptr(i.cellpin_ptr()->name());
+    is_pin_compatible = cellpin_ptr && cellpin_ptr->direction() == i.cellpin_ptr()->direction();
+  }
+
+  if(!is_pin_compatible) {
+    LOG(ERROR) << "Failed to swap model " + name + " (boundary pin mismatch exception)";
+    return nullptr;
+  }
+
+  journal_ptr()->set_is_irreversible();
+
+  for(CircuitGateIter i(circuit_ptr()); i(); ++i) {
+    if(i.gate_ptr()->cell_ptr(LATE) != (*itr)->cell_ptr(LATE)) continue;
+    _swap_gate_cell(i.gate_ptr(), model_uptr->cell_ptr(EARLY), model_uptr->cell_ptr(LATE));
+  }
+
+  itr->swap(model_uptr);
+
+  // [BEG INFO]
+  LOG(INFO) << "Swapped model " + name;
+  // [END INFO]
+
+  return itr->get();
+}
+
+// Procedure: begin_eco
+// Begin an eco transaction. Until the transaction is committed, the netlist modifiers 
+// insert_gate, insert_net, repower_gate, remove_gate, remove_net, connect_pin, and
+// disconnect_pin only update the pending state of the transaction, against which each of them
+// is validated, e.g., a gate removed in the transaction can be inserted again under the same
+// name but can no longer be resized. The gates and nets are therefore not created until commit.
+void_t Timer::begin_eco() {
+  
+  if(eco_ptr()->is_open()) {
+    LOG(WARNING) << "Nested eco transaction (previous operations are merged)";
+    return;
+  }
+
+  eco_ptr()->open(circuit_ptr());
+}
+
+// Procedure: commit_eco
+// Commit the eco transaction. The netlist is brought to the pending state in bulk with a single
+// operation per modified pin, gate, and net: all disconnections first, then the removals, the
+// insertions, the resizes, and finally all connections, so intermediate edits that cancel out
+// never reach the timing graph. An edge only bumps the level of its end node locally, and the
+// next timing update levelizes the affected region once and propagates the timing of all
+// modifications together. As with any other modifier, the update is left to the next query,
+// so the parasitics of the modified nets can be read in before.
+void_t Timer::commit_eco() {
+
+  if(!eco_ptr()->is_open()) {
+    LOG(ERROR) << "Failed to commit eco (no open transaction exception)";
+    return;
+  }
+  
+  eco_operation_vt operations;
+
+  eco_ptr()->close(operations);
+
+  for(const auto& op : operations) {
+
+    switch(op.type()) {
+
+      case INSERT_GATE_ECO_OPERATION:
+        insert_gate(op.name(), op.arg());
+      break;
+
+      case INSERT_NET_ECO_OPERATION:
+        insert_net(op.name());
+      break;
+
+      case REPOWER_GATE_ECO_OPERATION:
+        repower_gate(op.name(), op.arg());
+      break;
+
+      case REMOVE_GATE_ECO_OPERATION:
+        remove_gate(op.name());
+      break;
+
+      case REMOVE_NET_ECO_OPERATION:
+        remove_net(op.name());
+      break;
+
+      case CONNECT_PIN_ECO_OPERATION:
+        connect_pin(op.name(), op.arg());
+      break;
+
+      case DISCONNECT_PIN_ECO_OPERATION:
+        disconnect_pin(op.name());
+      break;
+
+      default:
+        CHECK(false) << "Unexpected eco operation";
+      break;
+    }
+  }
+}
+
+// Procedure: push_state
+// Save the current timing state. Until the state is popped or merged, the timer journals the
+// timing of every node, edge, and test it recomputes, together with an undo operation for every
+// netlist modification. Pending timing changes are propagated first so that the saved state is
+// consistent.
+void_t Timer::push_state() {
+
+  if(!pipeline().empty()) update_timing();
+
+  journal_ptr()->push();
+}
+
+// Procedure: pop_state
+// Restore the timing state saved by the latest push_state. Netlist modifications are undone in
+// the reverse order. If the graph topology has not changed, the journaled timing values are
+// written back without any timing propagation, and the cost is proportional to the number of
+// recomputed nodes. Otherwise, an incremental timing update is performed after the undo.
+void_t Timer::pop_state() {
+
+  if(journal_ptr()->num_frames() == 0) {
+    LOG(ERROR) << "Failed to pop state (empty state stack exception)";
+    return;
+  }
+
+  if(eco_ptr()->is_open()) {
+    LOG(ERROR) << "Failed to pop state (open eco transaction exception)";
+    return;
+  }
+
+  // The changes cannot be undone. They are kept and merged into the previous state.
+  if(!journal_ptr()->top().is_reversible()) {
+    LOG(ERROR) << "Failed to pop state (irreversible modification exception)";
+    journal_ptr()->merge();
+    return;
+  }
+
+  journal_frame_t frame(0);
+
+  journal_ptr()->pop(frame);
+  journal_ptr()->set_is_suspended(true);
+  _restore_state(frame);
+  journal_ptr()->set_is_suspended(false);
+}
+
+// Procedure: merge_state
+// Keep all changes since the latest push_state. The journal of the state is merged into the
+// previous state, if any, such that popping the previous state also undoes these changes.
+void_t Timer::merge_state() {
+
+  if(journal_ptr()->num_frames() == 0) {
+    LOG(ERROR) << "Failed to merge state (empty state stack exception)";
+    return;
+  }
+
+  journal_ptr()->merge();
+}
+
+// Procedure: _journal_node
+// Record the timing of a given node into the state journal before it is recomputed.
+void_t Timer::_journal_node(node_pt node_ptr) {
+
+  if(!journal_ptr()->is_recording()) return;
+
+  #pragma omp critical(OT_JOURNAL_CRITICAL)
+  {
+    journal_ptr()->insert_node_record(node_ptr);
+  }
+}
+
+// Procedure: _restore_state
+// Undo the netlist modifications of a journal frame and restore the journaled timing values.
+void_t Timer::_restore_state(journal_frame_rt frame) {
+  
+  // Undo the netlist modifications in the reverse order.
+  for(auto i=frame.undos().rbegin(); i!=frame.undos().rend(); ++i) {
+    (*i)();
+  }
+
+  // The recorded edges might no longer exist. Propagate the timing from the undo operations.
+  if(frame.is_structural()) {
+    update_timing();
+    return;
+  }
+  
+  // Restore the timing values in the reverse order, such that a node recorded more than once
+  // ends up with its earliest record.
+  for(auto i=frame.test_records().rbegin(); i!=frame.test_records().rend(); ++i) {
+    i->restore();
+  }
+  
+  for(auto i=frame.node_records().rbegin(); i!=frame.node_records().rend(); ++i) {
+    i->restore();
+  }
+
+  // Restore the rc timing of nets whose capacitance has been changed back by the undo. The rc
+  // timing last propagated from a restored root is unknown, so its fanout is re-timed the next
+  // time the root is recomputed.
+  for(const auto& r : frame.node_records()) {
+    _forward_propagate_rc_timing(r.node_ptr());
+    rctree_pt rctree_ptr = _rctree_ptr(r.node_ptr());
+    if(rctree_ptr != nullptr) rctree_ptr->propagated_values_ptr()->clear();
+  }
+
+  // Invalidate the jumps that depend on the restored delays.
+  _restore_jump(frame);
+
+  for(const auto& r : frame.test_records()) {
+    _update_endpoint_minheap(r.test_ptr());
+  }
+
+  for(const auto& r : frame.node_records()) {
+    r.node_ptr()->set_is_timing_dirty(false);
+    _mark_timing_view(r.node_ptr());
+  }
+
+  _publish_timing_view();
+  
+  // Remove the frontiers inserted by the undo operations.
+  _remove_all_frontiers();
+
+  _enable_lazy_evaluation();
+}
+
+// Procedure: _restore_jump
+// Invalidate the jumps that are affected by the recorded nodes of a journal frame. The jumps are
+// induced again from the restored delays by the time a path query needs them.
+void_t Timer::_restore_jump(journal_frame_rt frame) {
+  for(const auto& r : frame.node_records()) {
+    _enable_jump_update(r.node_ptr());
+  }
+}
+
+// Function: timing_view
+// Return a read-only view of the latest published timing. The function can be called from any
+// thread, including while another thread is updating the timing. The view remains consistent
+// with the epoch it was obtained from and is not affected by later updates.
+timing_view_t Timer::timing_view() const {
+  return timing_view_t(std::atomic_load(&_timing_snapshot_ptr));
+}
+
+// Procedure: _mark_timing_view
+// Mark the timing view block of a given node, which is cloned in the next epoch.
+void_t Timer::_mark_timing_view(node_pt node_ptr) {
+  
+  size_t b = node_ptr->idx() / OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE;
+
+  if(b >= _is_timing_view_block_dirty.size()) {
+    _is_timing_view_block_dirty.resize(b + 1, true);
+  }
+
+  _is_timing_view_block_dirty[b] = true;
+}
+
+// Procedure: _publish_timing_view
+// Build the snapshot of the next epoch and publish it atomically. Blocks without marked nodes
+// are shared with the previous snapshot, such that the cost is proportional to the number of
+// updated nodes rather than the design size. The pin index is rebuilt only if nodes have been
+// inserted or removed since the previous epoch.
+void_t Timer::_publish_timing_view() {
+
+  timing_snapshot_cspt prev_ptr = std::atomic_load(&_timing_snapshot_ptr);
+  
+  size_t epoch = prev_ptr ? prev_ptr->epoch() + 1 : 1;
+  
+  timing_snapshot_spt next_ptr = std::make_shared<timing_snapshot_t>(epoch, nodeset().num_indices());
+
+  // Pin index.
+  if(prev_ptr == nullptr || _is_timing_view_topology_dirty) {
+    auto pin_index_ptr = std::make_shared<string_to_idx_umap_t>();
+    pin_index_ptr->reserve(nodeset().size());
+    for(const auto& node_ptr : nodeset()) {
+      pin_index_ptr->emplace(node_ptr->pin_ptr()->name(), node_ptr->idx());
+    }
+    next_ptr->set_pin_index_ptr(pin_index_ptr);
+  }
+  else {
+    next_ptr->set_pin_index_ptr(prev_ptr->pin_index_ptr());
+  }
+
+  // Node timing blocks.
+  _is_timing_view_block_dirty.resize(next_ptr->num_blocks(), true);
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(size_t b=0; b<next_ptr->num_blocks(); ++b) {
+    
+    if(prev_ptr && b < prev_ptr->num_blocks() && !_is_timing_view_block_dirty[b]) {
+      next_ptr->set_block_ptr(b, prev_ptr->block_ptr(b));
+      continue;
+    }
+
+    auto block_ptr = std::make_shared<timing_view_block_t>();
+    auto beg = b * OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE;
+    auto end = min(beg + OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE, nodeset().num_indices());
+    for(auto idx=beg; idx<end; ++idx) {
+      block_ptr->set_node(idx - beg, nodeset()[idx]);
+    }
+    next_ptr->set_block_ptr(b, block_ptr);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  fill(_is_timing_view_block_dirty.begin(), _is_timing_view_block_dirty.end(), false);
+  _is_timing_view_topology_dirty = false;
+
+  std::atomic_store(&_timing_snapshot_ptr, timing_snapshot_cspt(next_ptr));
+}
+
+// Procedure: _update_tns
+// Update the total negative slack for any transition and timing split. The procedure applies
+// the parallel reduction to compute the value.
+void_t Timer::_update_tns() {
+  EL_RF_ITER(el, rf) {
+    _update_tns(el, rf);
+  }
+}
+
+// Procedure: _update_tns
+// Update the total negative slack for a given transition and a timing split. The procedure
+// applies the parallel reduction to obtain the vlaue.
+void_t Timer::_update_tns(int el, int rf) {
+  
+  if(_is_tns_updated[el][rf]) return;
+
+  float_t tns(OT_FLT_ZERO);
+
+  #pragma omp parallel for reduction(+ : tns)
+  for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
+    if(nodeset()[i] == nullptr || nodeset()[i]->slack(el, rf) >= OT_FLT_ZERO) continue;
+    tns = tns + nodeset()[i]->slack(el, rf);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  _tns[el][rf] = tns;
+  _is_tns_updated[el][rf] = true;
+}
+
+// Procedure: _update_wns
+// Update the total negative slack for any transition and timing split. The procedure apply
+// the parallel reduction to compute the value.
+void_t Timer::_update_wns() {
+  EL_RF_ITER(el, rf) {
+    _update_wns(el, rf);
+  }
+}
+
+// Procedure: _update_wns
+// The procedure updates the worst negative slack at a given transition and a timing split
+// using parallel reduction algorithm.
+void_t Timer::_update_wns(int el, int rf) {
+
+  if(_is_wns_updated[el][rf]) return;
+
+  float_t wns(OT_FLT_ZERO);
+  
+  #pragma omp parallel for reduction(min : wns)
+  for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
+    if(nodeset()[i] == nullptr || nodeset()[i]->slack(el, rf) >= OT_FLT_ZERO) continue;
+    if(nodeset()[i]->slack(el, rf) < wns) {
+      wns = nodeset()[i]->slack(el, rf);
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  _wns[el][rf] = wns;
+  _is_wns_updated[el][rf] = true;
+}
+
+// Procedure: _update_slack_statistics
+// Update the slack statistics for a given histogram configuration. The statistics are reused
+// until the timing changes or the configuration differs. The procedure makes one parallel pass
+// over the tests, where each thread accumulates the endpoints into its own statistics and the
+// per-thread statistics are merged at the end. The slack of an endpoint is read from its
+// constrained node, which keeps the post-CPPR slack of the last timing update, rather than from
+// the endpoint, which a through-pin path query overwrites. Tests without a related clock, i.e.,
+// primary output tests, are counted in an extra unclocked domain after the clock domains.
+// Endpoints whose slack is undefined are skipped.
+void_t Timer::_update_slack_statistics(size_t num_bins, float_ct lower, float_ct upper) {
+  
+  if(_is_slack_statistics_updated && _slack_statistics_uptr->is_configured(num_bins, lower, upper)) {
+    return;
+  }
+
+  // Assign each clock domain an index, and the unclocked domain the last index.
+  auto num_domains = circuit_ptr()->num_clock_trees();
+  unordered_map < clock_tree_pt, size_t > domain_idx;
+  
+  for(size_t d=0; d<num_domains; ++d) {
+    domain_idx[circuit_ptr()->clock_tree_uptrs()[d].get()] = d;
+  }
+
+  slack_statistics_vt stats(omp_get_max_threads(), slack_statistics_t(num_bins, lower, upper, num_domains + 1));
+
+  #pragma omp parallel for schedule(static)
+  for(unsigned_t i=0; i<circuit_ptr()->testset().num_indices(); ++i) {
+    test_pt test_ptr = circuit_ptr()->testset()[i];
+    if(test_ptr == nullptr) continue;
+    auto d = test_ptr->related_node_ptr() == nullptr ? num_domains :
+             domain_idx.at(circuit_ptr()->clock_tree_ptr(test_ptr->related_node_ptr()));
+    auto tid = omp_get_thread_num();
+    EL_RF_ITER(el, rf) {
+      auto slack = test_ptr->constrained_node_ptr()->slack(el, rf);
+      if(!Utility::is_finite_numeric(slack)) continue;
+      stats[tid].insert(d, el, slack);
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  for(size_t t=1; t<stats.size(); ++t) {
+    stats[0].merge(stats[t]);
+  }
+
+  for(size_t d=0; d<num_domains; ++d) {
+    auto root_pin_ptr = circuit_ptr()->clock_tree_uptrs()[d]->root_pin_ptr();
+    stats[0].set_domain_name(d, root_pin_ptr ? root_pin_ptr->name() : "");
+  }
+  stats[0].set_domain_name(num_domains, "unclocked");
+
+  _slack_statistics_uptr.reset(new slack_statistics_t(std::move(stats[0])));
+  _is_slack_statistics_updated = true;
+}
+
+// Function: insert_primary_input
+// Create a new primary input port in the design. The function return the pointer to the port.
+// Each primary input is associated with a pin and node.
+primary_input_pt Timer::insert_primary_input(string_crt name) {
+
+  journal_ptr()->set_is_irreversible();
+
+  // Insert a new primary input port into the circuit.
+  primary_input_pt pi_ptr = circuit_ptr()->insert_primary_input(name);
+
+  // Create a new pin corresponding to the primary input port.
+  pin_pt pin_ptr = circuit_ptr()->insert_pin(name);       // Get the pin pointer.
+  pin_ptr->set_direction(PRIMARY_INPUT_PIN_DIRECTION);    // Set the pin direction.
+  pin_ptr->set_primary_input_ptr(pi_ptr);                 // Set the pi pointer.
+  pi_ptr->set_pin_ptr(pin_ptr);                           // Set the pin pointer.
+  node_pt node_ptr = _insert_node(pin_ptr);               // Attach a node to the pin.
+  _insert_frontier(node_ptr);                             // Insert the frontier node.
+
+  // Create a new net for the primary input pin.
+  net_pt net_ptr = insert_net(name);
+  connect_pin(pin_ptr, net_ptr);
+
+  return pi_ptr;
+}
+
+// Procedure: splice_driver
+// This procedure replace a primary input with a driver. The original primary input will be 
+// isolated (not being removed) and the corresponding RC network, if any, is reattached to the
+// output pin of the driver. In other words, the output pin of the driver can be conceptually
+// viewed as the original primary input.
+void_t Timer::splice_driver(string_crt pi_name, string_crt gate_name, string_crt cell_name) {
+  
+  primary_input_pt pi_ptr = circuit_ptr()->primary_input_ptr(pi_name);
+
+  if(pi_ptr == nullptr) {
+    LOG(ERROR) << "Fail to splice driver (non-PI exception)";
+    return;
+  }
+
+  journal_ptr()->set_is_irreversible();
+  
+  // Insert the gate for the driver.
+  gate_pt gate_ptr = insert_gate(gate_name, cell_name); 
+  
+  // Obtain the driver's output pin.
+  string_t driver_output_name; 
+  for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
+    if(i.cellpin_ptr()->direction() == OUTPUT_CELLPIN_DIRECTION) {
+      driver_output_name = gate_name + ":" + i.cellpin_ptr()->name();
+      break;
+    }
+  }
+  
+  CHECK(driver_output_name != "");
+
+  // If the primary input pin is already isolated (no net and thus no RC), nothing to be done.
+  if(pi_ptr->pin_ptr()->net_ptr() == nullptr) return;
+
+  // Storage declaration.
+  pin_pt driver_output_pin_ptr = circuit_ptr()->pin_ptr(driver_output_name);
+  net_pt pi_net_ptr = pi_ptr->pin_ptr()->net_ptr();
+  rctree_node_pt rctree_node_ptr = pi_ptr->pin_ptr()->rctree_node_ptr();
+  rctree_pt rctree_ptr = pi_ptr->pin_ptr()->net_ptr()->rctree_ptr();
+
+  // Net/Pin-level modification. Here we disconnect the PI from its net. Notice that the PI will
+  // be disconnected from the RC network as well.
+  disconnect_pin(pi_ptr->pin_ptr());
+  connect_pin(driver_output_pin_ptr, pi_net_ptr);
+
+  // RC-level modification.
+  driver_output_pin_ptr->set_rctree_node_ptr(rctree_node_ptr);
+  if(rctree_node_ptr) {
+    rctree_node_ptr->set_pin_ptr(driver_output_pin_ptr);
+
+    CHECK(rctree_ptr != nullptr);
+
+    rctree_ptr->rehash_rctree_node(rctree_node_ptr->name(), driver_output_name);
+  }
+  
+  CHECK(pi_ptr->pin_ptr()->node_ptr()->num_fanouts() == 0);
+}
+
+// Function: primary_output_ptr
+// Query the pointer to a given name of primary output port.
+primary_output_pt Timer::primary_output_ptr(string_crt name) const {
+  return circuit_ptr()->primary_output_ptr(name);
+}
+
+// Function: insert_primary_output
+// Create a new primary output port in the design. The function return the pointer to the port.
+// Each primary output is associated with a pin and node.
+primary_output_pt Timer::insert_primary_output(string_crt name) {
+
+  journal_ptr()->set_is_irreversible();
+
+  // Insert a new primary output port into the circuit.
+  primary_output_pt po_ptr = circuit_ptr()->insert_primary_output(name);
+
+  // Create a new pin corresponding to the primary output port.
+  pin_pt pin_ptr = circuit_ptr()->insert_pin(name);       // Get the pin pointer.
+  pin_ptr->set_direction(PRIMARY_OUTPUT_PIN_DIRECTION);   // Set the pin direction.
+  pin_ptr->set_primary_output_ptr(po_ptr);                // Set the po pointer.
+  po_ptr->set_pin_ptr(pin_ptr);                           // Set the pin pointer.
+  _insert_node(pin_ptr);                                  // Attach a node to the pin.
+
+  // Create a new net for the primary output pin.
+  net_pt net_ptr = insert_net(name);
+  connect_pin(pin_ptr, net_ptr);
+
+  // Create a test for the primary output.
+  circuit_ptr()->insert_test(pin_ptr);
+
+  return po_ptr;
+}
+
+// Function: gate_ptr
+// Query the gate pointer by a given name.
+gate_pt Timer::gate_ptr(string_crt gate_name) const {
+  return circuit_ptr()->gate_ptr(gate_name);  
+}
+
+// Function: insert_gate
+// Create a new gate in the design. This newly-created gate is "not yet" connected to
+// any other gates or wires. The new gate name is guaranteed not to conflict with any
+// exisiting names in the current design. Within an eco transaction the gate is created on
+// commit and nullptr is returned.
+gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->insert_gate(gate_name, cell_name, cell_ptr(LATE, cell_name));
+    return nullptr;
+  }
+
+  journal_ptr()->set_is_structural();
+  journal_ptr()->insert_undo([=] () { remove_gate(gate_name); });
+  
+  // Insert a new gate.
+  gate_pt gate_ptr = circuit_ptr()->insert_gate(gate_name);
 
   // Assign the cell pointer.
-  cell_pt early_cell_ptr = celllib_ptr(EARLY)->cell_ptr(cell_name);
-  cell_pt late_cell_ptr = celllib_ptr(LATE)->cell_ptr(cell_name);
+  cell_pt early_cell_ptr = cell_ptr(EARLY, cell_name);
+  cell_pt late_cell_ptr = cell_ptr(LATE, cell_name);
 
   // No cell found for the gate. The gate might be a blockage with cell_name defined
   // in LEF file (optional). 
@@ -1007,9 +1742,8 @@ gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
   
   // Insert a new pin for each cell pin of the gate's cell.
   // Attach a new node for each pin.
-  string_t from_pin_name, to_pin_name, pin_name;
-  pin_pt from_pin_ptr, to_pin_ptr, pin_ptr;
-  timing_arc_pt timing_arc_ptr[2];
+  string_t pin_name;
+  pin_pt pin_ptr;
 
   for(CellpinEarlyLateIter i(early_cell_ptr, late_cell_ptr); i(); ++i) {
     pin_name = gate_name + ":" + i.cellpin_name();
@@ -1021,10 +1755,22 @@ gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
     _insert_node(pin_ptr);                                  // Attach a node to the pin.
   }
   
-  // Iterate the timing arc of the cell and insert an edge for each timing arc. Notice here
-  // we iterate the cellpin in the cell first and then iterate all timing arcs that connect
-  // this cellpin that is being iterated.
-  for(CellpinEarlyLateIter i(early_cell_ptr, late_cell_ptr); i(); ++i) {
+  _insert_gate_arcs(gate_ptr);
+
+  return gate_ptr;
+}
+
+// Procedure: _insert_gate_arcs
+// Iterate the timing arc of the gate's cell and insert an edge for each timing arc. Notice here
+// we iterate the cellpin in the cell first and then iterate all timing arcs that connect
+// this cellpin that is being iterated. A test is inserted for each constraint arc.
+void_t Timer::_insert_gate_arcs(gate_pt gate_ptr) {
+
+  string_t from_pin_name, to_pin_name;
+  pin_pt from_pin_ptr, to_pin_ptr;
+  timing_arc_pt timing_arc_ptr[2];
+
+  for(CellpinEarlyLateIter i(gate_ptr->cell_ptr(EARLY), gate_ptr->cell_ptr(LATE)); i(); ++i) {
 
     // Obtain the "to_pin".
     to_pin_name = gate_ptr->name() + ":" + i.cellpin_name();
@@ -1045,8 +1791,6 @@ gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
       }
     }
   }
-
-  return gate_ptr;
 }
 
 // Procedure: repower_gate
@@ -1054,10 +1798,21 @@ gate_pt Timer::insert_gate(string_crt gate_name, string_crt cell_name) {
 // logic function and topology is guaranteed to be the same, along with the currently-connected
 // nets. However, the pin capacitances of the new cell type could be different. 
 void_t Timer::repower_gate(string_crt gate_name, string_crt cell_name) {
+
+  cell_pt early_cell_ptr = cell_ptr(EARLY, cell_name);
+  cell_pt late_cell_ptr = cell_ptr(LATE, cell_name);
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    if(late_cell_ptr == nullptr || early_cell_ptr == nullptr) {
+      LOG(ERROR) << "Failed to repower gate (nullptr exception)";
+      return;
+    }
+    eco_ptr()->repower_gate(gate_name, cell_name);
+    return;
+  }
   
   gate_pt gate_ptr = circuit_ptr()->gate_ptr(gate_name);
-  cell_pt early_cell_ptr = celllib_ptr(EARLY)->cell_ptr(cell_name);
-  cell_pt late_cell_ptr = celllib_ptr(LATE)->cell_ptr(cell_name);
 
   if(gate_ptr == nullptr || late_cell_ptr == nullptr || early_cell_ptr == nullptr) {
     LOG(ERROR) << "Failed to repower gate (nullptr exception)";
@@ -1067,6 +1822,22 @@ void_t Timer::repower_gate(string_crt gate_name, string_crt cell_name) {
   // Dummy repower operation - he newly inserted cell is identical to the old one.
   if(early_cell_ptr == gate_ptr->cell_ptr(EARLY) && late_cell_ptr == gate_ptr->cell_ptr(LATE)) return;
 
+  // Record the previous cell for the state journal.
+  string_t prev_cell_name = gate_ptr->cell_ptr(LATE)->name();
+  journal_ptr()->insert_undo([=] () { repower_gate(gate_name, prev_cell_name); });
+
+  _rebind_gate(gate_ptr, early_cell_ptr, late_cell_ptr);
+}
+
+// Procedure: _rebind_gate
+// Bind a gate to a new pair of early and late cells that share the pins and timing arcs of the
+// old cells, e.g., another size of the cell. The pins are remapped to the new cellpins with their
+// capacitance, the edges and tests are remapped to the new timing arcs together with the arcs of
+// every corner, and the fanins of the pins are inserted into the pipeline.
+void_t Timer::_rebind_gate(gate_pt gate_ptr, cell_pt early_cell_ptr, cell_pt late_cell_ptr) {
+
+  string_crt gate_name = gate_ptr->name();
+
   // Data declaration.
   string_t from_pin_name, to_pin_name, pin_name;
   pin_pt from_pin_ptr, to_pin_ptr, pin_ptr;
@@ -1119,6 +1890,7 @@ void_t Timer::repower_gate(string_crt gate_name, string_crt cell_name) {
       // Remap the timing arc.
       edge_ptr->set_timing_arc_ptr(EARLY, j.timing_arc_ptr(EARLY));
       edge_ptr->set_timing_arc_ptr(LATE, j.timing_arc_ptr(LATE));
+      _bind_corner_arcs(edge_ptr);
       
       // Remap the constraint arc.
       if(j.is_constraint()) {
@@ -1133,6 +1905,78 @@ void_t Timer::repower_gate(string_crt gate_name, string_crt cell_name) {
   }
 }
 
+// Procedure: _swap_gate_cell
+// Bind a gate to a new pair of early and late cells that share the pins of the old cells but not
+// necessarily the timing arcs, e.g., a block model re-extracted after the block has changed. The
+// cell edges and tests of the gate are removed and re-inserted from the timing arcs of the new
+// cells, while the pins, the nodes, and the net connections of the gate are kept intact.
+void_t Timer::_swap_gate_cell(gate_pt gate_ptr, cell_pt early_cell_ptr, cell_pt late_cell_ptr) {
+
+  string_crt gate_name = gate_ptr->name();
+
+  pin_pt pin_ptr;
+
+  _remove_gate_arcs(gate_ptr);
+  
+  gate_ptr->set_cell_ptr(EARLY, early_cell_ptr);            // Gate's cell.
+  gate_ptr->set_cell_ptr(LATE, late_cell_ptr);              // Gate's cell.
+
+  // Remap the cellpins and insert the net fanins into the pipeline. A clock pin of the gate 
+  // invalidates its clock subtree as the sequential tests below it are replaced.
+  for(CellpinEarlyLateIter i(early_cell_ptr, late_cell_ptr); i(); ++i) {
+
+    pin_ptr = circuit_ptr()->pin_ptr(gate_name + ":" + i.cellpin_name());
+
+    _remap_cellpin(EARLY, pin_ptr, i.cellpin_ptr(EARLY));
+    _remap_cellpin(LATE, pin_ptr, i.cellpin_ptr(LATE));
+
+    for(auto& e : pin_ptr->node_ptr()->fanin()) {
+      _insert_frontier(e->from_node_ptr());
+    }
+    
+    if(pin_ptr->node_ptr()->is_in_clock_tree()) {
+      pin_ptr->node_ptr()->clock_tree_ptr()->enable_clock_subtree_update(pin_ptr->node_ptr());
+    }
+  }
+
+  _insert_gate_arcs(gate_ptr);
+
+  // The new cell edges remove their to nodes from the pipeline, whose timing however must be
+  // recomputed as the arrival time at the gate inputs is not necessarily changed.
+  for(CellpinIter i(late_cell_ptr); i(); ++i) {
+    _insert_frontier(circuit_ptr()->pin_ptr(gate_name + ":" + i.cellpin_ptr()->name())->node_ptr());
+  }
+}
+
+// Procedure: _remove_gate_arcs
+// Remove the cell edges and the tests of a gate, i.e., every fanin edge of the gate pins that
+// is not an rctree edge of a net. The endpoints of the removed tests are taken out of the
+// endpoint heap. The pins and nodes of the gate remain in the design.
+void_t Timer::_remove_gate_arcs(gate_pt gate_ptr) {
+
+  edge_pt edge_ptr;
+  pin_pt pin_ptr;
+
+  for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
+
+    pin_ptr = circuit_ptr()->pin_ptr(gate_ptr->name() + ":" + i.cellpin_ptr()->name());
+
+    for(NodeFaninIter j(pin_ptr->node_ptr()); j();) {
+      edge_ptr = j.edge_ptr();
+      ++j;
+      if(edge_ptr->edge_type() != RCTREE_EDGE_TYPE) _remove_edge(edge_ptr);
+    }
+
+    if(pin_ptr->test_ptr() != nullptr) {
+      EL_RF_ITER(el, rf) {
+        endpoint_minheap_ptr()->remove(pin_ptr->test_ptr()->endpoint_ptr(el, rf));
+      }
+      circuit_ptr()->remove_test(pin_ptr->test_ptr());
+      pin_ptr->set_test_ptr(nullptr);
+    }
+  }
+}
+
 // Procedure: remove_gate
 // Remove a gate from the current design. This is guaranteed to be called after the gate has 
 // been disconnected from the design using pin-level operations. The procedure iterates all 
@@ -1141,6 +1985,13 @@ void_t Timer::repower_gate(string_crt gate_name, string_crt cell_name) {
 // while in the later case, the ot_pin.has no output connections and all fanin edges should be 
 // removed here.
 void_t Timer::remove_gate(string_crt gate_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->remove_gate(gate_name);
+    return;
+  }
+
   remove_gate(circuit_ptr()->gate_ptr(gate_name));
 }
 
@@ -1155,6 +2006,14 @@ void_t Timer::remove_gate(gate_pt gate_ptr) {
 
   CHECK(gate_ptr != nullptr);
 
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->remove_gate(gate_ptr->name());
+    return;
+  }
+
+  journal_ptr()->set_is_irreversible();
+
   string_t pin_name;
   pin_pt pin_ptr;
 
@@ -1207,6 +2066,7 @@ void_t Timer::remove_gate(gate_pt gate_ptr) {
     pin_name = gate_ptr->name() + ":" + i.cellpin_ptr()->name();
     pin_ptr = circuit_ptr()->pin_ptr(pin_name);
     _remove_node(pin_ptr->node_ptr());
+    if(_spatial_grid_uptr) _spatial_grid_uptr->remove(pin_ptr);
     circuit_ptr()->remove_pin(pin_name);
   }
 
@@ -1224,8 +2084,17 @@ net_pt Timer::net_ptr(string_crt net_name) const {
 // Creates an empty net object with the input "net_name". By default, it will not be connected 
 // to any pins and have no parasitics (.spef). This net will be connected to existing pins in 
 // the design by the environment "connect_pin" and parasitics will be loaded by the environment
-// "read_spef".
+// "read_spef". Within an eco transaction the net is created on commit and nullptr is returned.
 net_pt Timer::insert_net(string_crt net_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->insert_net(net_name);
+    return nullptr;
+  }
+
+  journal_ptr()->set_is_structural();
+  journal_ptr()->insert_undo([=] () { remove_net(net_name); });
   net_pt net_ptr = circuit_ptr()->insert_net(net_name);
   return net_ptr;
 }
@@ -1235,6 +2104,7 @@ net_pt Timer::insert_net(string_crt net_name) {
 // net that already has parasitics in the design, it should be overwritten. Any .spef files
 // will be located in the same directory as the tau2015_wrapper (.tau2015).
 void_t Timer::read_spef(string_crt fpath) {
+  journal_ptr()->set_is_irreversible();
   spef_pt spef_ptr = new spef_t();
   _parse_spef(fpath, spef_ptr);
   _update_spef(spef_ptr);
@@ -1313,10 +2183,275 @@ void_t Timer::_update_spef(spef_pt spef_ptr) {
   } // Implicit synchronization barrier. ----------------------------------------------------------
 }
 
+// Procedure: estimate_rctrees
+// Estimate the parasitics of all nets that have no rctree from a spef file, or whose rctree was
+// estimated earlier, from the placement of their pins. Nets with unplaced pins are left as they
+// are. Spef parasitics always take precedence over the estimation.
+void_t Timer::estimate_rctrees() {
+
+  journal_ptr()->set_is_irreversible();
+
+  net_ptr_vt net_ptrs;
+
+  for(CircuitNetIter i(circuit_ptr()); i(); ++i) {
+    if(i.net_ptr()->rctree_ptr() == nullptr || i.net_ptr()->is_rctree_estimated()) {
+      net_ptrs.push_back(i.net_ptr());
+    }
+  }
+
+  _estimate_rctrees(net_ptrs);
+}
+
+// Procedure: estimate_rctrees
+// Estimate the net parasitics from the placement. The command accepts "-model hpwl|steiner",
+// "-layer <name>", "-res <float>", and "-cap <float>". The layer selects the lef routing layer 
+// whose unit resistance and capacitance are used for the wires, and the unit resistance and 
+// capacitance are given per micron in the units of the spef flow (kohm and fF). A later option 
+// overrides the values set by an earlier one.
+void_t Timer::estimate_rctrees(int argc, char **argv) {
+
+  float_t unit = techlib_ptr()->database_unit() > 0.0 ? techlib_ptr()->database_unit() : OT_FLT_ONE;
+
+  for(int i=0; i<argc; ++i) {
+    if(strcmp(argv[i], "-model") == 0 && i+1 < argc) {
+      ++i;
+      if(strcmp(argv[i], "hpwl") == 0) wire_estimator_ptr()->set_wire_model(HPWL_WIRE_MODEL);
+      else if(strcmp(argv[i], "steiner") == 0) wire_estimator_ptr()->set_wire_model(STEINER_WIRE_MODEL);
+      else LOG(WARNING) << "Unknown wire model " + string_t(argv[i]);
+    }
+    else if(strcmp(argv[i], "-layer") == 0 && i+1 < argc) {
+      layer_pt layer_ptr = techlib_ptr()->layer_ptr(argv[++i]);
+      if(layer_ptr == nullptr || layer_ptr->resistance() <= OT_FLT_ZERO || layer_ptr->width() <= OT_FLT_ZERO) {
+        LOG(WARNING) << "Failed to use wire layer " + string_t(argv[i]) + " (no resistance or width)";
+      }
+      else {
+        wire_estimator_ptr()->set_layer_ptr(layer_ptr);
+        _update_wire_estimator();
+      }
+    }
+    else if(strcmp(argv[i], "-res") == 0 && i+1 < argc) {
+      wire_estimator_ptr()->set_res_per_unit(atof(argv[++i]) / unit);
+    }
+    else if(strcmp(argv[i], "-cap") == 0 && i+1 < argc) {
+      wire_estimator_ptr()->set_cap_per_unit(atof(argv[++i]) / unit);
+    }
+  }
+
+  estimate_rctrees();
+}
+
+// Procedure: update_rctree_estimation
+// Re-estimate the parasitics of the nets connected to the given gate whose rctree was estimated
+// from the placement. The estimation is deferred to the next timing update, such that a net 
+// shared by many changed gates is estimated only once.
+void_t Timer::update_rctree_estimation(gate_pt gate_ptr) {
+
+  CHECK(gate_ptr != nullptr);
+
+  for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
+    pin_pt pin_ptr = circuit_ptr()->pin_ptr(gate_ptr->name() + ":" + i.cellpin_ptr()->name());
+    if(pin_ptr == nullptr) continue;
+    _enable_rctree_estimation_update(pin_ptr->net_ptr());
+  }
+}
+
+// Procedure: move_gate
+// Move a gate to the given location in the database unit of the def file.
+void_t Timer::move_gate(string_crt gate_name, float_ct x, float_ct y) {
+  move_gate(circuit_ptr()->gate_ptr(gate_name), x, y);
+}
+
+// Procedure: move_gate
+// Move a gate to the given location in the database unit of the def file. The pins of the gate
+// are updated in the spatial grid, and the nets of the gate whose rctree was estimated from the
+// placement are re-estimated at the next timing update. The timing of nets with spef parasitics
+// remains unchanged.
+void_t Timer::move_gate(gate_pt gate_ptr, float_ct x, float_ct y) {
+
+  if(gate_ptr == nullptr) {
+    LOG(ERROR) << "Failed to move gate (nullptr exception)";
+    return;
+  }
+
+  // Record the previous location for the state journal.
+  string_t gate_name = gate_ptr->name();
+  float_t prev_x = gate_ptr->location().x();
+  float_t prev_y = gate_ptr->location().y();
+  journal_ptr()->set_is_structural();
+  journal_ptr()->insert_undo([=] () { move_gate(gate_name, prev_x, prev_y); });
+
+  gate_ptr->set_location(x, y);
+  
+  if(gate_ptr->mobility() == UNPLACED_MOBILITY) gate_ptr->set_mobility(PLACED_MOBILITY);
+
+  for(CellpinIter i(gate_ptr->cell_ptr()); i(); ++i) {
+    pin_pt pin_ptr = circuit_ptr()->pin_ptr(gate_name + ":" + i.cellpin_ptr()->name());
+    if(pin_ptr == nullptr) continue;
+    if(_spatial_grid_uptr) _spatial_grid_uptr->update(pin_ptr);
+  }
+
+  update_rctree_estimation(gate_ptr);
+}
+
+// Procedure: get_pins_in_region
+// Get the placed pins inside the given region (boundary inclusive).
+void_t Timer::get_pins_in_region(rectangle_crt region, pin_ptr_vrt pin_ptrs) {
+  _update_spatial_grid();
+  _spatial_grid_uptr->query(region, pin_ptrs);
+}
+
+// Procedure: get_nets_in_region
+// Get the nets that have at least one placed pin inside the given region (boundary inclusive).
+void_t Timer::get_nets_in_region(rectangle_crt region, net_ptr_vrt net_ptrs) {
+
+  pin_ptr_vt pin_ptrs;
+  
+  get_pins_in_region(region, pin_ptrs);
+  
+  auto beg = net_ptrs.size();
+
+  for(const auto& pin_ptr : pin_ptrs) {
+    if(pin_ptr->net_ptr()) net_ptrs.push_back(pin_ptr->net_ptr());
+  }
+
+  sort(net_ptrs.begin() + beg, net_ptrs.end());
+  net_ptrs.erase(unique(net_ptrs.begin() + beg, net_ptrs.end()), net_ptrs.end());
+}
+
+// Procedure: _update_spatial_grid
+// Build the spatial grid over all placed pins if it does not exist. The grid covers the die
+// area, or the bounding box of the pins if the die area is not given, and is sized for a given
+// number of pins per bin. Afterwards the grid is maintained incrementally by the gate moves.
+void_t Timer::_update_spatial_grid() {
+
+  if(_spatial_grid_uptr) return;
+
+  pin_ptr_vt pin_ptrs;
+  rectangle_t box(circuit_ptr()->die());
+
+  for(CircuitPinIter i(circuit_ptr()); i(); ++i) {
+    if(i.pin_ptr()->is_placed()) pin_ptrs.push_back(i.pin_ptr());
+  }
+
+  if(box.area() <= OT_FLT_ZERO && !pin_ptrs.empty()) {
+    float_t lx(OT_FLT_MAX), ly(OT_FLT_MAX), ux(OT_FLT_MIN), uy(OT_FLT_MIN);
+    for(const auto& pin_ptr : pin_ptrs) {
+      auto p = pin_ptr->placement();
+      lx = min(lx, p.x());
+      ly = min(ly, p.y());
+      ux = max(ux, p.x());
+      uy = max(uy, p.y());
+    }
+    box = rectangle_t(lx, ly, ux, uy);
+  }
+
+  _spatial_grid_uptr.reset(new spatial_grid_t(box, pin_ptrs.size() / OT_DEFAULT_SPATIAL_GRID_BIN_SIZE));
+
+  for(const auto& pin_ptr : pin_ptrs) {
+    _spatial_grid_uptr->insert(pin_ptr);
+  }
+}
+
+// Procedure: _enable_rctree_estimation_update
+// Mark the net for the rctree estimation at the next timing update if its rctree is estimated
+// from the placement.
+void_t Timer::_enable_rctree_estimation_update(net_pt net_ptr) {
+  
+  if(net_ptr == nullptr || !net_ptr->is_rctree_estimated() || net_ptr->is_rctree_estimation_dirty()) {
+    return;
+  }
+
+  net_ptr->set_is_rctree_estimation_dirty(true);
+  _rctree_dirty_net_names.push_back(net_ptr->name());
+}
+
+// Procedure: _disable_rctree_estimation_update
+// Remove the net from the pending rctree estimation. The net stays in the dirty list and is
+// dropped at the next update.
+void_t Timer::_disable_rctree_estimation_update(net_pt net_ptr) {
+  if(net_ptr == nullptr) return;
+  net_ptr->set_is_rctree_estimation_dirty(false);
+}
+
+// Procedure: _update_rctree_estimations
+// Re-estimate the rctrees of all nets pending the estimation. The dirty list keeps net names and
+// is compacted here: a name whose net has been removed since, or replaced by a net that is not
+// dirty, is skipped.
+void_t Timer::_update_rctree_estimations() {
+
+  if(_rctree_dirty_net_names.empty()) return;
+
+  net_ptr_vt net_ptrs;
+
+  for(const auto& net_name : _rctree_dirty_net_names) {
+    net_pt net_ptr = circuit_ptr()->net_ptr(net_name);
+    if(net_ptr == nullptr || !net_ptr->is_rctree_estimation_dirty()) continue;
+    net_ptr->set_is_rctree_estimation_dirty(false);
+    net_ptrs.push_back(net_ptr);
+  }
+
+  __clear_vector(_rctree_dirty_net_names);
+
+  _estimate_rctrees(net_ptrs);
+}
+
+// Procedure: _estimate_rctrees
+// Estimate the rctrees of the given nets in parallel and insert the root pin of each estimated
+// net into the pipeline.
+void_t Timer::_estimate_rctrees(net_ptr_vrt net_ptrs) {
+  
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t i=0; i<net_ptrs.size(); ++i) {
+    if(wire_estimator_ptr()->estimate_rctree(net_ptrs[i])) {
+      #pragma omp critical
+      { _insert_frontier(net_ptrs[i]->root_pin_ptr()->node_ptr()); }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _update_wire_estimator
+// Derive the unit resistance and capacitance of the wire estimator from the wire layer in the
+// lef file, which defaults to the lowest routing layer that has a sheet resistance and a width.
+// The sheet resistance (ohm per square) and the area and edge capacitance (pF per square micron
+// and per micron) of the layer are converted to kohm and fF per micron of a wire of the layer
+// width and scaled to the database unit of the def file.
+void_t Timer::_update_wire_estimator() {
+
+  layer_pt layer_ptr = wire_estimator_ptr()->layer_ptr();
+
+  if(layer_ptr == nullptr) {
+    for(const auto& item : *(techlib_ptr()->layer_dict_ptr())) {
+      layer_pt candidate_ptr = item.second;
+      if(candidate_ptr->layer_type() != ROUTING_LAYER_TYPE) continue;
+      if(candidate_ptr->resistance() <= OT_FLT_ZERO || candidate_ptr->width() <= OT_FLT_ZERO) continue;
+      if(layer_ptr == nullptr || candidate_ptr->idx() < layer_ptr->idx()) layer_ptr = candidate_ptr;
+    }
+  }
+
+  float_t res(OT_DEFAULT_WIRE_RES_PER_MICRON), cap(OT_DEFAULT_WIRE_CAP_PER_MICRON);
+
+  if(layer_ptr != nullptr) {
+    res = layer_ptr->resistance() / layer_ptr->width() / 1000.0f;
+    cap = (layer_ptr->capacitance() * layer_ptr->width() + OT_FLT_TWO * layer_ptr->edge_capacitance()) * 1000.0f;
+  }
+
+  float_t unit = techlib_ptr()->database_unit() > 0.0 ? techlib_ptr()->database_unit() : OT_FLT_ONE;
+  
+  wire_estimator_ptr()->set_res_per_unit(res / unit);
+  wire_estimator_ptr()->set_cap_per_unit(cap / unit);
+}
+
 // Procedure: remove_net
 // Remove a net from the current design. By default, if a net is connected to pins, the pins 
 // should be automatically disconnected from the net.
 void_t Timer::remove_net(string_crt net_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->remove_net(net_name);
+    return;
+  }
+
   remove_net(circuit_ptr()->net_ptr(net_name));
 }
 
@@ -1325,7 +2460,17 @@ void_t Timer::remove_net(string_crt net_name) {
 // should be automatically disconnected from the net.
 void_t Timer::remove_net(net_pt net_ptr) {
 
-  CHECK(net_ptr != nullptr && net_ptr->num_pins() == 0);
+  CHECK(net_ptr != nullptr);
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->remove_net(net_ptr->name());
+    return;
+  }
+
+  journal_ptr()->set_is_irreversible();
+
+  CHECK(net_ptr->num_pins() == 0);
 
   // Disconnect all pins in the net.
   if(net_ptr->num_pins() > 0) {
@@ -1339,6 +2484,7 @@ void_t Timer::remove_net(net_pt net_ptr) {
   }
 
   // Remove the net from the current design.
+  _disable_rctree_estimation_update(net_ptr);
   circuit_ptr()->remove_net(net_ptr->name());
 }
 
@@ -1347,6 +2493,13 @@ void_t Timer::remove_net(net_pt net_ptr) {
 // Disconnect the pin from the net it is connected to. The pin_name will either have the 
 // <gate name>:<cell pin name> syntax (e.g., u4:ZN) or be a primary input.
 void_t Timer::disconnect_pin(string_crt pin_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->disconnect_pin(pin_name);
+    return;
+  }
+
   disconnect_pin(circuit_ptr()->pin_ptr(pin_name));
 }
 
@@ -1356,12 +2509,24 @@ void_t Timer::disconnect_pin(string_crt pin_name) {
 void_t Timer::disconnect_pin(pin_pt pin_ptr) {
 
   CHECK(pin_ptr != nullptr);
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->disconnect_pin(pin_ptr->name());
+    return;
+  }
   
   // Obtain the net to which the pin is connected.
   net_pt net_ptr = pin_ptr->net_ptr();
 
   if(net_ptr == nullptr) return;
 
+  // Record the reconnection for the state journal.
+  string_t pin_name = pin_ptr->name();
+  string_t net_name = net_ptr->name();
+  journal_ptr()->set_is_structural();
+  journal_ptr()->insert_undo([=] () { connect_pin(pin_name, net_name); });
+
   // Remove edge connections that are associated with the pin and disconnect the pin
   // from the net. Notice we have two cases, either the pin is a root of the net where we
   // need to remove all fanout edges of the root or the pin is a leave of the net where
@@ -1387,12 +2552,13 @@ void_t Timer::disconnect_pin(pin_pt pin_ptr) {
   }
 
   // Enable the clock tree update.
-  if(pin_ptr->node_ptr()->is_in_clock_tree()) {
-    circuit_ptr()->clock_tree_ptr()->enable_clock_tree_update();
-  }
+  _enable_clock_tree_update(net_ptr);
   
   // Remove the pin from the net and enable the rc timing update.
   net_ptr->remove_pin_ptr(pin_ptr);       
+  
+  // Enable the rctree estimation update.
+  _enable_rctree_estimation_update(net_ptr);
 }
 
 // Procedure: connect_pin
@@ -1400,6 +2566,13 @@ void_t Timer::disconnect_pin(pin_pt pin_ptr) {
 // <gate name>:<cell pin name> syntax (e.g., u4:ZN) or be a primary input. The net name
 // will match an existing net read in from a .spef file.
 void_t Timer::connect_pin(string_crt pin_name, string_crt net_name) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->connect_pin(pin_name, net_name);
+    return;
+  }
+
   connect_pin(circuit_ptr()->pin_ptr(pin_name), circuit_ptr()->net_ptr(net_name));
 }
 
@@ -1408,6 +2581,14 @@ void_t Timer::connect_pin(string_crt pin_name, string_crt net_name) {
 // <gate name>:<cell pin name> syntax (e.g., u4:ZN) or be a primary input. The net name
 // will match an existing net read in from a .spef file.
 void_t Timer::connect_pin(string_crt pin_name, net_pt net_ptr) {
+
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    CHECK(net_ptr != nullptr);
+    eco_ptr()->connect_pin(pin_name, net_ptr->name());
+    return;
+  }
+
   connect_pin(circuit_ptr()->pin_ptr(pin_name), net_ptr);
 }
 
@@ -1419,11 +2600,22 @@ void_t Timer::connect_pin(pin_pt pin_ptr, net_pt net_ptr) {
    
   CHECK(pin_ptr != nullptr && net_ptr != nullptr);
 
+  // Defer the modification to the commit of the eco transaction.
+  if(eco_ptr()->is_open()) {
+    eco_ptr()->connect_pin(pin_ptr->name(), net_ptr->name());
+    return;
+  }
+
   if(pin_ptr->net_ptr()) {
     LOG(ERROR) << "Failed to connect a pin to a net (non-disconnected pin exception)";
     return;
   }
 
+  // Record the disconnection for the state journal.
+  string_t pin_name = pin_ptr->name();
+  journal_ptr()->set_is_structural();
+  journal_ptr()->insert_undo([=] () { disconnect_pin(pin_name); });
+
   // Connect the pin to the net and construct the edge connections that are associated
   // with this net connection. Notice that are two cases - the given pin is either a root of
   // the net where we need to scan all other pins that remaines in the net and construct
@@ -1447,9 +2639,10 @@ void_t Timer::connect_pin(pin_pt pin_ptr, net_pt net_ptr) {
   }
 
   // Enable the clock tree update.
-  if(pin_ptr->node_ptr()->is_in_clock_tree()) {
-    circuit_ptr()->clock_tree_ptr()->enable_clock_tree_update();
-  }
+  _enable_clock_tree_update(net_ptr);
+  
+  // Enable the rctree estimation update.
+  _enable_rctree_estimation_update(net_ptr);
 }
 
 // Procedure: _remap_cellpin
@@ -1517,6 +2710,10 @@ node_pt Timer::_insert_node(pin_pt pin_ptr) {
   node_ptr->set_pin_ptr(pin_ptr);
   node_ptr->set_nodeset_ptr(nodeset_ptr());
   pin_ptr->set_node_ptr(node_ptr);
+  
+  // The pin index of the timing view must be rebuilt.
+  _is_timing_view_topology_dirty = true;
+  _mark_timing_view(node_ptr);
 
   return node_ptr;
 }
@@ -1557,7 +2754,10 @@ edge_pt Timer::_insert_edge(node_pt from_node_ptr, node_pt to_node_ptr, timing_a
     return nullptr;
   }
     
-  // Case 2: create a new edge.
+  // Case 2: create a new edge. The jumps through the from node are invalidated before the new
+  // fanout changes its jump structure.
+  _enable_jump_update(from_node_ptr);
+
   edge_pt edge_ptr = new edge_t();
   edge_ptr->set_edgelist_satellite(_edgelist_ptr->push_back(edge_ptr));
   edge_ptr->set_from_node_ptr(from_node_ptr);
@@ -1567,11 +2767,13 @@ edge_pt Timer::_insert_edge(node_pt from_node_ptr, node_pt to_node_ptr, timing_a
   }
   from_node_ptr->insert_fanout(edge_ptr);
   to_node_ptr->insert_fanin(edge_ptr);
+  _enable_jump_update(to_node_ptr);
   
   if(timing_arc_ptr[EARLY]->is_constraint()) edge_ptr->set_edge_type(CONSTRAINT_EDGE_TYPE);
   else edge_ptr->set_edge_type(COMBINATIONAL_EDGE_TYPE);
   
   edge_ptr->set_timing_sense(timing_arc_ptr[EARLY]->timing_sense());
+  _bind_corner_arcs(edge_ptr);
 
   // Insert the from node into the pipeline as the frontier and remove 
   // the to node from the frontier list.
@@ -1579,6 +2781,10 @@ edge_pt Timer::_insert_edge(node_pt from_node_ptr, node_pt to_node_ptr, timing_a
   _insert_frontier(from_node_ptr);
   to_node_ptr->set_level(max(from_node_ptr->level() + 1, to_node_ptr->level()));
 
+  // The to node has a new fanin and is a source of the timing change by itself, regardless of
+  // whether the timing of the from node changes.
+  _insert_frontier(to_node_ptr);
+
   return edge_ptr;
 }
 
@@ -1647,7 +2853,10 @@ edge_pt Timer::_insert_edge(node_pt from_node_ptr, node_pt to_node_ptr, net_pt n
   // Case 1: illegal nodes and arc
   if(!from_node_ptr || !to_node_ptr || !net_ptr) return nullptr;
     
-  // Case 2: create a new edge.
+  // Case 2: create a new edge. The jumps through the from node are invalidated before the new
+  // fanout changes its jump structure.
+  _enable_jump_update(from_node_ptr);
+
   edge_pt edge_ptr = new edge_t();
   edge_ptr->set_edgelist_satellite(_edgelist_ptr->push_back(edge_ptr));
   edge_ptr->set_from_node_ptr(from_node_ptr);
@@ -1655,14 +2864,20 @@ edge_pt Timer::_insert_edge(node_pt from_node_ptr, node_pt to_node_ptr, net_pt n
   edge_ptr->set_net_ptr(net_ptr);
   edge_ptr->set_edge_type(RCTREE_EDGE_TYPE);
   edge_ptr->set_timing_sense(POSITIVE_UNATE);
+  _bind_corner_arcs(edge_ptr);
   from_node_ptr->insert_fanout(edge_ptr);
   to_node_ptr->insert_fanin(edge_ptr);
+  _enable_jump_update(to_node_ptr);
 
   // Pipeline the node.
   _remove_frontier(to_node_ptr);
   _insert_frontier(from_node_ptr);
   to_node_ptr->set_level(max(from_node_ptr->level() + 1, to_node_ptr->level()));
 
+  // The to node has a new fanin and is a source of the timing change by itself, regardless of
+  // whether the timing of the from node changes.
+  _insert_frontier(to_node_ptr);
+
   return edge_ptr;
 }
 
@@ -1701,6 +2916,27 @@ jump_pt Timer::_insert_jump(node_pt from_ptr, node_pt to_ptr, int_t num_negs, fl
   return jump_ptr;
 }
 
+// Function: _insert_jump
+// Insert a copy of a given induced jump into the jump set and connect it to its two ending nodes.
+jump_pt Timer::_insert_jump(jump_crt jump) {
+
+  int_t idx = jumpset_ptr()->insert();
+  jump_pt jump_ptr = jumpset()[idx];
+  jump_ptr->set_idx(idx);
+  jump_ptr->set_from_node_ptr(jump.from_node_ptr());
+  jump_ptr->set_to_node_ptr(jump.to_node_ptr());
+  jump_ptr->set_timing_sense(jump.timing_sense());
+
+  EL_RF_RF_ITER(el, irf, orf) {
+    jump_ptr->set_delay(el, irf, orf, jump.delay(el, irf, orf));
+  }
+
+  jump.from_node_ptr()->insert_jumpout(jump_ptr);
+  jump.to_node_ptr()->insert_jumpin(jump_ptr);
+
+  return jump_ptr;
+}
+
 // Procedure: _remove_jump
 // Remove all jumps from/to a given node in the timing graph. 
 void_t Timer::_remove_jump(node_pt node_ptr) {
@@ -1724,102 +2960,500 @@ void_t Timer::_remove_jump(node_pt node_ptr) {
       _remove_jump(jump_ptr);
     }
   }
-}
+}
+
+// Procedure: _remove_jump
+// Remove a jump from the jump set and the timing graph. The procedure disconnects the 
+// two endpoint nodes and then deletes the jump.
+void_t Timer::_remove_jump(jump_pt jump_ptr) {
+  if(jump_ptr == nullptr) return;
+  jump_ptr->to_node_ptr()->set_is_timing_dirty(true);
+  jump_ptr->from_node_ptr()->remove_jumpout(jump_ptr);
+  jump_ptr->to_node_ptr()->remove_jumpin(jump_ptr);
+  jumpset_ptr()->remove(jump_ptr->idx());
+}
+
+// Function: _find_edge_ptr
+// The function finds the edge that connects the given two endpoints and returns the pointer
+// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
+// pointer.
+edge_pt Timer::_find_edge_ptr(string_crt from_pin_name, string_crt to_pin_name) {
+  pin_pt from_pin_ptr = circuit_ptr()->pin_ptr(from_pin_name);
+  pin_pt to_pin_ptr = circuit_ptr()->pin_ptr(to_pin_name);
+  return _find_edge_ptr(from_pin_ptr, to_pin_ptr);
+}
+
+// Function: _find_edge_ptr
+// The function finds the edge that connects the given two endpoints and returns the pointer
+// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
+// pointer.
+edge_pt Timer::_find_edge_ptr(pin_pt from_pin_ptr, pin_pt to_pin_ptr) {
+  if(!from_pin_ptr || !to_pin_ptr) return nullptr;
+  return _find_edge_ptr(from_pin_ptr->node_ptr(), to_pin_ptr->node_ptr());
+}
+
+// Function: _find_edge_ptr
+// The function finds the edge that connects the given two endpoints and returns the pointer
+// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
+// pointer.
+edge_pt Timer::_find_edge_ptr(node_pt from_node_ptr, node_pt to_node_ptr) {
+
+  if(!from_node_ptr || !to_node_ptr) return nullptr;
+
+  edgelist_pt edgelist_ptr;
+  
+  // Obtain the edgelist with smaller size, which could be better for later search.
+  if(from_node_ptr->num_fanouts() > to_node_ptr->num_fanins()) {
+    edgelist_ptr = from_node_ptr->fanout_ptr();
+  }
+  else {
+    edgelist_ptr = to_node_ptr->fanin_ptr();
+  }
+  
+  // Search the edge.
+  for(const auto& e : *edgelist_ptr) {
+    if(e->from_node_ptr() == from_node_ptr && e->to_node_ptr() == to_node_ptr)  {
+      return e;
+    }
+  }
+
+  return nullptr;
+}
+
+// Procedure: remove_node
+// Remove a node from the design. The node must be disconnected from the design using the
+// procedure "_remove_edge" before it can be removed and deleted. Notice that if the node
+// is deleted from the design, it should be removed from the pipeline if it was inserted 
+// to the pipeline before. By default, the node is isolated.
+void_t Timer::_remove_node(node_pt node_ptr) {
+  if(node_ptr->is_in_clock_tree()) node_ptr->clock_tree_ptr()->enable_clock_tree_update();
+  _is_timing_view_topology_dirty = true;
+  _mark_timing_view(node_ptr);
+  _remove_frontier(node_ptr);
+  nodeset_ptr()->remove(node_ptr->idx());
+}
+
+// Procedure: remove_edge
+// Remove an edge from the design. The procedure first disconnects the edge from its two ending
+// nodes, "from_node" and "to_node". Then it removes the edge from the design and insert both
+// "from_node" and "to_node" into the pipeline.
+void_t Timer::_remove_edge(edge_pt edge_ptr) {
+
+  _enable_jump_update(edge_ptr->to_node_ptr());
+  _remove_jump(edge_ptr->from_node_ptr());
+  _remove_jump(edge_ptr->to_node_ptr());
+  edge_ptr->from_node_ptr()->remove_fanout(edge_ptr);
+  edge_ptr->to_node_ptr()->remove_fanin(edge_ptr);
+  _enable_jump_update(edge_ptr->from_node_ptr());
+  _insert_frontier(edge_ptr->to_node_ptr());
+  _insert_frontier(edge_ptr->from_node_ptr());
+  edgelist_ptr()->remove(edge_ptr->edgelist_satellite());
+
+  delete edge_ptr;
+}
+
+// Procedure: _update_forward_propagate_pipeline
+// The procedure builds the pipeline for forward propagation. Starting from nodes in the lowest
+// level, the procedure iteratively updates the level of these nodes based on the fanin level.
+// Then the node insert all fanout of each node that was being iterated. In other words, in the
+// end of the procedure, the pipelins consists of all the fanout nodes of those initial node 
+// residing in the lowest starting level.
+void_t Timer::_update_forward_propagate_pipeline() {
+  
+  for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
+    _forward_propagate_fanout(l);
+  }
+}
+
+// Procedure: _update_forward_propagate_levels
+// The procedure restores the level order around the nodes residing in the pipeline, i.e., every
+// fanout node of a pipelined node is placed at a higher level, and so on for the fanout of each
+// node whose level is raised. Unlike the pipeline expansion, nodes are neither pipelined nor
+// visited beyond those whose level is raised.
+void_t Timer::_update_forward_propagate_levels() {
+
+  node_ptr_vt stack;
+
+  for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
+    nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
+    if(nodelist_ptr == nullptr) continue;
+    for(NodelistIter i(nodelist_ptr); i(); ++i) {
+      stack.push_back(i.node_ptr());
+    }
+  }
+
+  while(!stack.empty()) {
+    node_pt node_ptr = stack.back();
+    stack.pop_back();
+    for(const auto& e : node_ptr->fanout()) {
+      if(e->to_node_ptr()->level() > node_ptr->level()) continue;
+      _update_node_level(e->to_node_ptr(), node_ptr->level() + 1);
+      stack.push_back(e->to_node_ptr());
+    }
+  }
+}
+
+// Procedure: _forward_propagate_events
+// The procedure performs the incremental forward propagation in an event-driven fashion. The
+// pipeline initially holds the sources of the timing change only. The nodes in each level are
+// propagated in parallel, after which the fanout nodes of those whose timing has changed by more
+// than the epsilon are pipelined at their higher levels. A node none of whose fanins changed is
+// never visited, so the cost follows the extent of the change rather than the fanout cone. Since
+// the nodes to propagate are unknown until their fanins are done, the levels are synchronized.
+void_t Timer::_forward_propagate_events() {
+
+  _update_forward_propagate_levels();
+
+  #pragma omp parallel
+  {
+    #pragma omp single
+    {
+      for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
+
+        if(pipeline_ptr()->empty(l)) continue;
+
+        nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
+
+        for(NodelistIter i(nodelist_ptr); i(); ++i) {
+          auto node_ptr = i.node_ptr();
+          #pragma omp task firstprivate(node_ptr)
+          { _forward_propagate_node(node_ptr); }
+        }
+
+        // Synchronization.
+        #pragma omp taskwait
+
+        // Pipeline the fanout nodes whose fanin has changed.
+        for(NodelistIter i(nodelist_ptr); i(); ++i) {
+          for(const auto& e : i.node_ptr()->fanout()) {
+            if(_is_fanin_changed[e->to_node_ptr()->idx()]) {
+              _insert_frontier(e->to_node_ptr());
+            }
+          }
+        }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _forward_propagate_dataflow
+// The procedure performs the forward propagation in a dataflow fashion. Each pipelined node
+// keeps a counter of its pipelined fanins that have not yet been propagated. Nodes with zero
+// counter are spawned as tasks, and a node that finishes its propagation decrements the counter
+// of each fanout node, spawning the fanout node once the counter drops to zero. As a result, a
+// long path is no longer held back by the slowest node in every level it goes through.
+void_t Timer::_forward_propagate_dataflow() {
+
+  node_ptr_vt sources;
+
+  // Initialize the dependency counter of every pipelined node.
+  for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
+    
+    nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
+
+    if(nodelist_ptr == nullptr) continue;
+
+    for(NodelistIter i(nodelist_ptr); i(); ++i) {
+      for(const auto& e : i.node_ptr()->fanin()) {
+        if(e->from_node_ptr()->is_in_pipeline()) {
+          ++_num_pending_fanins[i.node_ptr()->idx()];
+        }
+      }
+      if(_num_pending_fanins[i.node_ptr()->idx()] == 0) {
+        sources.push_back(i.node_ptr());
+      }
+    }
+  }
+
+  #pragma omp parallel
+  {
+    #pragma omp single
+    {
+      for(unsigned_t i=0; i<sources.size(); ++i) {
+        auto node_ptr = sources[i];
+        #pragma omp task firstprivate(node_ptr)
+        { _forward_propagate_dataflow(node_ptr); }
+      }
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: _forward_propagate_dataflow
+// Propagate the timing of a given node pointer whose pipelined fanins are all up-to-date, and
+// then release those fanout nodes that are no longer waiting on any other fanin. The counters
+// drop back to zero once the pipeline has been propagated.
+void_t Timer::_forward_propagate_dataflow(node_pt node_ptr) {
+
+  if(node_ptr == nullptr) return;
+
+  _forward_propagate_node(node_ptr);
+
+  // Release the fanout nodes.
+  for(const auto& e : node_ptr->fanout()) {
+    
+    auto to_node_ptr = e->to_node_ptr();
+    int_t num_pending;
+
+    #pragma omp atomic capture seq_cst
+    num_pending = --_num_pending_fanins[to_node_ptr->idx()];
+
+    if(num_pending == 0) {
+      #pragma omp task firstprivate(to_node_ptr)
+      { _forward_propagate_dataflow(to_node_ptr); }
+    }
+  }
+}
+
+// Procedure: _forward_propagate_node
+// Propagate the timing of a given node pointer if it is a source of the timing change or any of
+// its fanins has changed, and mark the fanin of its fanout nodes as changed if the timing of the
+// node has changed. Otherwise the timing of this node and its jumps remain valid.
+void_t Timer::_forward_propagate_node(node_pt node_ptr) {
+
+  int_t is_fanin_changed;
+
+  #pragma omp atomic read
+  is_fanin_changed = _is_fanin_changed[node_ptr->idx()];
+
+  if(!node_ptr->is_timing_dirty() && !is_fanin_changed) return;
+    
+  bool_t is_changed = _forward_propagate_change(node_ptr);
+    
+  node_ptr->set_is_timing_dirty(false);
+
+  #pragma omp atomic write
+  _is_fanout_changed[node_ptr->idx()] = 1;
+
+  if(!is_changed) return;
+
+  for(const auto& e : node_ptr->fanout()) {
+    #pragma omp atomic write
+    _is_fanin_changed[e->to_node_ptr()->idx()] = 1;
+  }
+}
+
+// Function: _forward_propagate_change
+// Propagate the timing of a given node pointer and return true if anything its fanout depends
+// on differs from the value last propagated to the fanout by more than the timing change
+// epsilon, i.e., the slew or the arrival time of the node, or, at a rctree root, the load of the
+// net and the elmore delay and impulse at each sink. The latter change with the parasitics
+// (read_spef, set_load, or a repower) even if the timing of the root itself remains the same.
+// Comparing against the propagated values rather than the previous ones keeps the error of the
+// fanout within the epsilon, no matter how many small changes add up. The fanin nodes are marked
+// for the backward propagation if any of the fanin delays has changed, and the clock sinks of a
+// constrained node also if its arrival time has changed.
+bool_t Timer::_forward_propagate_change(node_pt node_ptr) {
+
+  _journal_node(node_ptr);
+
+  node_ptr->resize_corner_timing(num_corners());
+
+  _forward_propagate_rc_timing(node_ptr);
+  _forward_propagate_slew(node_ptr);
+  _forward_propagate_corner_slew(node_ptr);
+  _forward_propagate_delay(node_ptr);
+  _forward_propagate_corner_delay(node_ptr);
+  _forward_propagate_at(node_ptr);
+  _forward_propagate_corner_at(node_ptr);
+  _forward_propagate_jump(node_ptr);
+
+  if(node_ptr->is_constrained()) {
+    _forward_propagate_test(node_ptr->pin_ptr()->test_ptr());
+  }
+
+  bool_t is_changed = false;
+
+  EL_RF_ITER(el, rf) {
+    if(_is_timing_changed(node_ptr->propagated_slew(el, rf), node_ptr->slew(el, rf)) || 
+       _is_timing_changed(node_ptr->propagated_at(el, rf), node_ptr->at(el, rf))) {
+      is_changed = true;
+    }
+  }
+
+  for(size_t c=0; c<num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      if(_is_timing_changed(node_ptr->corner_propagated_slew(c, el, rf), node_ptr->corner_slew(c, el, rf)) || 
+         _is_timing_changed(node_ptr->corner_propagated_at(c, el, rf), node_ptr->corner_at(c, el, rf))) {
+        is_changed = true;
+      }
+    }
+  }
+
+  // The net delays and slews to the fanout depend on the rc timing of the net. A rctree root that
+  // is a source of the change may carry parasitics that were already re-timed when they were
+  // modified (e.g., read_spef), so its fanout is always re-timed.
+  rctree_pt rctree_ptr = _rctree_ptr(node_ptr);
+  
+  if(rctree_ptr != nullptr) {
+    float_vt curr;
+    float_vrt prev = *(rctree_ptr->propagated_values_ptr());
+    _collect_rc_values(node_ptr, rctree_ptr, curr);
+    bool_t is_rc_changed = node_ptr->is_timing_dirty() || prev.size() != curr.size();
+    for(size_t i=0; i<curr.size() && !is_rc_changed; ++i) {
+      if(_is_timing_changed(prev[i], curr[i])) is_rc_changed = true;
+    }
+    if(is_rc_changed) {
+      prev.swap(curr);
+      is_changed = true;
+    }
+  }
+
+  bool_t is_at_changed = is_changed;
+
+  if(is_changed) {
+    EL_RF_ITER(el, rf) {
+      node_ptr->set_propagated_slew(el, rf, node_ptr->slew(el, rf));
+      node_ptr->set_propagated_at(el, rf, node_ptr->at(el, rf));
+    }
+    for(size_t c=0; c<num_corners(); ++c) {
+      EL_RF_ITER(el, rf) {
+        node_ptr->set_corner_propagated_slew(c, el, rf, node_ptr->corner_slew(c, el, rf));
+        node_ptr->set_corner_propagated_at(c, el, rf, node_ptr->corner_at(c, el, rf));
+      }
+    }
+  }
+
+  // The required arrival time of the fanin nodes depends on the fanin delays. The required
+  // arrival time of a clock sink further depends on the slack of the constrained data pin and
+  // thus on its arrival time.
+  for(const auto& e : node_ptr->fanin()) {
+    bool_t is_delay_changed = is_at_changed && e->edge_type() == CONSTRAINT_EDGE_TYPE;
+    EL_RF_RF_ITER(el, irf, orf) {
+      if(_is_timing_changed(e->propagated_delay(el, irf, orf), e->delay(el, irf, orf))) {
+        is_delay_changed = true;
+      }
+    }
+    for(size_t c=0; c<e->num_corners(); ++c) {
+      EL_RF_RF_ITER(el, irf, orf) {
+        if(_is_timing_changed(e->corner_propagated_delay(c, el, irf, orf), e->corner_delay(c, el, irf, orf))) {
+          is_delay_changed = true;
+        }
+      }
+    }
+    if(is_delay_changed) {
+      is_changed = true;
+      EL_RF_RF_ITER(el, irf, orf) {
+        e->set_propagated_delay(el, irf, orf, e->delay(el, irf, orf));
+      }
+      for(size_t c=0; c<e->num_corners(); ++c) {
+        EL_RF_RF_ITER(el, irf, orf) {
+          e->set_corner_propagated_delay(c, el, irf, orf, e->corner_delay(c, el, irf, orf));
+        }
+      }
+      #pragma omp atomic write
+      _is_fanout_changed[e->from_node_ptr()->idx()] = 1;
+    }
+  }
 
-// Procedure: _remove_jump
-// Remove a jump from the jump set and the timing graph. The procedure disconnects the 
-// two endpoint nodes and then deletes the jump.
-void_t Timer::_remove_jump(jump_pt jump_ptr) {
-  if(jump_ptr == nullptr) return;
-  jump_ptr->from_node_ptr()->remove_jumpout(jump_ptr);
-  jump_ptr->to_node_ptr()->remove_jumpin(jump_ptr);
-  jumpset_ptr()->remove(jump_ptr->idx());
+  return is_changed;
 }
 
-// Function: _find_edge_ptr
-// The function finds the edge that connects the given two endpoints and returns the pointer
-// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
-// pointer.
-edge_pt Timer::_find_edge_ptr(string_crt from_pin_name, string_crt to_pin_name) {
-  pin_pt from_pin_ptr = circuit_ptr()->pin_ptr(from_pin_name);
-  pin_pt to_pin_ptr = circuit_ptr()->pin_ptr(to_pin_name);
-  return _find_edge_ptr(from_pin_ptr, to_pin_ptr);
+// Function: _rctree_ptr
+// Return the rctree rooted at a given node pointer or nullptr if the node is not a rctree root.
+rctree_pt Timer::_rctree_ptr(node_pt node_ptr) const {
+  if(!node_ptr->is_rctree_root()) return nullptr;
+  net_pt net_ptr = node_ptr->pin_ptr()->net_ptr();
+  return net_ptr == nullptr ? nullptr : net_ptr->rctree_ptr();
 }
 
-// Function: _find_edge_ptr
-// The function finds the edge that connects the given two endpoints and returns the pointer
-// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
-// pointer.
-edge_pt Timer::_find_edge_ptr(pin_pt from_pin_ptr, pin_pt to_pin_ptr) {
-  if(!from_pin_ptr || !to_pin_ptr) return nullptr;
-  return _find_edge_ptr(from_pin_ptr->node_ptr(), to_pin_ptr->node_ptr());
-}
+// Procedure: _collect_rc_values
+// Collect the load of a rctree rooted at a given node pointer followed by the elmore delay and
+// impulse of the rctree node at each fanout pin, first for the default libraries and then for
+// each corner.
+void_t Timer::_collect_rc_values(node_pt node_ptr, rctree_pt rctree_ptr, float_vrt values) const {
 
-// Function: _find_edge_ptr
-// The function finds the edge that connects the given two endpoints and returns the pointer
-// pointing to this edge. The two endpoints can be speficied by name, pin pointer, or node
-// pointer.
-edge_pt Timer::_find_edge_ptr(node_pt from_node_ptr, node_pt to_node_ptr) {
+  values.clear();
 
-  if(!from_node_ptr || !to_node_ptr) return nullptr;
+  EL_RF_ITER(el, rf) {
+    values.push_back(rctree_ptr->load(el, rf));
+  }
 
-  edgelist_pt edgelist_ptr;
-  
-  // Obtain the edgelist with smaller size, which could be better for later search.
-  if(from_node_ptr->num_fanouts() > to_node_ptr->num_fanins()) {
-    edgelist_ptr = from_node_ptr->fanout_ptr();
+  for(const auto& e : node_ptr->fanout()) {
+    if(e->edge_type() != RCTREE_EDGE_TYPE) continue;
+    rctree_node_pt rctree_node_ptr = e->to_node_ptr()->pin_ptr()->rctree_node_ptr();
+    if(rctree_node_ptr == nullptr) continue;
+    EL_RF_ITER(el, rf) {
+      values.push_back(rctree_node_ptr->delay(el, rf));
+      values.push_back(rctree_node_ptr->impulse(el, rf));
+    }
   }
-  else {
-    edgelist_ptr = to_node_ptr->fanin_ptr();
+
+  for(size_t c=0; c<num_corners(); ++c) {
+
+    EL_RF_ITER(el, rf) {
+      values.push_back(rctree_ptr->corner_load(c, el, rf));
+    }
+
+    for(const auto& e : node_ptr->fanout()) {
+      if(e->edge_type() != RCTREE_EDGE_TYPE) continue;
+      rctree_node_pt rctree_node_ptr = e->to_node_ptr()->pin_ptr()->rctree_node_ptr();
+      if(rctree_node_ptr == nullptr) continue;
+      EL_RF_ITER(el, rf) {
+        values.push_back(rctree_node_ptr->corner_delay(c, el, rf));
+        values.push_back(rctree_node_ptr->corner_impulse(c, el, rf));
+      }
+    }
   }
-  
-  // Search the edge.
-  for(const auto& e : *edgelist_ptr) {
-    if(e->from_node_ptr() == from_node_ptr && e->to_node_ptr() == to_node_ptr)  {
-      return e;
+}
+
+// Procedure: _backward_propagate_change
+// Propagate the required arrival time of a given node pointer and mark its fanin nodes for the
+// backward propagation if the required arrival time differs from the value last propagated to
+// the fanin by more than the timing change epsilon.
+void_t Timer::_backward_propagate_change(node_pt node_ptr) {
+
+  _journal_node(node_ptr);
+
+  _backward_propagate_rat(node_ptr);
+  _backward_propagate_corner_rat(node_ptr);
+
+  bool_t is_changed = false;
+
+  EL_RF_ITER(el, rf) {
+    if(_is_timing_changed(node_ptr->propagated_rat(el, rf), node_ptr->rat(el, rf))) {
+      is_changed = true;
     }
   }
 
-  return nullptr;
-}
+  for(size_t c=0; c<node_ptr->num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      if(_is_timing_changed(node_ptr->corner_propagated_rat(c, el, rf), node_ptr->corner_rat(c, el, rf))) {
+        is_changed = true;
+      }
+    }
+  }
 
-// Procedure: remove_node
-// Remove a node from the design. The node must be disconnected from the design using the
-// procedure "_remove_edge" before it can be removed and deleted. Notice that if the node
-// is deleted from the design, it should be removed from the pipeline if it was inserted 
-// to the pipeline before. By default, the node is isolated.
-void_t Timer::_remove_node(node_pt node_ptr) {
-  _remove_frontier(node_ptr);
-  nodeset_ptr()->remove(node_ptr->idx());
-}
+  if(!is_changed) return;
 
-// Procedure: remove_edge
-// Remove an edge from the design. The procedure first disconnects the edge from its two ending
-// nodes, "from_node" and "to_node". Then it removes the edge from the design and insert both
-// "from_node" and "to_node" into the pipeline.
-void_t Timer::_remove_edge(edge_pt edge_ptr) {
+  EL_RF_ITER(el, rf) {
+    node_ptr->set_propagated_rat(el, rf, node_ptr->rat(el, rf));
+  }
 
-  _remove_jump(edge_ptr->from_node_ptr());
-  _remove_jump(edge_ptr->to_node_ptr());
-  edge_ptr->from_node_ptr()->remove_fanout(edge_ptr);
-  edge_ptr->to_node_ptr()->remove_fanin(edge_ptr);
-  _insert_frontier(edge_ptr->to_node_ptr());
-  _insert_frontier(edge_ptr->from_node_ptr());
-  edgelist_ptr()->remove(edge_ptr->edgelist_satellite());
+  for(size_t c=0; c<node_ptr->num_corners(); ++c) {
+    EL_RF_ITER(el, rf) {
+      node_ptr->set_corner_propagated_rat(c, el, rf, node_ptr->corner_rat(c, el, rf));
+    }
+  }
 
-  delete edge_ptr;
+  for(const auto& e : node_ptr->fanin()) {
+    #pragma omp atomic write
+    _is_fanout_changed[e->from_node_ptr()->idx()] = 1;
+  }
 }
 
-// Procedure: _update_forward_propagate_pipeline
-// The procedure builds the pipeline for forward propagation. Starting from nodes in the lowest
-// level, the procedure iteratively updates the level of these nodes based on the fanin level.
-// Then the node insert all fanout of each node that was being iterated. In other words, in the
-// end of the procedure, the pipelins consists of all the fanout nodes of those initial node 
-// residing in the lowest starting level.
-void_t Timer::_update_forward_propagate_pipeline() {
-  
+// Procedure: _init_timing_change
+// Mark every node residing in the pipeline as the source of the timing change. This procedure
+// must be called before the pipeline is expanded to the fanout cone.
+void_t Timer::_init_timing_change() {
   for(int_t l=pipeline_ptr()->min_level(); l<=pipeline_ptr()->max_level(); ++l) {
-    _forward_propagate_fanout(l);
+    
+    nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(l);
+
+    if(nodelist_ptr == nullptr) continue;
+
+    for(NodelistIter i(nodelist_ptr); i(); ++i) {
+      i.node_ptr()->set_is_timing_dirty(true);
+    }
   }
 }
 
@@ -1885,6 +3519,7 @@ void_t Timer::_forward_propagate_rc_timing(node_pt node_ptr) {
 
   if(net_ptr == nullptr || net_ptr->rctree_ptr() == nullptr) return;
   net_ptr->rctree_ptr()->update_rc_timing();
+  net_ptr->rctree_ptr()->update_corner_rc_timing(_corner_uptrs);
 }
 
 // Procedure: _forward_propagate_delay
@@ -1992,7 +3627,7 @@ void_t Timer::_forward_propagate_at(node_pt to_node_ptr) {
     if(to_node_ptr->is_primary_input()) {
       EL_RF_ITER(el, rf) {
         to_node_ptr->set_at(el, rf, to_node_ptr->pin_ptr()->primary_input_ptr()->at(el, rf));
-        if(_clock_tree_root_node_ptr() == to_node_ptr) {
+        if(_is_clock_tree_root(to_node_ptr)) {
           to_node_ptr->set_is_at_clocked(el, rf, true);
         }
       }
@@ -2040,9 +3675,9 @@ void_t Timer::_forward_propagate_at(node_pt to_node_ptr) {
 }
 
 // Procedure: _backward_propagate_fanin
-// Propagate the level and insert all fanin cone of the nodelist to a given level. This procedure
-// is called before the propagation of required arrival time, which constructs the nodes that need
-// to update the rat value.
+// Propagate the level and insert the affected fanin nodes of the nodelist to a given level. This 
+// procedure is called after the propagation of required arrival time, which constructs the nodes
+// that need to update the rat value.
 void_t Timer::_backward_propagate_fanin(int_t level) {
 
   nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(level);
@@ -2055,9 +3690,9 @@ void_t Timer::_backward_propagate_fanin(int_t level) {
 }
 
 // Procedure: _backward_propagate_fanin
-// Propagate the level and insert all fanin cone of the node. This procedure is called before the 
-// propagation of required arrival time, which constructs the nodes that need to update the rat 
-// value. All the levels should be legal now after the forward propagation.
+// Propagate the level and insert the fanin nodes whose required arrival time is affected by the
+// change of their fanout. This procedure is called after the propagation of required arrival time
+// on the given node. All the levels should be legal now after the forward propagation.
 void_t Timer::_backward_propagate_fanin(node_pt to_node_ptr) {
   
   if(to_node_ptr == nullptr) {
@@ -2065,7 +3700,9 @@ void_t Timer::_backward_propagate_fanin(node_pt to_node_ptr) {
   }
 
   for(auto& e : to_node_ptr->fanin()) {
-    _insert_frontier(e->from_node_ptr());
+    if(_is_fanout_changed[e->from_node_ptr()->idx()]) {
+      _insert_frontier(e->from_node_ptr());
+    }
   }
 }
 
@@ -2222,41 +3859,314 @@ void_t Timer::_forward_propagate_slew(node_pt to_node_ptr) {
         }
         else {                                                 // Propagate the slew.
           EL_RF_ITER(el, rf) {
-            float_t rctree_si = e->from_node_ptr()->slew(el, rf);
-            float_t rctree_so = rctree_ptr->slew(to_node_ptr->pin_ptr()->rctree_node_ptr(), el, rf, rctree_si);
-            to_node_ptr->relax_slew(el, rf, rctree_so);
+            float_t rctree_si = e->from_node_ptr()->slew(el, rf);
+            float_t rctree_so = rctree_ptr->slew(to_node_ptr->pin_ptr()->rctree_node_ptr(), el, rf, rctree_si);
+            to_node_ptr->relax_slew(el, rf, rctree_so);
+          }
+        }
+      break;
+      // Case 2: Combinational propagation.
+      case COMBINATIONAL_EDGE_TYPE:
+        EL_RF_RF_ITER(el, irf, orf) {
+
+          timing_arc_ptr = e->timing_arc_ptr(el);
+          
+          if(!timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+
+          CL = to_node_ptr->pin_ptr()->load(el, orf);
+          so = timing_arc_ptr->slew(irf, orf, e->from_node_ptr()->slew(el, irf), CL);
+          to_node_ptr->relax_slew(el, orf, so);
+        }
+      break;
+      // Case 3: Constraint.
+      case CONSTRAINT_EDGE_TYPE:
+      break;
+      // Case 4: Assertion failure.
+      default:
+        LOG(ERROR) << "Failed to propagate slew (EdgeType exception)";
+        return;
+      break;
+    }
+  }         
+}
+
+// Function: _corner_load
+// Query the load capacitance at a given pin in a corner, in the same way as the pin load of the
+// default libraries, with the corner scales of the wire capacitance and the corner capacitance
+// of the cellpins.
+float_t Timer::_corner_load(pin_pt pin_ptr, corner_pt corner_ptr, int el, int rf) const {
+  
+  // Case 1: The pin is ever attached to a rctree node.
+  if(pin_ptr->rctree_node_ptr() != nullptr) {
+    return pin_ptr->rctree_node_ptr()->corner_load(corner_ptr->idx(), el, rf);
+  }
+
+  // Case 2: The pin is a rctree root.
+  if(pin_ptr->is_rctree_root()) {
+    net_pt net_ptr = pin_ptr->net_ptr();
+    if(net_ptr == nullptr) return OT_FLT_ZERO;
+    float_t load = net_ptr->total_leaf_cap(el, rf);
+    for(const auto& p : net_ptr->pinlist()) {
+      if(p->is_rctree_root()) continue;
+      load += corner_ptr->cap(p, el, rf) - p->cap(el, rf);
+    }
+    return load;
+  }
+
+  // Case 3: The pin is neither attached to a rctree nor a net.
+  return corner_ptr->cap(pin_ptr, el, rf);
+}
+
+// Procedure: _forward_propagate_corner_slew
+// Update the slew of every corner at a given node pointer "to_node_ptr" via fanin propagation,
+// in the same way as the slew of the default libraries.
+void_t Timer::_forward_propagate_corner_slew(node_pt to_node_ptr) {
+
+  if(to_node_ptr == nullptr || _corner_uptrs.empty()) return;
+
+  // No fanin - obtain the slew from primary input.
+  if(to_node_ptr->num_fanins() == 0) {
+    if(to_node_ptr->is_primary_input()) {
+      for(size_t c=0; c<num_corners(); ++c) {
+        EL_RF_ITER(el, rf) {
+          to_node_ptr->set_corner_slew(c, el, rf, to_node_ptr->pin_ptr()->primary_input_ptr()->slew(el, rf));
+        }
+      }
+    }
+    return;
+  }
+  
+  to_node_ptr->remove_corner_slew();
+
+  rctree_pt rctree_ptr;
+  timing_arc_pt timing_arc_ptr;
+
+  for(auto& e : to_node_ptr->fanin()) {
+    for(const auto& corner_uptr : _corner_uptrs) {
+
+      size_t c = corner_uptr->idx();
+
+      switch(e->edge_type()) {
+        // Case 1: RC propagation.
+        case RCTREE_EDGE_TYPE:
+          rctree_ptr = e->net_ptr()->rctree_ptr();
+          EL_RF_ITER(el, rf) {
+            float_t si = e->from_node_ptr()->corner_slew(c, el, rf);
+            float_t so = (rctree_ptr == nullptr) ? si : 
+                         rctree_ptr->corner_slew(to_node_ptr->pin_ptr()->rctree_node_ptr(), c, el, rf, si);
+            to_node_ptr->relax_corner_slew(c, el, rf, so);
+          }
+        break;
+        // Case 2: Combinational propagation.
+        case COMBINATIONAL_EDGE_TYPE:
+          EL_RF_RF_ITER(el, irf, orf) {
+
+            timing_arc_ptr = e->corner_timing_arc_ptr(c, el);
+            
+            if(!timing_arc_ptr || !timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+
+            to_node_ptr->relax_corner_slew(c, el, orf, timing_arc_ptr->slew(
+              irf, 
+              orf, 
+              e->from_node_ptr()->corner_slew(c, el, irf), 
+              _corner_load(to_node_ptr->pin_ptr(), corner_uptr.get(), el, orf)
+            ));
+          }
+        break;
+        // Case 3: Constraint.
+        default:
+        break;
+      }
+    }
+  }         
+}
+
+// Procedure: _forward_propagate_corner_delay
+// Update the delay of every corner on the fanin edges to a given node pointer "to_node_ptr", in
+// the same way as the delay of the default libraries.
+void_t Timer::_forward_propagate_corner_delay(node_pt to_node_ptr) {
+  
+  if(to_node_ptr == nullptr || _corner_uptrs.empty()) return;
+
+  rctree_pt rctree_ptr;
+  timing_arc_pt timing_arc_ptr;
+
+  for(auto& e : to_node_ptr->fanin()) {
+    for(const auto& corner_uptr : _corner_uptrs) {
+
+      size_t c = corner_uptr->idx();
+
+      switch(e->edge_type()) {
+        // Case 1: RC tree propagation.
+        case RCTREE_EDGE_TYPE:
+          rctree_ptr = e->net_ptr()->rctree_ptr();
+          if(rctree_ptr != nullptr) {
+            rctree_node_pt to_rctree_node_ptr = to_node_ptr->pin_ptr()->rctree_node_ptr();
+            EL_RF_RF_ITER(el, irf, orf) {
+              e->set_corner_delay(c, el, irf, orf, to_rctree_node_ptr->corner_delay(c, el, orf));
+            }
+          }
+        break;
+        // Case 2: Combinational propagation.
+        case COMBINATIONAL_EDGE_TYPE:
+          EL_RF_RF_ITER(el, irf, orf) {
+
+            timing_arc_ptr = e->corner_timing_arc_ptr(c, el);
+
+            if(!timing_arc_ptr || !timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+
+            e->set_corner_delay(c, el, irf, orf, timing_arc_ptr->delay(
+              irf, 
+              orf, 
+              e->from_node_ptr()->corner_slew(c, el, irf), 
+              _corner_load(to_node_ptr->pin_ptr(), corner_uptr.get(), el, orf)
+            ));
+          }
+        break;
+        // Case 3: Constraint.
+        default:
+        break;
+      }
+    }
+  }
+}
+
+// Procedure: _forward_propagate_corner_at
+// Update the arrival time of every corner at a given node pointer "to_node_ptr" via fanin
+// propagation, in the same way as the arrival time of the default libraries.
+void_t Timer::_forward_propagate_corner_at(node_pt to_node_ptr) {
+  
+  if(to_node_ptr == nullptr || _corner_uptrs.empty()) return;
+
+  // No fanin.
+  if(to_node_ptr->num_fanins() == 0) {
+    if(to_node_ptr->is_primary_input()) {
+      for(size_t c=0; c<num_corners(); ++c) {
+        EL_RF_ITER(el, rf) {
+          to_node_ptr->set_corner_at(c, el, rf, to_node_ptr->pin_ptr()->primary_input_ptr()->at(el, rf));
+        }
+      }
+    }
+    return;
+  }
+  
+  to_node_ptr->remove_corner_at();
+
+  timing_arc_pt timing_arc_ptr;
+  
+  for(auto& e : to_node_ptr->fanin()) {
+    for(size_t c=0; c<num_corners(); ++c) {
+      switch(e->edge_type()) {
+        // Case 1: RC tree propagation.
+        case RCTREE_EDGE_TYPE:
+          EL_RF_ITER(el, rf) {
+            to_node_ptr->relax_corner_at(
+              c, el, rf, e->from_node_ptr()->corner_at(c, el, rf) + e->corner_delay(c, el, rf, rf)
+            );
+          }
+        break;
+        // Case 2: Combinational propagation.
+        case COMBINATIONAL_EDGE_TYPE:
+          EL_RF_RF_ITER(el, irf, orf) {
+
+            timing_arc_ptr = e->corner_timing_arc_ptr(c, el);
+            
+            if(!timing_arc_ptr || !timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+
+            to_node_ptr->relax_corner_at(
+              c, el, orf, e->from_node_ptr()->corner_at(c, el, irf) + e->corner_delay(c, el, irf, orf)
+            );
+          }
+        break;
+        // Case 3: Constraint.
+        default:
+        break;
+      }
+    }
+  }                 
+}
+
+// Procedure: _backward_propagate_corner_rat
+// Update the required arrival time of every corner at a given node pointer "from_node_ptr" via
+// fanout propagation, in the same way as the required arrival time of the default libraries. The
+// rat of a constrained node comes from the pre-cppr rat of its test, and hence the corner rat
+// and slack are pre-cppr.
+void_t Timer::_backward_propagate_corner_rat(node_pt from_node_ptr) {
+ 
+  if(from_node_ptr == nullptr || from_node_ptr->num_corners() == 0) return;
+
+  // No fanout - obtain rat from 1) primary output or 2) hold/setup test at FF.
+  if(from_node_ptr->num_fanouts() == 0) {
+    if(from_node_ptr->is_constrained()) {
+      test_pt test_ptr = from_node_ptr->pin_ptr()->test_ptr();
+      for(size_t c=0; c<from_node_ptr->num_corners(); ++c) {
+        EL_RF_ITER(el, rf) {
+          from_node_ptr->set_corner_rat(c, el, rf, test_ptr->corner_rat(c, el, rf));
+        }
+      }
+    }
+    return;
+  }
+  
+  from_node_ptr->remove_corner_rat();
+
+  timing_arc_pt timing_arc_ptr;
+  float_t rat;
+  
+  for(auto& e : from_node_ptr->fanout()) {
+
+    node_pt to_node_ptr = e->to_node_ptr();
+
+    for(size_t c=0; c<from_node_ptr->num_corners(); ++c) {
+      switch(e->edge_type()) {
+        // Case 1: RC propagation.
+        case RCTREE_EDGE_TYPE:
+          EL_RF_ITER(el, rf) {
+            from_node_ptr->relax_corner_rat(
+              c, el, rf, to_node_ptr->corner_rat(c, el, rf) - e->corner_delay(c, el, rf, rf)
+            );
           }
-        }
-      break;
-      // Case 2: Combinational propagation.
-      case COMBINATIONAL_EDGE_TYPE:
-        EL_RF_RF_ITER(el, irf, orf) {
+        break;
+        // Case 2: Combinational propagation.
+        case COMBINATIONAL_EDGE_TYPE:
+          EL_RF_RF_ITER(el, irf, orf) {
 
-          timing_arc_ptr = e->timing_arc_ptr(el);
-          
-          if(!timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+            timing_arc_ptr = e->corner_timing_arc_ptr(c, el);
 
-          CL = to_node_ptr->pin_ptr()->load(el, orf);
-          so = timing_arc_ptr->slew(irf, orf, e->from_node_ptr()->slew(el, irf), CL);
-          to_node_ptr->relax_slew(el, orf, so);
-        }
-      break;
-      // Case 3: Constraint.
-      case CONSTRAINT_EDGE_TYPE:
-      break;
-      // Case 4: Assertion failure.
-      default:
-        LOG(ERROR) << "Failed to propagate slew (EdgeType exception)";
-        return;
-      break;
+            if(!timing_arc_ptr || !timing_arc_ptr->is_transition_defined(irf, orf)) continue;
+
+            rat = to_node_ptr->corner_rat(c, el, orf) - e->corner_delay(c, el, irf, orf); 
+            from_node_ptr->relax_corner_rat(c, el, irf, rat);
+          }
+        break;
+        // Case 3: Constraint propagation.
+        case CONSTRAINT_EDGE_TYPE:
+          EL_RF_RF_ITER(el, ck_rf, d_rf) {
+
+            timing_arc_ptr = e->corner_timing_arc_ptr(c, el);
+            
+            if(!timing_arc_ptr || !timing_arc_ptr->is_transition_defined(ck_rf, d_rf)) continue;
+
+            if(el == EARLY) {
+              rat = from_node_ptr->corner_at(c, LATE, ck_rf) + to_node_ptr->corner_slack(c, EARLY, d_rf);
+              from_node_ptr->relax_corner_rat(c, LATE, ck_rf, rat);
+            }
+            else {
+              rat = from_node_ptr->corner_at(c, EARLY, ck_rf) - to_node_ptr->corner_slack(c, LATE, d_rf);
+              from_node_ptr->relax_corner_rat(c, EARLY, ck_rf, rat);
+            }
+          }
+        break;  
+        default:
+        break;
+      }
     }
-  }         
+  }
 }
 
 // Procedure: _forward_propagate_jump
-// The procedure constructs the jump to a given node. The jump exists only when the given
-// node is a head of the jump, where we have to traverse through the fanin cone of the given
-// node to obtain a tree and then build a jump from every leave to the given root node.
+// The procedure invalidates the jumps that are affected by the timing change of the nodes in
+// a given level.
 void_t Timer::_forward_propagate_jump(int_t level) {
 
   nodelist_pt nodelist_ptr = pipeline_ptr()->nodelist_ptr(level);
@@ -2269,76 +4179,196 @@ void_t Timer::_forward_propagate_jump(int_t level) {
 }
 
 // Procedure: _forward_propagate_jump
-// The procedure constructs the jump to a given node. The jump exists only when the given
-// node is a head of the jump, where we have to traverse through the fanin cone of the given
-// node to obtain a tree and then build a jump from every leave to the given root node.
+// The procedure invalidates the jumps that are affected by the timing change of a given node.
+// The jumps are not rebuilt here but lazily by the time a path query needs them.
 void_t Timer::_forward_propagate_jump(node_pt node_ptr) {
 
   if(node_ptr == nullptr) return;
 
-  // Remove all the jumps that are previously attached to this node.
-  _remove_jump(node_ptr);
-  
-  // Return if the give node is not a head.
-  if(/*node_ptr->is_in_clock_tree() || */!node_ptr->is_jump_head()) return;
+  _enable_jump_update(node_ptr);
+}
 
-  //printf("jump head found: %s\n", node_ptr->pin_ptr()->name().c_str());
-  
-  // Construct the fanin tree and then connect jumps from all leaves to the root.
-  float_t d[2][2] = {
-    {OT_DEFAULT_EDGE_DELAY, OT_DEFAULT_EDGE_DELAY},
-    {OT_DEFAULT_EDGE_DELAY, OT_DEFAULT_EDGE_DELAY}
-  };
-  
-  // Backward induce the jump edge to the node_ptr.
-  _induce_jump(node_ptr, node_ptr, 0, d);
+// Procedure: _enable_jump_update
+// Mark the given node and every node on its single-fanout chain up to the jump head as dirty.
+// The delays of the fanin edges of the node are part of the jumps of that head, which must be
+// induced again before the next path query. The walk stops early at a node that is already
+// dirty since the rest of the chain has been marked by the same pending rebuild.
+void_t Timer::_enable_jump_update(node_pt node_ptr) {
+
+  while(node_ptr != nullptr) {
+
+    if(node_ptr->mark_jump_dirty()) return;
+
+    #pragma omp critical(OT_JUMPSET_CRITICAL)
+    {
+      _jump_dirty_node_idxs.push_back(node_ptr->idx());
+    }
+
+    if(node_ptr->is_jump_head()) return;
+
+    node_ptr = node_ptr->fanout_ptr()->head()->item()->to_node_ptr();
+  }
 }
 
-// Procedure: _induce_jump
-// The procedure constructs the jump to a given node. The jump exists only when the given
-// node is a head of the jump, where we have to traverse through the fanin cone of the given
-// node to obtain a tree and then build a jump from every leave to the given root node.
-void_t Timer::_induce_jump(node_pt v, node_pt root, int_t negs, float_t dv[][2]) {
-  
-  // Already reach the jump tail. Notice that we shouldn't consider the "loop-like" jump.
-  if(v->is_jump_tail()) {
-    if(v != root) {
-      _insert_jump(v, root, negs, dv);     
+// Procedure: _update_jumps
+// Rebuild the jumps that are affected by the dirty nodes. The procedure collects the affected
+// heads, i.e., the dirty heads, the dirty nodes that still carry stale fanin jumps, and the heads
+// of the jumps leaving a dirty node. The stale fanin jumps of every affected head are removed
+// and the heads are induced in parallel. The jumpset is only modified by the calling thread.
+// The dirty list keeps node indices and is compacted here: an index whose node has been removed
+// since, or reused by a node that is not dirty, is skipped.
+void_t Timer::_update_jumps() {
+
+  if(_jump_dirty_node_idxs.empty()) return;
+
+  node_ptr_vt dirty_node_ptrs;
+  node_ptr_vt heads;
+
+  for(const auto& idx : _jump_dirty_node_idxs) {
+    node_pt node_ptr = nodeset()[idx];
+    if(node_ptr == nullptr || !node_ptr->is_jump_dirty()) continue;
+    node_ptr->set_is_jump_dirty(false);
+    dirty_node_ptrs.push_back(node_ptr);
+  }
+
+  __clear_vector(_jump_dirty_node_idxs);
+
+  for(const auto& node_ptr : dirty_node_ptrs) {
+    if(node_ptr->is_jump_head() || node_ptr->num_jumpins()) {
+      heads.push_back(node_ptr);
+    }
+    for(const auto& j : node_ptr->jumpout()) {
+      heads.push_back(j->to_node_ptr());
     }
-    return;
   }
 
-  float_t du[2][2];
-  int vrf;
-  
-  // Recursively traverse the fanin of the nodes.
-  for(auto& e : v->fanin()) {
+  sort(heads.begin(), heads.end());
+  heads.erase(unique(heads.begin(), heads.end()), heads.end());
 
-    if(e->edge_type() == CONSTRAINT_EDGE_TYPE /*|| e->from_node_ptr()->is_in_clock_tree()*/) continue;
+  // Remove the stale jumps. Removing a jump flags its head for the timing update, which is not
+  // the case here since the timing of the heads is already up-to-date.
+  jump_pt jump_ptr;
+  bool_vt is_timing_dirty(heads.size());
+
+  for(size_t i=0; i<heads.size(); ++i) {
+    is_timing_dirty[i] = heads[i]->is_timing_dirty();
+    for(NodeJumpinIter j(heads[i]); j();) {
+      jump_ptr = j.jump_ptr();
+      ++j;
+      _remove_jump(jump_ptr);
+    }
+    heads[i]->set_is_timing_dirty(is_timing_dirty[i]);
+  }
+
+  // Induce the jumps of each head in parallel. The induction only reads the timing graph.
+  jump_mt jumps(heads.size());
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(size_t i=0; i<heads.size(); ++i) {
+    if(heads[i]->is_jump_head()) {
+      _induce_jump(heads[i], jumps[i]);
+    }
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  for(size_t i=0; i<heads.size(); ++i) {
+    for(const auto& jump : jumps[i]) {
+      _insert_jump(jump);
+    }
+  }
+
+}
+
+// Procedure: _induce_jump
+// The procedure constructs the jumps to a given head. The fanin cone of the head is traversed
+// backward down to the jump tails in non-increasing level order, and each node keeps only the
+// best delay (minimum for early and maximum for late) among all its paths to the head, for each
+// parity of the negative unate edges on the path. The induction is therefore linear in the cone
+// size regardless of the reconvergence. A jump is produced for every tail other than the head.
+void_t Timer::_induce_jump(node_pt root, jump_vrt jumps) const {
+
+  jumps.clear();
+
+  // Notice that we shouldn't consider the "loop-like" jump.
+  if(root->is_jump_tail()) return;
+
+  // Each induced state is a jump from the visited node to the root. The state is indexed by the
+  // node index together with the parity of the negative unate edges on the path.
+  jump_vt states;
+  unordered_map < int_t, size_t > state_idx;
+  std::priority_queue < pair<int_t, size_t> > frontier;
+
+  states.emplace_back();
+  states.back().set_from_node_ptr(root);
+  states.back().set_to_node_ptr(root);
+  states.back().set_timing_sense(POSITIVE_UNATE);
+  EL_RF_ITER(el, rf) {
+    states.back().set_delay(el, rf, rf, OT_DEFAULT_EDGE_DELAY);
+  }
+  state_idx[root->idx() << 1] = 0;
+  frontier.emplace(root->level(), 0);
+
+  int_t key, negs, vrf, urf;
+  size_t s;
+  float_t d;
+
+  while(!frontier.empty()) {
+
+    size_t v = frontier.top().second;
+    frontier.pop();
+    
+    node_pt v_ptr = states[v].from_node_ptr();
+
+    // Already reach the jump tail.
+    if(v != 0 && v_ptr->is_jump_tail()) {
+      jumps.push_back(states[v]);
+      continue;
+    }
+
+    negs = states[v].timing_sense() == NEGATIVE_UNATE;
+
+    for(const auto& e : v_ptr->fanin()) {
+
+      if(e->edge_type() == CONSTRAINT_EDGE_TYPE) continue;
+
+      if(e->timing_sense() != POSITIVE_UNATE && e->timing_sense() != NEGATIVE_UNATE) {
+        LOG(ERROR) << "Failed to induce jump (EdgeType exception)";
+        continue;
+      }
 
-    switch(e->timing_sense()) {
+      int_t unegs = negs ^ (e->timing_sense() == NEGATIVE_UNATE);
       
-      case NEGATIVE_UNATE:
-        EL_RF_ITER(el, rf) {
-          vrf = rf ^ (negs & 1);
-          du[el][rf] = dv[el][rf] + e->delay(el, !vrf, vrf);
-        }
-        _induce_jump(e->from_node_ptr(), root, negs + 1, du);
-      break;
+      key = (e->from_node_ptr()->idx() << 1) | unegs;
+
+      auto itr = state_idx.find(key);
+      bool_t is_new = (itr == state_idx.end());
       
-      case POSITIVE_UNATE:
-        EL_RF_ITER(el, rf) {
-          vrf = rf ^ (negs & 1);
-          du[el][rf] = dv[el][rf] + e->delay(el, vrf, vrf);
-        }
-        _induce_jump(e->from_node_ptr(), root, negs, du);
-      break;
+      if(is_new) {
+        s = states.size();
+        state_idx[key] = s;
+        states.emplace_back();
+        states[s].set_from_node_ptr(e->from_node_ptr());
+        states[s].set_to_node_ptr(root);
+        states[s].set_timing_sense(unegs ? NEGATIVE_UNATE : POSITIVE_UNATE);
+        frontier.emplace(e->from_node_ptr()->level(), s);
+      }
+      else s = itr->second;
 
-      default:
-        LOG(ERROR) << "Failed to induce jump (EdgeType exception)";
-        return;
-      break;
-    }  
+      // Merge the delay of the path through the edge into the state of the fanin node.
+      EL_RF_ITER(el, rf) {
+        vrf = rf ^ negs;
+        urf = rf ^ unegs;
+        d = states[v].delay(el, vrf, rf) + e->delay(el, urf, vrf);
+        if(is_new) {
+          states[s].set_delay(el, urf, rf, d);
+        }
+        else if(el == EARLY) {
+          states[s].set_delay(el, urf, rf, min(states[s].delay(el, urf, rf), d));
+        }
+        else {
+          states[s].set_delay(el, urf, rf, max(states[s].delay(el, urf, rf), d));
+        }
+      }
+    }
   }
 }
 
@@ -2396,7 +4426,14 @@ void_t Timer::_forward_propagate_test(test_pt test_ptr) {
   if(test_ptr == nullptr) return;
   
   // Update the pre-CPPR rat of the test.
-  test_ptr->update_rat(circuit_ptr()->clock_tree_ptr());
+  test_ptr->update_rat(circuit_ptr()->clock_tree_ptr(test_ptr->related_node_ptr()));
+
+  // Update the pre-CPPR rat of the test in every corner.
+  for(const auto& corner_uptr : _corner_uptrs) {
+    test_ptr->update_corner_rat(
+      corner_uptr.get(), circuit_ptr()->clock_tree_ptr(test_ptr->related_node_ptr())
+    );
+  }
 
   // Update the pre-CPPR slack of the test. 
   EL_RF_ITER(el, rf) {
@@ -2410,7 +4447,8 @@ void_t Timer::_forward_propagate_test(test_pt test_ptr) {
     EL_RF_ITER(el, rf) {
       if(test_ptr->endpoint_ptr(el, rf)->slack() <= cutoff_slack(el, rf)) {
         if(test_ptr->constrained_node_ptr()->is_at_clocked(el, rf)) {
-          CPPR cppr(test_ptr->endpoint_ptr(el, rf), nullptr, circuit_ptr()->clock_tree_ptr(), 1);
+          CPPR cppr(test_ptr->endpoint_ptr(el, rf), nullptr, 
+                    circuit_ptr()->clock_tree_ptr(test_ptr->related_node_ptr()), 1);
           test_ptr->endpoint_ptr(el, rf)->set_slack(cppr.report_worst_slack(1));
         }
       }
@@ -2420,13 +4458,20 @@ void_t Timer::_forward_propagate_test(test_pt test_ptr) {
   // Update the heap position for each endpoint of the test.
   #pragma omp critical
   {
-    EL_RF_ITER(el, rf) {
-      if(test_ptr->endpoint_ptr(el, rf)->slack() > cutoff_slack(el, rf)) {
-        endpoint_minheap_ptr()->remove(test_ptr->endpoint_ptr(el, rf));
-      }
-      else {
-        endpoint_minheap_ptr()->update(test_ptr->endpoint_ptr(el, rf));
-      }
+    _update_endpoint_minheap(test_ptr);
+  }
+}
+
+// Procedure: _update_endpoint_minheap
+// Update the heap position for each endpoint of the given test. Endpoints whose slack is above
+// the cutoff slack are removed from the heap.
+void_t Timer::_update_endpoint_minheap(test_pt test_ptr) {
+  EL_RF_ITER(el, rf) {
+    if(test_ptr->endpoint_ptr(el, rf)->slack() > cutoff_slack(el, rf)) {
+      endpoint_minheap_ptr()->remove(test_ptr->endpoint_ptr(el, rf));
+    }
+    else {
+      endpoint_minheap_ptr()->update(test_ptr->endpoint_ptr(el, rf));
     }
   }
 }
@@ -2455,63 +4500,334 @@ void_t Timer::_get_fanout_test_ptrs(pin_pt through_pin_ptr, test_ptr_vrt test_pt
   que.push(u);
   visited[u->idx()] = true;
 
-  while(!que.empty()) {
+  while(!que.empty()) {
+
+    u = que.front();
+    que.pop();
+
+    if(u->is_constrained()) {
+      test_ptrs.push_back(u->pin_ptr()->test_ptr());
+    }
+
+    for(auto& e : u->fanout()) {
+      v = e->to_node_ptr();
+      if(e->edge_type() == CONSTRAINT_EDGE_TYPE) continue;
+      if(!visited[v->idx()]) {
+        que.push(v);
+        visited[v->idx()] = true;
+      }
+    }
+  }
+}
+
+// Procedure: _get_endpoint_ptrs
+// Extract the endpoints from a given vector of tests. A endpoint is defined with respect to a
+// given test with timing split (early or late) and timing transition (rise or fall) specified
+// explicitly. That is, a test can contribute to up to four endpoints.
+void_t Timer::_get_endpoint_ptrs(test_ptr_vrt test_ptrs, endpoint_ptr_vrt endpoint_ptrs) {
+  
+  // Storage initialization.
+  endpoint_ptrs.clear();
+  endpoint_ptrs.reserve(test_ptrs.size() << 2);
+
+  // Extract the endpoint pointers from the tests.
+  for(unsigned_t i=0; i<test_ptrs.size(); ++i) {
+    EL_RF_ITER(el, rf) {
+      endpoint_ptrs.push_back(test_ptrs[i]->endpoint_ptr(el, rf)); 
+    }
+  }
+}
+
+// Procedure: _update_endpoint_slacks
+// Update the slack at each endpoint. The procedure copies the slack from the node to the test
+// point if the given through pin is a nullptr pointer. Otherwise, the we need to reperform the CPPR
+// analysis by specifying the through pin as it might affect the true CPPR slack.
+void_t Timer::_update_endpoint_slacks(pin_pt through_pin_ptr, endpoint_ptr_vrt endpoint_ptrs){
+  
+  // The through  pin is not specified where we can directly copy the node slack to the
+  // endpoint slack.
+  if(through_pin_ptr == nullptr) return;
+
+  // The through pin is specified where we need to recompute the true worst cppr slack with respect 
+  // to a given pin_ptr.
+  _update_jumps();
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t i=0; i<endpoint_ptrs.size(); ++i) {
+    if(endpoint_ptrs[i]->slack() > cutoff_slack(endpoint_ptrs[i]->el(), endpoint_ptrs[i]->rf()) || 
+       through_pin_ptr->test_ptr()) continue;
+    CPPR cppr(endpoint_ptrs[i], through_pin_ptr, 
+              circuit_ptr()->clock_tree_ptr(endpoint_ptrs[i]->test_ptr()->related_node_ptr()), 1);
+    endpoint_ptrs[i]->set_slack(cppr.report_worst_slack(1));
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+}
+
+// Procedure: get_post_cppr_slacks
+// Report the worst post-CPPR slack of every endpoint in one bulk analysis instead of one CPPR
+// search per endpoint. The slack of the endpoint (el, rf) of the test at the testset index i is
+// stored at slacks[(i << 2) | (el << 1) | rf], and removed tests hold the undefined slack.
+//
+// A launching path is tagged at clock tree depth j by the depth-j ancestor of its launching clock
+// sink and the transition at that ancestor. The CPPR credit of a path is determined by the depth
+// m of the deepest common tag with the capturing clock pin, where m = -1 means no common path.
+// For every depth j, the procedure keeps the worst arrival and the worst arrival of a different
+// depth-j tag at every node, and all depths are propagated together in one level-order pass. The
+// worst arrival at the D pin whose depth-j tag differs from the capturing one covers every path
+// with m < j, and it is combined with the minimum credit of the capturing ancestors at depths
+// [j-1, d], where d is the depth of the capturing clock pin. The minimum over all depths is the
+// exact post-CPPR slack when the credit does not decrease from a clock tree node to its
+// children, which holds when no early delay exceeds its late counterpart. Otherwise the credit of
+// a path may be taken from a deeper ancestor and the minimum is only a pessimistic bound. The
+// condition is checked along the capturing clock path of every endpoint as the tags reach its D
+// pin, and the endpoints that fail it are recomputed by the per-endpoint CPPR search. Paths
+// launched directly from a clock root receive no credit.
+void_t Timer::get_post_cppr_slacks(float_vrt slacks) {
+
+  // Update the timing.
+  update_timing();
+
+  auto num_tests = circuit_ptr()->testset().num_indices();
+  
+  // Data declaration.
+  node_ptr_mt levellist;
+  int_t max_depth = OT_UNDEFINED_LEVEL;
+  
+  slacks.assign(num_tests << 2, OT_FLT_MAX);
+
+  // Levelize the nodes and find the deepest launching clock sink and capturing clock pin.
+  for(const auto& u : nodeset()) {
+    if(u->level() >= (int_t)levellist.size()) levellist.resize(u->level() + 1);
+    levellist[u->level()].push_back(u);
+    if(u->is_data_path_source() && u->clock_tree_ptr() && u->clock_tree_ptr()->level(u) > 0) {
+      max_depth = max(max_depth, u->clock_tree_ptr()->level(u));
+    }
+  }
+
+  for(const auto& t : circuit_ptr()->testset()) {
+    node_pt ck = t->related_node_ptr();
+    if(ck && ck->clock_tree_ptr() && ck->clock_tree_ptr()->root_pin_ptr()) {
+      max_depth = max(max_depth, ck->clock_tree_ptr()->level(ck));
+    }
+  }
+
+  // The pairs of the depths [0, max_depth + 1] are stored contiguously per el/rf.
+  endpoint_ptr_vt bound_endpoint_ptrs(num_tests << 2, nullptr);
+
+  _propagate_cppr_tags(max_depth + 2, levellist, slacks, bound_endpoint_ptrs);
+
+  // Recompute the endpoints whose slacks are only bounds by the per-endpoint CPPR search, with
+  // no cutoff slack such that non-negative slacks are exact as well.
+  unsigned_t num_bounds = 0;
+
+  for(unsigned_t e=0; e<slacks.size(); ++e) {
+    if(bound_endpoint_ptrs[e] == nullptr || slacks[e] == OT_FLT_MAX) continue;
+    bound_endpoint_ptrs[num_bounds++] = bound_endpoint_ptrs[e];
+  }
+
+  if(num_bounds) _update_jumps();
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t b=0; b<num_bounds; ++b) {
+    auto endpoint_ptr = bound_endpoint_ptrs[b];
+    auto test_ptr = endpoint_ptr->test_ptr();
+    CPPR cppr(endpoint_ptr, nullptr, circuit_ptr()->clock_tree_ptr(test_ptr->related_node_ptr()), 1,
+              nullptr, OT_FLT_MAX);
+    slacks[(test_ptr->idx() << 2) | (endpoint_ptr->el() << 1) | endpoint_ptr->rf()] = cppr.report_worst_slack(1);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  // Endpoints that are not reached by any launching path have undefined slacks.
+  for(unsigned_t e=0; e<slacks.size(); ++e) {
+    if(slacks[e] == OT_FLT_MAX) slacks[e] = Utility::undefined_slack((e >> 1) & 1);
+  }
+}
+
+// Procedure: _propagate_cppr_tags
+// Propagate in level order, for every clock tree depth j less than the given number of depths,
+// the two worst arrival times of different depth-j tags from the data path sources to every node.
+// A data path source launches its own arrival time under the tag of its depth-j clock tree
+// ancestor, or the undefined tag if it has no such ancestor. The post-CPPR slacks of the test of
+// a D pin are taken as soon as the pin has been propagated, and the endpoints whose slacks are
+// only bounds are stored at their slack positions. Only a working set of the pairs is kept: the
+// pairs of a node are released once all its fanout nodes have read them, so the memory follows
+// the widest span of live nodes rather than the size of the graph.
+void_t Timer::_propagate_cppr_tags(int_ct num_depths, node_ptr_mrt levellist, float_vrt slacks,
+                                   endpoint_ptr_vrt bound_endpoint_ptrs) {
+
+  auto num_indices = nodeset().num_indices();
+
+  cppr_tag_pair_mt pairs(num_indices);
+  int_vt num_readers(num_indices, 0);
+
+  // Count the fanout nodes that read the pairs of each node.
+  for(const auto& u : nodeset()) {
+    for(const auto& e : u->fanout()) {
+      if(_is_cppr_tag_edge(e)) ++num_readers[u->idx()];
+    }
+  }
+  
+  for(unsigned_t l=0; l<levellist.size(); ++l) {
+    
+    #pragma omp parallel for schedule(dynamic, 64)
+    for(unsigned_t i=0; i<levellist[l].size(); ++i) {
+
+      node_pt v = levellist[l][i];
+
+      cppr_tag_pair_vrt to = pairs[v->idx()];
+
+      to.resize(num_depths << 2);
+
+      EL_RF_ITER(el, vrf) {
+
+        auto V = ((el << 1) | vrf) * num_depths;
+
+        for(int_t j=0; j<num_depths; ++j) to[V + j].reset(el);
+
+        // Data path source.
+        if(v->is_data_path_source()) {
+
+          if(!Utility::is_finite_numeric(v->at(el, vrf))) continue;
+
+          clock_tree_pt clock_tree_ptr = v->clock_tree_ptr();
+          node_pt a = (clock_tree_ptr && clock_tree_ptr->level(v) > 0) ? v : nullptr;
+
+          for(int_t j=num_depths-1; j>=0; --j) {
+            while(a && clock_tree_ptr->level(a) > j) a = clock_tree_ptr->parent_node_ptr(a);
+            if(a && clock_tree_ptr->level(a) == j) {
+              to[V + j].insert(el, v->at(el, vrf), _encode_cppr_tag(a, v, vrf));
+            }
+            else {
+              to[V + j].insert(el, v->at(el, vrf), OT_UNDEFINED_IDX);
+            }
+          }
+          continue;
+        }
+
+        // Internal node.
+        for(auto& e : v->fanin()) {
+
+          if(!_is_cppr_tag_edge(e)) continue;
+          
+          const auto& from = pairs[e->from_node_ptr()->idx()];
+
+          RF_ITER(urf) {
+            
+            if(e->edge_type() == RCTREE_EDGE_TYPE) {
+              if(urf != vrf) continue;
+            }
+            else if(!e->timing_arc_ptr(el)->is_transition_defined(urf, vrf)) {
+              continue;
+            }
+
+            auto U = ((el << 1) | urf) * num_depths;
+            auto delay = e->delay(el, urf, vrf);
+
+            for(int_t j=0; j<num_depths; ++j) {
+              for(int k=0; k<2; ++k) {
+                auto at = from[U + j].at(k);
+                if(Utility::is_finite_numeric(at)) to[V + j].insert(el, at + delay, from[U + j].tag(k));
+              }
+            }
+          }
+        }
+      }
+
+      // Take the post-CPPR slacks of the test constrained at this node.
+      if(v->is_constrained()) {
+        test_pt test_ptr = v->pin_ptr()->test_ptr();
+        if(test_ptr && test_ptr->constrained_node_ptr() == v) {
+          _update_post_cppr_slacks(test_ptr, num_depths, to, slacks, bound_endpoint_ptrs);
+        }
+      }
+
+      // Release the pairs of the fanin nodes that have been read by all their fanout nodes.
+      if(!v->is_data_path_source()) {
+        for(auto& e : v->fanin()) {
+          if(!_is_cppr_tag_edge(e)) continue;
+          int_t num_remains;
+          #pragma omp atomic capture
+          num_remains = --num_readers[e->from_node_ptr()->idx()];
+          if(num_remains == 0) cppr_tag_pair_vt().swap(pairs[e->from_node_ptr()->idx()]);
+        }
+      }
+
+      if(num_readers[v->idx()] == 0) cppr_tag_pair_vt().swap(to);
+
+    } // Implicit synchronization barrier. --------------------------------------------------------
+  }
+}
+
+// Function: _is_cppr_tag_edge
+// Return true if the given edge carries the cppr tags from its from node to its to node, i.e.,
+// a rctree or combinational edge whose to node is not a data path source.
+bool_t Timer::_is_cppr_tag_edge(edge_pt e) const {
+  if(e->edge_type() != RCTREE_EDGE_TYPE && e->edge_type() != COMBINATIONAL_EDGE_TYPE) return false;
+  return !e->to_node_ptr()->is_data_path_source();
+}
+
+// Procedure: _update_post_cppr_slacks
+// Combine the arrivals at the D pin of a given test with the credit of the capturing clock pin
+// from the deepest depth to the root, where the capturing ancestor moves up as the depth
+// decreases. The slack is exact only if the credit never increases on the way up, and otherwise
+// the endpoint is stored at its slack position of the bound endpoints.
+void_t Timer::_update_post_cppr_slacks(test_pt test_ptr, int_ct num_depths, cppr_tag_pair_vrt pairs, 
+                                       float_vrt slacks, endpoint_ptr_vrt bound_endpoint_ptrs) {
+
+  auto i = test_ptr->idx();
+
+  node_pt ck = test_ptr->related_node_ptr();
+  bool_t is_clocked = ck && ck->clock_tree_ptr() && ck->clock_tree_ptr()->root_pin_ptr();
+  clock_tree_pt clock_tree_ptr = is_clocked ? ck->clock_tree_ptr() : nullptr;
+  int_t d = is_clocked ? clock_tree_ptr->level(ck) : OT_UNDEFINED_LEVEL;
 
-    u = que.front();
-    que.pop();
+  EL_RF_ITER(el, rf) {
 
-    if(u->is_constrained()) {
-      test_ptrs.push_back(u->pin_ptr()->test_ptr());
-    }
+    auto e = (i << 2) | (el << 1) | rf;
+    auto D = ((el << 1) | rf) * num_depths;
+    auto credit = OT_FLT_MAX;
+    node_pt a = is_clocked ? ck : nullptr;
 
-    for(auto& e : u->fanout()) {
-      v = e->to_node_ptr();
-      if(e->edge_type() == CONSTRAINT_EDGE_TYPE) continue;
-      if(!visited[v->idx()]) {
-        que.push(v);
-        visited[v->idx()] = true;
+    for(int_t j=min(num_depths - 1, d + 1); j>=0; --j) {
+
+      auto tag = OT_UNDEFINED_IDX;
+      auto c_credit = OT_FLT_ZERO;
+
+      // Tag of the depth-j capturing ancestor and the credit of the depth-(j-1) one.
+      if(a) {
+        while(clock_tree_ptr->level(a) > j) a = clock_tree_ptr->parent_node_ptr(a);
+        int ck_rf = test_ptr->endpoint_ptr(el, rf)->timing_arc_ptr()->is_rising_edge_triggered() ? RISE : FALL;
+        if(j <= d) {
+          tag = _encode_cppr_tag(a, ck, ck_rf);
+        }
+        if(j > 0) {
+          node_pt c = (j <= d) ? clock_tree_ptr->parent_node_ptr(a) : a;
+          int c_rf = _encode_cppr_tag(c, ck, ck_rf) & 1;
+          int root_rf = (clock_tree_ptr->num_negations(ck) & 1) ? !ck_rf : ck_rf;
+          c_credit = c->at_diff(LATE, c_rf, EARLY, c_rf) - 
+                     clock_tree_ptr->root_node_ptr()->at_diff(LATE, root_rf, EARLY, root_rf);
+        }
       }
-    }
-  }
-}
 
-// Procedure: _get_endpoint_ptrs
-// Extract the endpoints from a given vector of tests. A endpoint is defined with respect to a
-// given test with timing split (early or late) and timing transition (rise or fall) specified
-// explicitly. That is, a test can contribute to up to four endpoints.
-void_t Timer::_get_endpoint_ptrs(test_ptr_vrt test_ptrs, endpoint_ptr_vrt endpoint_ptrs) {
-  
-  // Storage initialization.
-  endpoint_ptrs.clear();
-  endpoint_ptrs.reserve(test_ptrs.size() << 2);
+      if(c_credit > credit) bound_endpoint_ptrs[e] = test_ptr->endpoint_ptr(el, rf);
 
-  // Extract the endpoint pointers from the tests.
-  for(unsigned_t i=0; i<test_ptrs.size(); ++i) {
-    EL_RF_ITER(el, rf) {
-      endpoint_ptrs.push_back(test_ptrs[i]->endpoint_ptr(el, rf)); 
+      credit = min(credit, c_credit);
+
+      auto at = pairs[D + j].at_excluding(tag);
+
+      if(!Utility::is_finite_numeric(at)) continue;
+      
+      auto slack = (el == EARLY) ? at - test_ptr->rat(el, rf) : test_ptr->rat(el, rf) - at;
+
+      slacks[e] = min(slacks[e], slack + credit);
     }
   }
 }
 
-// Procedure: _update_endpoint_slacks
-// Update the slack at each endpoint. The procedure copies the slack from the node to the test
-// point if the given through pin is a nullptr pointer. Otherwise, the we need to reperform the CPPR
-// analysis by specifying the through pin as it might affect the true CPPR slack.
-void_t Timer::_update_endpoint_slacks(pin_pt through_pin_ptr, endpoint_ptr_vrt endpoint_ptrs){
-  
-  // The through  pin is not specified where we can directly copy the node slack to the
-  // endpoint slack.
-  if(through_pin_ptr == nullptr) return;
-
-  // The through pin is specified where we need to recompute the true worst cppr slack with respect 
-  // to a given pin_ptr.
-  #pragma omp parallel for schedule(dynamic, 1)
-  for(unsigned_t i=0; i<endpoint_ptrs.size(); ++i) {
-    if(endpoint_ptrs[i]->slack() > cutoff_slack(endpoint_ptrs[i]->el(), endpoint_ptrs[i]->rf()) || 
-       through_pin_ptr->test_ptr()) continue;
-    CPPR cppr(endpoint_ptrs[i], through_pin_ptr, circuit_ptr()->clock_tree_ptr(), 1);
-    endpoint_ptrs[i]->set_slack(cppr.report_worst_slack(1));
-  } // Implicit synchronization barrier. ----------------------------------------------------------
+// Function: _encode_cppr_tag
+// Encode the tag of a clock tree ancestor of a given clock tree node u, which is the ancestor
+// index and the transition at the ancestor propagated from the transition rf at u.
+int_t Timer::_encode_cppr_tag(node_pt a, node_pt u, int rf) const {
+  auto neg = (u->clock_tree_ptr()->num_negations(u) - u->clock_tree_ptr()->num_negations(a)) & 1;
+  return (a->idx() << 1) | (neg ? !rf : rf);
 }
 
 // Function: slew
@@ -3029,6 +5345,125 @@ void_t Timer::_report_wns(file_pt fp) {
   fprintf(fp, "%.5e\n", wns());
 }
 
+// Procedure: report_corners
+// Report the worst and total negative slack of every corner, followed by the merged worst case
+// over all corners, in which the slack of a node is its minimum slack across the corners.
+void_t Timer::report_corners() {
+  _report_corners(environment_ptr()->rpt_fptr());
+}
+
+// Procedure: _report_corners
+// Report the corner slacks. The corners are updated first, which times the design once for all
+// corners, and each row lists the early and late wns and tns of a corner. Corners that are no
+// longer bound to the design are reported as errors and left out of the merged worst case.
+void_t Timer::_report_corners(file_pt fp) {
+
+  if(_corner_uptrs.empty()) {
+    LOG(WARNING) << "No corner to report";
+    return;
+  }
+
+  update_corners();
+
+  fprintf(fp, "%-16s %14s %14s %14s %14s\n", "Corner", "wns(early)", "tns(early)", "wns(late)", "tns(late)");
+
+  size_vt cs;
+
+  for(const auto& corner_uptr : _corner_uptrs) {
+    if(!corner_uptr->is_bound()) {
+      LOG(ERROR) << "Failed to report corner " + corner_uptr->name() + " (cell binding exception)";
+      continue;
+    }
+    cs.push_back(corner_uptr->idx());
+    float_t wns[2] = {OT_FLT_ZERO, OT_FLT_ZERO}, tns[2] = {OT_FLT_ZERO, OT_FLT_ZERO};
+    EL_RF_ITER(el, rf) {
+      wns[el] = min(wns[el], corner_uptr->wns(el, rf));
+      tns[el] += corner_uptr->tns(el, rf);
+    }
+    fprintf(fp, "%-16s %14.6f %14.6f %14.6f %14.6f\n", 
+            corner_uptr->name().c_str(), wns[EARLY], tns[EARLY], wns[LATE], tns[LATE]);
+  }
+
+  if(cs.empty()) return;
+
+  // Merged worst case.
+  float_t wns[2] = {OT_FLT_ZERO, OT_FLT_ZERO}, tns[2] = {OT_FLT_ZERO, OT_FLT_ZERO};
+
+  EL_RF_ITER(el, rf) {
+
+    float_t w(OT_FLT_ZERO), t(OT_FLT_ZERO);
+
+    #pragma omp parallel for reduction(min : w) reduction(+ : t)
+    for(unsigned_t i=0; i<nodeset().num_indices(); ++i) {
+      if(nodeset()[i] == nullptr || nodeset()[i]->num_corners() < _corner_uptrs.size()) continue;
+      float_t s = OT_FLT_MAX;
+      for(const auto& c : cs) {
+        s = min(s, nodeset()[i]->corner_slack(c, el, rf));
+      }
+      if(s >= OT_FLT_ZERO) continue;
+      t = t + s;
+      if(s < w) w = s;
+    } // Implicit synchronization barrier. --------------------------------------------------------
+
+    wns[el] = min(wns[el], w);
+    tns[el] += t;
+  }
+
+  fprintf(fp, "%-16s %14.6f %14.6f %14.6f %14.6f\n", "merged", wns[EARLY], tns[EARLY], wns[LATE], tns[LATE]);
+}
+
+// Function: slack_statistics
+// Report the endpoint slack statistics of the design, including a histogram of the given number
+// of bins over the slack range [lower, upper), and the tns, wns, failing endpoint count, and
+// percentiles per timing split and clock domain. The returned statistics remain valid until the
+// next call.
+slack_statistics_crt Timer::slack_statistics(size_t num_bins, float_ct lower, float_ct upper) {
+  
+  // Update the timing.
+  update_timing();
+
+  // Update the statistics.
+  _update_slack_statistics(max(num_bins, size_t(1)), lower, max(upper, lower + 1.0f));
+
+  return *_slack_statistics_uptr;
+}
+
+// Procedure: report_slack_statistics
+// Report the endpoint slack statistics. The command accepts "-bins <integer>", "-lower <float>",
+// "-upper <float>", and "-binary <file_path>". The statistics are printed in text to the report
+// file unless a binary output file is given.
+void_t Timer::report_slack_statistics(int argc, char **argv) {
+
+  size_t num_bins = OT_DEFAULT_SLACK_HISTOGRAM_NUM_BINS;
+  float_t lower = OT_DEFAULT_SLACK_HISTOGRAM_LOWER;
+  float_t upper = OT_DEFAULT_SLACK_HISTOGRAM_UPPER;
+  string_t binary_fpath;
+
+  for(int i=0; i<argc; ++i) {
+    if(strcmp(argv[i], "-bins") == 0 && i+1 < argc) num_bins = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-lower") == 0 && i+1 < argc) lower = atof(argv[++i]);
+    else if(strcmp(argv[i], "-upper") == 0 && i+1 < argc) upper = atof(argv[++i]);
+    else if(strcmp(argv[i], "-binary") == 0 && i+1 < argc) binary_fpath = argv[++i];
+  }
+
+  const auto& stats = slack_statistics(num_bins, lower, upper);
+
+  if(binary_fpath.empty()) {
+    stats.print(environment_ptr()->rpt_fptr());
+    return;
+  }
+
+  file_pt fptr = fopen(binary_fpath.c_str(), "wb");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + binary_fpath;
+    return;
+  }
+
+  stats.write(fptr);
+  fclose(fptr);
+}
+
 // Procedure: get_worst_endpoints
 // Report the top K critical endpoints that pass through a given pin, where the pin will be or
 // not be in the current design. If the pin is not in the current design the paths are searched
@@ -3072,6 +5507,9 @@ void_t Timer::get_worst_endpoints(pin_pt through_pin_ptr, size_t K, endpoint_ptr
       endpoint_ptrs.pop_back();
     }
   }
+  else if(K >= OT_DEFAULT_PARALLEL_TOP_K) {
+    endpoint_minheap_ptr()->parallel_top(K, endpoint_ptrs);
+  }
   else {
     endpoint_minheap_ptr()->top(K, endpoint_ptrs);
   }
@@ -3102,7 +5540,8 @@ void_t Timer::get_worst_paths(pin_pt through_pin_ptr, size_t K, path_cache_rt ca
 
   // Data declaration.
   endpoint_ptr_vt endpoint_ptrs;
-  path_max_heap_vt heaps(OT_MAX_NUM_THREADS);
+  path_max_heap_vt heaps(omp_get_max_threads());
+  path_slack_bound_t bound;
 
   // Clear the path cache.
   cache.clear();
@@ -3110,32 +5549,263 @@ void_t Timer::get_worst_paths(pin_pt through_pin_ptr, size_t K, path_cache_rt ca
   // Get the top K critical endpoints. The function calls will perform the update timing.
   get_worst_endpoints(through_pin_ptr, K, endpoint_ptrs);
 
+  // Rebuild the jumps that have been invalidated since the last path query.
+  _update_jumps();
+
   // Now we have the top K (or less than K) endpoints in which we have to generate the K 
-  // shortest paths for each of them and store them into the path matrix.
-  #pragma omp parallel num_threads(min((int_t)endpoint_ptrs.size(), omp_get_num_threads()))
-  { 
-    int_t tid = omp_get_thread_num();
-    int_t num = endpoint_ptrs.size() / omp_get_num_threads();
-    int_t beg = num * tid;
-    int_t end = (tid == omp_get_num_threads()) ? endpoint_ptrs.size() : beg + num;
-
-    for(int_t i=beg; i<end; ++i) {
-      // Prune the endpoint.
-      if(heaps[tid].size() == K && endpoint_ptrs[i]->slack() >= heaps[tid].top()->slack()) {
-        break;
+  // shortest paths for each of them and store them into the path matrix. Each thread peels
+  // paths into its own heap, while the Kth worst slack over all heaps is shared through the
+  // bound so that endpoints and spur branches which cannot enter the global top K are pruned
+  // regardless of which thread found the competing paths.
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t i=0; i<endpoint_ptrs.size(); ++i) {
+
+    // Prune the endpoint. The endpoint slack is a lower bound of all its path slacks.
+    if(endpoint_ptrs[i]->slack() >= bound.value()) continue;
+
+    auto tid = omp_get_thread_num();
+    auto clock_tree_ptr = circuit_ptr()->clock_tree_ptr(endpoint_ptrs[i]->test_ptr()->related_node_ptr());
+    CPPR cppr(endpoint_ptrs[i], through_pin_ptr, clock_tree_ptr, K, &bound);
+    cppr.update_worst_paths(K, heaps[tid]);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  for(auto& heap : heaps) heap.emplace_path_ptrs(cache);
+
+  cache.maintain_k_min(K);
+}
+
+// Procedure: stream_worst_paths
+// Stream the top K critical post-CPPR slack paths through a given pin to a path writer in
+// non-decreasing slack order. The command accepts "-pin <pin_name>", "-numPaths <integer>",
+// "-batch <integer>", and "-binary <file_path>". Paths are written in the text format of
+// report_worst_paths to the report file unless a binary output file is given.
+void_t Timer::stream_worst_paths(int argc, char **argv) {
+
+  size_t num_paths = 1;
+  size_t batch_size = OT_DEFAULT_PATH_STREAM_BATCH_SIZE;
+  string_t pin_name;
+  string_t binary_fpath;
+
+  for(int i=0; i<argc; ++i) {
+    if(strcmp(argv[i], "-pin") == 0 && i+1 < argc) pin_name = argv[++i];
+    else if(strcmp(argv[i], "-numPaths") == 0 && i+1 < argc) num_paths = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-batch") == 0 && i+1 < argc) batch_size = atoi(argv[++i]);
+    else if(strcmp(argv[i], "-binary") == 0 && i+1 < argc) binary_fpath = argv[++i];
+  }
+
+  if(binary_fpath.empty()) {
+    path_text_writer_t writer(environment_ptr()->rpt_fptr());
+    stream_worst_paths(pin_name, num_paths, writer, batch_size);
+    return;
+  }
+
+  file_pt fptr = fopen(binary_fpath.c_str(), "wb");
+
+  if(fptr == nullptr) {
+    LOG(ERROR) << "Failed to open " + binary_fpath;
+    return;
+  }
+
+  path_binary_writer_t writer(fptr);
+  stream_worst_paths(pin_name, num_paths, writer, batch_size);
+  fclose(fptr);
+}
+
+// Procedure: stream_worst_paths
+// Stream the top K critical post-CPPR slack paths through a given pin name to a path writer.
+void_t Timer::stream_worst_paths(
+  string_crt through_pin_name, size_t K, path_writer_rt writer, size_t batch_size
+) {
+  stream_worst_paths(circuit_ptr()->pin_ptr(through_pin_name), K, writer, batch_size);
+}
+
+// Procedure: stream_worst_paths
+// Stream the top K critical post-CPPR slack paths through a given pin to a path writer in
+// non-decreasing slack order. Unlike get_worst_paths, the procedure never holds all K path
+// traces. The paths are first ranked globally as compact (slack, endpoint) records without
+// recovering any trace. Each endpoint that owns ranked records then peels its prefix tree once
+// up to the number of its records, and keeps only the popped prefixes, which are compact
+// deviation records rather than traces. The ranked records are finally streamed in batches,
+// where the endpoints of a batch rebuild their suffix trees in parallel, recover the paths of
+// the ranks they own in the batch from the kept prefixes, and hand them to the writer before the
+// next batch is started. A record whose rank is not reproduced by the prefix tree is dropped
+// before the stream begins, so the announced path count is exact.
+//
+// The memory is O(K) records plus the prefix trees of the endpoints that still have records to
+// write, and the traces of one batch. A prefix tree is deleted once the batch writing the last
+// record of its endpoint is done. The suffix trees live in the per-thread storage and are rebuilt
+// in every batch an endpoint appears in, hence a batch is cut, within the second half of its
+// size, at the record where the fewest endpoints continue into the next batch.
+void_t Timer::stream_worst_paths(
+  pin_pt through_pin_ptr, size_t K, path_writer_rt writer, size_t batch_size
+) {
+
+  // Data declaration.
+  endpoint_ptr_vt endpoint_ptrs;
+  path_slack_heap_vt heaps(omp_get_max_threads());
+  path_slack_bound_t bound;
+  path_slack_record_vt records;
+
+  batch_size = max(batch_size, size_t(1));
+
+  // Get the top K critical endpoints. The function calls will perform the update timing.
+  get_worst_endpoints(through_pin_ptr, K, endpoint_ptrs);
+
+  // Rebuild the jumps that have been invalidated since the last path query.
+  _update_jumps();
+
+  // Ranking stage. Each thread keeps the K worst slacks it has seen as compact records.
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t i=0; i<endpoint_ptrs.size(); ++i) {
+
+    if(endpoint_ptrs[i]->slack() >= bound.value()) continue;
+
+    auto tid = omp_get_thread_num();
+    auto clock_tree_ptr = circuit_ptr()->clock_tree_ptr(endpoint_ptrs[i]->test_ptr()->related_node_ptr());
+    CPPR cppr(endpoint_ptrs[i], through_pin_ptr, clock_tree_ptr, K, &bound);
+    cppr.update_worst_slacks(K, i, heaps[tid]);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  for(auto& heap : heaps) heap.emplace_records(records);
+
+  sort(records.begin(), records.end());
+
+  if(records.size() > K) records.resize(K);
+
+  // Count the paths of each endpoint.
+  int_vt num_paths(endpoint_ptrs.size(), 0);
+
+  for(const auto& record : records) ++num_paths[record.second];
+
+  // Peeling stage. The prefix tree of an endpoint is peeled once, without the global slack bound
+  // such that the suffix tree is rebuilt identically in every batch, and is kept across batches.
+  int_vt num_ranked(endpoint_ptrs.size(), 0);
+  prefix_tree_ptr_vt prefix_tree_ptrs(endpoint_ptrs.size(), nullptr);
+
+  #pragma omp parallel for schedule(dynamic, 1)
+  for(unsigned_t i=0; i<endpoint_ptrs.size(); ++i) {
+
+    if(num_paths[i] == 0) continue;
+
+    auto clock_tree_ptr = circuit_ptr()->clock_tree_ptr(endpoint_ptrs[i]->test_ptr()->related_node_ptr());
+    CPPR cppr(endpoint_ptrs[i], through_pin_ptr, clock_tree_ptr, num_paths[i]);
+    num_ranked[i] = cppr.rank_worst_paths(num_paths[i]);
+    prefix_tree_ptrs[i] = cppr.release_prefix_tree();
+    if(prefix_tree_ptrs[i]) prefix_tree_ptrs[i]->shrink(num_ranked[i]);
+  } // Implicit synchronization barrier. ----------------------------------------------------------
+
+  // Assign to each record its rank within the endpoint, and drop the ranks that do not exist.
+  int_vt ranks;
+  int_vt num_kept(endpoint_ptrs.size(), 0);
+  size_t num_records = 0;
+
+  for(size_t r=0; r<records.size(); ++r) {
+    auto i = records[r].second;
+    if(num_kept[i] == num_ranked[i]) continue;
+    ranks.push_back(num_kept[i]++);
+    records[num_records++] = records[r];
+  }
+
+  records.resize(num_records);
+
+  // Delete the prefix trees of the endpoints that have no record left.
+  int_vt last_record(endpoint_ptrs.size(), -1);
+
+  for(size_t r=0; r<records.size(); ++r) last_record[records[r].second] = r;
+
+  for(size_t i=0; i<endpoint_ptrs.size(); ++i) {
+    if(last_record[i] == -1 && prefix_tree_ptrs[i]) {
+      delete prefix_tree_ptrs[i];
+      prefix_tree_ptrs[i] = nullptr;
+    }
+  }
+
+  writer.begin(records.size());
+
+  // Streaming stage. The ranks of an endpoint are consecutive within a batch.
+  for(size_t beg=0, end; beg<records.size(); beg=end) {
+
+    end = _cut_path_stream_batch(records, last_record, beg, batch_size);
+
+    int_vt group_eps;
+    int_mt group_rs;
+    path_mt group_paths;
+    unordered_map < int_t, size_t > group_idx;
+
+    for(size_t r=beg; r<end; ++r) {
+      auto itr = group_idx.find(records[r].second);
+      if(itr == group_idx.end()) {
+        itr = group_idx.emplace(records[r].second, group_eps.size()).first;
+        group_eps.push_back(records[r].second);
+        group_rs.emplace_back();
       }
+      group_rs[itr->second].push_back(r);
+    }
 
-      CPPR cppr(endpoint_ptrs[i], through_pin_ptr, circuit_ptr()->clock_tree_ptr(), K);
-      cppr.update_worst_paths(K, heaps[tid]);
+    group_paths.resize(group_eps.size());
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(unsigned_t g=0; g<group_eps.size(); ++g) {
+      auto i = group_eps[g];
+      auto clock_tree_ptr = circuit_ptr()->clock_tree_ptr(endpoint_ptrs[i]->test_ptr()->related_node_ptr());
+      CPPR cppr(endpoint_ptrs[i], through_pin_ptr, clock_tree_ptr, num_paths[i]);
+      cppr.adopt_prefix_tree(prefix_tree_ptrs[i]);
+      cppr.report_worst_paths(ranks[group_rs[g].front()], ranks[group_rs[g].back()] + 1, group_paths[g]);
+      prefix_tree_ptrs[i] = cppr.release_prefix_tree();
+      CHECK(group_paths[g].size() == group_rs[g].size());
+    } // Implicit synchronization barrier. --------------------------------------------------------
+
+    // Write the batch in the global slack order.
+    int_vt cursor(group_eps.size(), 0);
+    
+    for(size_t r=beg; r<end; ++r) {
+      auto g = group_idx[records[r].second];
+      writer.write(group_paths[g][cursor[g]++]);
     }
 
-    #pragma omp critical 
-    {
-      heaps[tid].emplace_path_ptrs(cache);
+    // Delete the prefix trees of the endpoints whose last record is written.
+    for(auto i : group_eps) {
+      if(last_record[i] < (int_t)end) {
+        delete prefix_tree_ptrs[i];
+        prefix_tree_ptrs[i] = nullptr;
+      }
     }
-  } // Implicit synchronization barrier. ----------------------------------------------------------
+  }
 
-  cache.maintain_k_min(K);
+  writer.end();
+}
+
+// Function: _cut_path_stream_batch
+// Return the end of the batch of at most batch_size records that starts at beg. The end is chosen
+// within the second half of the batch size to minimize the number of endpoints that have records
+// on both sides of it, since each of them rebuilds its suffix tree in the next batch again. Ties
+// go to the longer batch.
+size_t Timer::_cut_path_stream_batch(
+  path_slack_record_vrt records, int_vrt last_record, size_t beg, size_t batch_size
+) const {
+
+  size_t end = min(records.size(), beg + batch_size);
+
+  if(end == records.size()) return end;
+
+  size_t min_end = beg + (batch_size + 1) / 2;
+  size_t best_end = end;
+  size_t best_num = OT_SIZE_MAX;
+  size_t num = 0;
+  unordered_set < int_t > seen;
+
+  for(size_t r=beg; r<end; ++r) {
+    auto i = records[r].second;
+    auto is_first = seen.insert(i).second;
+    if(is_first && last_record[i] > (int_t)r) ++num;
+    else if(!is_first && last_record[i] == (int_t)r) --num;
+    if(r + 1 >= min_end && num <= best_num) {
+      best_num = num;
+      best_end = r + 1;
+    }
+  }
+
+  return best_end;
 }
 
 // Procedure: report_worst_paths
@@ -3217,30 +5887,13 @@ void_t Timer::_report_worst_paths(file_pt fp, pin_pt through_pin_ptr, size_t K)
 
   // Print out the path trace for the top K critical paths. Here we only care about the non-positive
   // slack paths. That is we only print out the path with negative slack.
-  int_t num_paths = cache.size();
-  fprintf(fp, "report_worst_paths %d\n", num_paths);
-
-  for(int_t k=0; k<num_paths; k++) {
-    path_rt p = *(cache.path_ptrs()[k]);
-    switch(p.path_type()) {
-      case RAT_PATH_TYPE:
-        fprintf(fp, "Path %d: RAT %.3f %lu %c\n", k+1, p.slack(), p.size(), (p.el() ? 'L' : 'E'));
-      break;
-      case SETUP_PATH_TYPE:
-        fprintf(fp, "Path %d: Setup %.3f %lu %c\n", k+1, p.slack(), p.size(), (p.el() ? 'L' : 'E'));
-      break;
-      case HOLD_PATH_TYPE:
-        fprintf(fp, "Path %d: Hold %.3f %lu %c\n", k+1, p.slack(), p.size(), (p.el() ? 'L' : 'E'));
-      break;
-      default:
-        CHECK(false);
-      break;
-    }
-  
-    for(PathRIter i(p); i(); ++i) {
-      fprintf(fp, "%s %c\n", i.pin_ptr()->name().c_str(), i.rf() ? 'F' : 'R');
-    }
+  path_text_writer_t writer(fp);
+
+  writer.begin(cache.size());
+  for(const auto& path_ptr : cache.path_ptrs()) {
+    writer.write(*path_ptr);
   }
+  writer.end();
 }
 
 // Procedure: report_timer
@@ -3267,8 +5920,15 @@ void_t Timer::_report_timer(file_pt fptr) {
   fprintf(fptr, "Num of jumps            : %lu\n", jumpset().size());
   fprintf(fptr, "Num of primary inputs   : %lu\n", num_primary_inputs());
   fprintf(fptr, "Num of primary outputs  : %lu\n", num_primary_outputs());
-  fprintf(fptr, "Num of clock tree nodes : %lu\n", circuit_ptr()->clock_tree_ptr()->size());
-  fprintf(fptr, "Num of clock tree levels: %d\n", circuit_ptr()->clock_tree_ptr()->level());
+  size_t num_clock_tree_nodes(0);
+  int_t num_clock_tree_levels(-1);
+  for(const auto& clock_tree_uptr : circuit_ptr()->clock_tree_uptrs()) {
+    num_clock_tree_nodes += clock_tree_uptr->size();
+    num_clock_tree_levels = max(num_clock_tree_levels, clock_tree_uptr->level());
+  }
+  fprintf(fptr, "Num of clock trees      : %lu\n", circuit_ptr()->num_clock_trees());
+  fprintf(fptr, "Num of clock tree nodes : %lu\n", num_clock_tree_nodes);
+  fprintf(fptr, "Num of clock tree levels: %d\n", num_clock_tree_levels);
 }
 
 // Procedure: report_max_num_threads
@@ -3292,10 +5952,11 @@ void_t Timer::exec_tau2015(int argc, char *argv[]) {
 }
 
 // Procedure: exec_tau2016
-// The procedure initializes the timer for TAU 2015 contest.
+// The procedure initializes the timer for TAU 2016 contest and writes the timing macro.
 void_t Timer::exec_tau2016(int argc, char *argv[]) {
   environment_ptr()->parse_environment_tau2016(argc, argv);
   init_timer();
+  write_macro(environment_ptr()->tau2016_macro_name());
 }
 
 // Procedure: exec_iccad2015
@@ -3325,6 +5986,18 @@ void_t Timer::init_timer() {
   // performed in a parallel fashion.
   verilog_pt verilog_ptr = new verilog_t();
   spef_pt spef_ptr = new spef_t();
+  def_reader_pt def_reader_ptr = new def_reader_t();
+  timing_reader_pt timing_reader_ptr = new timing_reader_t();
+  sdc_reader_pt sdc_reader_ptr = nullptr;
+
+  bool_t is_layout_available = __is_file_available(environment_ptr()->lef_fpath()) && 
+                               __is_file_available(environment_ptr()->def_fpath());
+
+  bool_t is_sdc_available = __is_file_available(environment_ptr()->sdc_fpath());
+
+  if(is_sdc_available) {
+    sdc_reader_ptr = new sdc_reader_t();
+  }
 
   #pragma omp parallel
   {
@@ -3332,8 +6005,9 @@ void_t Timer::init_timer() {
     // - read spef file
     // - read celllib file
     // - read verilog file
+    // - read lef file and parse def file (optional)
     // - initialize the circuit connection from verilog file.
-    // - initialize the io timing.
+    // - initialize the io timing from the timing file and the sdc file (optional).
     #pragma omp sections 
     {
       // Section task: parse the spef file
@@ -3341,6 +6015,16 @@ void_t Timer::init_timer() {
       { 
         _parse_spef(environment_ptr()->spef_fpath(), spef_ptr); 
       }
+
+      // Section task: read the lef file and parse the def file into the buffer, which overlaps
+      // with the construction of the circuit.
+      #pragma omp section
+      {
+        if(is_layout_available) {
+          _read_lef(environment_ptr()->lef_fpath());
+          def_reader_ptr->parse(environment_ptr()->def_fpath());
+        }
+      }
     
       // Section task: prase celllib, parse verilog, and initialize the circuit.
       #pragma omp section
@@ -3356,18 +6040,59 @@ void_t Timer::init_timer() {
         { 
           _read_celllib(environment_ptr()->late_celllib_fpath(), celllib_ptr(LATE)); 
         }
-      
+
         // Child task: parse the verilog
         #pragma omp task
         { 
           _parse_verilog(environment_ptr()->verilog_fpath(), verilog_ptr); 
         }
+
+        // Child task: parse the timing assertions, which are optional given a sdc file.
+        #pragma omp task
+        {
+          if(!is_sdc_available || __is_file_available(environment_ptr()->timing_fpath())) {
+            timing_reader_ptr->read(environment_ptr()->timing_fpath());
+          }
+        }
+
+        // Child task: parse the sdc file (optional)
+        #pragma omp task
+        {
+          if(is_sdc_available) {
+            sdc_reader_ptr->parse(environment_ptr()->sdc_fpath());
+          }
+        }
       
-        // Section task: initialize the circuit from verilog
         #pragma omp taskwait
 
+        // Child task: read the block models (optional), which are checked against the cell
+        // names of the libraries and hence read after them.
+        size_t num_models = environment_ptr()->num_models();
+        model_upt_vt model_uptrs(num_models);
+
+        for(size_t i=0; i<num_models; ++i) {
+          model_uptrs[i].reset(new model_t(environment_ptr()->model_name(i)));
+          EL_ITER(el) {
+            #pragma omp task shared(model_uptrs) firstprivate(i, el)
+            { 
+              model_uptrs[i]->read_celllib(el, environment_ptr()->model_celllib_fpath(el, i)); 
+            }
+          }
+        }
+
+        #pragma omp taskwait
+
+        for(auto& model_uptr : model_uptrs) {
+          _insert_model(std::move(model_uptr));
+        }
+
+        // Section task: initialize the circuit from verilog
         _init_circuit_from_verilog(verilog_ptr);
-        _init_io_timing(environment_ptr()->timing_fpath());
+        _init_io_timing(*timing_reader_ptr);
+
+        if(is_sdc_available) {
+          sdc_reader_ptr->apply(this);
+        }
       }
     } // Implicit synchronization barrier after sections. -----------------------------------------
 
@@ -3387,26 +6112,26 @@ void_t Timer::init_timer() {
 
     } // Implicit sychronization barrier after single directive. ----------------------------------
 
-    // Parallel task group 4: Read the physical Layout (optional).
-    // - read the design exchangeable file (DEF)
-    // - read the library exchangeable file (LEF)
-    #pragma omp single
-    {
-      if(__is_file_available(environment_ptr()->lef_fpath()) && __is_file_available(environment_ptr()->def_fpath())) {
-        #pragma omp task
-        { 
-          _read_lef(environment_ptr()->lef_fpath()); 
-        }
-        #pragma omp task
-        { 
-          _read_def(environment_ptr()->def_fpath()); 
-        }
-      }
-    } // Implicit synchronization barrier after single directive. ---------------------------------
+  }
+
+  // Apply the physical layout (optional) parsed from the design exchangeable file (DEF) 
+  // to the gates and ports in parallel batches.
+  if(is_layout_available) {
+    def_reader_ptr->apply(this);
+  }
+
+  // Estimate the net parasitics from the placement if no spef file is given.
+  if(is_layout_available) {
+    _spatial_grid_uptr.reset();
+    _update_wire_estimator();
+    if(!__is_file_available(environment_ptr()->spef_fpath())) estimate_rctrees();
   }
 
   delete verilog_ptr;
   delete spef_ptr;
+  delete def_reader_ptr;
+  delete timing_reader_ptr;
+  delete sdc_reader_ptr;
   
   // [BEG INFO]
   LOG(INFO) << "Successfully initialized the timer";
@@ -3432,7 +6157,7 @@ void_t Timer::exec_ops(string_crt ops_fpath) {
 
   int el, rf;
   int num_paths;
-  float_t numeric;
+  float_t numeric, x, y;
   char_cpt ops_delimiters = " \n\0";
   char_pt keyword, pin_name, gate_name, cell_name, net_name, spef_name;
   char_pt line = (char_pt)malloc(sizeof(char_t)*(max_file_line_size));
@@ -3507,6 +6232,66 @@ void_t Timer::exec_ops(string_crt ops_fpath) {
       if(pin_name == nullptr) report_worst_paths("", num_paths);               
       else report_worst_paths(pin_name, num_paths);
     }
+    // Stream the worst paths.
+    else if(strcmp(keyword, "stream_worst_paths") == 0) {
+      vector < char_pt > args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      stream_worst_paths(args.size(), args.data());
+    }
+    // Report the slack statistics.
+    else if(strcmp(keyword, "report_slack_statistics") == 0) {
+      vector < char_pt > args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      report_slack_statistics(args.size(), args.data());
+    }
+    // Report the corner slacks.
+    else if(strcmp(keyword, "report_corners") == 0) {
+      report_corners();
+    }
+    // Multi-corner analysis: insert a corner whose libraries are relative to the wrapper.
+    else if(strcmp(keyword, "insert_corner") == 0) {
+      string_vt args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      for(size_t i=1; i<args.size(); ++i) {
+        if(args[i] == "-res" || args[i] == "-cap") ++i;
+        else args[i] = environment_ptr()->tau2015_wrapper_fdir() + args[i];
+      }
+      vector < char_pt > argv;
+      for(auto& arg : args) argv.push_back(&arg[0]);
+      insert_corner(argv.size(), argv.data());
+    }
+    // Multi-corner analysis: update the timing of every corner.
+    else if(strcmp(keyword, "update_corners") == 0) {
+      update_corners();
+    }
+    // Extract the timing macro.
+    else if(strcmp(keyword, "write_macro") == 0) {
+      if((keyword = strtok(nullptr, ops_delimiters))) write_macro(keyword);
+    }
+    // Partition the design for the distributed timing.
+    else if(strcmp(keyword, "write_partitions") == 0) {
+      string_vt args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      if(args.size() == 2) write_partitions(atoi(args[0].c_str()), args[1]);
+    }
+    // Hierarchical analysis: read or swap a block model whose libraries are relative to the wrapper.
+    else if(strcmp(keyword, "read_model") == 0) {
+      string_vt args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      if(args.size() == 3) {
+        read_model(
+          args[0], 
+          environment_ptr()->tau2015_wrapper_fdir() + args[1], 
+          environment_ptr()->tau2015_wrapper_fdir() + args[2]
+        );
+      }
+    }
+    // Estimate the net parasitics.
+    else if(strcmp(keyword, "estimate_rctrees") == 0) {
+      vector < char_pt > args;
+      while((keyword = strtok(nullptr, ops_delimiters))) args.push_back(keyword);
+      estimate_rctrees(args.size(), args.data());
+    }
     // Report the tns.
     else if(strcmp(keyword, "report_tns") == 0) {
       __tau2015_numeric_guard(numeric = tns());
@@ -3583,6 +6368,13 @@ void_t Timer::exec_ops(string_crt ops_fpath) {
       cell_name = strtok(nullptr, ops_delimiters);
       repower_gate(gate_name, cell_name);
     }
+    // Gate-level circuit modification: move a gate.
+    else if(strcmp(keyword, "move_gate") == 0) {
+      gate_name = strtok(nullptr, ops_delimiters);
+      x = atof(strtok(nullptr, ops_delimiters));
+      y = atof(strtok(nullptr, ops_delimiters));
+      move_gate(gate_name, x, y);
+    }
     // Gate-level circuit modification: remove a gate
     else if(strcmp(keyword, "remove_gate") == 0) {
       gate_name = strtok(nullptr, ops_delimiters);
@@ -3614,6 +6406,26 @@ void_t Timer::exec_ops(string_crt ops_fpath) {
       pin_name = strtok(nullptr, ops_delimiters);
       disconnect_pin(pin_name);
     } 
+    // Batch circuit modification: begin an eco transaction.
+    else if(strcmp(keyword, "begin_eco") == 0) {
+      begin_eco();
+    }
+    // Batch circuit modification: commit the eco transaction.
+    else if(strcmp(keyword, "commit_eco") == 0) {
+      commit_eco();
+    }
+    // What-if evaluation: save the timing state.
+    else if(strcmp(keyword, "push_state") == 0) {
+      push_state();
+    }
+    // What-if evaluation: restore the timing state.
+    else if(strcmp(keyword, "pop_state") == 0) {
+      pop_state();
+    }
+    // What-if evaluation: keep the changes since the saved state.
+    else if(strcmp(keyword, "merge_state") == 0) {
+      merge_state();
+    }
     else {
       LOG(WARNING) << "Unexpected op keyword " + string_t(keyword);
     }
@@ -26,7 +26,18 @@
 #include "ot_dump.h"
 #include "ot_spef.h"
 #include "ot_pipeline.h"
+#include "ot_eco.h"
+#include "ot_journal.h"
+#include "ot_timing_view.h"
 #include "ot_path.h"
+#include "ot_path_writer.h"
+#include "ot_slack_statistics.h"
+#include "ot_wire_estimator.h"
+#include "ot_spatial_grid.h"
+#include "ot_timing_reader.h"
+#include "ot_sdc_reader.h"
+#include "ot_corner.h"
+#include "ot_model.h"
 #include "ot_functor.h"
 #include "ot_debug_graph.h"
 #include "ot_log.h"
@@ -43,6 +54,7 @@ class Timer {
     ~Timer();                                                           // Destructor.
 
     inline void_t set_cutoff_slack(int, int, float_ct);                 // Set the cutoff slack.
+    inline void_t set_timing_change_epsilon(float_ct);                  // Set the change epsilon.
 
     net_pt net_ptr(string_crt) const;                                   // Query the net pointer.
     net_pt insert_net(string_crt);                                      // Create a new net.
@@ -59,6 +71,12 @@ class Timer {
     
     gate_pt gate_ptr(string_crt) const;                                 // Query the gate pointer.
     gate_pt insert_gate(string_crt, string_crt);                        // Create a new gate.
+
+    corner_pt corner_ptr(string_crt) const;                             // Query the corner pointer.
+    corner_pt insert_corner(string_crt, string_crt, string_crt);        // Create a new corner.
+
+    model_pt model_ptr(string_crt) const;                               // Query the model pointer.
+    model_pt read_model(string_crt, string_crt, string_crt);            // Read or swap a block model.
     
     void_t exec_tau2015(int argc, char *argv[]);                        // Execute the timer.
     void_t exec_tau2016(int argc, char *argv[]);                        // Execute the timer.
@@ -85,11 +103,26 @@ class Timer {
     void_t report_slew(string_crt, int, int);                           // Report the slew.
     void_t report_slew(pin_pt, int, int);                               // Report the slew.
     void_t report_all_slacks();                                         // Report all slacks.
+    void_t report_slack_statistics(int, char**);                        // Report the slack statistics.
+    void_t report_corners();                                            // Report the corner slacks.
     void_t get_worst_paths(string_crt, size_t, path_cache_rt);          // Report the worst paths.
+    void_t get_post_cppr_slacks(float_vrt);                             // Report all post-CPPR slacks.
     void_t get_worst_paths(pin_pt, size_t, path_cache_rt);              // Report the worst paths.
+    void_t stream_worst_paths(int, char**);                             // Stream the worst paths.
+    void_t stream_worst_paths(string_crt, size_t, path_writer_rt,       // Stream the worst paths.
+                              size_t = OT_DEFAULT_PATH_STREAM_BATCH_SIZE);
+    void_t stream_worst_paths(pin_pt, size_t, path_writer_rt,           // Stream the worst paths.
+                              size_t = OT_DEFAULT_PATH_STREAM_BATCH_SIZE);
     void_t get_worst_endpoints(string_crt, size_t, endpoint_ptr_vrt);   // Get the worst endpoints.
     void_t get_worst_endpoints(pin_pt, size_t, endpoint_ptr_vrt);       // Get the worst endpoints.
     void_t read_spef(string_crt);                                       // Read a spef file.
+    void_t estimate_rctrees();                                          // Estimate the net parasitics.
+    void_t estimate_rctrees(int, char**);                               // Estimate the net parasitics.
+    void_t update_rctree_estimation(gate_pt);                           // Re-estimate the gate nets.
+    void_t move_gate(string_crt, float_ct, float_ct);                   // Move a gate.
+    void_t move_gate(gate_pt, float_ct, float_ct);                      // Move a gate.
+    void_t get_pins_in_region(rectangle_crt, pin_ptr_vrt);              // Get the pins in a region.
+    void_t get_nets_in_region(rectangle_crt, net_ptr_vrt);              // Get the nets in a region.
     void_t repower_gate(string_crt, string_crt);                        // Resize an existing gate.
     void_t remove_net(string_crt);                                      // Remove an existing net.
     void_t remove_net(net_pt);                                          // Remove an existing net.
@@ -102,6 +135,15 @@ class Timer {
     void_t connect_pin(pin_pt, net_pt);                                 // Connect the pin to the net.
     void_t splice_driver(string_crt, string_crt, string_crt);           // Insert an input driver.
     void_t update_timing(bool_t is_incremental = true);                 // Update the timing.
+    void_t update_corners();                                            // Update the corner timing.
+    void_t insert_corner(int, char**);                                  // Create a new corner.
+    void_t write_macro(string_crt);                                     // Write the timing macro.
+    void_t write_partitions(size_t, string_crt);                        // Write the design partitions.
+    void_t begin_eco();                                                 // Begin an eco transaction.
+    void_t commit_eco();                                                // Commit the eco transaction.
+    void_t push_state();                                                // Save the timing state.
+    void_t pop_state();                                                 // Restore the timing state.
+    void_t merge_state();                                               // Keep the changes of a state.
     void_t set_num_threads(int_ct);                                     // Set the number of threads.
     void_t set_rpt_fpath(string_crt);                                   // Set the report file path.
     void_t set_slew(int, char**);                                       // Assert the slew on a pin.
@@ -140,15 +182,21 @@ class Timer {
     float_t wns(int, int);                                              // Report the wns.
     float_t wns();                                                      // Report the wns.
 
+    slack_statistics_crt slack_statistics(size_t, float_ct, float_ct);  // Query the slack statistics.
+
+    timing_view_t timing_view() const;                                  // Query the timing view.
+
     file_pt log_fptr() const;                                           // Query the log file pointer.
 
     inline float_t cutoff_slack(int, int) const;                        // Query the cutoff slack.
+    inline float_t timing_change_epsilon() const;                       // Query the change epsilon.
 
     inline string_crt name() const;                                     // Query the timer name.
     inline celllib_pt celllib_ptr(int) const;                           // Query the celllib pointer.
     inline techlib_pt techlib_ptr() const;                              // Query the techlib pointer.
     inline circuit_pt circuit_ptr() const;                              // Query the circuit pointer.
     inline environment_pt environment_ptr() const;                      // Query the environment pointer.
+    inline wire_estimator_pt wire_estimator_ptr() const;                // Query the wire estimator pointer.
     
     size_t num_pins() const;                                            // Query the pin count.
     size_t num_nets() const;                                            // Query the net count.
@@ -161,6 +209,9 @@ class Timer {
     size_t num_primary_outputs() const;                                 // Query the number of primary outputs.
     size_t num_threads() const;                                         // Query the number of threads.
 
+    inline size_t num_corners() const;                                  // Query the corner count.
+    inline size_t num_models() const;                                   // Query the model count.
+
     inline size_t max_num_threads() const;                              // Query the max number of threads.
 
     inline nodeset_rt nodeset() const;                                  // Query the nodeset reference.
@@ -170,6 +221,9 @@ class Timer {
     inline edgelist_pt edgelist_ptr() const;                            // Query the edgelist pointer.
     inline pipeline_rt pipeline() const;                                // Query the pipeline reference.
     inline pipeline_pt pipeline_ptr() const;                            // Query the pipeline pointer.
+    inline eco_pt eco_ptr() const;                                      // Query the eco pointer.
+    inline journal_pt journal_ptr() const;                              // Query the journal pointer.
+    inline size_t num_states() const;                                   // Query the number of states.
     inline endpoint_minheap_pt endpoint_minheap_ptr() const;            // Query the endpoint min heap.
     inline endpoint_minheap_rt endpoint_minheap() const;                // Query the endpoint min heap.
     
@@ -185,14 +239,26 @@ class Timer {
     float_t _tns[2][2];                                                 // Total negative slack.
     float_t _wns[2][2];                                                 // Worst negative slack.
     float_t _cutoff_slack[2][2];                                        // Cutoff slack.
+    float_t _timing_change_epsilon;                                     // Timing change epsilon.
 
     bool_t _is_tns_updated[2][2];                                       // tns update flag.
     bool_t _is_wns_updated[2][2];                                       // wns update flag.
+    bool_t _is_slack_statistics_updated;                                // Slack statistics update flag.
      
     celllib_upt _celllib_uptr[2];                                       // Early/Late celllib pointer.
     techlib_upt _techlib_uptr;                                          // Technoligy library pointer.
     circuit_upt _circuit_uptr;                                          // Circuit object pointer.
     pipeline_upt _pipeline_uptr;                                        // Pipeline pointer.
+    eco_upt _eco_uptr;                                                  // Eco transaction pointer.
+    journal_upt _journal_uptr;                                          // State journal pointer.
+    slack_statistics_upt _slack_statistics_uptr;                        // Slack statistics pointer.
+    wire_estimator_upt _wire_estimator_uptr;                            // Wire estimator pointer.
+    spatial_grid_upt _spatial_grid_uptr;                                // Spatial grid pointer.
+
+    corner_upt_vt _corner_uptrs;                                        // Corners.
+    bool_t _is_corner_timing_updated;                                   // Corner timing status.
+
+    model_upt_vt _model_uptrs;                                          // Block models.
      
     nodeset_upt _nodeset_uptr;
     jumpset_upt _jumpset_uptr;                                          // Jumpset.
@@ -200,8 +266,21 @@ class Timer {
 
     endpoint_minheap_upt _endpoint_minheap_uptr;                        // Endpoint min heap.
 
+    int_vt _num_pending_fanins;                                         // Dataflow dependency counters.
+    int_vt _is_fanin_changed;                                           // Forward change flags.
+    int_vt _is_fanout_changed;                                          // Backward change flags.
+
+    size_vt _jump_dirty_node_idxs;                                      // Nodes pending jump rebuild.
+    string_vt _rctree_dirty_net_names;                                  // Nets pending rctree estimation.
+
+    timing_snapshot_cspt _timing_snapshot_ptr;                          // Published timing snapshot.
+    bool_vt _is_timing_view_block_dirty;                                // Timing view block flags.
+    bool_t _is_timing_view_topology_dirty;                              // Timing view topology flag.
+
     node_pt _insert_node(pin_pt);                                       // Insert a node.
-    node_pt _clock_tree_root_node_ptr() const;                          // Return the clock tree root node.
+    bool_t _is_clock_tree_root(node_pt) const;                          // Query if a node is a clock root.
+    int_t _encode_cppr_tag(node_pt, node_pt, int) const;                // Encode a cppr tag.
+    bool_t _is_cppr_tag_edge(edge_pt) const;                            // Query the cppr tag edge.
 
     edge_pt _insert_edge(string_crt, string_crt, net_pt);               // Insert an edge (net arc).
     edge_pt _insert_edge(node_pt, node_pt, net_pt);                     // Insert an edge (net arc).
@@ -218,6 +297,7 @@ class Timer {
     
     jump_pt _insert_jump(pin_pt, pin_pt, int_t, float_t [][2]);         // Insert a jump.
     jump_pt _insert_jump(node_pt, node_pt, int_t, float_t [][2]);       // Insert a jump.
+    jump_pt _insert_jump(jump_crt);                                     // Insert a jump.
 
     void_t _parse_verilog(string_crt, verilog_pt);                      // Parse the verilog.
     void_t _parse_spef(string_crt, spef_pt);                            // Parse the spef file.
@@ -229,19 +309,35 @@ class Timer {
     void_t _update_tns(int, int);                                       // Update the tns.
     void_t _update_wns();                                               // Update the wns.
     void_t _update_wns(int, int);                                       // Update the wns.
+    void_t _update_slack_statistics(size_t, float_ct, float_ct);        // Update the slack statistics.
     void_t _update_spef(spef_pt);                                       // Update the spef object.
+    void_t _update_wire_estimator();                                    // Update the wire estimator.
+    void_t _estimate_rctrees(net_ptr_vrt);                              // Estimate the net parasitics.
+    void_t _enable_rctree_estimation_update(net_pt);                    // Enable the rctree estimation.
+    void_t _disable_rctree_estimation_update(net_pt);                   // Disable the rctree estimation.
+    void_t _update_rctree_estimations();                                // Re-estimate the dirty nets.
+    void_t _update_spatial_grid();                                      // Update the spatial grid.
     void_t _update_forward_propagate_pipeline();                        // Update the forward pipeline.
     void_t _update_pipelined_tests();                                   // Update the pipelined tests.
     void_t _update_endpoint_slacks(pin_pt, endpoint_ptr_vrt);           // Update the endpoint slacks.
+    void_t _propagate_cppr_tags(int_ct, node_ptr_mrt, float_vrt,        // Propagate the cppr tags.
+                                endpoint_ptr_vrt);
+    void_t _update_post_cppr_slacks(test_pt, int_ct, cppr_tag_pair_vrt, // Update the test slacks.
+                                    float_vrt, endpoint_ptr_vrt);
     void_t _update_clock_tree();                                        // Update the clock tree.
+    void_t _enable_clock_tree_update(net_pt);                           // Enable the clock tree update.
     void_t _update_node_level(node_pt, int_t) const;                    // Update the node level.
     void_t _update_all_node_levels() const;                             // Update all node levels.
     void_t _get_fanout_test_ptrs(pin_pt, test_ptr_vrt);                 // Update the pin fanout tests.
     void_t _get_endpoint_ptrs(test_ptr_vrt, endpoint_ptr_vrt);          // Update the endpoints.
-    void_t _induce_jump(node_pt, node_pt, int_t, float_t dv[][2]);      // Induce the jump
+    void_t _induce_jump(node_pt, jump_vrt) const;                       // Induce the jumps of a head.
+    void_t _update_jumps();                                             // Rebuild the dirty jumps.
+    void_t _enable_jump_update(node_pt);                                // Enable the jump update.
     void_t _report_worst_paths(file_pt, string_crt, size_t);            // Report the worst paths.
     void_t _report_worst_paths(file_pt, pin_pt, size_t);                // Report the worst paths.
     void_t _report_worst_paths(file_pt, int, char**);                   // Report the worst paths.
+    size_t _cut_path_stream_batch(path_slack_record_vrt, int_vrt,       // Cut a path stream batch.
+                                  size_t, size_t) const;
     void_t _report_tns(file_pt);                                        // Report the TNS.
     void_t _report_wns(file_pt);                                        // Report the WNS.
     void_t _report_at(file_pt, int, char**);                            // Report the AT.
@@ -260,9 +356,18 @@ class Timer {
     void_t _report_max_num_threads(file_pt);                            // Report the thread limit.
     void_t _init_circuit_from_verilog(verilog_pt);                      // Initialize circuit connection.
     void_t _init_io_timing(string_crt);                                 // Initialize the io timing.
+    void_t _init_io_timing(timing_reader_crt);                          // Initialize the io timing.
     void_t _init_full_timing_update();                                  // Initialize the full timing update.
     void_t _clear_edgelist();                                           // Clear the edgelist.
     void_t _remap_cellpin(int, pin_pt, cellpin_pt);                     // Remap the cellpin.
+    void_t _rebind_gate(gate_pt, cell_pt, cell_pt);                     // Rebind the gate cells.
+    void_t _swap_gate_cell(gate_pt, cell_pt, cell_pt);                  // Swap the gate cells.
+    model_pt _insert_model(model_upt);                                  // Insert or swap a model.
+    void_t _insert_gate_arcs(gate_pt);                                  // Insert the gate cell edges.
+    void_t _remove_gate_arcs(gate_pt);                                  // Remove the gate cell edges.
+    void_t _bind_corner_arcs(edge_pt) const;                            // Bind the corner arcs.
+    bool_t _is_corner_bound(corner_pt) const;                           // Query the corner binding.
+    void_t _report_corners(file_pt);                                    // Report the corner slacks.
     void_t _remove_node(node_pt);                                       // Remove the node. 
     void_t _remove_edge(edge_pt);                                       // Remove the edge.
     void_t _remove_jump(node_pt);                                       // Remove the jump.
@@ -271,6 +376,12 @@ class Timer {
     void_t _remove_frontier(node_pt) const;                             // Remove a frontier node.
     void_t _remove_all_frontiers();                                     // Clear the pipeline.
     void_t _enable_lazy_evaluation();                                   // Enable the lazy evaluation.
+    void_t _journal_node(node_pt);                                      // Record the node timing.
+    void_t _restore_state(journal_frame_rt);                            // Restore a journal frame.
+    void_t _restore_jump(journal_frame_rt);                             // Restore the jumps of a frame.
+    void_t _update_endpoint_minheap(test_pt);                           // Update the heap position.
+    void_t _mark_timing_view(node_pt);                                  // Mark a timing view block.
+    void_t _publish_timing_view();                                      // Publish the timing view.
     void_t _forward_propagate_fanout(node_pt);                          // Forward propagate fanout.
     void_t _forward_propagate_fanout(int_t);                            // Forward propagate fanout.
     void_t _forward_propagate_at(node_pt);                              // Forward propagate at.
@@ -279,16 +390,36 @@ class Timer {
     void_t _forward_propagate_slew(int_t);                              // Forward propagate slew.
     void_t _forward_propagate_delay(node_pt);                           // Forward propagate delay.
     void_t _forward_propagate_delay(int_t);                             // Forward propagate delay.
+    void_t _forward_propagate_corner_slew(node_pt);                     // Forward propagate corner slew.
+    void_t _forward_propagate_corner_delay(node_pt);                    // Forward propagate corner delay.
+    void_t _forward_propagate_corner_at(node_pt);                       // Forward propagate corner at.
     void_t _forward_propagate_rc_timing(int_t);                         // Forward propagate the rc delay.
     void_t _forward_propagate_rc_timing(node_pt);                       // Forward propagate the rc delay.
     void_t _forward_propagate_jump(int_t);                              // Forward propagate the jump.
     void_t _forward_propagate_jump(node_pt);                            // Forward propagate the jump.
     void_t _forward_propagate_test(int_t);                              // Forward propagate the test.
     void_t _forward_propagate_test(test_pt);                            // Forward propagate the endpoint.
+    void_t _forward_propagate_dataflow();                               // Forward propagate the pipeline.
+    void_t _forward_propagate_dataflow(node_pt);                        // Forward propagate a node.
+    void_t _forward_propagate_events();                                 // Forward propagate the changes.
+    void_t _forward_propagate_node(node_pt);                            // Forward propagate a node.
+    void_t _update_forward_propagate_levels();                          // Update the pipeline levels.
+    void_t _backward_propagate_change(node_pt);                         // Backward propagate a change.
+    void_t _init_timing_change();                                       // Initialize the timing change.
+    void_t _collect_rc_values(node_pt, rctree_pt, float_vrt) const;     // Collect the net rc timing.
+
+    rctree_pt _rctree_ptr(node_pt) const;                               // Query the rooted rctree.
+
+    float_t _corner_load(pin_pt, corner_pt, int, int) const;            // Query the corner pin load.
+
+    bool_t _forward_propagate_change(node_pt);                          // Forward propagate a change.
+
+    inline bool_t _is_timing_changed(float_ct, float_ct) const;         // Query the timing change.
     void_t _backward_propagate_fanin(node_pt);                          // Backward propagate the level.
     void_t _backward_propagate_fanin(int_t);                            // Backward propagate the level.
     void_t _backward_propagate_rat(node_pt);                            // Backward propagate the rat.
     void_t _backward_propagate_rat(int_t);                              // Backward propagate the rat.
+    void_t _backward_propagate_corner_rat(node_pt);                     // Backward propagate corner rat.
 };
 
 // Function: name
@@ -313,12 +444,30 @@ inline environment_pt Timer::environment_ptr() const {
   return _environment_uptr.get();
 }
 
+// Function: wire_estimator_ptr
+// Return the pointer to the wire estimator.
+inline wire_estimator_pt Timer::wire_estimator_ptr() const {
+  return _wire_estimator_uptr.get();
+}
+
 // Function: celllib_ptr
 // Return the pointer to the celllib.
 inline celllib_pt Timer::celllib_ptr(int el) const {
   return _celllib_uptr[el].get();
 }
 
+// Function: num_corners
+// Return the number of corners inserted in addition to the default libraries.
+inline size_t Timer::num_corners() const {
+  return _corner_uptrs.size();
+}
+
+// Function: num_models
+// Return the number of block models read into the timer.
+inline size_t Timer::num_models() const {
+  return _model_uptrs.size();
+}
+
 // Function: techlib_ptr
 // Return the pointer to the techlib.
 inline techlib_pt Timer::techlib_ptr() const {
@@ -369,6 +518,24 @@ inline pipeline_rt Timer::pipeline() const {
   return *(pipeline_ptr());
 }
 
+// Function: eco_ptr
+// Return the pointer to the eco transaction.
+inline eco_pt Timer::eco_ptr() const {
+  return _eco_uptr.get();
+}
+
+// Function: journal_ptr
+// Return the pointer to the state journal.
+inline journal_pt Timer::journal_ptr() const {
+  return _journal_uptr.get();
+}
+
+// Function: num_states
+// Return the number of states that have been pushed and not yet popped or merged.
+inline size_t Timer::num_states() const {
+  return journal_ptr()->num_frames();
+}
+
 // Function: endpoint_minheap_ptr
 inline endpoint_minheap_pt Timer::endpoint_minheap_ptr() const {
   return _endpoint_minheap_uptr.get();
@@ -385,6 +552,25 @@ inline float_t Timer::cutoff_slack(int el, int rf) const {
   return _cutoff_slack[el][rf];
 }
 
+// Procedure: set_timing_change_epsilon
+// Set the epsilon below which a change of slew, arrival time, delay, or required arrival time
+// is not propagated to the neighboring nodes in the incremental timing update.
+inline void_t Timer::set_timing_change_epsilon(float_ct epsilon) {
+  _timing_change_epsilon = epsilon;
+}
+
+// Function: timing_change_epsilon
+// Return the timing change epsilon.
+inline float_t Timer::timing_change_epsilon() const {
+  return _timing_change_epsilon;
+}
+
+// Function: _is_timing_changed
+// Return true if the two timing values differ by more than the timing change epsilon.
+inline bool_t Timer::_is_timing_changed(float_ct prev, float_ct curr) const {
+  return fabs(curr - prev) > _timing_change_epsilon;
+}
+
 };  // End of OpenTimer namespace. ----------------------------------------------------------------
 
 #endif
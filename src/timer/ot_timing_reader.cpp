@@ -0,0 +1,307 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_timing_reader.h"
+
+namespace __OpenTimer {
+
+// Constructor: TimingReader
+TimingReader::TimingReader() {
+
+}
+
+// Destructor: ~TimingReader
+TimingReader::~TimingReader() {
+
+}
+
+// Procedure: read
+// Read the timing assertions from either the text form or the binary form. The file is memory
+// mapped and the form is detected by the magic at the beginning of the file.
+void_t TimingReader::read(string_crt fpath) {
+
+  LOG(INFO) << "Loading " + Utility::realpath(fpath);
+
+  _assertions.clear();
+
+  int_t fd = open(fpath.c_str(), O_RDONLY);
+
+  LOG_IF(FATAL, fd < 0) << "Failed to open " + Utility::realpath(fpath);
+
+  struct stat st;
+  
+  if(fstat(fd, &st) < 0 || st.st_size == 0) {
+    close(fd);
+    return;
+  }
+
+  size_t size = st.st_size;
+  void_pt addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  LOG_IF(FATAL, addr == MAP_FAILED) << "Failed to map " + Utility::realpath(fpath);
+
+  char_cpt beg = static_cast<char_cpt>(addr);
+  char_cpt end = beg + size;
+
+  if(size >= OT_TIMING_BINARY_MAGIC_SIZE && 
+     memcmp(beg, OT_TIMING_BINARY_MAGIC, OT_TIMING_BINARY_MAGIC_SIZE) == 0) {
+    _read_binary(beg + OT_TIMING_BINARY_MAGIC_SIZE, end);
+  }
+  else {
+    _read_text(beg, end);
+  }
+
+  munmap(addr, size);
+  close(fd);
+}
+
+// Procedure: _read_text
+// Read the text form. The line boundaries are indexed first and then batches of lines are parsed
+// into their own assertion records by tasks, which keeps the records in the order of the file.
+// Tasks rather than a parallel loop let the reader run inside the parallel initialization.
+void_t TimingReader::_read_text(char_cpt beg, char_cpt end) {
+
+  vector < char_cpt > lines;
+
+  for(char_cpt cursor = beg; cursor < end; ) {
+    lines.push_back(cursor);
+    char_cpt eol = static_cast<char_cpt>(memchr(cursor, '\n', end - cursor));
+    cursor = (eol == nullptr) ? end : eol + 1;
+  }
+  lines.push_back(end);
+
+  int_t N = lines.size() - 1;
+
+  _assertions.resize(N);
+
+  for(int_t b=0; b<N; b+=OT_DEFAULT_TIMING_BATCH_SIZE) {
+    #pragma omp task firstprivate(b) shared(lines, N)
+    {
+      for(int_t i=b; i<std::min(N, b + OT_DEFAULT_TIMING_BATCH_SIZE); ++i) {
+        _parse_line(lines[i], lines[i+1], _assertions[i]);
+      }
+    }
+  }
+  #pragma omp taskwait
+}
+
+// Procedure: _parse_line
+// Parse a line of the text form into an assertion. An unknown keyword leaves the type undefined
+// and keeps the keyword in the name such that the caller can report it.
+//
+// clock <pi> <period>
+// at <pi> <early-rise> <early-fall> <late-rise> <late-fall>
+// slew <pi> <early-rise> <early-fall> <late-rise> <late-fall>
+// rat <po> <early-rise> <early-fall> <late-rise> <late-fall>
+// load <po> <cap>
+//
+void_t TimingReader::_parse_line(char_cpt beg, char_cpt end, timing_assertion_t& assertion) const {
+
+  char_cpt tbeg, tend;
+  
+  assertion.type = UNDEFINED_TIMING_ASSERTION;
+
+  if(!_next_token(beg, end, tbeg, tend)) return;
+
+  string_t keyword(tbeg, tend);
+  
+  if(keyword == "clock") assertion.type = CLOCK_TIMING_ASSERTION;
+  else if(keyword == "at") assertion.type = AT_TIMING_ASSERTION;
+  else if(keyword == "slew") assertion.type = SLEW_TIMING_ASSERTION;
+  else if(keyword == "rat") assertion.type = RAT_TIMING_ASSERTION;
+  else if(keyword == "load") assertion.type = LOAD_TIMING_ASSERTION;
+  else {
+    assertion.name = std::move(keyword);
+    return;
+  }
+
+  if(_next_token(beg, end, tbeg, tend)) {
+    assertion.name.assign(tbeg, tend);
+  }
+
+  switch(assertion.type) {
+    case CLOCK_TIMING_ASSERTION:
+    case LOAD_TIMING_ASSERTION: {
+      float_t value = _next_token(beg, end, tbeg, tend) ? _parse_float(tbeg, tend) : OT_FLT_ZERO;
+      EL_RF_ITER(el, rf) {
+        assertion.value[el][rf] = value;
+      }
+    }
+    break;
+
+    default:
+      EL_RF_ITER(el, rf) {
+        assertion.value[el][rf] = _next_token(beg, end, tbeg, tend) ? _parse_float(tbeg, tend) 
+                                                                    : OT_FLT_ZERO;
+      }
+    break;
+  }
+}
+
+// Function: _next_token
+// Find the next whitespace-separated token from the cursor and advance the cursor past it.
+bool_t TimingReader::_next_token(char_cpt& cursor, char_cpt end, char_cpt& tbeg, char_cpt& tend) {
+  while(cursor < end && isspace(*cursor)) ++cursor;
+  if(cursor == end) return false;
+  tbeg = cursor;
+  while(cursor < end && !isspace(*cursor)) ++cursor;
+  tend = cursor;
+  return true;
+}
+
+// Function: _parse_float
+// Parse a decimal number. The mantissa of at most 15 digits and the power of ten of at most 22
+// are both exact in double precision, so their product or quotient is correctly rounded. Other
+// numbers, such as the special values, fall back to the standard library.
+float_t TimingReader::_parse_float(char_cpt beg, char_cpt end) {
+
+  static const double pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11, 
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  char_cpt cursor = beg;
+  bool_t is_negative = false;
+  uint64_t mantissa = 0;
+  int_t num_digits = 0, exponent = 0;
+
+  if(cursor < end && (*cursor == '-' || *cursor == '+')) {
+    is_negative = (*cursor++ == '-');
+  }
+
+  for(; cursor < end && isdigit(*cursor); ++cursor, ++num_digits) {
+    mantissa = mantissa * 10 + (*cursor - '0');
+  }
+
+  if(cursor < end && *cursor == '.') {
+    for(++cursor; cursor < end && isdigit(*cursor); ++cursor, ++num_digits, --exponent) {
+      mantissa = mantissa * 10 + (*cursor - '0');
+    }
+  }
+
+  if(num_digits > 0 && cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+    int_t sign = 1, value = 0;
+    ++cursor;
+    if(cursor < end && (*cursor == '-' || *cursor == '+')) {
+      sign = (*cursor++ == '-') ? -1 : 1;
+    }
+    char_cpt digits = cursor;
+    for(; cursor < end && isdigit(*cursor) && value < 1000; ++cursor) {
+      value = value * 10 + (*cursor - '0');
+    }
+    if(cursor == digits) num_digits = 0;
+    exponent += sign * value;
+  }
+
+  if(cursor != end || num_digits == 0 || num_digits > 15 || exponent < -22 || exponent > 22) {
+    return strtof(string_t(beg, end).c_str(), nullptr);
+  }
+
+  double value = static_cast<double>(mantissa);
+  value = (exponent < 0) ? value / pow10[-exponent] : value * pow10[exponent];
+
+  return static_cast<float_t>(is_negative ? -value : value);
+}
+
+// Procedure: _read_binary
+// Read the records of the binary form following the magic. The record count is checked against
+// the smallest record size before any storage is allocated.
+void_t TimingReader::_read_binary(char_cpt beg, char_cpt end) {
+
+  const size_t record_size = sizeof(uint8_t) + sizeof(uint32_t) + 4 * sizeof(uint32_t);
+
+  LOG_IF(FATAL, beg + sizeof(uint64_t) > end) << "Corrupted binary timing file";
+  uint64_t num_records = _read_le(beg, sizeof(uint64_t));
+
+  LOG_IF(FATAL, num_records > static_cast<uint64_t>(end - beg) / record_size) 
+    << "Corrupted binary timing file";
+
+  _assertions.resize(num_records);
+
+  for(auto& assertion : _assertions) {
+
+    LOG_IF(FATAL, beg + sizeof(uint8_t) + sizeof(uint32_t) > end) << "Corrupted binary timing file";
+    uint8_t type = _read_le(beg, sizeof(uint8_t));
+    uint32_t length = _read_le(beg, sizeof(uint32_t));
+
+    LOG_IF(FATAL, length + 4 * sizeof(uint32_t) > static_cast<size_t>(end - beg)) 
+      << "Corrupted binary timing file";
+    assertion.name.assign(beg, length);
+    beg += length;
+
+    assertion.type = (type < UNDEFINED_TIMING_ASSERTION) ? static_cast<timing_assertion_type_e>(type)
+                                                          : UNDEFINED_TIMING_ASSERTION;
+    EL_RF_ITER(el, rf) {
+      uint32_t bits = _read_le(beg, sizeof(uint32_t));
+      static_assert(sizeof(bits) == sizeof(assertion.value[el][rf]), "Value is not a 32-bit float");
+      memcpy(&assertion.value[el][rf], &bits, sizeof(bits));
+    }
+  }
+}
+
+// Procedure: write_binary
+// Write the assertions in the binary form. Records of unknown keywords are dropped.
+void_t TimingReader::write_binary(string_crt fpath) const {
+
+  ofstream_t ofs(fpath, std::ios::binary);
+
+  LOG_IF(FATAL, !ofs.good()) << "Failed to open " + fpath;
+
+  uint64_t num_records = 0;
+  for(const auto& assertion : _assertions) {
+    if(assertion.type != UNDEFINED_TIMING_ASSERTION) ++num_records;
+  }
+
+  ofs.write(OT_TIMING_BINARY_MAGIC, OT_TIMING_BINARY_MAGIC_SIZE);
+  _write_le(ofs, num_records, sizeof(uint64_t));
+
+  for(const auto& assertion : _assertions) {
+    
+    if(assertion.type == UNDEFINED_TIMING_ASSERTION) continue;
+
+    _write_le(ofs, assertion.type, sizeof(uint8_t));
+    _write_le(ofs, assertion.name.size(), sizeof(uint32_t));
+    ofs.write(assertion.name.data(), assertion.name.size());
+
+    EL_RF_ITER(el, rf) {
+      uint32_t bits;
+      memcpy(&bits, &assertion.value[el][rf], sizeof(bits));
+      _write_le(ofs, bits, sizeof(uint32_t));
+    }
+  }
+}
+
+// Function: _read_le
+// Read a number of the given number of bytes in the little-endian byte order and advance the 
+// cursor. The caller guarantees the bytes are in range.
+uint64_t TimingReader::_read_le(char_cpt& cursor, size_t num_bytes) {
+  uint64_t value = 0;
+  for(size_t i=0; i<num_bytes; ++i) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(*cursor++)) << (i << 3);
+  }
+  return value;
+}
+
+// Procedure: _write_le
+// Write the lowest given number of bytes of a number in the little-endian byte order.
+void_t TimingReader::_write_le(ofstream_t& ofs, uint64_t value, size_t num_bytes) {
+  char bytes[8];
+  for(size_t i=0; i<num_bytes; ++i) {
+    bytes[i] = static_cast<char>(value >> (i << 3));
+  }
+  ofs.write(bytes, num_bytes);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
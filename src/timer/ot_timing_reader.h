@@ -0,0 +1,83 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_TIMING_READER_H_
+#define OT_TIMING_READER_H_
+
+#include "ot_macrodef.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+#include "ot_utility.h"
+
+namespace __OpenTimer {
+
+// Struct: TimingAssertion
+// An assertion record of the .timing file. A clock assertion stores its period and a load 
+// assertion stores its capacitance in every split and transition of the value.
+struct TimingAssertion {
+  timing_assertion_type_e type;                                           // Assertion type.
+  string_t name;                                                          // Port name.
+  float_t value[2][2];                                                    // Value.
+};
+
+// Class: TimingReader
+// The reader ingests the timing assertions of the primary inputs and primary outputs. The text
+// form is memory mapped and its lines are parsed in parallel with a hand-rolled number parser. 
+// The binary form starts with the magic OT_TIMING_BINARY_MAGIC and the number of records in 
+// uint64, followed by the records of uint8 type, uint32 name length, name, and four float32 
+// values in the order of early-rise, early-fall, late-rise, and late-fall. Numbers are in the 
+// little-endian byte order regardless of the host.
+class TimingReader {
+
+  public:
+
+    TimingReader();                                                       // Constructor.
+    ~TimingReader();                                                      // Destructor.
+
+    void_t read(string_crt);                                              // Read a timing file.
+    void_t write_binary(string_crt) const;                                // Write the binary form.
+
+    inline size_t num_assertions() const;                                 // Query the assertion count.
+
+    inline timing_assertion_cvrt assertions() const;                      // Query the assertions.
+
+  private:
+
+    timing_assertion_vt _assertions;                                      // Assertions.
+
+    void_t _read_text(char_cpt, char_cpt);                                // Read the text form.
+    void_t _read_binary(char_cpt, char_cpt);                              // Read the binary form.
+    void_t _parse_line(char_cpt, char_cpt, timing_assertion_t&) const;    // Parse a text line.
+
+    static bool_t _next_token(char_cpt&, char_cpt, char_cpt&, char_cpt&); // Query the next token.
+    static float_t _parse_float(char_cpt, char_cpt);                      // Parse a number.
+    static uint64_t _read_le(char_cpt&, size_t);                          // Read a little-endian number.
+    static void_t _write_le(ofstream_t&, uint64_t, size_t);               // Write a little-endian number.
+};
+
+// Function: num_assertions
+// Return the number of assertions.
+inline size_t TimingReader::num_assertions() const {
+  return _assertions.size();
+}
+
+// Function: assertions
+// Return the assertions in the order of the file.
+inline timing_assertion_cvrt TimingReader::assertions() const {
+  return _assertions;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
@@ -0,0 +1,153 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include "ot_timing_view.h"
+#include "ot_node.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+TimingViewBlock::TimingViewBlock() {
+  for(size_t i=0; i<OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE; ++i) {
+    EL_RF_ITER(el, rf) {
+      _slew[i][el][rf] = Utility::undefined_slew(el);
+      _at[i][el][rf] = Utility::undefined_at(el);
+      _rat[i][el][rf] = Utility::undefined_rat(el);
+    }
+  }
+}
+
+// Destructor.
+TimingViewBlock::~TimingViewBlock() {
+
+}
+
+// Procedure: set_node
+// Copy the timing of a given node to the i-th entry of the block. A nullptr node, i.e., a
+// removed node index, leaves the entry undefined.
+void_t TimingViewBlock::set_node(size_t i, node_pt node_ptr) {
+  EL_RF_ITER(el, rf) {
+    _slew[i][el][rf] = node_ptr ? node_ptr->slew(el, rf) : Utility::undefined_slew(el);
+    _at[i][el][rf] = node_ptr ? node_ptr->at(el, rf) : Utility::undefined_at(el);
+    _rat[i][el][rf] = node_ptr ? node_ptr->rat(el, rf) : Utility::undefined_rat(el);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+TimingSnapshot::TimingSnapshot(size_t epoch, size_t num_indices):
+  _epoch(epoch),
+  _num_indices(num_indices),
+  _blocks((num_indices + OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE - 1) / OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE)
+{
+}
+
+// Destructor.
+TimingSnapshot::~TimingSnapshot() {
+
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Constructor.
+TimingView::TimingView() {
+
+}
+
+// Constructor.
+TimingView::TimingView(timing_snapshot_cspt snapshot_ptr):
+  _snapshot_ptr(snapshot_ptr)
+{
+}
+
+// Destructor.
+TimingView::~TimingView() {
+
+}
+
+// Function: _idx
+// Return the node index of a given pin name, or OT_SIZE_MAX if the pin is not found.
+size_t TimingView::_idx(string_crt pin_name) const {
+  
+  if(!is_valid() || _snapshot_ptr->pin_index_ptr() == nullptr) return OT_SIZE_MAX;
+
+  auto itr = _snapshot_ptr->pin_index_ptr()->find(pin_name);
+
+  return itr == _snapshot_ptr->pin_index_ptr()->end() ? OT_SIZE_MAX : itr->second;
+}
+
+// Function: _block_ptr
+// Return the block of a given node index, or nullptr if the index is out of the snapshot.
+const timing_view_block_t* TimingView::_block_ptr(size_t idx) const {
+  if(!is_valid() || idx >= _snapshot_ptr->num_indices()) return nullptr;
+  return _snapshot_ptr->block_ptr(idx / OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE).get();
+}
+
+// Function: slew
+float_t TimingView::slew(string_crt pin_name, int el, int rf) const {
+  return slew(_idx(pin_name), el, rf);
+}
+
+// Function: at
+float_t TimingView::at(string_crt pin_name, int el, int rf) const {
+  return at(_idx(pin_name), el, rf);
+}
+
+// Function: rat
+float_t TimingView::rat(string_crt pin_name, int el, int rf) const {
+  return rat(_idx(pin_name), el, rf);
+}
+
+// Function: slack
+float_t TimingView::slack(string_crt pin_name, int el, int rf) const {
+  return slack(_idx(pin_name), el, rf);
+}
+
+// Function: slew
+// Return the slew of a given node index in the epoch of the view.
+float_t TimingView::slew(size_t idx, int el, int rf) const {
+  auto block_ptr = _block_ptr(idx);
+  if(block_ptr == nullptr) return Utility::undefined_slew(el);
+  return block_ptr->slew(idx % OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE, el, rf);
+}
+
+// Function: at
+// Return the arrival time of a given node index in the epoch of the view.
+float_t TimingView::at(size_t idx, int el, int rf) const {
+  auto block_ptr = _block_ptr(idx);
+  if(block_ptr == nullptr) return Utility::undefined_at(el);
+  return block_ptr->at(idx % OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE, el, rf);
+}
+
+// Function: rat
+// Return the required arrival time of a given node index in the epoch of the view.
+float_t TimingView::rat(size_t idx, int el, int rf) const {
+  auto block_ptr = _block_ptr(idx);
+  if(block_ptr == nullptr) return Utility::undefined_rat(el);
+  return block_ptr->rat(idx % OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE, el, rf);
+}
+
+// Function: slack
+// Return the slack of a given node index in the epoch of the view.
+float_t TimingView::slack(size_t idx, int el, int rf) const {
+  auto block_ptr = _block_ptr(idx);
+  if(block_ptr == nullptr) return Utility::undefined_slack(el);
+  auto i = idx % OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE;
+  return (el == EARLY) ? block_ptr->at(i, el, rf) - block_ptr->rat(i, el, rf) : 
+                         block_ptr->rat(i, el, rf) - block_ptr->at(i, el, rf);
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
@@ -0,0 +1,183 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#ifndef OT_TIMING_VIEW_H_
+#define OT_TIMING_VIEW_H_
+
+#include "ot_utility.h"
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+
+namespace __OpenTimer {
+
+// Class: TimingViewBlock
+// A block stores the slew, arrival time, and required arrival time of a fixed range of node
+// indices. A block is never modified after it is published. A new epoch shares the blocks
+// whose nodes are untouched and clones only the blocks whose nodes have been updated.
+class TimingViewBlock {
+
+  public:
+
+    TimingViewBlock();                                                    // Constructor.
+    ~TimingViewBlock();                                                   // Destructor.
+
+    inline float_t slew(size_t, int, int) const;                          // Query the slew.
+    inline float_t at(size_t, int, int) const;                            // Query the arrival time.
+    inline float_t rat(size_t, int, int) const;                           // Query the rat.
+
+    void_t set_node(size_t, node_pt);                                     // Copy the node timing.
+
+  private:
+
+    float_t _slew[OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE][2][2];               // Slew.
+    float_t _at[OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE][2][2];                 // Arrival time.
+    float_t _rat[OT_DEFAULT_TIMING_VIEW_BLOCK_SIZE][2][2];                // Required arrival time.
+};
+
+// Function: slew
+inline float_t TimingViewBlock::slew(size_t i, int el, int rf) const {
+  return _slew[i][el][rf];
+}
+
+// Function: at
+inline float_t TimingViewBlock::at(size_t i, int el, int rf) const {
+  return _at[i][el][rf];
+}
+
+// Function: rat
+inline float_t TimingViewBlock::rat(size_t i, int el, int rf) const {
+  return _rat[i][el][rf];
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: TimingSnapshot
+// A snapshot is the node timing of one epoch. The timer builds a snapshot at the end of each
+// timing update and publishes it atomically. A published snapshot is immutable.
+class TimingSnapshot {
+
+  public:
+
+    TimingSnapshot(size_t, size_t);                                       // Constructor.
+    ~TimingSnapshot();                                                    // Destructor.
+
+    inline size_t epoch() const;                                          // Query the epoch.
+    inline size_t num_indices() const;                                    // Query the index size.
+    inline size_t num_blocks() const;                                     // Query the block size.
+
+    inline timing_view_block_cspt block_ptr(size_t) const;                // Query a block.
+    inline string_to_idx_umap_cspt pin_index_ptr() const;                 // Query the pin index.
+
+    inline void_t set_block_ptr(size_t, timing_view_block_cspt);          // Set a block.
+    inline void_t set_pin_index_ptr(string_to_idx_umap_cspt);             // Set the pin index.
+
+  private:
+
+    size_t _epoch;                                                        // Epoch.
+    size_t _num_indices;                                                  // Node index size.
+
+    timing_view_block_cspt_vt _blocks;                                    // Node timing blocks.
+    string_to_idx_umap_cspt _pin_index_ptr;                               // Pin name to node index.
+};
+
+// Function: epoch
+inline size_t TimingSnapshot::epoch() const {
+  return _epoch;
+}
+
+// Function: num_indices
+inline size_t TimingSnapshot::num_indices() const {
+  return _num_indices;
+}
+
+// Function: num_blocks
+inline size_t TimingSnapshot::num_blocks() const {
+  return _blocks.size();
+}
+
+// Function: block_ptr
+inline timing_view_block_cspt TimingSnapshot::block_ptr(size_t b) const {
+  return _blocks[b];
+}
+
+// Function: pin_index_ptr
+inline string_to_idx_umap_cspt TimingSnapshot::pin_index_ptr() const {
+  return _pin_index_ptr;
+}
+
+// Procedure: set_block_ptr
+inline void_t TimingSnapshot::set_block_ptr(size_t b, timing_view_block_cspt ptr) {
+  _blocks[b] = ptr;
+}
+
+// Procedure: set_pin_index_ptr
+inline void_t TimingSnapshot::set_pin_index_ptr(string_to_idx_umap_cspt ptr) {
+  _pin_index_ptr = ptr;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+// Class: TimingView
+// A timing view is a read-only handle to the snapshot of one epoch. Queries on a view never
+// block the timer and always see the values of the same epoch, while the timer keeps updating
+// the design and publishing newer epochs. The view keeps its snapshot alive until it is
+// destroyed or refreshed.
+class TimingView {
+
+  public:
+
+    TimingView();                                                         // Constructor.
+    TimingView(timing_snapshot_cspt);                                     // Constructor.
+    ~TimingView();                                                        // Destructor.
+
+    inline bool_t is_valid() const;                                       // Query the view status.
+
+    inline size_t epoch() const;                                          // Query the epoch.
+
+    float_t slew(string_crt, int, int) const;                             // Query the slew.
+    float_t at(string_crt, int, int) const;                               // Query the arrival time.
+    float_t rat(string_crt, int, int) const;                              // Query the rat.
+    float_t slack(string_crt, int, int) const;                            // Query the slack.
+
+    float_t slew(size_t, int, int) const;                                 // Query the slew.
+    float_t at(size_t, int, int) const;                                   // Query the arrival time.
+    float_t rat(size_t, int, int) const;                                  // Query the rat.
+    float_t slack(size_t, int, int) const;                                // Query the slack.
+
+  private:
+
+    timing_snapshot_cspt _snapshot_ptr;                                   // Snapshot pointer.
+
+    size_t _idx(string_crt) const;                                        // Query the node index.
+
+    const timing_view_block_t* _block_ptr(size_t) const;                  // Query the node block.
+};
+
+// Function: is_valid
+// Return true if the view is attached to a snapshot.
+inline bool_t TimingView::is_valid() const {
+  return _snapshot_ptr != nullptr;
+}
+
+// Function: epoch
+// Return the epoch of the view. The epoch increases by one every time the timer publishes a
+// new snapshot. An invalid view has epoch zero.
+inline size_t TimingView::epoch() const {
+  return _snapshot_ptr ? _snapshot_ptr->epoch() : 0;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+
@@ -0,0 +1,181 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#include "ot_wire_estimator.h"
+
+namespace __OpenTimer {
+
+// Constructor.
+WireEstimator::WireEstimator():
+  _wire_model(OT_DEFAULT_WIRE_MODEL),
+  _layer_ptr(nullptr),
+  _res_per_unit(OT_DEFAULT_WIRE_RES_PER_MICRON),
+  _cap_per_unit(OT_DEFAULT_WIRE_CAP_PER_MICRON)
+{
+}
+
+// Destructor.
+WireEstimator::~WireEstimator() {
+}
+
+// Function: estimate_rctree
+// Build a new rctree for the given net from the placement of its pins. The driver pin becomes
+// the root and every other pin becomes a tap that carries its pin capacitance. The function
+// returns false and leaves the net untouched if the net has no driver or some pin is unplaced.
+bool_t WireEstimator::estimate_rctree(net_pt net_ptr) const {
+
+  if(net_ptr == nullptr || net_ptr->root_pin_ptr() == nullptr) return false;
+
+  // Collect the pins with the root pin in the front.
+  pin_ptr_vt pin_ptrs(1, net_ptr->root_pin_ptr());
+  point_vt points;
+
+  for(const auto& pin_ptr : net_ptr->pinlist()) {
+    if(pin_ptr != net_ptr->root_pin_ptr()) pin_ptrs.push_back(pin_ptr);
+  }
+
+  for(const auto& pin_ptr : pin_ptrs) {
+    if(!pin_ptr->is_placed()) return false;
+    points.push_back(pin_ptr->placement());
+  }
+
+  // Create the rctree and attach each pin to its own rctree node.
+  net_ptr->create_new_rctree();
+
+  rctree_pt rctree_ptr = net_ptr->rctree_ptr();
+
+  for(unsigned_t i=0; i<pin_ptrs.size(); ++i) {
+    rctree_node_pt rctree_node_ptr = rctree_ptr->insert_rctree_node(pin_ptrs[i]->name(), OT_FLT_ZERO);
+    rctree_node_ptr->set_pin_ptr(pin_ptrs[i]);
+    pin_ptrs[i]->set_rctree_node_ptr(rctree_node_ptr);
+    if(i == 0) rctree_ptr->set_root_ptr(rctree_node_ptr);
+    else {
+      EL_RF_ITER(el, rf) {
+        rctree_node_ptr->add_cap(el, rf, pin_ptrs[i]->cap(el, rf));
+      }
+    }
+  }
+
+  switch(wire_model()) {
+    case HPWL_WIRE_MODEL:
+      _build_star(net_ptr, pin_ptrs, points);
+    break;
+
+    default:
+      _build_trunk(net_ptr, pin_ptrs, points);
+    break;
+  }
+
+  rctree_ptr->update_rc_timing();
+  net_ptr->set_is_rctree_estimated(true);
+
+  return true;
+}
+
+// Procedure: _insert_wire
+// Insert a wire of the given length between two rctree nodes as a pi-section, where half of the
+// wire capacitance is lumped at each end.
+void_t WireEstimator::_insert_wire(rctree_pt rctree_ptr, string_crt u, string_crt v, float_ct len) const {
+  
+  rctree_ptr->insert_rctree_segment(u, v, res_per_unit() * len);
+  
+  EL_RF_ITER(el, rf) {
+    rctree_ptr->rctree_node_ptr(u)->add_cap(el, rf, cap_per_unit() * len / OT_FLT_TWO);
+    rctree_ptr->rctree_node_ptr(v)->add_cap(el, rf, cap_per_unit() * len / OT_FLT_TWO);
+  }
+}
+
+// Procedure: _build_star
+// Connect the root to each tap by a direct wire whose resistance follows the Manhattan distance
+// from the root. The wire capacitance of the whole net is the HPWL times the unit capacitance
+// and is shared by the wires in proportion to their lengths.
+void_t WireEstimator::_build_star(net_pt net_ptr, pin_ptr_vrt pin_ptrs, point_vrt points) const {
+  
+  rctree_pt rctree_ptr = net_ptr->rctree_ptr();
+  
+  float_vt dists(pin_ptrs.size(), OT_FLT_ZERO);
+  float_t sum(OT_FLT_ZERO);
+
+  for(unsigned_t i=1; i<pin_ptrs.size(); ++i) {
+    dists[i] = fabs(points[i].x() - points[0].x()) + fabs(points[i].y() - points[0].y());
+    sum += dists[i];
+  }
+
+  float_t scale = (sum > OT_FLT_ZERO) ? net_ptr->HPWL() / sum : OT_FLT_ZERO;
+
+  for(unsigned_t i=1; i<pin_ptrs.size(); ++i) {
+    rctree_ptr->insert_rctree_segment(pin_ptrs[0]->name(), pin_ptrs[i]->name(), res_per_unit() * dists[i]);
+    EL_RF_ITER(el, rf) {
+      rctree_ptr->root_ptr()->add_cap(el, rf, cap_per_unit() * dists[i] * scale / OT_FLT_TWO);
+      pin_ptrs[i]->rctree_node_ptr()->add_cap(el, rf, cap_per_unit() * dists[i] * scale / OT_FLT_TWO);
+    }
+  }
+}
+
+// Procedure: _build_trunk
+// Build the single-trunk Steiner tree over the pins. The trunk runs through the median of the 
+// pins along the shorter orientation and has a Steiner node at each distinct pin coordinate along
+// the trunk. Each pin is then connected to the Steiner node of its coordinate by a branch.
+void_t WireEstimator::_build_trunk(net_pt net_ptr, pin_ptr_vrt pin_ptrs, point_vrt points) const {
+
+  if(pin_ptrs.size() < 2) return;
+
+  rctree_pt rctree_ptr = net_ptr->rctree_ptr();
+
+  float_vt xs, ys;
+
+  for(const auto& p : points) {
+    xs.push_back(p.x());
+    ys.push_back(p.y());
+  }
+
+  // Find the median and the wirelength of a trunk along the given coordinates.
+  auto trunk = [] (float_vt along, float_vt across, float_rt median) {
+    auto m = across.begin() + across.size() / 2;
+    nth_element(across.begin(), m, across.end());
+    median = *m;
+    float_t wl = *max_element(along.begin(), along.end()) - *min_element(along.begin(), along.end());
+    for(const auto& v : across) wl += fabs(v - median);
+    return wl;
+  };
+
+  float_t xmedian, ymedian;
+  
+  bool_t is_horizontal = trunk(xs, ys, ymedian) <= trunk(ys, xs, xmedian);
+
+  float_vrt along  = is_horizontal ? xs : ys;
+  float_vrt across = is_horizontal ? ys : xs;
+  float_t median   = is_horizontal ? ymedian : xmedian;
+
+  // Create the Steiner nodes along the trunk.
+  float_vt stops(along);
+  sort(stops.begin(), stops.end());
+  stops.erase(unique(stops.begin(), stops.end()), stops.end());
+
+  string_vt names(stops.size());
+
+  for(unsigned_t k=0; k<stops.size(); ++k) {
+    names[k] = net_ptr->name() + ":s" + to_string(k);
+    rctree_ptr->insert_rctree_node(names[k], OT_FLT_ZERO);
+    if(k) _insert_wire(rctree_ptr, names[k-1], names[k], stops[k] - stops[k-1]);
+  }
+  
+  // Connect each pin to the trunk.
+  for(unsigned_t i=0; i<pin_ptrs.size(); ++i) {
+    auto k = lower_bound(stops.begin(), stops.end(), along[i]) - stops.begin();
+    _insert_wire(rctree_ptr, names[k], pin_ptrs[i]->name(), fabs(across[i] - median));
+  }
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *                                                                            *
+ * Copyright (c) 2015, Tsung-Wei Huang and Martin D. F. Wong,                 *
+ * University of Illinois at Urbana-Champaign (UIUC), IL, USA.                *
+ *                                                                            *
+ * All Rights Reserved.                                                       *
+ *                                                                            *
+ * This program is free software. You can redistribute and/or modify          *
+ * it in accordance with the terms of the accompanying license agreement.     *
+ * See LICENSE in the top-level directory for details.                        *
+ *                                                                            *
+ ******************************************************************************/
+
+#ifndef OT_WIRE_ESTIMATOR_H_
+#define OT_WIRE_ESTIMATOR_H_
+
+#include "ot_typedef.h"
+#include "ot_classdef.h"
+#include "ot_net.h"
+
+namespace __OpenTimer {
+
+// Class: WireEstimator
+// The class estimates the parasitics of a net from the placement of its pins when the net has no
+// extracted parasitics. The RC tree is rooted at the driver pin and follows either a star of
+// driver-to-sink wires whose total capacitance is bounded by the HPWL, or a single-trunk Steiner
+// tree. Each wire segment is a pi-section of the unit resistance and capacitance per database
+// unit of length, where the pin capacitance is added at each tap as in the spef flow.
+class WireEstimator {
+
+  public:
+
+    WireEstimator();                                                      // Constructor.
+    ~WireEstimator();                                                     // Destructor.
+
+    inline wire_model_e wire_model() const;                               // Query the wire model.
+    inline layer_pt layer_ptr() const;                                    // Query the wire layer.
+
+    inline float_t res_per_unit() const;                                  // Query the unit resistance.
+    inline float_t cap_per_unit() const;                                  // Query the unit capacitance.
+
+    inline void_t set_wire_model(wire_model_ce);                          // Set the wire model.
+    inline void_t set_layer_ptr(layer_pt);                                // Set the wire layer.
+    inline void_t set_res_per_unit(float_ct);                             // Set the unit resistance.
+    inline void_t set_cap_per_unit(float_ct);                             // Set the unit capacitance.
+
+    bool_t estimate_rctree(net_pt) const;                                 // Estimate the rctree of a net.
+
+  private:
+
+    wire_model_e _wire_model;                                             // Wire model.
+    layer_pt _layer_ptr;                                                  // Wire layer.
+
+    float_t _res_per_unit;                                                // Resistance per unit length.
+    float_t _cap_per_unit;                                                // Capacitance per unit length.
+
+    void_t _insert_wire(rctree_pt, string_crt, string_crt, float_ct) const;         // Insert a wire.
+    void_t _build_star(net_pt, pin_ptr_vrt, point_vrt) const;                       // Build a star.
+    void_t _build_trunk(net_pt, pin_ptr_vrt, point_vrt) const;                      // Build a trunk.
+};
+
+// Function: wire_model
+inline wire_model_e WireEstimator::wire_model() const {
+  return _wire_model;
+}
+
+// Function: layer_ptr
+// Query the lef layer whose unit resistance and capacitance are used for the wires.
+inline layer_pt WireEstimator::layer_ptr() const {
+  return _layer_ptr;
+}
+
+// Function: res_per_unit
+inline float_t WireEstimator::res_per_unit() const {
+  return _res_per_unit;
+}
+
+// Function: cap_per_unit
+inline float_t WireEstimator::cap_per_unit() const {
+  return _cap_per_unit;
+}
+
+// Procedure: set_wire_model
+inline void_t WireEstimator::set_wire_model(wire_model_ce wire_model) {
+  _wire_model = wire_model;
+}
+
+// Procedure: set_layer_ptr
+inline void_t WireEstimator::set_layer_ptr(layer_pt layer_ptr) {
+  _layer_ptr = layer_ptr;
+}
+
+// Procedure: set_res_per_unit
+inline void_t WireEstimator::set_res_per_unit(float_ct res) {
+  _res_per_unit = res;
+}
+
+// Procedure: set_cap_per_unit
+inline void_t WireEstimator::set_cap_per_unit(float_ct cap) {
+  _cap_per_unit = cap;
+}
+
+};  // End of OpenTimer namespace. ----------------------------------------------------------------
+
+#endif
+